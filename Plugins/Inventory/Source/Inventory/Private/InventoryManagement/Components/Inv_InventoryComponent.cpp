@@ -22,7 +22,10 @@
 #include "Widgets/Inventory/InventoryBase/Inv_InventoryBase.h"
 #include "Widgets/Inventory/Spatial/Inv_SpatialInventory.h"
 #include "Widgets/Inventory/Spatial/Inv_InventoryGrid.h"
+#include "InventoryManagement/GridModel/Inv_GridModel.h"
 #include "Net/UnrealNetwork.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
 #include "Items/Inv_InventoryItem.h"
 #include "Items/Fragments/Inv_ItemFragment.h"
 #include "Building/Components/Inv_BuildingComponent.h"
@@ -999,8 +1002,8 @@ bool UInv_InventoryComponent::HasRequiredMaterialsOnServer(const FGameplayTag& M
 		return true;
 	}
 
-	// GetTotalMaterialCount는 이미 서버의 InventoryList를 사용하므로 안전합니다.
-	const int32 CurrentAmount = GetTotalMaterialCount(MaterialTag);
+	// [MaterialCountCacheV1] UI용 캐시가 아닌 InventoryList 순회 결과로 판정 (캐시 어긋남이 치트 판정에 번지지 않도록)
+	const int32 CurrentAmount = GetAuthoritativeMaterialCount(MaterialTag);
 	
 	if (CurrentAmount < RequiredAmount)
 	{
@@ -1547,40 +1550,79 @@ void UInv_InventoryComponent::Server_ConsumeMaterials_Implementation(const FGame
 }
 
 // 같은 타입의 모든 스택 개수 합산 (Building UI용)
+// [MaterialCountCacheV1] Entry 순회 대신 FastArray 타입 인덱스의 스택 합계 사용 (Split된 여러 Entry 포함)
 int32 UInv_InventoryComponent::GetTotalMaterialCount(const FGameplayTag& MaterialTag) const
 {
 	if (!MaterialTag.IsValid()) return 0;
 
-	// ⭐ InventoryList에서 읽기 (Split 대응: 같은 ItemType의 모든 Entry 합산!)
-	int32 TotalCount = 0;
+	const int32 TotalCount = InventoryList.GetTotalStackCountByType(MaterialTag);
 
 #if INV_DEBUG_INVENTORY
-	UE_LOG(LogTemp, Verbose, TEXT("🔍 GetTotalMaterialCount(%s) 시작:"), *MaterialTag.ToString());
+	UE_LOG(LogTemp, Verbose, TEXT("✅ GetTotalMaterialCount(%s) = %d (타입 인덱스 합계)"),
+		*MaterialTag.ToString(), TotalCount);
 #endif
+	return TotalCount;
+}
+
+// ⭐ [SERVER-ONLY] InventoryList에서 읽기 (Split 대응: 같은 ItemType의 모든 Entry 합산!)
+int32 UInv_InventoryComponent::GetAuthoritativeMaterialCount(const FGameplayTag& MaterialTag) const
+{
+	if (!MaterialTag.IsValid()) return 0;
 
+	int32 TotalCount = 0;
 	for (const auto& Entry : InventoryList.Entries)
 	{
-		if (!IsValid(Entry.Item)) continue;
+		if (!IsValid(Entry.Item) || Entry.bIsAttachedToWeapon) continue; // 타입 인덱스와 동일하게 부착물 제외
 
 		if (Entry.Item->GetItemManifest().GetItemType().MatchesTagExact(MaterialTag))
 		{
-			int32 EntryCount = Entry.Item->GetTotalStackCount();
-			TotalCount += EntryCount;
-
-#if INV_DEBUG_INVENTORY
-			UE_LOG(LogTemp, Verbose, TEXT("  Entry 발견: Item포인터=%p, TotalStackCount=%d, 누적합=%d"),
-				Entry.Item.Get(), EntryCount, TotalCount);
-#endif
+			TotalCount += Entry.Item->GetTotalStackCount();
 		}
 	}
 
 #if INV_DEBUG_INVENTORY
-	UE_LOG(LogTemp, Log, TEXT("✅ GetTotalMaterialCount(%s) = %d (InventoryList 전체 합산)"),
-		*MaterialTag.ToString(), TotalCount);
+	// 캐시 합계가 어긋나면 로그로 드러냄 (MarkItemDirty/SetTotalStackCount 경로 누락 탐지용)
+	const int32 CachedCount = InventoryList.GetTotalStackCountByType(MaterialTag);
+	if (CachedCount != TotalCount)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("⚠️ GetAuthoritativeMaterialCount(%s) = %d, 타입 인덱스 합계 = %d (불일치)"),
+			*MaterialTag.ToString(), TotalCount, CachedCount);
+	}
 #endif
 	return TotalCount;
 }
 
+// [MaterialCountCacheV1] 합계 변경 태그 기록 + 다음 틱 발송 예약 (같은 프레임 변경은 1회로 합침)
+void UInv_InventoryComponent::MarkMaterialCountDirty(const FGameplayTag& ItemType)
+{
+	if (!ItemType.IsValid()) return;
+
+	PendingMaterialCountTags.Add(ItemType);
+	if (bMaterialCountFlushScheduled) return;
+
+	UWorld* World = GetWorld();
+	if (!IsValid(World))
+	{
+		FlushMaterialCountChanges();
+		return;
+	}
+
+	bMaterialCountFlushScheduled = true;
+	World->GetTimerManager().SetTimerForNextTick(this, &ThisClass::FlushMaterialCountChanges);
+}
+
+void UInv_InventoryComponent::FlushMaterialCountChanges()
+{
+	bMaterialCountFlushScheduled = false;
+	if (PendingMaterialCountTags.Num() == 0) return;
+
+	// 발송 중 구독자가 다시 Mark해도 안전하도록 로컬로 옮긴 뒤 발송
+	const TSet<FGameplayTag> ChangedTags = MoveTemp(PendingMaterialCountTags);
+	PendingMaterialCountTags.Reset();
+
+	OnMaterialCountsChanged.Broadcast(ChangedTags);
+}
+
 bool UInv_InventoryComponent::Server_ConsumeMaterialsMultiStack_Validate(const FGameplayTag& MaterialTag, int32 Amount)
 {
 	return MaterialTag.IsValid() && Amount > 0;
@@ -2912,324 +2954,98 @@ void UInv_InventoryComponent::Server_UpdateItemGridPositionsBatch_Implementation
 #endif
 }
 
-bool UInv_InventoryComponent::HasRoomInInventoryList(const FInv_ItemManifest& Manifest) const
+// ⭐ [Phase C] 서버 InventoryList → 카테고리별 점유 비트셋 (UI 없음)
+// 실제 Grid 위치(Entry.GridIndex → Item GridPosition 순)를 우선 사용하고, 위치가 없거나 겹치면 first-fit
+void UInv_InventoryComponent::BuildGridModelFromInventoryList(FInv_GridModel& OutModel) const
 {
-	EInv_ItemCategory Category = Manifest.GetItemCategory();
-	FGameplayTag ItemType = Manifest.GetItemType();
-
-	// GridFragment에서 아이템 크기 가져오기
-	const FInv_GridFragment* GridFragment = Manifest.GetFragmentOfType<FInv_GridFragment>();
-	FIntPoint ItemSize = GridFragment ? GridFragment->GetGridSize() : FIntPoint(1, 1);
-
-#if INV_DEBUG_INVENTORY
-	UE_LOG(LogTemp, Warning, TEXT("========================================"));
-	UE_LOG(LogTemp, Warning, TEXT("[공간체크] 제작할 아이템: %s"), *ItemType.ToString());
-	UE_LOG(LogTemp, Warning, TEXT("[공간체크] 아이템 카테고리: %d"), (int32)Category);
-	UE_LOG(LogTemp, Warning, TEXT("[공간체크] 아이템 크기: %d x %d"), ItemSize.X, ItemSize.Y);
-#endif
-
-	// ⭐ Grid 크기 설정 (Component 설정에서 가져오기)
-	int32 LocalGridRows = GridRows;  // ⭐ 지역 변수로 복사 (const 함수에서 수정 가능)
-	int32 LocalGridColumns = GridColumns;
-	int32 MaxSlots = LocalGridRows * LocalGridColumns;
-	UInv_InventoryGrid* TargetGrid = nullptr;
+	OutModel.Init(GridColumns, GridRows);
 
-#if INV_DEBUG_INVENTORY
-	UE_LOG(LogTemp, Warning, TEXT("[공간체크] Component 설정: %d x %d = %d칸 (모든 카테고리 공통)"),
-		LocalGridRows, LocalGridColumns, MaxSlots);
-#endif
-	
-	// ⭐ InventoryMenu가 있으면 실제 Grid의 HasRoomForItem 사용 (더 정확함!)
-	if (IsValid(InventoryMenu))
+	for (const FInv_InventoryEntry& Entry : InventoryList.Entries)
 	{
-		UInv_SpatialInventory* SpatialInv = Cast<UInv_SpatialInventory>(InventoryMenu);
-		if (IsValid(SpatialInv))
-		{
-			switch (Category)
-			{
-			case EInv_ItemCategory::Equippable:
-				TargetGrid = SpatialInv->GetGrid_Equippables();
-				break;
-			case EInv_ItemCategory::Consumable:
-				TargetGrid = SpatialInv->GetGrid_Consumables();
-				break;
-			case EInv_ItemCategory::Craftable:
-				TargetGrid = SpatialInv->GetGrid_Craftables();
-				break;
-#if INV_DEBUG_INVENTORY
-			default:
-				UE_LOG(LogTemp, Warning, TEXT("[공간체크] ⚠️ 알 수 없는 카테고리: %d"), (int32)Category);
-				break;
-#endif
-			}
-
-			if (IsValid(TargetGrid))
-			{
-				LocalGridRows = TargetGrid->GetRows();  // ⭐ 지역 변수 사용
-				LocalGridColumns = TargetGrid->GetColumns();
-				MaxSlots = TargetGrid->GetMaxSlots();
+		if (!IsValid(Entry.Item)) continue;
 
-#if INV_DEBUG_INVENTORY
-				UE_LOG(LogTemp, Warning, TEXT("[공간체크] Grid 설정: %d x %d = %d칸"),
-					LocalGridRows, LocalGridColumns, MaxSlots);
-#endif
+		// 부착/장착 중인 아이템은 그리드 칸을 차지하지 않음
+		if (Entry.bIsAttachedToWeapon || Entry.bIsEquipped) continue;
 
-				// ⭐⭐⭐ 실제 UI GridSlots 상태 기반 공간 체크! (플레이어가 옮긴 위치 반영!)
-				bool bHasRoom = TargetGrid->HasRoomInActualGrid(Manifest);
+		const FInv_ItemManifest& ItemManifest = Entry.Item->GetItemManifest();
+		const int32 Category = static_cast<int32>(ItemManifest.GetItemCategory());
+		if (!OutModel.IsValidCategory(Category)) continue;
 
-#if INV_DEBUG_INVENTORY
-				UE_LOG(LogTemp, Warning, TEXT("[공간체크] 🔍 Grid->HasRoomInActualGrid() 결과: %s"),
-					bHasRoom ? TEXT("✅ 실제 UI Grid에 공간 있음!") : TEXT("❌ UI Grid 꽉 참!"));
-				UE_LOG(LogTemp, Warning, TEXT("========================================"));
-#endif
+		const FInv_GridFragment* ItemGridFragment = ItemManifest.GetFragmentOfType<FInv_GridFragment>();
+		const FIntPoint ItemSize = ItemGridFragment ? ItemGridFragment->GetGridSize() : FIntPoint(1, 1);
+		const FIntPoint EffectiveSize = FInv_GridModel::GetEffectiveSize(ItemSize, Entry.bRotated);
 
-				return bHasRoom;
-			}
+		int32 PlacedIndex = INDEX_NONE;
+		if (Entry.GridIndex != INDEX_NONE && OutModel.TryPlace(Category, Entry.GridIndex, EffectiveSize))
+		{
+			PlacedIndex = Entry.GridIndex;
 		}
-	}
-#if INV_DEBUG_INVENTORY
-	else
-	{
-		UE_LOG(LogTemp, Warning, TEXT("[공간체크] ⚠️ InventoryMenu가 nullptr - Fallback 로직 사용"));
-	}
-
-	// ========== Fallback: Virtual Grid 시뮬레이션 (서버 전용) ==========
-	UE_LOG(LogTemp, Warning, TEXT("[공간체크] Fallback 모드: Virtual Grid 시뮬레이션 시작"));
-	UE_LOG(LogTemp, Warning, TEXT("[공간체크] Grid 크기: %d x %d = %d칸"), LocalGridRows, LocalGridColumns, MaxSlots);
-#endif
-	
-	// Virtual Grid 생성 (0 = 빈 칸, 1~ = 아이템 인덱스)
-	TArray<int32> VirtualGrid;
-	VirtualGrid.SetNum(MaxSlots);
-	for (int32 i = 0; i < MaxSlots; i++)
-	{
-		VirtualGrid[i] = 0; // 모두 빈 칸으로 초기화
-	}
-
-#if INV_DEBUG_INVENTORY
-	UE_LOG(LogTemp, Warning, TEXT("[공간체크] 📋 Virtual Grid 초기화 완료 (%dx%d)"), LocalGridRows, LocalGridColumns);
-
-	// 1. 현재 인벤토리의 아이템들을 Virtual Grid에 배치
-	UE_LOG(LogTemp, Warning, TEXT("[공간체크] 현재 인벤토리 내용을 Grid에 배치 중..."));
-#endif
-
-	int32 ItemIndex = 1; // 0은 빈 칸이므로 1부터 시작
-	int32 CurrentItemCount = 0;
-
-	for (const auto& Entry : InventoryList.Entries)
-	{
-		if (!IsValid(Entry.Item)) continue;
 
-		if (Entry.Item->GetItemManifest().GetItemCategory() == Category)
+		const FIntPoint ActualPos = Entry.Item->GetGridPosition();
+		if (PlacedIndex == INDEX_NONE && ActualPos.X >= 0 && ActualPos.Y >= 0
+			&& OutModel.IsAreaFree(Category, ActualPos, EffectiveSize))
 		{
-			const FInv_GridFragment* ItemGridFragment = Entry.Item->GetItemManifest().GetFragmentOfType<FInv_GridFragment>();
-			FIntPoint ExistingItemSize = ItemGridFragment ? ItemGridFragment->GetGridSize() : FIntPoint(1, 1);
-
-			FGameplayTag EntryType = Entry.Item->GetItemManifest().GetItemType();
-			int32 StackCount = Entry.Item->GetTotalStackCount();
-
-			// ⭐ 실제 Grid 위치 사용! (없으면 순차 배치 Fallback)
-			FIntPoint ActualPos = Entry.Item->GetGridPosition();
-
-#if INV_DEBUG_INVENTORY
-			UE_LOG(LogTemp, Warning, TEXT("[공간체크]   - [%d] %s x%d (크기: %dx%d, 실제위치: [%d,%d])"),
-				CurrentItemCount, *EntryType.ToString(), StackCount, ExistingItemSize.X, ExistingItemSize.Y,
-				ActualPos.X, ActualPos.Y);
-#endif
-			
-			// Virtual Grid에 배치
-			bool bPlaced = false;
-			
-			// ⭐ 실제 위치가 있으면 그대로 사용!
-			if (ActualPos.X >= 0 && ActualPos.Y >= 0 &&
-				ActualPos.X + ExistingItemSize.X <= LocalGridColumns &&
-				ActualPos.Y + ExistingItemSize.Y <= LocalGridRows)
-			{
-				// 실제 위치에 배치 가능한지 체크
-				bool bCanPlace = true;
-				for (int32 y = 0; y < ExistingItemSize.Y && bCanPlace; y++)
-				{
-					for (int32 x = 0; x < ExistingItemSize.X && bCanPlace; x++)
-					{
-						int32 CheckIndex = (ActualPos.Y + y) * LocalGridColumns + (ActualPos.X + x);
-						if (VirtualGrid[CheckIndex] != 0) // 이미 점유됨
-						{
-							bCanPlace = false;
-						}
-					}
-				}
-				
-				if (bCanPlace)
-				{
-					// 실제 위치에 배치!
-					for (int32 y = 0; y < ExistingItemSize.Y; y++)
-					{
-						for (int32 x = 0; x < ExistingItemSize.X; x++)
-						{
-							int32 PlaceIndex = (ActualPos.Y + y) * LocalGridColumns + (ActualPos.X + x);
-							VirtualGrid[PlaceIndex] = ItemIndex;
-						}
-					}
-					bPlaced = true;
-#if INV_DEBUG_INVENTORY
-					UE_LOG(LogTemp, Warning, TEXT("[공간체크]     → ✅ 실제 위치 Grid[%d,%d]에 배치됨"), ActualPos.X, ActualPos.Y);
-#endif
-				}
-			}
-
-			// ⚠️ 실제 위치가 없거나 배치 실패하면 순차 배치 시도 (Fallback)
-			if (!bPlaced)
-			{
-#if INV_DEBUG_INVENTORY
-				UE_LOG(LogTemp, Warning, TEXT("[공간체크]     → ⚠️ 실제 위치 사용 불가! Fallback 순차 배치 시도..."));
-#endif
-				
-				for (int32 Row = 0; Row <= LocalGridRows - ExistingItemSize.Y && !bPlaced; Row++)
-				{
-					for (int32 Col = 0; Col <= LocalGridColumns - ExistingItemSize.X && !bPlaced; Col++)
-					{
-						int32 StartIndex = Row * LocalGridColumns + Col;
-						
-						// 이 위치에 배치 가능한지 체크
-						bool bCanPlace = true;
-						for (int32 y = 0; y < ExistingItemSize.Y && bCanPlace; y++)
-						{
-							for (int32 x = 0; x < ExistingItemSize.X && bCanPlace; x++)
-							{
-								int32 CheckIndex = (Row + y) * LocalGridColumns + (Col + x);
-								if (VirtualGrid[CheckIndex] != 0) // 이미 점유됨
-								{
-									bCanPlace = false;
-								}
-							}
-						}
-						
-						// 배치 가능하면 Grid에 표시
-						if (bCanPlace)
-						{
-							for (int32 y = 0; y < ExistingItemSize.Y; y++)
-							{
-								for (int32 x = 0; x < ExistingItemSize.X; x++)
-								{
-									int32 PlaceIndex = (Row + y) * LocalGridColumns + (Col + x);
-									VirtualGrid[PlaceIndex] = ItemIndex;
-								}
-							}
-							bPlaced = true;
-#if INV_DEBUG_INVENTORY
-							UE_LOG(LogTemp, Warning, TEXT("[공간체크]     → Fallback Grid[%d,%d]에 배치됨"), Col, Row);
-#endif
-						}
-					}
-				}
-			}
-
-#if INV_DEBUG_INVENTORY
-			if (!bPlaced)
-			{
-				UE_LOG(LogTemp, Error, TEXT("[공간체크]     → ❌ 배치 실패! (Grid 시뮬레이션 오류 가능성)"));
-			}
-#endif
+			OutModel.SetArea(Category, ActualPos, EffectiveSize, true);
+			PlacedIndex = OutModel.PositionToIndex(ActualPos);
+		}
 
-			ItemIndex++;
-			CurrentItemCount++;
+		// ⚠️ 위치가 없거나 겹치면 순차 배치 (Fallback)
+		if (PlacedIndex == INDEX_NONE)
+		{
+			bool bPlacedRotated = false;
+			PlacedIndex = OutModel.PlaceFirstFit(Category, EffectiveSize, false, bPlacedRotated);
 		}
-	}
 
 #if INV_DEBUG_INVENTORY
-	// 2. Virtual Grid 상태 출력
-	UE_LOG(LogTemp, Warning, TEXT("[공간체크] 📊 현재 Virtual Grid 상태:"));
-	for (int32 Row = 0; Row < LocalGridRows; Row++)
-	{
-		FString RowStr = TEXT("  ");
-		for (int32 Col = 0; Col < LocalGridColumns; Col++)
+		UE_LOG(LogTemp, Warning, TEXT("[공간체크]   - %s (크기: %dx%d, 회전: %d) → Grid[%d]"),
+			*ItemManifest.GetItemType().ToString(), EffectiveSize.X, EffectiveSize.Y, Entry.bRotated ? 1 : 0, PlacedIndex);
+		if (PlacedIndex == INDEX_NONE)
 		{
-			int32 Value = VirtualGrid[Row * LocalGridColumns + Col];
-			RowStr += FString::Printf(TEXT("[%d]"), Value);
+			UE_LOG(LogTemp, Error, TEXT("[공간체크]     → ❌ 배치 실패! (Grid 시뮬레이션 오류 가능성)"));
 		}
-		UE_LOG(LogTemp, Warning, TEXT("%s"), *RowStr);
-	}
 #endif
+	}
+}
 
-	// 3. 스택 가능 여부 체크
-	const FInv_StackableFragment* StackableFragment = Manifest.GetFragmentOfType<FInv_StackableFragment>();
-	bool bStackable = (StackableFragment != nullptr);
+bool UInv_InventoryComponent::HasRoomInInventoryList(const FInv_ItemManifest& Manifest) const
+{
+	const EInv_ItemCategory Category = Manifest.GetItemCategory();
+	const FGameplayTag ItemType = Manifest.GetItemType();
 
-	if (bStackable)
+	// 1. 스택 여유가 있으면 새 칸 불필요
+	if (const FInv_StackableFragment* StackableFragment = Manifest.GetFragmentOfType<FInv_StackableFragment>())
 	{
-#if INV_DEBUG_INVENTORY
-		UE_LOG(LogTemp, Warning, TEXT("[공간체크] 🔍 스택 가능 아이템 - 기존 스택 찾기 중..."));
-#endif
-		for (const auto& Entry : InventoryList.Entries)
+		const int32 MaxStack = StackableFragment->GetMaxStackSize();
+		for (const FInv_InventoryEntry& Entry : InventoryList.Entries)
 		{
 			if (!IsValid(Entry.Item)) continue;
 
-			if (Entry.Item->GetItemManifest().GetItemType().MatchesTagExact(ItemType) &&
-				Entry.Item->GetItemManifest().GetItemCategory() == Category)
+			const FInv_ItemManifest& EntryManifest = Entry.Item->GetItemManifest();
+			if (EntryManifest.GetItemType().MatchesTagExact(ItemType) &&
+				EntryManifest.GetItemCategory() == Category &&
+				Entry.Item->GetTotalStackCount() < MaxStack)
 			{
-				int32 CurrentStack = Entry.Item->GetTotalStackCount();
-				int32 MaxStack = StackableFragment->GetMaxStackSize();
-
-				if (CurrentStack < MaxStack)
-				{
 #if INV_DEBUG_INVENTORY
-					UE_LOG(LogTemp, Warning, TEXT("[공간체크] ✅ 스택 가능! (현재: %d / 최대: %d)"), CurrentStack, MaxStack);
-					UE_LOG(LogTemp, Warning, TEXT("========================================"));
+				UE_LOG(LogTemp, Warning, TEXT("[공간체크] ✅ 스택 가능! (%s 현재: %d / 최대: %d)"),
+					*ItemType.ToString(), Entry.Item->GetTotalStackCount(), MaxStack);
 #endif
-					return true;
-				}
+				return true;
 			}
 		}
-#if INV_DEBUG_INVENTORY
-		UE_LOG(LogTemp, Warning, TEXT("[공간체크] ⚠️ 스택 여유 없음 - 새 슬롯 필요"));
-#endif
 	}
 
-#if INV_DEBUG_INVENTORY
-	// 4. 새로운 아이템을 배치할 수 있는지 체크
-	UE_LOG(LogTemp, Warning, TEXT("[공간체크] 🔍 새 아이템 배치 가능 여부 체크 (크기: %dx%d)"), ItemSize.X, ItemSize.Y);
-#endif
-	
-	bool bHasRoom = false;
-	for (int32 Row = 0; Row <= LocalGridRows - ItemSize.Y && !bHasRoom; Row++)
-	{
-		for (int32 Col = 0; Col <= LocalGridColumns - ItemSize.X && !bHasRoom; Col++)
-		{
-			bool bCanPlace = true;
-			
-			// 이 위치에 배치 가능한지 체크
-			for (int32 y = 0; y < ItemSize.Y && bCanPlace; y++)
-			{
-				for (int32 x = 0; x < ItemSize.X && bCanPlace; x++)
-				{
-					int32 CheckIndex = (Row + y) * LocalGridColumns + (Col + x);
-					if (VirtualGrid[CheckIndex] != 0) // 이미 점유됨
-					{
-						bCanPlace = false;
-					}
-				}
-			}
-			
-			if (bCanPlace)
-			{
-				bHasRoom = true;
-#if INV_DEBUG_INVENTORY
-				UE_LOG(LogTemp, Warning, TEXT("[공간체크] ✅ 배치 가능! Grid[%d,%d]부터 %dx%d 공간 확보됨"),
-					Col, Row, ItemSize.X, ItemSize.Y);
-#endif
-			}
-		}
-	}
+	// 2. 서버 데이터 기반 점유 비트셋에서 first-fit (위젯과 같은 순서, 새 아이템은 회전 없이 배치)
+	FInv_GridModel GridModel;
+	BuildGridModelFromInventoryList(GridModel);
 
-#if INV_DEBUG_INVENTORY
-	if (!bHasRoom)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("[공간체크] ❌ Grid 꽉 참! %dx%d 크기의 빈 공간 없음"), ItemSize.X, ItemSize.Y);
-	}
+	const FInv_GridFragment* GridFragment = Manifest.GetFragmentOfType<FInv_GridFragment>();
+	const FIntPoint ItemSize = GridFragment ? GridFragment->GetGridSize() : FIntPoint(1, 1);
+	const bool bHasRoom = GridModel.HasRoom(static_cast<int32>(Category), ItemSize);
 
-	UE_LOG(LogTemp, Warning, TEXT("[공간체크] Virtual Grid 결과: %s"),
-		bHasRoom ? TEXT("✅ 공간 있음") : TEXT("❌ 공간 없음"));
-	UE_LOG(LogTemp, Warning, TEXT("========================================"));
+#if INV_DEBUG_INVENTORY
+	UE_LOG(LogTemp, Warning, TEXT("[공간체크] %s (카테고리 %d, 크기 %dx%d) | Grid %dx%d | 결과: %s"),
+		*ItemType.ToString(), static_cast<int32>(Category), ItemSize.X, ItemSize.Y,
+		GridModel.GetColumns(), GridModel.GetRows(), bHasRoom ? TEXT("✅ 공간 있음") : TEXT("❌ 공간 없음"));
 #endif
 
 	return bHasRoom;
@@ -4051,13 +3867,12 @@ void UInv_InventoryComponent::Server_TakeItemFromContainer_Implementation(
 	}
 	AddRepSubObj(ItemToMove);
 
-	InventoryList.MarkItemDirty(NewEntry);
-	InventoryList.RebuildItemTypeIndex();
+	InventoryList.MarkItemDirty(NewEntry); // ⭐ [ItemTypeIndexV2] 타입 인덱스 색인 포함
 
 	// 컨테이너에서 제거 (Entry만 제거, Item 객체는 유지 — 내 InvComp으로 이동했으므로)
+	ContainerList.UnindexEntry(ContainerList.Entries[ContainerEntryIndex]);
 	ContainerList.Entries.RemoveAt(ContainerEntryIndex);
 	ContainerList.MarkArrayDirty();
-	ContainerList.RebuildItemTypeIndex();
 
 	UE_LOG(LogTemp, Log, TEXT("[Phase 9] Server_TakeItemFromContainer: %s (x%d) 가져옴"),
 		*ItemType.ToString(), StackCount);
@@ -4139,13 +3954,12 @@ void UInv_InventoryComponent::Server_PutItemInContainer_Implementation(
 		Container->AddReplicatedSubObject(ItemToMove);
 	}
 
-	ContainerList.MarkItemDirty(NewEntry);
-	ContainerList.RebuildItemTypeIndex();
+	ContainerList.MarkItemDirty(NewEntry); // ⭐ [ItemTypeIndexV2] 타입 인덱스 색인 포함
 
 	// 내 인벤토리에서 제거
+	InventoryList.UnindexEntry(InventoryList.Entries[PlayerEntryIndex]);
 	InventoryList.Entries.RemoveAt(PlayerEntryIndex);
 	InventoryList.MarkArrayDirty();
-	InventoryList.RebuildItemTypeIndex();
 
 	UE_LOG(LogTemp, Log, TEXT("[Phase 9] Server_PutItemInContainer: %s (x%d) 넣음"),
 		*ItemType.ToString(), StackCount);
@@ -4211,6 +4025,7 @@ void UInv_InventoryComponent::Server_TakeAllFromContainer_Implementation(
 		InventoryList.MarkItemDirty(NewEntry);
 
 		// 컨테이너에서 제거
+		ContainerList.UnindexEntry(ContainerList.Entries[i]);
 		ContainerList.Entries.RemoveAt(i);
 		TakenCount++;
 
@@ -4222,8 +4037,6 @@ void UInv_InventoryComponent::Server_TakeAllFromContainer_Implementation(
 	}
 
 	ContainerList.MarkArrayDirty();
-	ContainerList.RebuildItemTypeIndex();
-	InventoryList.RebuildItemTypeIndex();
 
 	UE_LOG(LogTemp, Log, TEXT("[Phase 9] Server_TakeAllFromContainer: %d개 아이템 가져옴"), TakenCount);
 
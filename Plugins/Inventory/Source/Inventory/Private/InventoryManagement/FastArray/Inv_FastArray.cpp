@@ -8,6 +8,11 @@
 #include "Items/Fragments/Inv_AttachmentFragments.h"
 #include "Types/Inv_GridTypes.h"
 
+FInv_InventoryFastArray::~FInv_InventoryFastArray()
+{
+	ReleaseIndexedItems();
+}
+
 TArray<UInv_InventoryItem*> FInv_InventoryFastArray::GetAllItems() const
 {
 	TArray<UInv_InventoryItem*> Results;
@@ -60,6 +65,8 @@ void FInv_InventoryFastArray::PreReplicatedRemove(const TArrayView<int32> Remove
 			continue;
 		}
 
+		UnindexEntry(Entries[Index]); // ⭐ [ItemTypeIndexV2] 제거될 Entry만 해제 (O(1))
+
 		UInv_InventoryItem* RemovedItem = Entries[Index].Item;
 		if (IsValid(RemovedItem))
 		{
@@ -112,8 +119,6 @@ void FInv_InventoryFastArray::PreReplicatedRemove(const TArrayView<int32> Remove
 #endif
 	}
 
-	RebuildItemTypeIndex(); // ⚠️ 클라이언트 인덱스 캐시 동기화
-
 #if INV_DEBUG_INVENTORY
 	UE_LOG(LogTemp, Warning, TEXT("=== PreReplicatedRemove 완료! ==="));
 #endif
@@ -166,6 +171,9 @@ void FInv_InventoryFastArray::PostReplicatedAdd(const TArrayView<int32> AddedInd
 			continue;
 		}
 
+		// ⭐ [ItemTypeIndexV2] 추가된 Entry만 색인 (부착/장착 스킵보다 먼저 — 장착 아이템도 타입 조회 대상)
+		IndexEntry(Entries[Index]);
+
 #if INV_DEBUG_INVENTORY
 		UE_LOG(LogTemp, Warning, TEXT("[PostReplicatedAdd] Index: %d, ItemType: %s"),
 			Index, *Entries[Index].Item->GetItemManifest().GetItemType().ToString());
@@ -229,8 +237,6 @@ void FInv_InventoryFastArray::PostReplicatedAdd(const TArrayView<int32> AddedInd
 		}
 	}
 
-	RebuildItemTypeIndex(); // ⚠️ 클라이언트 인덱스 캐시 동기화
-
 #if INV_DEBUG_INVENTORY
 	UE_LOG(LogTemp, Warning, TEXT("=== PostReplicatedAdd 완료! ==="));
 #endif
@@ -277,6 +283,9 @@ void FInv_InventoryFastArray::PostReplicatedChange(const TArrayView<int32> Chang
 			continue;
 		}
 
+		// ⭐ [ItemTypeIndexV2] 스택 수 / 부착 상태 변경분만 인덱스에 반영
+		RefreshIndexedEntry(Entries[Index]);
+
 		UInv_InventoryItem* ChangedItem = Entries[Index].Item;
 		if (!IsValid(ChangedItem))
 		{
@@ -398,8 +407,6 @@ void FInv_InventoryFastArray::PostReplicatedChange(const TArrayView<int32> Chang
 		}
 	}
 
-	RebuildItemTypeIndex(); // ⚠️ 클라이언트 인덱스 캐시 동기화
-
 #if INV_DEBUG_INVENTORY
 	UE_LOG(LogTemp, Warning, TEXT("=== PostReplicatedChange 완료 (총 %d개 Entry 처리됨) ==="), ChangedIndices.Num());
 #endif
@@ -494,8 +501,7 @@ UInv_InventoryItem* FInv_InventoryFastArray::AddEntry(UInv_ItemComponent* ItemCo
 			ContainerComp->AddReplicatedSubObject(NewEntry.Item);
 		}
 	}
-	MarkItemDirty(NewEntry); // 복제되어야 함을 알려주는 것.
-	RebuildItemTypeIndex(); // ⭐ [최적화 #4] 인덱스 캐시 재구축
+	MarkItemDirty(NewEntry); // 복제되어야 함을 알려주는 것. (⭐ [ItemTypeIndexV2] 타입 인덱스도 여기서 색인)
 
 	return NewEntry.Item; // 새로 추가된 항목 반환
 }
@@ -546,8 +552,7 @@ UInv_InventoryItem* FInv_InventoryFastArray::AddEntry(UInv_InventoryItem* Item)
 			ContainerComp->AddReplicatedSubObject(NewEntry.Item);
 		}
 	}
-	MarkItemDirty(NewEntry);
-	RebuildItemTypeIndex(); // ⭐ [최적화 #4] 인덱스 캐시 재구축
+	MarkItemDirty(NewEntry); // ⭐ [ItemTypeIndexV2] 타입 인덱스 색인 포함
 
 	return Item;
 }
@@ -581,9 +586,9 @@ void FInv_InventoryFastArray::RemoveEntry(UInv_InventoryItem* Item)
 				}
 			}
 
+			UnindexEntry(Entry); // ⭐ [ItemTypeIndexV2] 슬롯 ID 기반이라 뒤쪽 Entry 인덱스 보정 불필요
 			EntryIt.RemoveCurrent(); // 현재 항목 제거
 			MarkArrayDirty();
-			RebuildItemTypeIndex(); // ⭐ [최적화 #4] 인덱스 캐시 재구축
 			return; // 아이템 찾았으므로 즉시 반환
 		}
 	}
@@ -624,44 +629,189 @@ void FInv_InventoryFastArray::ClearAllEntries()
 
 UInv_InventoryItem* FInv_InventoryFastArray::FindFirstItemByType(const FGameplayTag& ItemType)
 {
-	// ⭐ [최적화 #4] 캐시가 구축되어 있으면 O(1) 조회
-	if (ItemTypeIndex.Num() > 0)
+	// ⭐ [ItemTypeIndexV2] 버킷의 첫 슬롯 반환 (O(1))
+	// 인덱스는 Add/Remove/PostReplicated*에서 증분 유지되므로 폴백 선형 탐색 불필요
+	if (const FInv_ItemTypeBucket* Bucket = ItemTypeIndex.Find(ItemType))
 	{
-		TArray<int32> Indices;
-		ItemTypeIndex.MultiFind(ItemType, Indices);
-		for (int32 Idx : Indices)
+		for (int32 SlotId : Bucket->Slots)
 		{
-			if (Entries.IsValidIndex(Idx) && IsValid(Entries[Idx].Item))
+			if (UInv_InventoryItem* Item = IndexSlots[SlotId].Item.Get())
 			{
-				return Entries[Idx].Item;
+				return Item;
 			}
 		}
-		return nullptr;
 	}
+	return nullptr;
+}
 
-	// 캐시 미구축 시 기존 O(n) 폴백
-	auto* FoundItem = Entries.FindByPredicate([ItemType = ItemType](const FInv_InventoryEntry& Entry)
+// ⭐ [ItemTypeIndexV2] Entry 1개 색인
+void FInv_InventoryFastArray::IndexEntry(FInv_InventoryEntry& Entry)
+{
+	if (Entry.TypeIndexSlot != INDEX_NONE) return;
+	if (!IsValid(Entry.Item) || Entry.bIsAttachedToWeapon) return; // ⚠️ 부착물은 제외 — 재료 소비 시 부착물이 잡히는 버그 방지
+
+	int32 SlotId;
+	if (FreeIndexSlots.Num() > 0)
 	{
-		return IsValid(Entry.Item) && Entry.Item->GetItemManifest().GetItemType().MatchesTagExact(ItemType);
-	});
-	return FoundItem ? FoundItem->Item : nullptr;
+		SlotId = FreeIndexSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		SlotId = IndexSlots.AddDefaulted();
+	}
+
+	FInv_ItemTypeIndexSlot& Slot = IndexSlots[SlotId];
+	Slot.ItemType = Entry.Item->GetItemManifest().GetItemType();
+	Slot.Item = Entry.Item;
+	Slot.StackCount = Entry.Item->GetTotalStackCount();
+
+	FInv_ItemTypeBucket& Bucket = ItemTypeIndex.FindOrAdd(Slot.ItemType);
+	Slot.BucketPos = Bucket.Slots.Add(SlotId);
+	Bucket.TotalStackCount += Slot.StackCount;
+
+	Entry.TypeIndexSlot = SlotId;
+	Entry.Item->TypeIndexOwner = this;
+	Entry.Item->TypeIndexSlot = SlotId;
+	NotifyTypeTotalChanged(Slot.ItemType);
 }
 
-// ⭐ [최적화 #4] 아이템 타입별 인덱스 캐시 재구축
-void FInv_InventoryFastArray::RebuildItemTypeIndex()
+// ⭐ [ItemTypeIndexV2] Entry 1개 해제 — 버킷에서 RemoveAtSwap 후 옮겨진 슬롯의 BucketPos만 보정
+void FInv_InventoryFastArray::UnindexEntry(FInv_InventoryEntry& Entry)
 {
-	ItemTypeIndex.Reset();
-	for (int32 i = 0; i < Entries.Num(); ++i)
+	const int32 SlotId = Entry.TypeIndexSlot;
+	Entry.TypeIndexSlot = INDEX_NONE;
+	if (!IndexSlots.IsValidIndex(SlotId)) return;
+
+	FInv_ItemTypeIndexSlot& Slot = IndexSlots[SlotId];
+
+	// 컨테이너 이동 시 새 리스트가 먼저 색인할 수 있으므로 이 리스트를 가리킬 때만 해제
+	UInv_InventoryItem* SlotItem = Slot.Item.Get();
+	if (SlotItem && SlotItem->TypeIndexOwner == this && SlotItem->TypeIndexSlot == SlotId)
+	{
+		SlotItem->TypeIndexOwner = nullptr;
+		SlotItem->TypeIndexSlot = INDEX_NONE;
+	}
+
+	if (FInv_ItemTypeBucket* Bucket = ItemTypeIndex.Find(Slot.ItemType))
+	{
+		if (Bucket->Slots.IsValidIndex(Slot.BucketPos) && Bucket->Slots[Slot.BucketPos] == SlotId)
+		{
+			Bucket->Slots.RemoveAtSwap(Slot.BucketPos, EAllowShrinking::No);
+			if (Bucket->Slots.IsValidIndex(Slot.BucketPos))
+			{
+				IndexSlots[Bucket->Slots[Slot.BucketPos]].BucketPos = Slot.BucketPos;
+			}
+			Bucket->TotalStackCount -= Slot.StackCount;
+			NotifyTypeTotalChanged(Slot.ItemType);
+		}
+
+		if (Bucket->Slots.Num() == 0)
+		{
+			ItemTypeIndex.Remove(Slot.ItemType);
+		}
+	}
+
+	Slot = FInv_ItemTypeIndexSlot();
+	FreeIndexSlots.Add(SlotId);
+}
+
+// ⭐ [ItemTypeIndexV2] Entry 재평가 — 스택 수 변경은 차분만 반영, 부착/아이템 교체는 해제 후 재색인
+void FInv_InventoryFastArray::RefreshIndexedEntry(FInv_InventoryEntry& Entry)
+{
+	const bool bShouldIndex = IsValid(Entry.Item) && !Entry.bIsAttachedToWeapon;
+	if (Entry.TypeIndexSlot == INDEX_NONE)
 	{
-		if (IsValid(Entries[i].Item) && !Entries[i].bIsAttachedToWeapon) // ⚠️ 부착물은 제외 — 재료 소비 시 부착물이 잡히는 버그 방지
+		if (bShouldIndex)
 		{
-			ItemTypeIndex.Add(Entries[i].Item->GetItemManifest().GetItemType(), i);
+			IndexEntry(Entry);
 		}
+		return;
+	}
+
+	if (!bShouldIndex || !IndexSlots.IsValidIndex(Entry.TypeIndexSlot)
+		|| IndexSlots[Entry.TypeIndexSlot].Item.Get() != Entry.Item
+		|| !IndexSlots[Entry.TypeIndexSlot].ItemType.MatchesTagExact(Entry.Item->GetItemManifest().GetItemType()))
+	{
+		UnindexEntry(Entry);
+		IndexEntry(Entry);
+		return;
+	}
+
+	ApplyIndexedStackCount(Entry.TypeIndexSlot, Entry.Item->GetTotalStackCount());
+}
+
+// ⭐ [ItemTypeIndexV2] 아이템 쪽에서 스택 수가 바뀐 경우 (Entry 탐색 없이 슬롯 ID로 O(1))
+void FInv_InventoryFastArray::RefreshIndexedItemStack(const UInv_InventoryItem* Item)
+{
+	if (!IsValid(Item) || !IndexSlots.IsValidIndex(Item->TypeIndexSlot)) return;
+	if (IndexSlots[Item->TypeIndexSlot].Item.Get() != Item) return;
+
+	ApplyIndexedStackCount(Item->TypeIndexSlot, Item->GetTotalStackCount());
+}
+
+void FInv_InventoryFastArray::ApplyIndexedStackCount(int32 SlotId, int32 NewStackCount)
+{
+	FInv_ItemTypeIndexSlot& Slot = IndexSlots[SlotId];
+	if (NewStackCount != Slot.StackCount)
+	{
+		ItemTypeIndex.FindChecked(Slot.ItemType).TotalStackCount += NewStackCount - Slot.StackCount;
+		Slot.StackCount = NewStackCount;
+		NotifyTypeTotalChanged(Slot.ItemType);
+	}
+}
+
+void FInv_InventoryFastArray::ReleaseIndexedItems()
+{
+	for (int32 SlotId = 0; SlotId < IndexSlots.Num(); ++SlotId)
+	{
+		UInv_InventoryItem* Item = IndexSlots[SlotId].Item.Get();
+		if (Item && Item->TypeIndexOwner == this && Item->TypeIndexSlot == SlotId)
+		{
+			Item->TypeIndexOwner = nullptr;
+			Item->TypeIndexSlot = INDEX_NONE;
+		}
+	}
+}
+
+// ⭐ [MaterialCountCacheV1] InventoryComponent 소유일 때만 재료 수량 dirty 전달
+void FInv_InventoryFastArray::NotifyTypeTotalChanged(const FGameplayTag& ItemType) const
+{
+	if (UInv_InventoryComponent* IC = Cast<UInv_InventoryComponent>(OwnerComponent))
+	{
+		IC->MarkMaterialCountDirty(ItemType);
 	}
 }
 
-// ⭐ [최적화 #4] 아이템 타입별 개수 조회 (O(1) 해시 조회)
+// ⭐ [최적화 #4] 아이템 타입별 인덱스 캐시 재구축 (일괄 변경 전용 — 평소에는 증분 유지)
+void FInv_InventoryFastArray::RebuildItemTypeIndex()
+{
+	// ⭐ [MaterialCountCacheV1] 재구축 전 타입도 dirty 처리 (전부 사라진 타입의 UI 갱신용)
+	for (const TPair<FGameplayTag, FInv_ItemTypeBucket>& Pair : ItemTypeIndex)
+	{
+		NotifyTypeTotalChanged(Pair.Key);
+	}
+
+	ReleaseIndexedItems();
+	ItemTypeIndex.Reset();
+	IndexSlots.Reset();
+	FreeIndexSlots.Reset();
+	for (FInv_InventoryEntry& Entry : Entries)
+	{
+		Entry.TypeIndexSlot = INDEX_NONE;
+		IndexEntry(Entry);
+	}
+}
+
+// ⭐ [최적화 #4] 아이템 타입별 Entry 개수 조회 (O(1) 해시 조회)
 int32 FInv_InventoryFastArray::GetTotalCountByType(const FGameplayTag& ItemType) const
 {
-	return ItemTypeIndex.Num(ItemType);
+	const FInv_ItemTypeBucket* Bucket = ItemTypeIndex.Find(ItemType);
+	return Bucket ? Bucket->Slots.Num() : 0;
+}
+
+// ⭐ [ItemTypeIndexV2] 아이템 타입별 스택 합계 조회 (O(1))
+int32 FInv_InventoryFastArray::GetTotalStackCountByType(const FGameplayTag& ItemType) const
+{
+	const FInv_ItemTypeBucket* Bucket = ItemTypeIndex.Find(ItemType);
+	return Bucket ? Bucket->TotalStackCount : 0;
 }
@@ -0,0 +1,220 @@
+// Gihyeon's Inventory Project
+
+#include "InventoryManagement/GridModel/Inv_GridModel.h"
+
+void FInv_GridModel::Init(int32 InColumns, int32 InRows, int32 InNumCategories)
+{
+	Columns = FMath::Max(0, InColumns);
+	Rows = FMath::Max(0, InRows);
+	WordsPerRow = (Columns + 63) / 64;
+
+	Categories.SetNum(FMath::Max(0, InNumCategories));
+	for (TArray<uint64>& Bits : Categories)
+	{
+		Bits.Init(0, Rows * WordsPerRow);
+	}
+}
+
+void FInv_GridModel::Reset()
+{
+	for (TArray<uint64>& Bits : Categories)
+	{
+		FMemory::Memzero(Bits.GetData(), Bits.Num() * sizeof(uint64));
+	}
+}
+
+uint64 FInv_GridModel::MakeSpanMask(int32 WordIdx, int32 X, int32 Width)
+{
+	const int32 Base = WordIdx * 64;
+	const int32 Lo = FMath::Max(X, Base);
+	const int32 Hi = FMath::Min(X + Width, Base + 64);
+	if (Lo >= Hi)
+	{
+		return 0;
+	}
+
+	const int32 NumBits = Hi - Lo;
+	const uint64 Mask = NumBits >= 64 ? ~uint64(0) : ((uint64(1) << NumBits) - 1);
+	return Mask << (Lo - Base);
+}
+
+bool FInv_GridModel::IsInBounds(const FIntPoint& Position, const FIntPoint& Size) const
+{
+	return Size.X > 0 && Size.Y > 0
+		&& Position.X >= 0 && Position.Y >= 0
+		&& Position.X + Size.X <= Columns
+		&& Position.Y + Size.Y <= Rows;
+}
+
+bool FInv_GridModel::IsCellOccupied(int32 Category, int32 Index) const
+{
+	if (!IsValidCategory(Category) || Index < 0 || Index >= GetNumCells())
+	{
+		return true;
+	}
+
+	const FIntPoint Pos = IndexToPosition(Index);
+	const uint64 Word = Categories[Category][Pos.Y * WordsPerRow + Pos.X / 64];
+	return (Word >> (Pos.X % 64)) & 1;
+}
+
+bool FInv_GridModel::IsAreaFree(int32 Category, const FIntPoint& Position, const FIntPoint& Size) const
+{
+	if (!IsValidCategory(Category) || !IsInBounds(Position, Size))
+	{
+		return false;
+	}
+
+	const TArray<uint64>& Bits = Categories[Category];
+	const int32 FirstWord = Position.X / 64;
+	const int32 LastWord = (Position.X + Size.X - 1) / 64;
+
+	for (int32 Row = Position.Y; Row < Position.Y + Size.Y; ++Row)
+	{
+		for (int32 WordIdx = FirstWord; WordIdx <= LastWord; ++WordIdx)
+		{
+			if (Bits[Row * WordsPerRow + WordIdx] & MakeSpanMask(WordIdx, Position.X, Size.X))
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+void FInv_GridModel::SetArea(int32 Category, const FIntPoint& Position, const FIntPoint& Size, bool bOccupied)
+{
+	if (!IsValidCategory(Category) || Size.X <= 0 || Size.Y <= 0)
+	{
+		return;
+	}
+
+	// 범위 밖 칸은 잘라냄 (기존 위젯 SetOccupiedBits와 동일 동작)
+	const int32 X0 = FMath::Max(Position.X, 0);
+	const int32 Y0 = FMath::Max(Position.Y, 0);
+	const int32 X1 = FMath::Min(Position.X + Size.X, Columns);
+	const int32 Y1 = FMath::Min(Position.Y + Size.Y, Rows);
+	if (X0 >= X1 || Y0 >= Y1)
+	{
+		return;
+	}
+
+	TArray<uint64>& Bits = Categories[Category];
+	const int32 Width = X1 - X0;
+	const int32 FirstWord = X0 / 64;
+	const int32 LastWord = (X1 - 1) / 64;
+
+	for (int32 Row = Y0; Row < Y1; ++Row)
+	{
+		for (int32 WordIdx = FirstWord; WordIdx <= LastWord; ++WordIdx)
+		{
+			const uint64 Mask = MakeSpanMask(WordIdx, X0, Width);
+			uint64& Word = Bits[Row * WordsPerRow + WordIdx];
+			Word = bOccupied ? (Word | Mask) : (Word & ~Mask);
+		}
+	}
+}
+
+bool FInv_GridModel::TryPlace(int32 Category, int32 Index, const FIntPoint& Size)
+{
+	if (!IsAreaFree(Category, Index, Size))
+	{
+		return false;
+	}
+
+	SetArea(Category, Index, Size, true);
+	return true;
+}
+
+int32 FInv_GridModel::FindFirstFitUnrotated(int32 Category, const FIntPoint& Size) const
+{
+	if (!IsValidCategory(Category) || Size.X <= 0 || Size.Y <= 0 || Size.X > Columns || Size.Y > Rows)
+	{
+		return INDEX_NONE;
+	}
+
+	const TArray<uint64>& Bits = Categories[Category];
+
+	// 일반적인 경우 (Columns <= 64): 행 Size.Y개를 OR → 빈 칸 비트에서 길이 Size.X 연속 구간 탐색
+	if (WordsPerRow == 1)
+	{
+		const uint64 RowMask = Columns >= 64 ? ~uint64(0) : ((uint64(1) << Columns) - 1);
+
+		for (int32 Row = 0; Row + Size.Y <= Rows; ++Row)
+		{
+			uint64 Combined = 0;
+			for (int32 k = 0; k < Size.Y; ++k)
+			{
+				Combined |= Bits[Row + k];
+			}
+
+			const uint64 Free = ~Combined & RowMask;
+
+			// Run의 비트 x = [x, x + Size.X) 전부 빈 칸
+			uint64 Run = Free;
+			for (int32 Shift = 1; Shift < Size.X && Run; ++Shift)
+			{
+				Run &= Free >> Shift;
+			}
+
+			if (Run)
+			{
+				return Row * Columns + static_cast<int32>(FMath::CountTrailingZeros64(Run));
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	// 64열 초과 그리드: 위치별 워드 검사
+	for (int32 Row = 0; Row + Size.Y <= Rows; ++Row)
+	{
+		for (int32 Col = 0; Col + Size.X <= Columns; ++Col)
+		{
+			if (IsAreaFree(Category, FIntPoint(Col, Row), Size))
+			{
+				return Row * Columns + Col;
+			}
+		}
+	}
+	return INDEX_NONE;
+}
+
+int32 FInv_GridModel::FindFirstFit(int32 Category, const FIntPoint& Size, bool bAllowRotation, bool& bOutRotated) const
+{
+	bOutRotated = false;
+
+	const int32 Index = FindFirstFitUnrotated(Category, Size);
+	if (Index != INDEX_NONE || !bAllowRotation || Size.X == Size.Y)
+	{
+		return Index;
+	}
+
+	const int32 RotatedIndex = FindFirstFitUnrotated(Category, GetEffectiveSize(Size, true));
+	bOutRotated = RotatedIndex != INDEX_NONE;
+	return RotatedIndex;
+}
+
+int32 FInv_GridModel::PlaceFirstFit(int32 Category, const FIntPoint& Size, bool bAllowRotation, bool& bOutRotated)
+{
+	const int32 Index = FindFirstFit(Category, Size, bAllowRotation, bOutRotated);
+	if (Index != INDEX_NONE)
+	{
+		SetArea(Category, Index, GetEffectiveSize(Size, bOutRotated), true);
+	}
+	return Index;
+}
+
+int32 FInv_GridModel::GetNumOccupied(int32 Category) const
+{
+	if (!IsValidCategory(Category))
+	{
+		return 0;
+	}
+
+	int32 Count = 0;
+	for (const uint64 Word : Categories[Category])
+	{
+		Count += static_cast<int32>(FMath::CountBits(Word));
+	}
+	return Count;
+}
@@ -0,0 +1,148 @@
+// File: Plugins/Inventory/Source/Inventory/Private/InventoryManagement/GridModel/Tests/Inv_GridModel.spec.cpp
+//
+// 자동화 테스트 — FInv_GridModel (위젯 없는 그리드 점유 비트셋)
+//
+// 테스트 경로: Inventory.GridModel
+// 실행: Session Frontend → Automation → "Inventory.GridModel" 체크 후 RunTests
+// 또는 콘솔: Automation RunTests Inventory.GridModel
+//
+// 검증 범위:
+//   - 영역 점유/해제 + 범위 검사
+//   - first-fit 순서 (행 우선, 위젯 HasRoomForItem과 동일)
+//   - 회전 재시도 / 카테고리 독립
+//   - 64열 초과 그리드 (행당 워드 2개) 경계
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "InventoryManagement/GridModel/Inv_GridModel.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(FInv_GridModelSpec,
+	"Inventory.GridModel",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+	FInv_GridModel Model;
+
+END_DEFINE_SPEC(FInv_GridModelSpec)
+
+void FInv_GridModelSpec::Define()
+{
+	Describe("8x6 grid", [this]()
+	{
+		BeforeEach([this]()
+		{
+			Model.Init(8, 6);
+		});
+
+		It("should start empty", [this]()
+		{
+			for (int32 Category = 0; Category < FInv_GridModel::NumItemCategories; ++Category)
+			{
+				TestEqual(TEXT("No occupied cells"), Model.GetNumOccupied(Category), 0);
+				TestEqual(TEXT("First fit 1x1 at 0"), Model.FindFirstFit(Category, FIntPoint(1, 1)), 0);
+			}
+		});
+
+		It("should reject out-of-bounds areas", [this]()
+		{
+			TestFalse(TEXT("Overflows right edge"), Model.IsAreaFree(0, FIntPoint(7, 0), FIntPoint(2, 1)));
+			TestFalse(TEXT("Overflows bottom edge"), Model.IsAreaFree(0, FIntPoint(0, 5), FIntPoint(1, 2)));
+			TestFalse(TEXT("Negative position"), Model.IsAreaFree(0, FIntPoint(-1, 0), FIntPoint(1, 1)));
+			TestFalse(TEXT("Zero size"), Model.IsAreaFree(0, FIntPoint(0, 0), FIntPoint(0, 1)));
+			TestFalse(TEXT("Invalid category"), Model.IsAreaFree(FInv_GridModel::NumItemCategories, 0, FIntPoint(1, 1)));
+			TestTrue(TEXT("Exactly fits bottom-right"), Model.IsAreaFree(0, FIntPoint(6, 4), FIntPoint(2, 2)));
+		});
+
+		It("should occupy and release areas", [this]()
+		{
+			TestTrue(TEXT("Place 2x3 at (1,1)"), Model.TryPlace(0, Model.PositionToIndex(FIntPoint(1, 1)), FIntPoint(2, 3)));
+			TestEqual(TEXT("6 cells occupied"), Model.GetNumOccupied(0), 6);
+			TestTrue(TEXT("Corner cell occupied"), Model.IsCellOccupied(0, Model.PositionToIndex(FIntPoint(2, 3))));
+			TestFalse(TEXT("Neighbour cell free"), Model.IsCellOccupied(0, Model.PositionToIndex(FIntPoint(3, 3))));
+			TestFalse(TEXT("Overlapping placement rejected"), Model.TryPlace(0, Model.PositionToIndex(FIntPoint(2, 2)), FIntPoint(2, 2)));
+
+			Model.SetArea(0, FIntPoint(1, 1), FIntPoint(2, 3), false);
+			TestEqual(TEXT("Released"), Model.GetNumOccupied(0), 0);
+		});
+
+		It("should keep categories independent", [this]()
+		{
+			Model.SetArea(1, FIntPoint(0, 0), FIntPoint(8, 6), true);
+			TestFalse(TEXT("Consumables full"), Model.HasRoom(1, FIntPoint(1, 1)));
+			TestTrue(TEXT("Equippables untouched"), Model.HasRoom(0, FIntPoint(8, 6)));
+			TestTrue(TEXT("Craftables untouched"), Model.HasRoom(2, FIntPoint(1, 1)));
+		});
+
+		It("should find the first fit in row-major order", [this]()
+		{
+			// 첫 행 0~4 점유 → 2x1은 (5,0)
+			Model.SetArea(0, FIntPoint(0, 0), FIntPoint(5, 1), true);
+			TestEqual(TEXT("2x1 after the filled run"), Model.FindFirstFit(0, FIntPoint(2, 1)), Model.PositionToIndex(FIntPoint(5, 0)));
+
+			// (6,1) 점유 → 2x2는 첫 행/둘째 행 모두 비어 있는 열이 없어 (0,1)
+			Model.SetArea(0, FIntPoint(6, 1), FIntPoint(1, 1), true);
+			TestEqual(TEXT("2x2 drops to the next row"), Model.FindFirstFit(0, FIntPoint(2, 2)), Model.PositionToIndex(FIntPoint(0, 1)));
+
+			// 첫 칸 구멍(1칸) 무시하고 3칸 연속 구간 찾기
+			Model.Reset();
+			Model.SetArea(0, FIntPoint(1, 0), FIntPoint(1, 1), true);
+			TestEqual(TEXT("3x1 skips the 1-wide gap"), Model.FindFirstFit(0, FIntPoint(3, 1)), Model.PositionToIndex(FIntPoint(2, 0)));
+		});
+
+		It("should retry rotated when allowed", [this]()
+		{
+			// 폭 2열만 남김 → 3x1은 원래 방향으로 불가, 회전(1x3)하면 가능
+			Model.SetArea(0, FIntPoint(0, 0), FIntPoint(6, 6), true);
+			Model.SetArea(0, FIntPoint(7, 0), FIntPoint(1, 6), true);
+
+			bool bRotated = false;
+			TestEqual(TEXT("No unrotated fit"), Model.FindFirstFit(0, FIntPoint(3, 1), false, bRotated), static_cast<int32>(INDEX_NONE));
+			TestFalse(TEXT("Not rotated"), bRotated);
+
+			const int32 Index = Model.PlaceFirstFit(0, FIntPoint(3, 1), true, bRotated);
+			TestEqual(TEXT("Rotated fit at (6,0)"), Index, Model.PositionToIndex(FIntPoint(6, 0)));
+			TestTrue(TEXT("Rotated"), bRotated);
+			TestTrue(TEXT("Rotated footprint occupied"), Model.IsCellOccupied(0, Model.PositionToIndex(FIntPoint(6, 2))));
+			TestFalse(TEXT("Below footprint free"), Model.IsCellOccupied(0, Model.PositionToIndex(FIntPoint(6, 3))));
+		});
+
+		It("should report full grids", [this]()
+		{
+			bool bRotated = false;
+			for (int32 i = 0; i < 48; ++i)
+			{
+				TestNotEqual(TEXT("Fill cell"), Model.PlaceFirstFit(2, FIntPoint(1, 1), false, bRotated), static_cast<int32>(INDEX_NONE));
+			}
+			TestEqual(TEXT("All cells occupied"), Model.GetNumOccupied(2), 48);
+			TestFalse(TEXT("No room"), Model.HasRoom(2, FIntPoint(1, 1), true));
+		});
+	});
+
+	Describe("wide grid (more than 64 columns)", [this]()
+	{
+		BeforeEach([this]()
+		{
+			Model.Init(70, 2, 1);
+		});
+
+		It("should handle spans across the word boundary", [this]()
+		{
+			TestTrue(TEXT("Place across bit 63/64"), Model.TryPlace(0, 62, FIntPoint(4, 1)));
+			TestTrue(TEXT("Cell 63 occupied"), Model.IsCellOccupied(0, 63));
+			TestTrue(TEXT("Cell 64 occupied"), Model.IsCellOccupied(0, 64));
+			TestFalse(TEXT("Cell 66 free"), Model.IsCellOccupied(0, 66));
+			TestFalse(TEXT("Overlap in second word rejected"), Model.IsAreaFree(0, FIntPoint(65, 0), FIntPoint(2, 1)));
+			TestEqual(TEXT("4 cells"), Model.GetNumOccupied(0), 4);
+		});
+
+		It("should first-fit past a filled first word", [this]()
+		{
+			Model.SetArea(0, FIntPoint(0, 0), FIntPoint(66, 2), true);
+			TestEqual(TEXT("2x2 at column 66"), Model.FindFirstFit(0, FIntPoint(2, 2)), 66);
+			TestEqual(TEXT("5x1 does not fit"), Model.FindFirstFit(0, FIntPoint(5, 1)), static_cast<int32>(INDEX_NONE));
+		});
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
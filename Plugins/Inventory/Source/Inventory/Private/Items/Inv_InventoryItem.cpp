@@ -5,6 +5,7 @@
 
 #include "Items/Fragments/Inv_ItemFragment.h"
 #include "Items/Fragments/Inv_AttachmentFragments.h"
+#include "InventoryManagement/FastArray/Inv_FastArray.h"
 #include "Net/UnrealNetwork.h"
 
 void UInv_InventoryItem::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -50,6 +51,20 @@ void UInv_InventoryItem::SetTotalStackCount(int32 Count)
 		// Stackable Fragment가 없으면 스택 불가 아이템 (1개만 가능)
 		TotalStackCount = FMath::Clamp(Count, 0, 1);
 	}
+
+	// ⭐ [ItemTypeIndexV2] 호출부가 MarkItemDirty를 생략해도 타입별 스택 합계가 어긋나지 않도록
+	if (TypeIndexOwner)
+	{
+		TypeIndexOwner->RefreshIndexedItemStack(this);
+	}
+}
+
+void UInv_InventoryItem::OnRep_TotalStackCount()
+{
+	if (TypeIndexOwner)
+	{
+		TypeIndexOwner->RefreshIndexedItemStack(this);
+	}
 }
 
 // ════════════════════════════════════════════════════════════════
@@ -608,6 +608,8 @@ void UInv_BuildMenu::DistributeBuildingButtonsToWrapBoxes()
 //       → 1번 인벤토리 변경 시 N*3회 인벤토리 순회 (60~90회)
 // 변경: BuildMenu에서 1번만 구독 → 모든 BuildingButton 일괄 업데이트
 //       → 1번 인벤토리 변경 시 1회 순회 후 N번 UI 갱신
+// [MaterialCountCacheV1] OnMaterialCountsChanged 1개만 구독
+//       → 프레임당 1회, 바뀐 재료를 쓰는 버튼만 갱신 (수량 조회는 타입 합계 캐시 O(1))
 
 void UInv_BuildMenu::BindInventoryDelegates()
 {
@@ -617,37 +619,43 @@ void UInv_BuildMenu::BindInventoryDelegates()
 	UInv_InventoryComponent* InvComp = PC->FindComponentByClass<UInv_InventoryComponent>();
 	if (!IsValid(InvComp)) return;
 
+	if (CachedInventoryComponent.Get() == InvComp && MaterialCountsChangedHandle.IsValid()) return;
+	UnbindInventoryDelegates();
+
 	CachedInventoryComponent = InvComp;
+	MaterialCountsChangedHandle = InvComp->OnMaterialCountsChanged.AddUObject(this, &ThisClass::OnMaterialCountsChanged);
 
-	InvComp->OnItemAdded.AddUniqueDynamic(this, &ThisClass::OnInventoryChanged_ItemAdded);
-	InvComp->OnItemRemoved.AddUniqueDynamic(this, &ThisClass::OnInventoryChanged_ItemRemoved);
-	InvComp->OnStackChange.AddUniqueDynamic(this, &ThisClass::OnInventoryChanged_StackChanged);
+	// 구독 전에 바뀐 수량은 통지를 못 받았으므로 1회 동기화
+	RefreshAllBuildingButtons();
 }
 
 void UInv_BuildMenu::UnbindInventoryDelegates()
 {
 	if (!CachedInventoryComponent.IsValid()) return;
 
-	CachedInventoryComponent->OnItemAdded.RemoveAll(this);
-	CachedInventoryComponent->OnItemRemoved.RemoveAll(this);
-	CachedInventoryComponent->OnStackChange.RemoveAll(this);
+	CachedInventoryComponent->OnMaterialCountsChanged.Remove(MaterialCountsChangedHandle);
+	MaterialCountsChangedHandle.Reset();
 
 	CachedInventoryComponent.Reset();
 }
 
-void UInv_BuildMenu::OnInventoryChanged_ItemAdded(UInv_InventoryItem* Item, int32 EntryIndex)
+void UInv_BuildMenu::OnMaterialCountsChanged(const TSet<FGameplayTag>& ChangedTags)
 {
-	RefreshAllBuildingButtons();
-}
-
-void UInv_BuildMenu::OnInventoryChanged_ItemRemoved(UInv_InventoryItem* Item, int32 EntryIndex)
-{
-	RefreshAllBuildingButtons();
-}
+	for (TObjectPtr<UInv_BuildingButton>& Btn : CollectedBuildingButtons)
+	{
+		if (!IsValid(Btn)) continue;
 
-void UInv_BuildMenu::OnInventoryChanged_StackChanged(const FInv_SlotAvailabilityResult& Result)
-{
-	RefreshAllBuildingButtons();
+		const FGameplayTag ButtonTags[] = { Btn->GetRequiredMaterialTag(), Btn->GetRequiredMaterialTag2(), Btn->GetRequiredMaterialTag3() };
+		for (const FGameplayTag& Tag : ButtonTags)
+		{
+			if (Tag.IsValid() && ChangedTags.Contains(Tag))
+			{
+				Btn->UpdateMaterialUI();
+				Btn->UpdateButtonState();
+				break;
+			}
+		}
+	}
 }
 
 void UInv_BuildMenu::RefreshAllBuildingButtons()
@@ -352,14 +352,8 @@ void UInv_BuildingButton::UpdateMaterialUI()
 
 			if (IsValid(AmountText) && IsValid(InvComp))
 			{
-				int32 CurrentAmount = 0;
-				const auto& AllItems = InvComp->GetInventoryList().GetAllItems();
-				for (UInv_InventoryItem* Item : AllItems)
-				{
-					if (!IsValid(Item)) continue;
-					if (!Item->GetItemManifest().GetItemType().MatchesTagExact(Tag)) continue;
-					CurrentAmount += Item->GetTotalStackCount();
-				}
+				// [MaterialCountCacheV1] 타입 합계 캐시 O(1) 조회
+				const int32 CurrentAmount = InvComp->GetTotalMaterialCount(Tag);
 				AmountText->SetText(FText::FromString(FString::Printf(TEXT("%d/%d"), CurrentAmount, Required)));
 			}
 		}
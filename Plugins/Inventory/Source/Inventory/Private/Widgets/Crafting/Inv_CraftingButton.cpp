@@ -217,10 +217,10 @@ bool UInv_CraftingButton::HasRequiredMaterials()
 	if (!IsValid(InvComp)) return false;
 
 	// ════════════════════════════════════════════════════════════════
-	// 📌 [최적화] GetAllItems() 1번만 호출, 루프 1번만 순회
+	// 📌 [MaterialCountCacheV1] 타입별 스택 합계 캐시 조회
 	// ════════════════════════════════════════════════════════════════
-	// 이전: GetAllItems() 3번 호출 + 루프 3번 순회
-	// 이후: GetAllItems() 1번 호출 + 루프 1번 순회 (약 66% 연산량 감소)
+	// 이전: GetAllItems() 1번 + 루프 1번 순회 (인벤토리 크기에 비례)
+	// 이후: GetTotalMaterialCount(Tag) 재료당 O(1)
 	// ════════════════════════════════════════════════════════════════
 
 	const bool bNeedMaterial1 = RequiredMaterialTag.IsValid() && RequiredAmount > 0;
@@ -233,34 +233,9 @@ bool UInv_CraftingButton::HasRequiredMaterials()
 		return true;
 	}
 
-	// 1번만 GetAllItems() 호출
-	const TArray<UInv_InventoryItem*> AllItems = InvComp->GetInventoryList().GetAllItems();
-
-	int32 TotalCount1 = 0;
-	int32 TotalCount2 = 0;
-	int32 TotalCount3 = 0;
-
-	// 1번만 루프 순회하면서 3개 재료 모두 카운트
-	for (UInv_InventoryItem* Item : AllItems)
-	{
-		if (!IsValid(Item)) continue;
-
-		const FGameplayTag ItemType = Item->GetItemManifest().GetItemType();
-		const int32 StackCount = Item->GetTotalStackCount();
-
-		if (bNeedMaterial1 && ItemType.MatchesTagExact(RequiredMaterialTag))
-		{
-			TotalCount1 += StackCount;
-		}
-		if (bNeedMaterial2 && ItemType.MatchesTagExact(RequiredMaterialTag2))
-		{
-			TotalCount2 += StackCount;
-		}
-		if (bNeedMaterial3 && ItemType.MatchesTagExact(RequiredMaterialTag3))
-		{
-			TotalCount3 += StackCount;
-		}
-	}
+	const int32 TotalCount1 = bNeedMaterial1 ? InvComp->GetTotalMaterialCount(RequiredMaterialTag) : 0;
+	const int32 TotalCount2 = bNeedMaterial2 ? InvComp->GetTotalMaterialCount(RequiredMaterialTag2) : 0;
+	const int32 TotalCount3 = bNeedMaterial3 ? InvComp->GetTotalMaterialCount(RequiredMaterialTag3) : 0;
 
 	// 재료 1 체크
 	if (bNeedMaterial1 && TotalCount1 < RequiredAmount)
@@ -323,19 +298,8 @@ void UInv_CraftingButton::UpdateMaterialUI()
 		// 개수 텍스트 업데이트 (실시간!)
 		if (IsValid(Text_Material1Amount))
 		{
-			int32 CurrentAmount = 0;
-			
-			// 인벤토리에서 재료 개수 세기
-			if (IsValid(InvComp))
-			{
-				const auto& AllItems = InvComp->GetInventoryList().GetAllItems();
-				for (UInv_InventoryItem* Item : AllItems)
-				{
-					if (!IsValid(Item)) continue;
-					if (!Item->GetItemManifest().GetItemType().MatchesTagExact(RequiredMaterialTag)) continue;
-					CurrentAmount += Item->GetTotalStackCount();
-				}
-			}
+			// 인벤토리에서 재료 개수 조회 ([MaterialCountCacheV1] 타입 합계 캐시)
+			const int32 CurrentAmount = IsValid(InvComp) ? InvComp->GetTotalMaterialCount(RequiredMaterialTag) : 0;
 			
 			// 아이템이 없으면 CurrentAmount = 0 (위에서 초기화됨)
 			FString AmountText = FString::Printf(TEXT("%d/%d"), CurrentAmount, RequiredAmount);
@@ -368,19 +332,8 @@ void UInv_CraftingButton::UpdateMaterialUI()
 		// 개수 텍스트 업데이트 (실시간!)
 		if (IsValid(Text_Material2Amount))
 		{
-			int32 CurrentAmount = 0;
-			
-			// 인벤토리에서 재료 개수 세기
-			if (IsValid(InvComp))
-			{
-				const auto& AllItems = InvComp->GetInventoryList().GetAllItems();
-				for (UInv_InventoryItem* Item : AllItems)
-				{
-					if (!IsValid(Item)) continue;
-					if (!Item->GetItemManifest().GetItemType().MatchesTagExact(RequiredMaterialTag2)) continue;
-					CurrentAmount += Item->GetTotalStackCount();
-				}
-			}
+			// 인벤토리에서 재료 개수 조회 ([MaterialCountCacheV1] 타입 합계 캐시)
+			const int32 CurrentAmount = IsValid(InvComp) ? InvComp->GetTotalMaterialCount(RequiredMaterialTag2) : 0;
 			
 			// 아이템이 없으면 CurrentAmount = 0
 			FString AmountText = FString::Printf(TEXT("%d/%d"), CurrentAmount, RequiredAmount2);
@@ -410,19 +363,8 @@ void UInv_CraftingButton::UpdateMaterialUI()
 		// 개수 텍스트 업데이트 (실시간!)
 		if (IsValid(Text_Material3Amount))
 		{
-			int32 CurrentAmount = 0;
-			
-			// 인벤토리에서 재료 개수 세기
-			if (IsValid(InvComp))
-			{
-				const auto& AllItems = InvComp->GetInventoryList().GetAllItems();
-				for (UInv_InventoryItem* Item : AllItems)
-				{
-					if (!IsValid(Item)) continue;
-					if (!Item->GetItemManifest().GetItemType().MatchesTagExact(RequiredMaterialTag3)) continue;
-					CurrentAmount += Item->GetTotalStackCount();
-				}
-			}
+			// 인벤토리에서 재료 개수 조회 ([MaterialCountCacheV1] 타입 합계 캐시)
+			const int32 CurrentAmount = IsValid(InvComp) ? InvComp->GetTotalMaterialCount(RequiredMaterialTag3) : 0;
 			
 			// 아이템이 없으면 CurrentAmount = 0
 			FString AmountText = FString::Printf(TEXT("%d/%d"), CurrentAmount, RequiredAmount3);
@@ -448,26 +390,12 @@ void UInv_CraftingButton::BindInventoryDelegates()
 	UInv_InventoryComponent* InvComp = UInv_InventoryStatics::GetInventoryComponent(GetOwningPlayer());
 	if (!IsValid(InvComp)) return;
 
-	if (!InvComp->OnItemAdded.IsAlreadyBound(this, &ThisClass::OnInventoryItemAdded))
-	{
-		InvComp->OnItemAdded.AddUniqueDynamic(this, &ThisClass::OnInventoryItemAdded);
-	}
-
-	if (!InvComp->OnItemRemoved.IsAlreadyBound(this, &ThisClass::OnInventoryItemRemoved))
-	{
-		InvComp->OnItemRemoved.AddUniqueDynamic(this, &ThisClass::OnInventoryItemRemoved);
-	}
-
-	if (!InvComp->OnStackChange.IsAlreadyBound(this, &ThisClass::OnInventoryStackChanged))
-	{
-		InvComp->OnStackChange.AddUniqueDynamic(this, &ThisClass::OnInventoryStackChanged);
-	}
+	// ⭐ [MaterialCountCacheV1] 재료 수량 통지 1개만 구독 (프레임당 1회, 바뀐 태그만)
+	if (BoundInventoryComponent.Get() == InvComp && MaterialCountsChangedHandle.IsValid()) return;
+	UnbindInventoryDelegates();
 
-	// ⭐ OnMaterialStacksChanged 델리게이트 바인딩 (Tag 기반 - 안전!)
-	if (!InvComp->OnMaterialStacksChanged.IsAlreadyBound(this, &ThisClass::OnMaterialStacksChanged))
-	{
-		InvComp->OnMaterialStacksChanged.AddUniqueDynamic(this, &ThisClass::OnMaterialStacksChanged);
-	}
+	BoundInventoryComponent = InvComp;
+	MaterialCountsChangedHandle = InvComp->OnMaterialCountsChanged.AddUObject(this, &ThisClass::OnMaterialCountsChanged);
 
 #if INV_DEBUG_CRAFT
 	UE_LOG(LogTemp, Log, TEXT("CraftingButton: 인벤토리 델리게이트 바인딩 완료"));
@@ -476,64 +404,43 @@ void UInv_CraftingButton::BindInventoryDelegates()
 
 void UInv_CraftingButton::UnbindInventoryDelegates()
 {
-	UInv_InventoryComponent* InvComp = UInv_InventoryStatics::GetInventoryComponent(GetOwningPlayer());
-	if (!IsValid(InvComp)) return;
-
-	InvComp->OnItemAdded.RemoveDynamic(this, &ThisClass::OnInventoryItemAdded);
-	InvComp->OnItemRemoved.RemoveDynamic(this, &ThisClass::OnInventoryItemRemoved);
-	InvComp->OnStackChange.RemoveDynamic(this, &ThisClass::OnInventoryStackChanged);
-	InvComp->OnMaterialStacksChanged.RemoveDynamic(this, &ThisClass::OnMaterialStacksChanged);
+	if (UInv_InventoryComponent* InvComp = BoundInventoryComponent.Get())
+	{
+		InvComp->OnMaterialCountsChanged.Remove(MaterialCountsChangedHandle);
+	}
+	MaterialCountsChangedHandle.Reset();
+	BoundInventoryComponent.Reset();
 }
 
-void UInv_CraftingButton::OnInventoryItemAdded(UInv_InventoryItem* Item, int32 EntryIndex)
+bool UInv_CraftingButton::UsesMaterial(const FGameplayTag& MaterialTag) const
 {
-#if INV_DEBUG_CRAFT
-	UE_LOG(LogTemp, Log, TEXT("CraftingButton: 아이템 추가됨! EntryIndex=%d, 버튼 상태 재계산..."), EntryIndex);
-#endif
-	UpdateMaterialUI(); // 재료 UI 업데이트
-	UpdateButtonState();
+	return (RequiredMaterialTag.IsValid() && RequiredMaterialTag.MatchesTagExact(MaterialTag))
+		|| (RequiredMaterialTag2.IsValid() && RequiredMaterialTag2.MatchesTagExact(MaterialTag))
+		|| (RequiredMaterialTag3.IsValid() && RequiredMaterialTag3.MatchesTagExact(MaterialTag));
 }
 
-void UInv_CraftingButton::OnInventoryItemRemoved(UInv_InventoryItem* Item, int32 EntryIndex)
+void UInv_CraftingButton::OnMaterialCountsChanged(const TSet<FGameplayTag>& ChangedTags)
 {
-#if INV_DEBUG_CRAFT
-	UE_LOG(LogTemp, Warning, TEXT("=== CraftingButton: 아이템 제거됨! EntryIndex=%d ==="), EntryIndex);
-	if (IsValid(Item))
+	// ⭐ Tag 기반이므로 Dangling Pointer 걱정 없음!
+	// 이 버튼이 사용하는 재료가 바뀌었을 때만 갱신
+	bool bAffected = false;
+	for (const FGameplayTag& Tag : ChangedTags)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("제거된 아이템: %s"), *Item->GetItemManifest().GetItemType().ToString());
+		if (UsesMaterial(Tag))
+		{
+			bAffected = true;
+			break;
+		}
 	}
-#endif
+	if (!bAffected) return;
 
-	UpdateMaterialUI(); // 재료 UI 업데이트
-	UpdateButtonState();
-}
-
-void UInv_CraftingButton::OnInventoryStackChanged(const FInv_SlotAvailabilityResult& Result)
-{
 #if INV_DEBUG_CRAFT
-	UE_LOG(LogTemp, Log, TEXT("CraftingButton: 스택 변경됨! 버튼 상태 재계산..."));
+	UE_LOG(LogTemp, Log, TEXT("CraftingButton: 재료 변경됨! (%d개 태그) 버튼 상태 재계산..."), ChangedTags.Num());
 #endif
 	UpdateMaterialUI(); // 재료 UI 업데이트
 	UpdateButtonState();
 }
 
-void UInv_CraftingButton::OnMaterialStacksChanged(const FGameplayTag& MaterialTag)
-{
-	// ⭐ Tag 기반이므로 Dangling Pointer 걱정 없음!
-#if INV_DEBUG_CRAFT
-	UE_LOG(LogTemp, Log, TEXT("CraftingButton: 재료 변경됨! (Tag: %s)"), *MaterialTag.ToString());
-#endif
-
-	// 이 버튼이 사용하는 재료인지 체크
-	if (RequiredMaterialTag.MatchesTagExact(MaterialTag) ||
-		RequiredMaterialTag2.MatchesTagExact(MaterialTag) ||
-		RequiredMaterialTag3.MatchesTagExact(MaterialTag))
-	{
-		UpdateMaterialUI(); // 재료 UI 즉시 업데이트
-		UpdateButtonState();
-	}
-}
-
 void UInv_CraftingButton::ConsumeMaterials()
 {
 #if INV_DEBUG_CRAFT
@@ -80,37 +80,15 @@ void UInv_TabbedCraftingEntry::RefreshMaterialUI()
 {
 	UInv_InventoryComponent* InvComp = UInv_InventoryStatics::GetInventoryComponent(GetOwningPlayer());
 
-	// [최적화] GetAllItems() 1회 호출, 3개 재료 동시 카운트 (기존 3회 → 1회)
+	// [MaterialCountCacheV1] 재료당 타입 합계 캐시 O(1) 조회 (인벤토리 순회 없음)
 	const bool bNeedMat1 = CachedRecipe.MaterialTag1.IsValid() && CachedRecipe.MaterialAmount1 > 0;
 	const bool bNeedMat2 = CachedRecipe.MaterialTag2.IsValid() && CachedRecipe.MaterialAmount2 > 0;
 	const bool bNeedMat3 = CachedRecipe.MaterialTag3.IsValid() && CachedRecipe.MaterialAmount3 > 0;
 
-	int32 Count1 = 0, Count2 = 0, Count3 = 0;
-
-	if (IsValid(InvComp) && (bNeedMat1 || bNeedMat2 || bNeedMat3))
-	{
-		const auto& AllItems = InvComp->GetInventoryList().GetAllItems();
-		for (UInv_InventoryItem* Item : AllItems)
-		{
-			if (!IsValid(Item)) continue;
-
-			const FGameplayTag ItemType = Item->GetItemManifest().GetItemType();
-			const int32 StackCount = Item->GetTotalStackCount();
-
-			if (bNeedMat1 && ItemType.MatchesTagExact(CachedRecipe.MaterialTag1))
-			{
-				Count1 += StackCount;
-			}
-			if (bNeedMat2 && ItemType.MatchesTagExact(CachedRecipe.MaterialTag2))
-			{
-				Count2 += StackCount;
-			}
-			if (bNeedMat3 && ItemType.MatchesTagExact(CachedRecipe.MaterialTag3))
-			{
-				Count3 += StackCount;
-			}
-		}
-	}
+	const bool bHasInvComp = IsValid(InvComp);
+	const int32 Count1 = (bHasInvComp && bNeedMat1) ? InvComp->GetTotalMaterialCount(CachedRecipe.MaterialTag1) : 0;
+	const int32 Count2 = (bHasInvComp && bNeedMat2) ? InvComp->GetTotalMaterialCount(CachedRecipe.MaterialTag2) : 0;
+	const int32 Count3 = (bHasInvComp && bNeedMat3) ? InvComp->GetTotalMaterialCount(CachedRecipe.MaterialTag3) : 0;
 
 	// === 재료 1 UI ===
 	if (bNeedMat1)
@@ -196,7 +174,7 @@ bool UInv_TabbedCraftingEntry::HasRequiredMaterials() const
 	UInv_InventoryComponent* InvComp = UInv_InventoryStatics::GetInventoryComponent(GetOwningPlayer());
 	if (!IsValid(InvComp)) return false;
 
-	// [최적화] GetAllItems() 1번만 호출, 루프 1번만 순회
+	// [MaterialCountCacheV1] 타입 합계 캐시 조회
 	const bool bNeedMaterial1 = CachedRecipe.MaterialTag1.IsValid() && CachedRecipe.MaterialAmount1 > 0;
 	const bool bNeedMaterial2 = CachedRecipe.MaterialTag2.IsValid() && CachedRecipe.MaterialAmount2 > 0;
 	const bool bNeedMaterial3 = CachedRecipe.MaterialTag3.IsValid() && CachedRecipe.MaterialAmount3 > 0;
@@ -207,32 +185,9 @@ bool UInv_TabbedCraftingEntry::HasRequiredMaterials() const
 		return true;
 	}
 
-	const TArray<UInv_InventoryItem*> AllItems = InvComp->GetInventoryList().GetAllItems();
-
-	int32 TotalCount1 = 0;
-	int32 TotalCount2 = 0;
-	int32 TotalCount3 = 0;
-
-	for (UInv_InventoryItem* Item : AllItems)
-	{
-		if (!IsValid(Item)) continue;
-
-		const FGameplayTag ItemType = Item->GetItemManifest().GetItemType();
-		const int32 StackCount = Item->GetTotalStackCount();
-
-		if (bNeedMaterial1 && ItemType.MatchesTagExact(CachedRecipe.MaterialTag1))
-		{
-			TotalCount1 += StackCount;
-		}
-		if (bNeedMaterial2 && ItemType.MatchesTagExact(CachedRecipe.MaterialTag2))
-		{
-			TotalCount2 += StackCount;
-		}
-		if (bNeedMaterial3 && ItemType.MatchesTagExact(CachedRecipe.MaterialTag3))
-		{
-			TotalCount3 += StackCount;
-		}
-	}
+	const int32 TotalCount1 = bNeedMaterial1 ? InvComp->GetTotalMaterialCount(CachedRecipe.MaterialTag1) : 0;
+	const int32 TotalCount2 = bNeedMaterial2 ? InvComp->GetTotalMaterialCount(CachedRecipe.MaterialTag2) : 0;
+	const int32 TotalCount3 = bNeedMaterial3 ? InvComp->GetTotalMaterialCount(CachedRecipe.MaterialTag3) : 0;
 
 	if (bNeedMaterial1 && TotalCount1 < CachedRecipe.MaterialAmount1)
 	{
@@ -218,25 +218,16 @@ void UInv_TabbedCraftingMenu::BindInventoryDelegates()
 	UInv_InventoryComponent* InvComp = UInv_InventoryStatics::GetInventoryComponent(GetOwningPlayer());
 	if (!IsValid(InvComp)) return;
 
-	if (!InvComp->OnItemAdded.IsAlreadyBound(this, &ThisClass::OnInventoryChanged))
-	{
-		InvComp->OnItemAdded.AddUniqueDynamic(this, &ThisClass::OnInventoryChanged);
-	}
-
-	if (!InvComp->OnItemRemoved.IsAlreadyBound(this, &ThisClass::OnInventoryChanged))
-	{
-		InvComp->OnItemRemoved.AddUniqueDynamic(this, &ThisClass::OnInventoryChanged);
-	}
+	// [MaterialCountCacheV1] OnItemAdded/OnItemRemoved/OnStackChange/OnMaterialStacksChanged 대신
+	// 프레임당 1회 합쳐진 재료 수량 통지만 구독
+	if (BoundInventoryComponent.Get() == InvComp && MaterialCountsChangedHandle.IsValid()) return;
+	UnbindInventoryDelegates();
 
-	if (!InvComp->OnStackChange.IsAlreadyBound(this, &ThisClass::OnStackChanged))
-	{
-		InvComp->OnStackChange.AddUniqueDynamic(this, &ThisClass::OnStackChanged);
-	}
+	BoundInventoryComponent = InvComp;
+	MaterialCountsChangedHandle = InvComp->OnMaterialCountsChanged.AddUObject(this, &ThisClass::OnMaterialCountsChanged);
 
-	if (!InvComp->OnMaterialStacksChanged.IsAlreadyBound(this, &ThisClass::OnMaterialChanged))
-	{
-		InvComp->OnMaterialStacksChanged.AddUniqueDynamic(this, &ThisClass::OnMaterialChanged);
-	}
+	// 구독 전에 바뀐 수량은 통지를 못 받았으므로 1회 동기화
+	RefreshAllEntryUI();
 
 #if INV_DEBUG_CRAFT
 	UE_LOG(LogTemp, Log, TEXT("TabbedCraftingMenu: 인벤토리 델리게이트 바인딩 완료"));
@@ -245,53 +236,28 @@ void UInv_TabbedCraftingMenu::BindInventoryDelegates()
 
 void UInv_TabbedCraftingMenu::UnbindInventoryDelegates()
 {
-	UInv_InventoryComponent* InvComp = UInv_InventoryStatics::GetInventoryComponent(GetOwningPlayer());
-	if (!IsValid(InvComp)) return;
-
-	InvComp->OnItemAdded.RemoveDynamic(this, &ThisClass::OnInventoryChanged);
-	InvComp->OnItemRemoved.RemoveDynamic(this, &ThisClass::OnInventoryChanged);
-	InvComp->OnStackChange.RemoveDynamic(this, &ThisClass::OnStackChanged);
-	InvComp->OnMaterialStacksChanged.RemoveDynamic(this, &ThisClass::OnMaterialChanged);
-}
-
-void UInv_TabbedCraftingMenu::OnInventoryChanged(UInv_InventoryItem* Item, int32 EntryIndex)
-{
-	// [최적화] 변경된 아이템 타입을 재료로 사용하는 엔트리만 갱신
-	if (!IsValid(Item))
-	{
-		RefreshAllEntryUI();
-		return;
-	}
-
-	const FGameplayTag ItemType = Item->GetItemManifest().GetItemType();
-	for (const TObjectPtr<UInv_TabbedCraftingEntry>& Entry : AllEntryWidgets)
+	if (UInv_InventoryComponent* InvComp = BoundInventoryComponent.Get())
 	{
-		if (IsValid(Entry) && Entry->UsesMaterial(ItemType))
-		{
-			Entry->RefreshMaterialUI();
-		}
+		InvComp->OnMaterialCountsChanged.Remove(MaterialCountsChangedHandle);
 	}
+	MaterialCountsChangedHandle.Reset();
+	BoundInventoryComponent.Reset();
 }
 
-void UInv_TabbedCraftingMenu::OnStackChanged(const FInv_SlotAvailabilityResult& Result)
-{
-	RefreshAllEntryUI();
-}
-
-void UInv_TabbedCraftingMenu::OnMaterialChanged(const FGameplayTag& MaterialTag)
+void UInv_TabbedCraftingMenu::OnMaterialCountsChanged(const TSet<FGameplayTag>& ChangedTags)
 {
-	// [최적화] 해당 재료 태그를 사용하는 엔트리만 갱신
-	if (!MaterialTag.IsValid())
-	{
-		RefreshAllEntryUI();
-		return;
-	}
-
+	// [최적화] 바뀐 재료 태그를 사용하는 엔트리만 갱신 (엔트리당 1회)
 	for (const TObjectPtr<UInv_TabbedCraftingEntry>& Entry : AllEntryWidgets)
 	{
-		if (IsValid(Entry) && Entry->UsesMaterial(MaterialTag))
+		if (!IsValid(Entry)) continue;
+
+		for (const FGameplayTag& Tag : ChangedTags)
 		{
-			Entry->RefreshMaterialUI();
+			if (Entry->UsesMaterial(Tag))
+			{
+				Entry->RefreshMaterialUI();
+				break;
+			}
 		}
 	}
 }
@@ -1109,43 +1109,13 @@ void UInv_InventoryGrid::ReleaseSlottedItem(UInv_SlottedItem* SlottedItem)
 // ⭐ [최적화 #5] 비트마스크 점유 상태 일괄 설정
 void UInv_InventoryGrid::SetOccupiedBits(int32 StartIndex, const FIntPoint& Dimensions, bool bOccupied)
 {
-	const FIntPoint StartPos = UInv_WidgetUtils::GetPositionFromIndex(StartIndex, Columns);
-	for (int32 j = 0; j < Dimensions.Y; ++j)
-	{
-		for (int32 i = 0; i < Dimensions.X; ++i)
-		{
-			const FIntPoint Coord = StartPos + FIntPoint(i, j);
-			const int32 Idx = UInv_WidgetUtils::GetIndexFromPosition(Coord, Columns);
-			if (Idx >= 0 && Idx < OccupiedMask.Num())
-			{
-				OccupiedMask[Idx] = bOccupied;
-			}
-		}
-	}
+	OccupancyModel.SetArea(0, StartIndex, Dimensions, bOccupied);
 }
 
-// ⭐ [최적화 #5] 영역이 비어있는지 비트마스크로 빠르게 확인
+// ⭐ [최적화 #5] 영역이 비어있는지 비트마스크로 빠르게 확인 (그리드 범위 밖이면 자유 아님)
 bool UInv_InventoryGrid::IsAreaFree(int32 StartIndex, const FIntPoint& Dimensions) const
 {
-	const FIntPoint StartPos = UInv_WidgetUtils::GetPositionFromIndex(StartIndex, Columns);
-	for (int32 j = 0; j < Dimensions.Y; ++j)
-	{
-		for (int32 i = 0; i < Dimensions.X; ++i)
-		{
-			const FIntPoint Coord = StartPos + FIntPoint(i, j);
-			// 그리드 범위 밖이면 자유 아님
-			if (Coord.X < 0 || Coord.X >= Columns || Coord.Y < 0 || Coord.Y >= Rows)
-			{
-				return false;
-			}
-			const int32 Idx = UInv_WidgetUtils::GetIndexFromPosition(Coord, Columns);
-			if (Idx < 0 || Idx >= OccupiedMask.Num() || OccupiedMask[Idx])
-			{
-				return false;
-			}
-		}
-	}
-	return true;
+	return OccupancyModel.IsAreaFree(0, StartIndex, Dimensions);
 }
 
 // 같은 아이템이면 수량 쌓기
@@ -2917,7 +2887,7 @@ void UInv_InventoryGrid::ConstructGrid()
 	if (GridSlots.Num() > 0) return;
 
 	GridSlots.Reserve(Rows * Columns); // Tarray 지정 하는 건 알겠는데 GridSlot이거 어디서?
-	OccupiedMask.Init(false, Rows * Columns); // ⭐ [최적화 #5] 비트마스크 초기화 (모두 비점유)
+	OccupancyModel.Init(Columns, Rows, 1); // ⭐ [최적화 #5] 비트마스크 초기화 (모두 비점유)
 
 	for (int32 j = 0; j < Rows; ++j)
 	{
@@ -3776,75 +3746,19 @@ int32 UInv_InventoryGrid::GetTotalMaterialCountFromSlots(const FGameplayTag& Mat
 // ⭐ 실제 UI Grid 상태 확인 (크래프팅 공간 체크용)
 bool UInv_InventoryGrid::HasRoomInActualGrid(const FInv_ItemManifest& Manifest) const
 {
-	// ⭐ GridSlots를 직접 참조하여 실제 UI 상태 기반 공간 체크!
-	// HasRoomForItem은 const가 아니므로 직접 구현
-
+	// [Phase C] GridSlots 순회 대신 점유 비트셋 first-fit (GridSlot 점유와 SetOccupiedBits가 항상 같이 갱신됨)
 	const FInv_GridFragment* GridFragment = Manifest.GetFragmentOfType<FInv_GridFragment>();
 	if (!GridFragment) return false;
 
-	FIntPoint ItemSize = GridFragment->GetGridSize();
-
-#if INV_DEBUG_WIDGET
-	UE_LOG(LogTemp, Warning, TEXT("[ACTUAL GRID CHECK] 아이템 크기: %dx%d"), ItemSize.X, ItemSize.Y);
-	UE_LOG(LogTemp, Warning, TEXT("[ACTUAL GRID CHECK] Grid 크기: %dx%d"), Columns, Rows);
-#endif
-
-	if (Columns <= 0) return false;
-
-	// 실제 GridSlots 순회 (UI의 정확한 상태!)
-	for (int32 StartIndex = 0; StartIndex < GridSlots.Num(); ++StartIndex)
-	{
-		// 그리드 범위 체크
-		int32 StartX = StartIndex % Columns;
-		int32 StartY = StartIndex / Columns;
-
-		// 아이템이 그리드를 벗어나는지 확인
-		if (StartX + ItemSize.X > Columns || StartY + ItemSize.Y > Rows)
-		{
-			continue; // 범위 밖이면 스킵
-		}
-
-		// 해당 위치에서 ItemSize 크기만큼의 공간이 비어있는지 체크
-		bool bCanFit = true;
-
-		for (int32 Y = 0; Y < ItemSize.Y; ++Y)
-		{
-			for (int32 X = 0; X < ItemSize.X; ++X)
-			{
-				int32 CheckIndex = (StartY + Y) * Columns + (StartX + X);
-
-				if (CheckIndex >= GridSlots.Num())
-				{
-					bCanFit = false;
-					break;
-				}
+	const FIntPoint ItemSize = GridFragment->GetGridSize();
+	const int32 FoundIndex = OccupancyModel.FindFirstFit(0, ItemSize);
 
-				UInv_GridSlot* CheckSlot = GridSlots[CheckIndex];
-				if (!IsValid(CheckSlot) || CheckSlot->GetInventoryItem().IsValid())
-				{
-					// 슬롯이 유효하지 않거나 이미 아이템이 있으면 실패
-					bCanFit = false;
-					break;
-				}
-			}
-
-			if (!bCanFit) break;
-		}
-
-		if (bCanFit)
-		{
 #if INV_DEBUG_WIDGET
-			UE_LOG(LogTemp, Warning, TEXT("[ACTUAL GRID CHECK] ✅ 공간 발견! [%d, %d]부터 %dx%d"),
-				StartX, StartY, ItemSize.X, ItemSize.Y);
+	UE_LOG(LogTemp, Warning, TEXT("[ACTUAL GRID CHECK] 아이템 크기: %dx%d | Grid 크기: %dx%d | 결과: %d"),
+		ItemSize.X, ItemSize.Y, Columns, Rows, FoundIndex);
 #endif
-			return true; // 공간 발견!
-		}
-	}
 
-#if INV_DEBUG_WIDGET
-	UE_LOG(LogTemp, Warning, TEXT("[ACTUAL GRID CHECK] ❌ 공간 없음!"));
-#endif
-	return false; // 공간 없음
+	return FoundIndex != INDEX_NONE;
 }
 
 // ============================================
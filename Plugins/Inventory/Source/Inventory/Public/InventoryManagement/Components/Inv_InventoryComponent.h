@@ -20,6 +20,7 @@ class AInv_EquipActor;
 class UInv_LootContainerComponent;
 struct FInv_ItemManifest;
 struct FInv_PlayerSaveData;
+class FInv_GridModel;
 
 // RPC 파라미터 인덱스 상한 (Validate에서 값 타입 검증용)
 namespace InvValidation
@@ -45,6 +46,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FItemEquipStatusChanged, UInv_Inven
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInventoryMenuToggled, bool, bOpen);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMaterialStacksChanged, const FGameplayTag&, MaterialTag); // Building 시스템용
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FWeaponAttachmentVisualChanged, AInv_EquipActor*, EquipActor); // 부착물 시각 변경 → HandWeapon 전파용
+DECLARE_MULTICAST_DELEGATE_OneParam(FInv_MaterialCountsChanged, const TSet<FGameplayTag>& /*ChangedTags*/); // [MaterialCountCacheV1] 프레임당 1회 합산 통지
 
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent), Blueprintable ) // Blueprintable : 블루프린트에서 상속
 class INVENTORY_API UInv_InventoryComponent : public UActorComponent
@@ -118,8 +120,17 @@ public:
 	void Multicast_ConsumeMaterialsUI(const FGameplayTag& MaterialTag, int32 Amount);
 
 	// 같은 타입의 모든 스택 개수 합산 (Building UI용)
+	// [MaterialCountCacheV1] FastArray 타입별 스택 합계 캐시 조회 — O(1), 스택 순회 없음
 	UFUNCTION(BlueprintCallable, Category = "인벤토리", meta = (DisplayName = "총 재료 수량 가져오기"))
 	int32 GetTotalMaterialCount(const FGameplayTag& MaterialTag) const;
+
+	// ⭐ [SERVER-ONLY] InventoryList 전체 순회 합산 — 캐시를 거치지 않는 권위 있는 수량
+	// 재료 검증/소비 판정(치트 방지, 수리)은 이것을 사용. UI는 GetTotalMaterialCount
+	int32 GetAuthoritativeMaterialCount(const FGameplayTag& MaterialTag) const;
+
+	// [MaterialCountCacheV1] 타입 합계가 바뀐 태그 기록 → 다음 틱에 OnMaterialCountsChanged 1회 발송
+	// InventoryList(FastArray)의 타입 인덱스가 호출. 서버/클라이언트 공통
+	void MarkMaterialCountDirty(const FGameplayTag& ItemType);
 	
 	UFUNCTION(Server, Reliable, WithValidation) // 신뢰하는 것? 서버에 전달하는 것?
 	void Server_EquipSlotClicked(UInv_InventoryItem* ItemToEquip, UInv_InventoryItem* ItemToUnequip, int32 WeaponSlotIndex = -1);
@@ -281,6 +292,11 @@ public:
 	FInventoryMenuToggled OnInventoryMenuToggled;
 	FMaterialStacksChanged OnMaterialStacksChanged; // Building 시스템용
 
+	// [MaterialCountCacheV1] 재료 수량 변경 통지 (합계가 바뀐 태그만, 한 프레임 변경분을 모아서 1회)
+	// 크래프팅/건설 UI는 OnItemAdded/OnItemRemoved/OnStackChange 대신 이것만 구독하고,
+	// 자기가 쓰는 태그가 ChangedTags에 있을 때만 GetTotalMaterialCount로 다시 읽는다
+	FInv_MaterialCountsChanged OnMaterialCountsChanged;
+
 	// ════════════════════════════════════════════════════════════════
 	// 부착물 시각 변경 델리게이트 (무기가 장착 중일 때 부착물 장착/분리 시 발동)
 	// WeaponBridgeComponent가 구독하여 HandWeapon에 Multicast 전파
@@ -309,15 +325,22 @@ private:
 	// ⭐ Blueprint Widget의 Grid 크기를 Component 설정으로 동기화
 	void SyncGridSizesFromWidget();
 
-	// TODO [Phase C] GridModel 도입 시 이 함수 제거 → GridModel.HasRoom()으로 통합
-	// 현재는 서버에 GridSlot(UI)이 없어서 별도 구현한 중복 로직
 	// ⭐ 서버 전용: InventoryList 기반 공간 체크 (UI 없이 작동!)
+	// [Phase C] 위젯 Grid 대신 FInv_GridModel 비트셋으로 판정 (위젯과 같은 first-fit 순서)
 	bool HasRoomInInventoryList(const FInv_ItemManifest& Manifest) const;
+
+	// [Phase C] InventoryList의 현재 배치를 카테고리별 점유 비트셋으로 구성 (여러 아이템 연속 배치 검사용)
+	void BuildGridModelFromInventoryList(FInv_GridModel& OutModel) const;
 	bool ApplyItemGridPositionSync(UInv_InventoryItem* Item, int32 GridIndex, uint8 GridCategory, bool bRotated);
 
 	// ⭐ [SERVER-ONLY] 서버의 InventoryList를 기준으로 실제 재료 보유 여부를 확인합니다.
 	bool HasRequiredMaterialsOnServer(const FGameplayTag& MaterialTag, int32 RequiredAmount) const;
 
+	// [MaterialCountCacheV1] 이번 프레임에 합계가 바뀐 태그 (다음 틱에 일괄 발송 후 비움)
+	TSet<FGameplayTag> PendingMaterialCountTags;
+	bool bMaterialCountFlushScheduled = false;
+	void FlushMaterialCountChanges();
+
 	/**
 	 * 리슨서버 호스트 또는 스탠드얼론인지 확인
 	 *
@@ -65,6 +65,26 @@ private:
 	// R키 아이템 회전 상태 (90도 회전 여부)
 	UPROPERTY()
 	bool bRotated = false;
+
+	// ⭐ [ItemTypeIndexV2] 타입 인덱스 슬롯 ID (INDEX_NONE = 미색인)
+	// 복제하지 않음 — 서버/클라이언트가 각자 부여. Entries 위치와 무관하므로 RemoveAt/RemoveAtSwap 후에도 유지됨
+	int32 TypeIndexSlot = INDEX_NONE;
+};
+
+// ⭐ [ItemTypeIndexV2] 타입 인덱스 슬롯 (Entry 1개당 1개, 슬롯 ID로 재사용)
+struct FInv_ItemTypeIndexSlot
+{
+	FGameplayTag ItemType;
+	TWeakObjectPtr<UInv_InventoryItem> Item;
+	int32 StackCount = 0;    // 마지막으로 반영한 스택 수 (합계 차분 계산용)
+	int32 BucketPos = INDEX_NONE; // FInv_ItemTypeBucket::Slots 안의 위치 (INDEX_NONE = 빈 슬롯)
+};
+
+// ⭐ [ItemTypeIndexV2] 아이템 타입별 버킷 (슬롯 목록 + 스택 합계)
+struct FInv_ItemTypeBucket
+{
+	TArray<int32> Slots;
+	int32 TotalStackCount = 0;
 };
 
 /* List of inventory Items 
@@ -76,6 +96,7 @@ struct FInv_InventoryFastArray : public FFastArraySerializer
 
 	FInv_InventoryFastArray() : OwnerComponent(nullptr) {}
 	FInv_InventoryFastArray(UActorComponent* InOwnerComponent) : OwnerComponent(InOwnerComponent) {}
+	INVENTORY_API ~FInv_InventoryFastArray(); // ⭐ [ItemTypeIndexV2] 색인된 아이템의 역참조 해제
 
 	//유틸리티 함수 구현
 	TArray<UInv_InventoryItem*> GetAllItems() const; // 아이템 정보 얻어오기
@@ -100,17 +121,46 @@ struct FInv_InventoryFastArray : public FFastArraySerializer
 	INVENTORY_API void ClearAllEntries(); // [Phase22] 외부 모듈에서 부활 시 인벤 클리어 호출
 	UInv_InventoryItem* FindFirstItemByType(const FGameplayTag& ItemType);
 
-	// ⭐ [최적화 #4] 아이템 타입별 개수 조회 (O(1) 해시 조회)
+	// ⭐ [최적화 #4] 아이템 타입별 Entry 개수 조회 (O(1) 해시 조회)
 	int32 GetTotalCountByType(const FGameplayTag& ItemType) const;
 
-private:
-	// TODO [Phase C] GridModel 도입 시 이 멤버를 GridModel로 이관 검토
-	// ⭐ [최적화 #4] 아이템 타입별 인덱스 캐시 (O(n) 선형 탐색 → O(1) 해시 조회)
-	// Key = ItemType GameplayTag, Value = Entries 배열 인덱스
-	// AddEntry/RemoveEntry 시 재구축
-	TMultiMap<FGameplayTag, int32> ItemTypeIndex;
+	// ⭐ [ItemTypeIndexV2] 아이템 타입별 스택 합계 조회 (O(1), 스택 순회 없음)
+	int32 GetTotalStackCountByType(const FGameplayTag& ItemType) const;
+
+	// ⭐ [ItemTypeIndexV2] FFastArraySerializer::MarkItemDirty 가림 — dirty 표시와 함께 타입 인덱스 갱신
+	// 서버에서 스택 수/부착 상태를 바꾼 뒤에는 항상 MarkItemDirty를 호출하므로 여기서 합계를 맞춘다
+	void MarkItemDirty(FInv_InventoryEntry& Entry)
+	{
+		FFastArraySerializer::MarkItemDirty(Entry);
+		RefreshIndexedEntry(Entry);
+	}
+
+	// ⭐ [ItemTypeIndexV2] 색인된 아이템의 스택 수 변경 반영 (UInv_InventoryItem::SetTotalStackCount / OnRep에서 호출)
+	void RefreshIndexedItemStack(const UInv_InventoryItem* Item);
 
-	// ⭐ [최적화 #4] 아이템 타입 인덱스 재구축
+private:
+	// ⭐ [ItemTypeIndexV2] 아이템 타입별 인덱스 (증분 유지)
+	// Key = ItemType GameplayTag, Value = 슬롯 ID 목록 + 스택 합계
+	// Entry는 TypeIndexSlot으로 슬롯을 가리키므로 Entries 인덱스가 밀려도 보정할 필요 없음
+	// 제거는 버킷 안에서 RemoveAtSwap + BucketPos 보정 → O(1)
+	TMap<FGameplayTag, FInv_ItemTypeBucket> ItemTypeIndex;
+	TArray<FInv_ItemTypeIndexSlot> IndexSlots;
+	TArray<int32> FreeIndexSlots;
+
+	// ⭐ [ItemTypeIndexV2] Entry 1개 색인/해제/재평가 (O(1))
+	// 색인 조건: 유효한 Item + 무기 부착 상태 아님 (부착물은 재료 소비 대상에서 제외)
+	void IndexEntry(FInv_InventoryEntry& Entry);
+	void UnindexEntry(FInv_InventoryEntry& Entry);
+	void RefreshIndexedEntry(FInv_InventoryEntry& Entry);
+	void ApplyIndexedStackCount(int32 SlotId, int32 NewStackCount);
+
+	// ⭐ [ItemTypeIndexV2] 색인된 아이템의 TypeIndexOwner 역참조 해제 (재구축/소멸 전)
+	void ReleaseIndexedItems();
+
+	// ⭐ [MaterialCountCacheV1] 타입 합계 변경 → 소유 InventoryComponent에 dirty 태그 전달 (컨테이너는 무시)
+	void NotifyTypeTotalChanged(const FGameplayTag& ItemType) const;
+
+	// ⭐ [최적화 #4] 아이템 타입 인덱스 전체 재구축 (일괄 변경/ClearAllEntries 전용)
 	void RebuildItemTypeIndex();
 	friend UInv_InventoryComponent;
 	friend UInv_LootContainerComponent; // ⭐ [Phase 9] 컨테이너 Entries 접근용
@@ -0,0 +1,119 @@
+// Gihyeon's Inventory Project
+
+// ════════════════════════════════════════════════════════════════════════
+// FInv_GridModel — 위젯 없는 그리드 점유 모델 (서버 + 클라 공용)
+// ════════════════════════════════════════════════════════════════════════
+// [Phase C - 데이터/뷰 분리] 1단계
+//
+// 카테고리(장비/소모품/재료)마다 점유 비트셋 1개.
+//   - 행 단위로 64비트 워드에 패킹 (Columns <= 64면 행당 워드 1개)
+//   - 영역 검사 = 행 수 x 워드 수 만큼의 AND 연산 (GridSlot 순회 없음)
+//   - first-fit = 행 h개를 OR로 합친 뒤 연속 빈 칸 w개를 비트 시프트로 탐색
+//
+// 사용처:
+//   - UInv_InventoryComponent::HasRoomInInventoryList (서버, UI 없음)
+//   - UInv_InventoryGrid (위젯 — 기존 OccupiedMask 대체)
+//
+// Slate/UObject 의존 없음 → 자동화 테스트에서 단독 검증 가능
+// (Private/InventoryManagement/GridModel/Tests/Inv_GridModel.spec.cpp)
+// ════════════════════════════════════════════════════════════════════════
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class INVENTORY_API FInv_GridModel
+{
+public:
+	/** EInv_ItemCategory의 그리드 카테고리 수 (Equippable / Consumable / Craftable) */
+	static constexpr int32 NumItemCategories = 3;
+
+	FInv_GridModel() = default;
+	FInv_GridModel(int32 InColumns, int32 InRows, int32 InNumCategories = NumItemCategories)
+	{
+		Init(InColumns, InRows, InNumCategories);
+	}
+
+	/** 크기 설정 + 전체 비점유로 초기화 */
+	void Init(int32 InColumns, int32 InRows, int32 InNumCategories = NumItemCategories);
+
+	/** 크기 유지, 모든 카테고리 비점유 */
+	void Reset();
+
+	int32 GetColumns() const { return Columns; }
+	int32 GetRows() const { return Rows; }
+	int32 GetNumCells() const { return Columns * Rows; }
+	int32 GetNumCategories() const { return Categories.Num(); }
+	bool IsValidCategory(int32 Category) const { return Categories.IsValidIndex(Category); }
+
+	/** 회전(90도) 적용된 실효 크기 */
+	static FIntPoint GetEffectiveSize(const FIntPoint& Size, bool bRotated)
+	{
+		return bRotated ? FIntPoint(Size.Y, Size.X) : Size;
+	}
+
+	bool IsInBounds(const FIntPoint& Position, const FIntPoint& Size) const;
+
+	/** 단일 칸 점유 여부 (범위 밖 = true) */
+	bool IsCellOccupied(int32 Category, int32 Index) const;
+
+	/** 영역 전체가 범위 안 + 비점유인지 */
+	bool IsAreaFree(int32 Category, const FIntPoint& Position, const FIntPoint& Size) const;
+	bool IsAreaFree(int32 Category, int32 Index, const FIntPoint& Size) const
+	{
+		return Columns > 0 && Index >= 0 && IsAreaFree(Category, IndexToPosition(Index), Size);
+	}
+
+	/** 영역 점유/해제 (범위 밖 칸은 무시) */
+	void SetArea(int32 Category, const FIntPoint& Position, const FIntPoint& Size, bool bOccupied);
+	void SetArea(int32 Category, int32 Index, const FIntPoint& Size, bool bOccupied)
+	{
+		if (Columns > 0 && Index >= 0)
+		{
+			SetArea(Category, IndexToPosition(Index), Size, bOccupied);
+		}
+	}
+
+	/** 비어 있으면 점유하고 true, 아니면 그대로 false */
+	bool TryPlace(int32 Category, int32 Index, const FIntPoint& Size);
+
+	/**
+	 * first-fit (행 우선, 인덱스 오름차순 — 위젯 HasRoomForItem과 동일 순서).
+	 * bAllowRotation이면 원래 방향으로 자리가 없을 때 회전 방향으로 재시도.
+	 * @return 시작 인덱스, 없으면 INDEX_NONE
+	 */
+	int32 FindFirstFit(int32 Category, const FIntPoint& Size, bool bAllowRotation, bool& bOutRotated) const;
+	int32 FindFirstFit(int32 Category, const FIntPoint& Size) const
+	{
+		bool bRotated = false;
+		return FindFirstFit(Category, Size, false, bRotated);
+	}
+
+	/** first-fit 자리를 찾아 점유. @return 시작 인덱스, 없으면 INDEX_NONE */
+	int32 PlaceFirstFit(int32 Category, const FIntPoint& Size, bool bAllowRotation, bool& bOutRotated);
+
+	bool HasRoom(int32 Category, const FIntPoint& Size, bool bAllowRotation = false) const
+	{
+		bool bRotated = false;
+		return FindFirstFit(Category, Size, bAllowRotation, bRotated) != INDEX_NONE;
+	}
+
+	/** 점유 칸 수 (디버그/테스트용) */
+	int32 GetNumOccupied(int32 Category) const;
+
+	int32 PositionToIndex(const FIntPoint& Position) const { return Position.Y * Columns + Position.X; }
+	FIntPoint IndexToPosition(int32 Index) const { return FIntPoint(Index % Columns, Index / Columns); }
+
+private:
+	int32 Columns = 0;
+	int32 Rows = 0;
+	int32 WordsPerRow = 0;
+
+	/** 카테고리별 행 우선 비트셋 — Row * WordsPerRow + (Col / 64) 워드의 (Col % 64) 비트 */
+	TArray<TArray<uint64>> Categories;
+
+	/** [X, X + Width) 구간 중 워드 WordIdx에 걸친 비트 마스크 */
+	static uint64 MakeSpanMask(int32 WordIdx, int32 X, int32 Width);
+
+	int32 FindFirstFitUnrotated(int32 Category, const FIntPoint& Size) const;
+};
@@ -7,6 +7,8 @@
 #include "Items/Manifest/Inv_ItemManifest.h"
 #include "Inv_InventoryItem.generated.h"
 
+struct FInv_InventoryFastArray;
+
 /**
  * 
  */
@@ -31,7 +33,7 @@ public:
 	int32 GetAttachmentSlotCount() const; // 부착물 슬롯 개수
 	bool IsAttachableItem() const;      // 이 아이템이 부착물인지
 	int32 GetTotalStackCount() const { return TotalStackCount; } // 총 스택 수 가져오기
-	void SetTotalStackCount(int32 Count); // 총 스택 수 설정 (MaxStackSize 검증 포함)
+	void SetTotalStackCount(int32 Count); // 총 스택 수 설정 (MaxStackSize 검증 포함, ⭐ 타입 인덱스 합계도 갱신)
 
 	// ⭐ Grid 위치 정보 (서버에서 클라이언트로 동기화됨!)
 	FIntPoint GetGridPosition() const { return GridPosition; }
@@ -42,9 +44,19 @@ private: //이 부분 GPT 돌려보자 항목 복제해서 서버에 전달하
 	UPROPERTY(VisibleAnywhere, meta = (BaseStruct = "/Script/Inventory.Inv_ItemManifest", DisplayName = "아이템 매니페스트", Tooltip = "이 인벤토리 아이템의 매니페스트 데이터. 모든 프래그먼트 정보를 포함합니다."), Replicated) //인벤토리 아이템 블루프린트 만드는 곳? 파생?
 	FInstancedStruct ItemManifest; // instance struct? 이게 뭔데?
 	
-	UPROPERTY(Replicated) // 이 아이템의 총 스택 수 Replicated 뜻이 뭘까?
+	UPROPERTY(ReplicatedUsing = OnRep_TotalStackCount) // 이 아이템의 총 스택 수 Replicated 뜻이 뭘까?
 	int32 TotalStackCount{ 0 };
 
+	// ⭐ [ItemTypeIndexV2] 클라이언트 — 스택 수는 Entry 변경 없이 서브오브젝트로만 복제되므로 여기서 타입 합계 갱신
+	UFUNCTION()
+	void OnRep_TotalStackCount();
+
+	// ⭐ [ItemTypeIndexV2] 이 아이템을 색인한 FastArray + 슬롯 ID (복제 안 함, FastArray가 색인/해제 시 설정)
+	// SetTotalStackCount/OnRep에서 스택 합계를 바로 맞추기 위한 역참조 — MarkItemDirty 누락 호출부 대비
+	FInv_InventoryFastArray* TypeIndexOwner = nullptr;
+	int32 TypeIndexSlot = INDEX_NONE;
+	friend struct FInv_InventoryFastArray;
+
 	// ⭐ Grid 위치 (서버→클라이언트 동기화! 실제 위치 저장!)
 	UPROPERTY(Replicated)
 	FIntPoint GridPosition{ -1, -1 };  // {-1, -1} = 아직 Grid에 배치 안 됨
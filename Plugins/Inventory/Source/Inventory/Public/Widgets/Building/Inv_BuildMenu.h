@@ -168,8 +168,8 @@ private:
 	void DistributeBuildingButtonsToWrapBoxes();
 
 	// === [최적화] 인벤토리 델리게이트 일괄 관리 ===
-	// BuildMenu에서 1번만 바인딩 → 모든 BuildingButton 일괄 업데이트
-	// (개별 BuildingButton이 각각 바인딩하면 N*3회 인벤토리 순회 발생)
+	// BuildMenu에서 1번만 바인딩 → 바뀐 재료를 쓰는 BuildingButton만 업데이트
+	// [MaterialCountCacheV1] 재료 수량 통지(프레임당 1회) 1개만 구독, 수량은 타입 합계 캐시 O(1) 조회
 
 	void BindInventoryDelegates();
 	void UnbindInventoryDelegates();
@@ -177,14 +177,9 @@ private:
 	// 모든 BuildingButton의 재료 UI + 버튼 상태 일괄 업데이트
 	void RefreshAllBuildingButtons();
 
-	UFUNCTION()
-	void OnInventoryChanged_ItemAdded(UInv_InventoryItem* Item, int32 EntryIndex);
-
-	UFUNCTION()
-	void OnInventoryChanged_ItemRemoved(UInv_InventoryItem* Item, int32 EntryIndex);
-
-	UFUNCTION()
-	void OnInventoryChanged_StackChanged(const FInv_SlotAvailabilityResult& Result);
+	// [MaterialCountCacheV1] 합계가 바뀐 재료 태그 목록 (프레임당 1회)
+	void OnMaterialCountsChanged(const TSet<FGameplayTag>& ChangedTags);
+	FDelegateHandle MaterialCountsChangedHandle;
 
 	// 수집된 BuildingButton 배열 (일괄 업데이트용)
 	UPROPERTY()
@@ -28,8 +28,7 @@
 // [동작]
 // 1. 쿨다운 체크 (연타 방지)
 // 2. HasRequiredMaterials() - 로컬에서 재료 충분한지 체크
-//    └─> InventoryList.GetAllItems() 순회
-//    └─> GameplayTag가 일치하는 Craftable 아이템의 TotalStackCount 합산
+//    └─> InvComp->GetTotalMaterialCount(Tag) — 타입별 스택 합계 캐시 조회 (순회 없음)
 //    └─> 예) GameItems.Craftables.FireFernFruit 개수 확인
 // 3. ConsumeMaterials() 호출 → [2단계]로 이동
 //
@@ -113,20 +112,18 @@
 //    └─> GridSlot 상태 초기화
 //
 // ================================================================================================
-// [6단계] 클라이언트 - CraftingButton UI 업데이트 (OnInventoryStackChanged)
+// [6단계] 클라이언트 - CraftingButton UI 업데이트 (OnMaterialCountsChanged)
 // ================================================================================================
 //
-// 📍 위치: Inv_CraftingButton.cpp::OnInventoryStackChanged()
+// 📍 위치: Inv_CraftingButton.cpp::OnMaterialCountsChanged()
 // 🎯 실행 환경: 클라이언트
 //
-// [동작]
-// 1. OnStackChange 델리게이트 수신
-// 2. UpdateMaterialUI() 호출
-//    └─> 인벤토리에서 현재 재료 개수 다시 조회
-//    └─> Text_Material1Amount 텍스트 업데이트 (예: "20/10" → "8/10")
-// 3. UpdateButtonState() 호출
-//    └─> HasRequiredMaterials() 재검사
-//    └─> 재료 부족 시 버튼 비활성화
+// [동작] [MaterialCountCacheV1]
+// 1. FastArray 타입 인덱스가 합계 변경 태그를 InventoryComponent에 기록
+// 2. 다음 틱에 OnMaterialCountsChanged(ChangedTags) 1회 발송 (같은 프레임 변경은 합쳐짐)
+// 3. 이 버튼이 쓰는 태그가 ChangedTags에 있을 때만:
+//    └─> UpdateMaterialUI() — GetTotalMaterialCount(Tag) O(1) 조회로 텍스트 갱신 (예: "20/10" → "8/10")
+//    └─> UpdateButtonState() — 재료 부족 시 버튼 비활성화
 //
 // ================================================================================================
 // [핵심 개념 정리]
@@ -148,7 +145,7 @@
 // - FastArray 리플리케이션으로 클라이언트에 자동 동기화
 //
 // 📌 UI 업데이트는 델리게이트로 자동화
-// - OnStackChange 델리게이트를 구독하면 자동으로 알림 받음
+// - OnMaterialCountsChanged 델리게이트를 구독하면 프레임당 1회, 바뀐 태그만 알림 받음
 // - 수동으로 Multicast RPC 호출 금지 (이중 차감 방지)
 //
 // ================================================================================================
@@ -165,6 +162,7 @@ class UImage;
 class UTextBlock;
 class UHorizontalBox;
 class UInv_InventoryItem;
+class UInv_InventoryComponent;
 class UInv_InfoMessage;  // ⭐ 메시지 위젯
 
 /**
@@ -209,19 +207,16 @@ private:
 	void BindInventoryDelegates();
 	void UnbindInventoryDelegates();
 
-	// 인벤토리 변경 시 호출될 콜백 함수들
-	UFUNCTION()
-	void OnInventoryItemAdded(UInv_InventoryItem* Item, int32 EntryIndex);
-
-	UFUNCTION()
-	void OnInventoryItemRemoved(UInv_InventoryItem* Item, int32 EntryIndex);
+	// ⭐ [MaterialCountCacheV1] 재료 수량 변경 콜백 (프레임당 1회, 바뀐 태그 목록)
+	// 기존 OnItemAdded/OnItemRemoved/OnStackChange/OnMaterialStacksChanged 4중 구독 대체
+	void OnMaterialCountsChanged(const TSet<FGameplayTag>& ChangedTags);
 
-	UFUNCTION()
-	void OnInventoryStackChanged(const FInv_SlotAvailabilityResult& Result);
+	// 이 버튼이 해당 재료를 사용하는지
+	bool UsesMaterial(const FGameplayTag& MaterialTag) const;
 
-	// ⭐ Tag 기반 재료 변경 콜백 (Dangling Pointer 방지!)
-	UFUNCTION()
-	void OnMaterialStacksChanged(const FGameplayTag& MaterialTag);
+	// 바인딩한 InventoryComponent + 핸들 (Native 델리게이트 해제용)
+	TWeakObjectPtr<UInv_InventoryComponent> BoundInventoryComponent;
+	FDelegateHandle MaterialCountsChangedHandle;
 
 	// === 블루프린트에서 바인딩할 위젯들 (meta = (BindWidget)) ===
 	
@@ -16,6 +16,7 @@ class UWidgetSwitcher;
 class UScrollBox;
 class UButton;
 class UInv_InventoryItem;
+class UInv_InventoryComponent;
 class UInv_TabbedCraftingEntry;
 struct FInv_SlotAvailabilityResult;
 
@@ -73,16 +74,15 @@ private:
 	void PopulateCraftingEntries();
 	void PopulateScrollBox(UScrollBox* TargetBox, const TArray<FInv_CraftingRecipe>& Recipes);
 
-	// === 델리게이트 콜백 (인벤토리 변경 시 전체 엔트리 UI 갱신) ===
+	// === 델리게이트 콜백 (재료 수량 변경 시 해당 재료를 쓰는 엔트리만 갱신) ===
 	void BindInventoryDelegates();
 	void UnbindInventoryDelegates();
 
-	UFUNCTION()
-	void OnInventoryChanged(UInv_InventoryItem* Item, int32 EntryIndex);
-	UFUNCTION()
-	void OnStackChanged(const FInv_SlotAvailabilityResult& Result);
-	UFUNCTION()
-	void OnMaterialChanged(const FGameplayTag& MaterialTag);
+	// [MaterialCountCacheV1] 프레임당 1회, 합계가 바뀐 태그 목록
+	void OnMaterialCountsChanged(const TSet<FGameplayTag>& ChangedTags);
+
+	TWeakObjectPtr<UInv_InventoryComponent> BoundInventoryComponent;
+	FDelegateHandle MaterialCountsChangedHandle;
 
 	void RefreshAllEntryUI();
 
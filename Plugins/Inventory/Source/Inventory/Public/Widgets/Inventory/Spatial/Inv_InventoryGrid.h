@@ -4,7 +4,7 @@
 #include "Blueprint/UserWidget.h"
 #include "Types/Inv_GridTypes.h"
 #include "Player/Inv_PlayerController.h"
-#include "Containers/BitArray.h"
+#include "InventoryManagement/GridModel/Inv_GridModel.h"
 
 #include "Inv_InventoryGrid.generated.h"
 
@@ -54,8 +54,8 @@ enum class EGridOwnerType : uint8
 // 현재 이 클래스가 UI(위젯)와 데이터(점유 판단)를 모두 담당하고 있음.
 // 상용화 시 아래 작업 필요:
 //
-// 1. GridModel 클래스 신설 (UObject, 서버+클라 공유)
-//    - OccupiedMask (비트마스크) → 이미 구현됨, 여기서 이관
+// 1. GridModel 클래스 신설 (서버+클라 공유)
+//    - OccupiedMask (비트마스크) → ✅ FInv_GridModel로 이관 완료 (OccupancyModel)
 //    - ItemTypeIndex (타입별 인덱스) → FastArray에서 이관
 //    - HasRoom(), FindSpace(), PlaceItem(), RemoveItem()
 //
@@ -524,9 +524,9 @@ private:
 	// ⭐ [최적화 #6] SlottedItem을 풀에 반환 (RemoveFromParent 후 보관)
 	void ReleaseSlottedItem(UInv_SlottedItem* SlottedItem);
 
-	// ⭐ [최적화 #5] 비트마스크 점유 맵 (O(n) GridSlot 순회 → O(1) 비트 검사)
-	// Index = Row * Columns + Col, true = 점유됨
-	TBitArray<> OccupiedMask;
+	// ⭐ [최적화 #5] 비트마스크 점유 맵 (O(n) GridSlot 순회 → 행당 64비트 워드 검사)
+	// [Phase C] 위젯 전용 TBitArray → 서버와 공유하는 FInv_GridModel (이 Grid는 카테고리 1개만 사용)
+	FInv_GridModel OccupancyModel;
 
 	// ⭐ [최적화 #5] 비트마스크 점유 상태 일괄 설정
 	void SetOccupiedBits(int32 StartIndex, const FIntPoint& Dimensions, bool bOccupied);
@@ -11,11 +11,14 @@
 #include "Net/UnrealNetwork.h"
 #include "Interface/MDF_GameStateInterface.h"
 #include "GameFramework/GameStateBase.h"
+#include "Async/ParallelFor.h"
 
 // 다이나믹 메시 관련 헤더
 #include "Components/DynamicMeshComponent.h"
 #include "UDynamicMesh.h"
 #include "DynamicMesh/DynamicMesh3.h"
+#include "DynamicMesh/MeshNormals.h"
+#include "DynamicMesh/MeshTangents.h"
 #include "GeometryScript/MeshAssetFunctions.h"
 #include "GeometryScript/MeshNormalsFunctions.h"
 #include "GeometryScript/MeshVertexColorFunctions.h"
@@ -32,6 +35,38 @@
 // FFastArraySerializer 관련
 #include "Net/Serialization/FastArraySerializer.h"
 
+// ---------------------------------------------------------------------------
+// [Lag-Fix13] 병렬 변형 계산용 내부 구조체
+// ---------------------------------------------------------------------------
+namespace
+{
+    /** 후보 정점 수가 이보다 적으면 ParallelFor 태스크 분배 비용이 더 커서 단일 스레드로 처리 */
+    constexpr int32 MDFParallelMinVertices = 512;
+
+    /** 히트 1개의 변형 상수 (배치 시작 시 1회 계산, 워커 스레드에서 읽기 전용) */
+    struct FMDFHitParams
+    {
+        FVector3d Location = FVector3d::ZeroVector;
+        FVector3d LocalDirection = FVector3d::ZeroVector;
+        FVector3d BulletDir = FVector3d::ZeroVector;
+        float DamageFactor = 0.f;
+        float Strength = 0.f;
+        float DamageTypeEncoded = 0.f;
+    };
+
+    /** 후보 정점 1개의 계산 결과 (워커 스레드가 자기 슬롯에만 기록) */
+    struct FMDFVertexDeformResult
+    {
+        FVector3d NewPosition = FVector3d::ZeroVector;
+        double MinDistSq = DBL_MAX;
+        double OffsetLength = 0.0;
+        float MaxDamageIntensity = 0.f;
+        float DamageTypeEncoded = 0.f;
+        int32 RimHitCount = 0;
+        bool bModified = false;
+    };
+}
+
 // ---------------------------------------------------------------------------
 // FFastArraySerializer 콜백 구현
 // ---------------------------------------------------------------------------
@@ -518,30 +553,76 @@ void UMDF_DeformableComponent::ApplyDeformationForHits(int32 StartIndex, int32 C
 
     // -------------------------------------------------------------------------
     // [Phase 19] 메쉬 편집 (Vertex 순회) - 개선된 변형 알고리즘
+    // [Lag-Fix13] 버킷 인덱스로 후보 정점만 수집 → ParallelFor로 변위 계산 → 게임 스레드에서 일괄 기록
     // -------------------------------------------------------------------------
     int32 TotalVertexCount = 0;
     const bool bPaintVertexColor = bEnableVisualDamage && !IsRunningDedicatedServer();
+    const bool bCapEnabled = MaxTotalDisplacement > 0.f;
 
 #if MDF_DEBUG_DEFORM
     int32 RimAffectedCount = 0;
     double MaxOffsetMagnitude = 0.0;
     int32 ClampedVertexCount = 0;
     int32 AABBSkippedCount = 0;
+    bool bUsedVertexBuckets = false;
 #endif
 
-    // [Lag-Fix10] 전체 히트의 합산 AABB 계산 — 영역 밖 정점은 즉시 스킵
-    // O(V×H) → O(K×H) 최적화 (K = AABB 내 정점, 보통 V의 5~20%)
+    // [Lag-Fix13] 히트별 상수 미리 계산 — 워커 스레드 정점 루프에서 UClass 조회(IsChildOf) 제거
+    TArray<FMDFHitParams> HitParams;
+    HitParams.Reserve(EndIndex - StartIndex);
+    for (int32 i = StartIndex; i < EndIndex; ++i)
+    {
+        const FMDFHitData& Hit = HitHistoryArray.Items[i];
+        const bool bMelee = Hit.DamageTypeClass && MeleeDamageType && Hit.DamageTypeClass->IsChildOf(MeleeDamageType);
+        const bool bRanged = Hit.DamageTypeClass && RangedDamageType && Hit.DamageTypeClass->IsChildOf(RangedDamageType);
+        const bool bBreach = Hit.DamageTypeClass && BreachDamageType && Hit.DamageTypeClass->IsChildOf(BreachDamageType);
+
+        FMDFHitParams& Params = HitParams.AddDefaulted_GetRef();
+        Params.Location = (FVector3d)Hit.LocalLocation;
+        Params.LocalDirection = (FVector3d)Hit.LocalDirection;
+        Params.BulletDir = Params.LocalDirection.GetSafeNormal();
+
+        // [Phase 19] 로그 스케일 DamageFactor (고데미지 수렴)
+        // 기존 선형(Damage*0.15): D10=1.5, D50=7.5, D100=15.0
+        // 로그 스케일:            D10=0.69, D50=1.79, D100=2.40
+        Params.DamageFactor = FMath::Loge(1.0f + Hit.Damage * 0.1f);
+        Params.Strength = DeformStrength * Params.DamageFactor;
+
+        // 데미지 타입별 가중치 (근접은 더 세게, 원거리는 약하게)
+        if (bMelee)
+            Params.Strength *= 1.5f;
+        else if (bRanged)
+            Params.Strength *= 0.5f;
+
+        // 데미지 타입 인코딩: Ranged=0.0, Melee=0.5, Breach=1.0
+        Params.DamageTypeEncoded = bMelee ? 0.5f : (bBreach ? 1.0f : 0.0f);
+    }
+
+    // [Lag-Fix10] 전체 히트의 합산 AABB 계산 — 버킷 인덱스가 무효일 때(폴백 전체 순회) 사용
     FVector3d HitBoundsMin(DBL_MAX);
     FVector3d HitBoundsMax(-DBL_MAX);
-    for (int32 i = StartIndex; i < EndIndex; ++i)
+    for (const FMDFHitParams& Hit : HitParams)
+    {
+        HitBoundsMin.X = FMath::Min(HitBoundsMin.X, Hit.Location.X - SafeRadius);
+        HitBoundsMin.Y = FMath::Min(HitBoundsMin.Y, Hit.Location.Y - SafeRadius);
+        HitBoundsMin.Z = FMath::Min(HitBoundsMin.Z, Hit.Location.Z - SafeRadius);
+        HitBoundsMax.X = FMath::Max(HitBoundsMax.X, Hit.Location.X + SafeRadius);
+        HitBoundsMax.Y = FMath::Max(HitBoundsMax.Y, Hit.Location.Y + SafeRadius);
+        HitBoundsMax.Z = FMath::Max(HitBoundsMax.Z, Hit.Location.Z + SafeRadius);
+    }
+
+    // [Lag-Fix13] 위치(+클라 비주얼 데미지 시 컬러)만 바뀌는 변형 편집 — GeneralEdit 전체 리빌드 회피
+    // [Lag-Fix14] 클라는 법선/탄젠트도 같은 편집 안에서 재계산 → DeformationEdit 한 번으로 정점 버퍼만 갱신
+    //            (GeometryScript 법선/탄젠트 호출은 각각 GeneralEdit + 프록시 전체 재생성을 유발)
+    const bool bRecomputeShading = !IsRunningDedicatedServer();
+    EDynamicMeshAttributeChangeFlags ChangeFlags = EDynamicMeshAttributeChangeFlags::VertexPositions;
+    if (bPaintVertexColor)
+    {
+        ChangeFlags |= EDynamicMeshAttributeChangeFlags::VertexColors;
+    }
+    if (bRecomputeShading)
     {
-        const FVector3d HitPos = (FVector3d)HitHistoryArray.Items[i].LocalLocation;
-        HitBoundsMin.X = FMath::Min(HitBoundsMin.X, HitPos.X - SafeRadius);
-        HitBoundsMin.Y = FMath::Min(HitBoundsMin.Y, HitPos.Y - SafeRadius);
-        HitBoundsMin.Z = FMath::Min(HitBoundsMin.Z, HitPos.Z - SafeRadius);
-        HitBoundsMax.X = FMath::Max(HitBoundsMax.X, HitPos.X + SafeRadius);
-        HitBoundsMax.Y = FMath::Max(HitBoundsMax.Y, HitPos.Y + SafeRadius);
-        HitBoundsMax.Z = FMath::Max(HitBoundsMax.Z, HitPos.Z + SafeRadius);
+        ChangeFlags |= EDynamicMeshAttributeChangeFlags::NormalsTangents;
     }
 
     // [Fix54] GetDynamicMesh() 로컬 캐시 — 유효성 검사와 사용 사이 파괴 방지
@@ -556,206 +637,281 @@ void UMDF_DeformableComponent::ApplyDeformationForHits(int32 StartIndex, int32 C
             ColorOverlay = EditMesh.Attributes()->PrimaryColors();
         }
 
-        for (int32 VertexID : EditMesh.VertexIndicesItr())
+        TotalVertexCount = EditMesh.VertexCount();
+
+        // ---------------------------------------------------------------
+        // 1) 후보 정점 수집
+        // ---------------------------------------------------------------
+        TArray<int32> CandidateVertices;
+
+        // 인덱스 빌드 이후 토폴로지가 바뀌었으면(MiniGame Boolean 절단 등) VertexID가 달라졌으므로 폴백
+        const bool bBucketsValid = VertexBuckets.Num() > 0
+            && VertexBucketTopologyStamp == EditMesh.GetTopologyChangeStamp()
+            && VertexBucketMaxVertexID == EditMesh.MaxVertexID();
+
+        if (bBucketsValid)
         {
-            TotalVertexCount++;
-            FVector3d VertexPos = EditMesh.GetVertex(VertexID);  // 변형 누적의 기준(현재 위치)
+#if MDF_DEBUG_DEFORM
+            bUsedVertexBuckets = true;
+#endif
+            // 캡 ON: 원본 위치로 판정 → 반경 그대로
+            // 캡 OFF: 현재(변형된) 위치로 판정 → 원본에서 멀어진 최대 거리만큼 조회 반경 확장
+            const double QueryRadius = SafeRadius + (bCapEnabled ? 0.0 : MaxVertexDrift);
+            const double InvCellSize = 1.0 / VertexBucketCellSize;
+            TBitArray<> Visited(false, EditMesh.MaxVertexID());
 
-            // [Phase 20] 누적 캡 활성 여부 + 형상 판정 기준 위치.
-            //  - 캡 OFF(MaxTotalDisplacement<=0) 또는 원본 캐시 없음 → 기존과 동일하게 변형 위치(VertexPos) 사용.
-            //  - 캡 ON → 반경/감쇠/방향을 '원본 위치(SamplePos)' 기준으로 판정 → 같은 자리 연타가
-            //    캡까지 일관 누적되고(변형되어 반경 밖으로 빠지는 현상 제거), 서버/클라 결정적.
-            const bool bHasOrig = OriginalVertexPositions.IsValidIndex(VertexID);
-            const bool bCapActive = (MaxTotalDisplacement > 0.f) && bHasOrig;
-            const FVector3d SamplePos = bCapActive ? (FVector3d)OriginalVertexPositions[VertexID] : VertexPos;
+            for (const FMDFHitParams& Hit : HitParams)
+            {
+                const FIntVector MinCell(
+                    FMath::FloorToInt32((Hit.Location.X - QueryRadius) * InvCellSize),
+                    FMath::FloorToInt32((Hit.Location.Y - QueryRadius) * InvCellSize),
+                    FMath::FloorToInt32((Hit.Location.Z - QueryRadius) * InvCellSize));
+                const FIntVector MaxCell(
+                    FMath::FloorToInt32((Hit.Location.X + QueryRadius) * InvCellSize),
+                    FMath::FloorToInt32((Hit.Location.Y + QueryRadius) * InvCellSize),
+                    FMath::FloorToInt32((Hit.Location.Z + QueryRadius) * InvCellSize));
+
+                for (int32 CX = MinCell.X; CX <= MaxCell.X; ++CX)
+                {
+                    for (int32 CY = MinCell.Y; CY <= MaxCell.Y; ++CY)
+                    {
+                        for (int32 CZ = MinCell.Z; CZ <= MaxCell.Z; ++CZ)
+                        {
+                            const TArray<int32>* Bucket = VertexBuckets.Find(FIntVector(CX, CY, CZ));
+                            if (!Bucket) continue;
 
-            // [Lag-Fix10] AABB 사전 필터링 — 합산 히트 영역 밖 정점 즉시 스킵 (판정 기준 위치 사용)
-            if (SamplePos.X < HitBoundsMin.X || SamplePos.X > HitBoundsMax.X ||
-                SamplePos.Y < HitBoundsMin.Y || SamplePos.Y > HitBoundsMax.Y ||
-                SamplePos.Z < HitBoundsMin.Z || SamplePos.Z > HitBoundsMax.Z)
+                            for (const int32 VertexID : *Bucket)
+                            {
+                                if (Visited[VertexID]) continue;
+                                Visited[VertexID] = true;
+                                CandidateVertices.Add(VertexID);
+                            }
+                        }
+                    }
+                }
+            }
+#if MDF_DEBUG_DEFORM
+            AABBSkippedCount = TotalVertexCount - CandidateVertices.Num();
+#endif
+        }
+        else
+        {
+            for (int32 VertexID : EditMesh.VertexIndicesItr())
             {
+                // [Phase 20] 캡 ON이면 원본 위치 기준 판정 (아래 변위 계산과 동일 기준)
+                const bool bCapActive = bCapEnabled && OriginalVertexPositions.IsValidIndex(VertexID);
+                const FVector3d SamplePos = bCapActive ? (FVector3d)OriginalVertexPositions[VertexID] : EditMesh.GetVertex(VertexID);
+
+                // [Lag-Fix10] AABB 사전 필터링 — 합산 히트 영역 밖 정점 즉시 스킵
+                if (SamplePos.X < HitBoundsMin.X || SamplePos.X > HitBoundsMax.X ||
+                    SamplePos.Y < HitBoundsMin.Y || SamplePos.Y > HitBoundsMax.Y ||
+                    SamplePos.Z < HitBoundsMin.Z || SamplePos.Z > HitBoundsMax.Z)
+                {
 #if MDF_DEBUG_DEFORM
-                AABBSkippedCount++;
+                    AABBSkippedCount++;
 #endif
-                continue;
+                    continue;
+                }
+                CandidateVertices.Add(VertexID);
             }
-            FVector3d TotalOffset(0.0, 0.0, 0.0);
-            bool bModified = false;
+        }
 
-            // [Phase 18] Vertex Color 페인팅 변수
-            float MaxDamageIntensity = 0.0f;
-            float DamageTypeEncoded = 0.0f;
+        // ---------------------------------------------------------------
+        // 2) 변위 계산 — 정점별 독립 (메시/히트는 읽기 전용) → ParallelFor
+        // ---------------------------------------------------------------
+        TArray<FMDFVertexDeformResult> Results;
+        Results.SetNum(CandidateVertices.Num());
 
-            // 새로 추가된 히트 데이터들만 순회하며 오프셋 누적
-            for (int32 i = StartIndex; i < EndIndex; ++i)
-            {
-                const FMDFHitData& Hit = HitHistoryArray.Items[i];
+        const UE::Geometry::FDynamicMesh3& ReadMesh = EditMesh;
+        ParallelFor(CandidateVertices.Num(), [&](int32 Index)
+        {
+            FMDFVertexDeformResult& Out = Results[Index];
+            const int32 VertexID = CandidateVertices[Index];
+            const FVector3d VertexPos = ReadMesh.GetVertex(VertexID);  // 변형 누적의 기준(현재 위치)
 
-                double DistSq = FVector3d::DistSquared(SamplePos, (FVector3d)Hit.LocalLocation);
+            // [Phase 20] 누적 캡 활성 여부 + 형상 판정 기준 위치.
+            //  - 캡 OFF(MaxTotalDisplacement<=0) 또는 원본 캐시 없음 → 변형 위치(VertexPos) 사용.
+            //  - 캡 ON → 반경/감쇠/방향을 '원본 위치(SamplePos)' 기준으로 판정 → 같은 자리 연타가
+            //    캡까지 일관 누적되고(변형되어 반경 밖으로 빠지는 현상 제거), 서버/클라 결정적.
+            const bool bCapActive = bCapEnabled && OriginalVertexPositions.IsValidIndex(VertexID);
+            const FVector3d SamplePos = bCapActive ? (FVector3d)OriginalVertexPositions[VertexID] : VertexPos;
 
-                if (DistSq < MinDebugDistSq) MinDebugDistSq = DistSq;
+            FVector3d TotalOffset(0.0, 0.0, 0.0);
 
-                // 반경 내에 있는 버텍스라면?
-                if (DistSq < RadiusSq)
+            // 새로 추가된 히트 데이터들만 순회하며 오프셋 누적
+            for (const FMDFHitParams& Hit : HitParams)
+            {
+                const double DistSq = FVector3d::DistSquared(SamplePos, Hit.Location);
+                Out.MinDistSq = FMath::Min(Out.MinDistSq, DistSq);
+
+                // 반경 밖 버텍스는 무시
+                if (DistSq >= RadiusSq) continue;
+
+                const double Distance = FMath::Sqrt(DistSq);
+                const double t = Distance * InverseRadius; // 0(중심) ~ 1(가장자리)
+
+                // [Phase 19] SmoothStep Falloff (Hermite 보간)
+                // 선형(1-t) 대비: 중심부가 더 평탄하고 가장자리에서 급격히 감쇠
+                const double SmoothT = t * t * (3.0 - 2.0 * t);
+                const double Falloff = 1.0 - SmoothT;
+
+                // -------------------------------------------------------
+                // [Phase 19] 방향 계산: 히트→버텍스 방향 블렌딩
+                // 법선 Overlay 접근 없이 충격 중심 기준 자연스러운 안쪽 변위
+                // -------------------------------------------------------
+                const FVector3d HitToVertex = SamplePos - Hit.Location;
+                const double HitToVertexLen = HitToVertex.Length();
+                const FVector3d InwardDir = (HitToVertexLen > KINDA_SMALL_NUMBER)
+                    ? -HitToVertex / HitToVertexLen  // 안쪽 방향 (히트 중심을 향해)
+                    : Hit.LocalDirection;            // 정확히 히트 지점이면 총알 방향 사용
+
+                // NormalBlendRatio: 1.0 = 히트→버텍스만, 0.0 = 총알 방향만
+                const double BlendR = (double)NormalBlendRatio;
+                FVector3d BlendedDir = (InwardDir * BlendR + Hit.BulletDir * (1.0 - BlendR));
+                const double BlendedLen = BlendedDir.Length();
+                if (BlendedLen > KINDA_SMALL_NUMBER)
+                    BlendedDir /= BlendedLen;
+                else
+                    BlendedDir = Hit.BulletDir;
+
+                // -------------------------------------------------------
+                // [Phase 19] 가장자리 융기(Rim) 효과
+                // 중심(t < RimStart): 안쪽 함몰
+                // 가장자리(RimStart ~ 1.0): 바깥으로 솟아오름
+                // -------------------------------------------------------
+                if (t < RimStart)
                 {
-                    double Distance = FMath::Sqrt(DistSq);
-                    double t = Distance * InverseRadius; // 0(중심) ~ 1(가장자리)
-
-                    // [Phase 19] SmoothStep Falloff (Hermite 보간)
-                    // 선형(1-t) 대비: 중심부가 더 평탄하고 가장자리에서 급격히 감쇠
-                    double SmoothT = t * t * (3.0 - 2.0 * t);
-                    double Falloff = 1.0 - SmoothT;
-
-                    // [Phase 19] 로그 스케일 DamageFactor (고데미지 수렴)
-                    // 기존 선형(Damage*0.15): D10=1.5, D50=7.5, D100=15.0
-                    // 로그 스케일:            D10=0.69, D50=1.79, D100=2.40
-                    float DamageFactor = FMath::Loge(1.0f + Hit.Damage * 0.1f);
-                    float CurrentStrength = DeformStrength * DamageFactor;
-
-                    // 데미지 타입별 가중치 (근접은 더 세게, 원거리는 약하게)
-                    if (Hit.DamageTypeClass && MeleeDamageType && Hit.DamageTypeClass->IsChildOf(MeleeDamageType))
-                        CurrentStrength *= 1.5f;
-                    else if (Hit.DamageTypeClass && RangedDamageType && Hit.DamageTypeClass->IsChildOf(RangedDamageType))
-                        CurrentStrength *= 0.5f;
-
-                    // -------------------------------------------------------
-                    // [Phase 19] 방향 계산: 히트→버텍스 방향 블렌딩
-                    // 법선 Overlay 접근 없이 충격 중심 기준 자연스러운 안쪽 변위
-                    // -------------------------------------------------------
-                    FVector3d HitToVertex = SamplePos - (FVector3d)Hit.LocalLocation;
-                    double HitToVertexLen = HitToVertex.Length();
-                    FVector3d InwardDir = (HitToVertexLen > KINDA_SMALL_NUMBER)
-                        ? -HitToVertex / HitToVertexLen  // 안쪽 방향 (히트 중심을 향해)
-                        : (FVector3d)Hit.LocalDirection;  // 정확히 히트 지점이면 총알 방향 사용
-
-                    FVector3d BulletDir = ((FVector3d)Hit.LocalDirection).GetSafeNormal();
-
-                    // NormalBlendRatio: 1.0 = 히트→버텍스만, 0.0 = 총알 방향만
-                    double BlendR = (double)NormalBlendRatio;
-                    FVector3d BlendedDir = (InwardDir * BlendR + BulletDir * (1.0 - BlendR));
-                    double BlendedLen = BlendedDir.Length();
-                    if (BlendedLen > KINDA_SMALL_NUMBER)
-                        BlendedDir /= BlendedLen;
-                    else
-                        BlendedDir = BulletDir;
-
-                    // -------------------------------------------------------
-                    // [Phase 19] 가장자리 융기(Rim) 효과
-                    // 중심(t < RimStart): 안쪽 함몰
-                    // 가장자리(RimStart ~ 1.0): 바깥으로 솟아오름
-                    // -------------------------------------------------------
-                    if (t < RimStart)
-                    {
-                        // 함몰 영역: 블렌딩된 방향으로 밀어넣기
-                        TotalOffset += BlendedDir * (double)(CurrentStrength * Falloff);
-                    }
-                    else if (RimStrength > KINDA_SMALL_NUMBER)
-                    {
-                        // 융기 영역: 바깥 방향(히트에서 멀어지는 방향)으로 솟아오름
-                        double RimT = (t - RimStart) / FMath::Max(RimRange, 0.01); // 0~1 정규화
-                        double RimFalloff = FMath::Sin(RimT * PI) * (double)RimStrength;
+                    // 함몰 영역: 블렌딩된 방향으로 밀어넣기
+                    TotalOffset += BlendedDir * (double)(Hit.Strength * Falloff);
+                }
+                else if (RimStrength > KINDA_SMALL_NUMBER)
+                {
+                    // 융기 영역: 바깥 방향(히트에서 멀어지는 방향)으로 솟아오름
+                    const double RimT = (t - RimStart) / FMath::Max(RimRange, 0.01); // 0~1 정규화
+                    const double RimFalloff = FMath::Sin(RimT * PI) * (double)RimStrength;
 
-                        FVector3d OutwardDir = (HitToVertexLen > KINDA_SMALL_NUMBER)
-                            ? HitToVertex / HitToVertexLen  // 바깥 방향
-                            : -BulletDir;
+                    const FVector3d OutwardDir = (HitToVertexLen > KINDA_SMALL_NUMBER)
+                        ? HitToVertex / HitToVertexLen  // 바깥 방향
+                        : -Hit.BulletDir;
 
-                        TotalOffset += OutwardDir * (double)(CurrentStrength * RimFalloff);
-#if MDF_DEBUG_DEFORM
-                        RimAffectedCount++;
-#endif
-                    }
+                    TotalOffset += OutwardDir * (double)(Hit.Strength * RimFalloff);
+                    Out.RimHitCount++;
+                }
 
-                    bModified = true;
+                Out.bModified = true;
 
-                    // [Phase 18] Vertex Color 강도 계산 (Substrate 준비)
-                    if (bPaintVertexColor)
+                // [Phase 18] Vertex Color 강도 계산 (Substrate 준비)
+                if (bPaintVertexColor)
+                {
+                    const float Intensity = static_cast<float>(Falloff) * Hit.DamageFactor * DamageColorIntensityScale;
+                    if (Intensity > Out.MaxDamageIntensity)
                     {
-                        float Intensity = static_cast<float>(Falloff) * DamageFactor * DamageColorIntensityScale;
-                        if (Intensity > MaxDamageIntensity)
-                        {
-                            MaxDamageIntensity = Intensity;
-                            // 데미지 타입 인코딩: Ranged=0.0, Melee=0.5, Breach=1.0
-                            if (Hit.DamageTypeClass && MeleeDamageType && Hit.DamageTypeClass->IsChildOf(MeleeDamageType))
-                                DamageTypeEncoded = 0.5f;
-                            else if (Hit.DamageTypeClass && BreachDamageType && Hit.DamageTypeClass->IsChildOf(BreachDamageType))
-                                DamageTypeEncoded = 1.0f;
-                            else
-                                DamageTypeEncoded = 0.0f;
-                        }
+                        Out.MaxDamageIntensity = Intensity;
+                        Out.DamageTypeEncoded = Hit.DamageTypeEncoded;
                     }
                 }
             }
 
+            if (!Out.bModified) return;
+
             // -------------------------------------------------------
-            // [Phase 19] 배치당 최대 변위 클램프 + 버텍스 이동
+            // [Phase 19] 배치당 최대 변위 클램프
             // -------------------------------------------------------
-            if (bModified)
+            Out.OffsetLength = TotalOffset.Length();
+            if (Out.OffsetLength > (double)MaxDisplacementPerBatch)
             {
-                double OffsetLength = TotalOffset.Length();
+                TotalOffset = (TotalOffset / Out.OffsetLength) * (double)MaxDisplacementPerBatch;
+            }
 
-#if MDF_DEBUG_DEFORM
-                if (OffsetLength > MaxOffsetMagnitude)
-                    MaxOffsetMagnitude = OffsetLength;
-#endif
+            // 변형 누적: 현재(변형된) 위치에 이번 배치 오프셋을 더함
+            FVector3d Candidate = VertexPos + TotalOffset;
 
-                if (OffsetLength > (double)MaxDisplacementPerBatch)
+            // [Phase 20] 누적 변위 캡 — 원본 대비 총 이동량을 MaxTotalDisplacement로 제한.
+            // 한 부위를 계속 맞아도 정해진 최대 깊이(폭)를 넘지 않음. 0 = 무제한.
+            // 원본 중심 반지름 캡짜리 공(ball)에 투영 → 같은 방향 연타가 한 점에 수렴(오버슈트/진동 없음).
+            if (bCapActive)
+            {
+                const FVector3d Orig = (FVector3d)OriginalVertexPositions[VertexID];
+                const FVector3d FromOrig = Candidate - Orig;
+                const double FromOrigLen = FromOrig.Length();
+                if (FromOrigLen > (double)MaxTotalDisplacement)
                 {
-                    TotalOffset = (TotalOffset / OffsetLength) * (double)MaxDisplacementPerBatch;
-#if MDF_DEBUG_DEFORM
-                    ClampedVertexCount++;
-#endif
+                    Candidate = Orig + (FromOrig / FromOrigLen) * (double)MaxTotalDisplacement;
                 }
+            }
 
-                // 변형 누적: 현재(변형된) 위치에 이번 배치 오프셋을 더함
-                FVector3d Candidate = VertexPos + TotalOffset;
+            Out.NewPosition = Candidate;
+        }, CandidateVertices.Num() < MDFParallelMinVertices ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 
-                // [Phase 20] 누적 변위 캡 — 원본 대비 총 이동량을 MaxTotalDisplacement로 제한.
-                // 한 부위를 계속 맞아도 정해진 최대 깊이(폭)를 넘지 않음. 0 = 무제한.
-                // 원본 중심 반지름 캡짜리 공(ball)에 투영 → 같은 방향 연타가 한 점에 수렴(오버슈트/진동 없음).
-                if (bCapActive)
-                {
-                    const FVector3d Orig = (FVector3d)OriginalVertexPositions[VertexID];
-                    FVector3d FromOrig = Candidate - Orig;
-                    const double FromOrigLen = FromOrig.Length();
-                    if (FromOrigLen > (double)MaxTotalDisplacement)
-                    {
-                        Candidate = Orig + (FromOrig / FromOrigLen) * (double)MaxTotalDisplacement;
-                    }
-                }
+        // ---------------------------------------------------------------
+        // 3) 기록 — SetVertex/컬러 오버레이는 공유 상태이므로 게임 스레드에서 순차 처리
+        // ---------------------------------------------------------------
+        for (int32 Index = 0; Index < CandidateVertices.Num(); ++Index)
+        {
+            const FMDFVertexDeformResult& Result = Results[Index];
+            MinDebugDistSq = FMath::Min(MinDebugDistSq, Result.MinDistSq);
+            if (!Result.bModified) continue;
 
-                EditMesh.SetVertex(VertexID, Candidate);
-                bAnyModified = true;
-                ModifiedVertexCount++;
+            const int32 VertexID = CandidateVertices[Index];
+
+#if MDF_DEBUG_DEFORM
+            RimAffectedCount += Result.RimHitCount;
+            MaxOffsetMagnitude = FMath::Max(MaxOffsetMagnitude, Result.OffsetLength);
+            if (Result.OffsetLength > (double)MaxDisplacementPerBatch)
+            {
+                ClampedVertexCount++;
+            }
+#endif
+
+            EditMesh.SetVertex(VertexID, Result.NewPosition);
+            bAnyModified = true;
+            ModifiedVertexCount++;
+
+            // [Lag-Fix13] 원본 대비 최대 이동량 갱신 (캡 OFF 시 다음 배치의 버킷 조회 반경 확장용)
+            if (OriginalVertexPositions.IsValidIndex(VertexID))
+            {
+                MaxVertexDrift = FMath::Max(MaxVertexDrift,
+                    FVector3d::Distance(Result.NewPosition, (FVector3d)OriginalVertexPositions[VertexID]));
+            }
 
-                // [Phase 18] Vertex Color 페인팅 (Substrate 데이터)
-                if (ColorOverlay && MaxDamageIntensity > 0.0f)
+            // [Phase 18] Vertex Color 페인팅 (Substrate 데이터)
+            if (ColorOverlay && Result.MaxDamageIntensity > 0.0f)
+            {
+                const float ClampedIntensity = FMath::Clamp(Result.MaxDamageIntensity, 0.0f, 1.0f);
+                const float DamageTypeEncoded = Result.DamageTypeEncoded;
+                EditMesh.EnumerateVertexTriangles(VertexID, [&](int32 TriangleID)
                 {
-                    float ClampedIntensity = FMath::Clamp(MaxDamageIntensity, 0.0f, 1.0f);
-                    EditMesh.EnumerateVertexTriangles(VertexID, [&](int32 TriangleID)
-                    {
-                        UE::Geometry::FIndex3i TriElements = ColorOverlay->GetTriangle(TriangleID);
-                        UE::Geometry::FIndex3i TriVertices = EditMesh.GetTriangle(TriangleID);
+                    UE::Geometry::FIndex3i TriElements = ColorOverlay->GetTriangle(TriangleID);
+                    UE::Geometry::FIndex3i TriVertices = EditMesh.GetTriangle(TriangleID);
 
-                        for (int32 SubIdx = 0; SubIdx < 3; ++SubIdx)
+                    for (int32 SubIdx = 0; SubIdx < 3; ++SubIdx)
+                    {
+                        if (TriVertices[SubIdx] == VertexID)
                         {
-                            if (TriVertices[SubIdx] == VertexID)
+                            int32 ElementID = TriElements[SubIdx];
+                            if (ColorOverlay->IsElement(ElementID))
                             {
-                                int32 ElementID = TriElements[SubIdx];
-                                if (ColorOverlay->IsElement(ElementID))
-                                {
-                                    FVector4f Existing = ColorOverlay->GetElement(ElementID);
-                                    Existing.X = FMath::Max(Existing.X, ClampedIntensity); // R: 데미지 강도
-                                    Existing.Y = DamageTypeEncoded;                         // G: 데미지 타입
-                                    // B, A: 향후 Substrate 확장용 (예: 균열 방향, 습기 등)
-                                    ColorOverlay->SetElement(ElementID, Existing);
-                                }
+                                FVector4f Existing = ColorOverlay->GetElement(ElementID);
+                                Existing.X = FMath::Max(Existing.X, ClampedIntensity); // R: 데미지 강도
+                                Existing.Y = DamageTypeEncoded;                         // G: 데미지 타입
+                                // B, A: 향후 Substrate 확장용 (예: 균열 방향, 습기 등)
+                                ColorOverlay->SetElement(ElementID, Existing);
                             }
                         }
-                    });
-                }
+                    }
+                });
             }
         }
-    }, EDynamicMeshChangeType::GeneralEdit);
+
+        // ---------------------------------------------------------------
+        // 4) [Lag-Fix14] 법선/탄젠트 재계산 (클라 전용, 변형이 있을 때만)
+        // ---------------------------------------------------------------
+        if (bRecomputeShading && bAnyModified && EditMesh.HasAttributes() && EditMesh.Attributes()->PrimaryNormals())
+        {
+            UE::Geometry::FMeshNormals::QuickRecomputeOverlayNormals(EditMesh);
+            UE::Geometry::FMeshTangentsd::ComputeDefaultOverlayTangents(EditMesh);
+        }
+    }, EDynamicMeshChangeType::DeformationEdit, ChangeFlags);
 
     // -------------------------------------------------------------------------
     // [Phase 19] 변형 결과 요약 로깅
@@ -771,6 +927,8 @@ void UMDF_DeformableComponent::ApplyDeformationForHits(int32 StartIndex, int32 C
     {
 #if MDF_DEBUG_DEFORM
         UE_LOG(LogMeshDeform, Log, TEXT("[MDF Deform] === Phase 19 변형 결과 ==="));
+        UE_LOG(LogMeshDeform, Log, TEXT("[MDF Deform] 후보 수집: %s (버킷 %d개, 최대 이동량 %.1f)"),
+            bUsedVertexBuckets ? TEXT("버킷 인덱스") : TEXT("전체 순회 폴백"), VertexBuckets.Num(), (float)MaxVertexDrift);
         UE_LOG(LogMeshDeform, Log, TEXT("[MDF Deform] 총 버텍스: %d | AABB 스킵: %d (%.1f%%) | 변형됨: %d (%.1f%%)"),
             TotalVertexCount, AABBSkippedCount,
             TotalVertexCount > 0 ? (float)AABBSkippedCount / TotalVertexCount * 100.f : 0.f,
@@ -801,15 +959,8 @@ void UMDF_DeformableComponent::ApplyDeformationForHits(int32 StartIndex, int32 C
     }
 
     // 렌더링은 즉시 업데이트 (비주얼 지연 방지, 콜리전만 디바운스)
-    if (!IsRunningDedicatedServer())
-    {
-        if (UDynamicMesh* PostEditMesh = DeformMeshComp->GetDynamicMesh())
-        {
-            UGeometryScriptLibrary_MeshNormalsFunctions::RecomputeNormals(PostEditMesh, FGeometryScriptCalculateNormalsOptions());
-            UGeometryScriptLibrary_MeshNormalsFunctions::ComputeTangents(PostEditMesh, FGeometryScriptTangentsOptions());
-        }
-        DeformMeshComp->NotifyMeshUpdated();
-    }
+    // [Lag-Fix14] DeformationEdit 커밋이 컴포넌트의 정점 속성 빠른 갱신(FastNotifyVertexAttributesUpdated)을
+    // 이미 트리거하므로 NotifyMeshUpdated(프록시 전체 재생성)는 호출하지 않음
 
 #if MDF_DEBUG_DEFORM
     UE_LOG(LogMeshDeform, Log, TEXT("[MDF Deform] ========== Phase 19 변형 완료 =========="));
@@ -921,7 +1072,8 @@ void UMDF_DeformableComponent::InitializeDynamicMesh()
             }
 
             // [Phase 18] Vertex Color 초기화 (전체 검정 = 손상 없음)
-            if (bEnableVisualDamage)
+            // [Lag-Fix13] 데디 서버는 컬러/머티리얼을 쓰지 않으므로 건너뜀 (콜리전만 유지)
+            if (bEnableVisualDamage && !IsRunningDedicatedServer())
             {
                 UGeometryScriptLibrary_MeshVertexColorFunctions::SetMeshConstantVertexColor(
                     InitMeshComp->GetDynamicMesh(),
@@ -941,6 +1093,9 @@ void UMDF_DeformableComponent::InitializeDynamicMesh()
                 }
             }
 
+            // [Lag-Fix13] 원본 정점 버킷 인덱스 빌드 (컬러 초기화 이후 토폴로지 기준으로 기록)
+            BuildVertexBuckets(InitMeshComp->GetDynamicMesh());
+
             // 충돌 업데이트 (서버 + 클라 모두)
             InitMeshComp->UpdateCollision();
 
@@ -962,6 +1117,47 @@ void UMDF_DeformableComponent::InitializeDynamicMesh()
     }
 }
 
+// -----------------------------------------------------------------------------
+// [Lag-Fix13] 원본 정점 공간 버킷 인덱스
+// 셀 크기 = 빌드 시점 DeformRadius → 히트 1개가 보통 3x3x3 셀만 조회.
+// 조회 시 셀 범위를 실제 반경으로 계산하므로 런타임에 DeformRadius가 바뀌어도 결과는 정확함.
+// -----------------------------------------------------------------------------
+void UMDF_DeformableComponent::BuildVertexBuckets(UDynamicMesh* Mesh)
+{
+    VertexBuckets.Reset();
+    VertexBucketTopologyStamp = 0;
+    VertexBucketMaxVertexID = 0;
+    MaxVertexDrift = 0.0;
+
+    if (!Mesh) return;
+
+    VertexBucketCellSize = FMath::Max((double)DeformRadius, 1.0);
+    const double InvCellSize = 1.0 / VertexBucketCellSize;
+
+    Mesh->ProcessMesh([this, InvCellSize](const UE::Geometry::FDynamicMesh3& ReadMesh)
+    {
+        for (int32 VID : ReadMesh.VertexIndicesItr())
+        {
+            if (!OriginalVertexPositions.IsValidIndex(VID)) continue;
+
+            const FVector& Pos = OriginalVertexPositions[VID];
+            const FIntVector Cell(
+                FMath::FloorToInt32(Pos.X * InvCellSize),
+                FMath::FloorToInt32(Pos.Y * InvCellSize),
+                FMath::FloorToInt32(Pos.Z * InvCellSize));
+            VertexBuckets.FindOrAdd(Cell).Add(VID);
+        }
+
+        VertexBucketTopologyStamp = ReadMesh.GetTopologyChangeStamp();
+        VertexBucketMaxVertexID = ReadMesh.MaxVertexID();
+    });
+
+#if MDF_DEBUG_DEFORM
+    UE_LOG(LogMeshDeform, Log, TEXT("[MDF] [Lag-Fix13] 정점 버킷 인덱스 빌드: 정점 %d개 → 버킷 %d개 (셀 %.1f)"),
+        OriginalVertexPositions.Num(), VertexBuckets.Num(), (float)VertexBucketCellSize);
+#endif
+}
+
 // -----------------------------------------------------------------------------
 // [유틸리티] 좌표 변환 함수
 // -----------------------------------------------------------------------------
@@ -9,6 +9,7 @@
 #include "MDF_DeformableComponent.generated.h"
 
 class UDynamicMeshComponent;
+class UDynamicMesh;
 class UNiagaraSystem;
 class USoundBase;
 class UMDF_DeformableComponent;
@@ -310,6 +311,23 @@ protected:
      *  (mesh 재복사 시 VertexID가 재할당되므로 반드시 재캡처 필요) */
     TArray<FVector> OriginalVertexPositions;
 
+    /** [Lag-Fix13] OriginalVertexPositions 공간 버킷 인덱스 (셀 좌표 → VertexID 목록).
+     *  InitializeDynamicMesh()에서 원본 캡처 직후 1회 빌드 → 히트마다 반경 내 셀의 정점만 방문합니다. */
+    TMap<FIntVector, TArray<int32>> VertexBuckets;
+
+    /** [Lag-Fix13] 버킷 셀 크기 (빌드 시점 DeformRadius) */
+    double VertexBucketCellSize = 100.0;
+
+    /** [Lag-Fix13] 빌드 시점 토폴로지 스탬프/MaxVertexID — 달라지면(Boolean 절단 등) 전체 순회로 폴백 */
+    uint64 VertexBucketTopologyStamp = 0;
+    int32 VertexBucketMaxVertexID = 0;
+
+    /** [Lag-Fix13] 원본 대비 최대 정점 이동량 — 누적 캡 OFF일 때 버킷 조회 반경을 이만큼 확장 */
+    double MaxVertexDrift = 0.0;
+
+    /** [Lag-Fix13] 버킷 인덱스 빌드 (OriginalVertexPositions 캡처 이후 호출) */
+    void BuildVertexBuckets(UDynamicMesh* Mesh);
+
     /** 타이머 핸들 (중복 호출 방지용) */
     FTimerHandle BatchTimerHandle;
 
@@ -53,6 +53,9 @@ public class Helluna : ModuleRules
             // [Phase 12g] 클립보드 복사 (파티 코드)
             "ApplicationCore",
 
+            // [ChannelRegistryV1] 로비 ↔ 게임서버 채널 하트비트 (127.0.0.1 UDP)
+            "Sockets", "Networking",
+
             // [PCG] 밤 시작 시 런타임 PCG 생성 (장애물/환경 스폰)
             "PCG",
 
@@ -14,6 +14,7 @@
 #include "AIController.h"
 #include "GameFramework/Pawn.h"
 #include "EngineUtils.h"
+#include "Utils/HellunaActorRegistrySubsystem.h"
 
 void UEnvQueryContext_SpaceShip::ProvideContext(
 	FEnvQueryInstance& QueryInstance,
@@ -40,6 +41,19 @@ void UEnvQueryContext_SpaceShip::ProvideContext(
 	const UWorld* World = QuerierPawn->GetWorld();
 	if (!World) return;
 
+	// [ActorRegistryV1] 쿼리마다 월드 전체를 순회하던 경로 → 레지스트리 우선.
+	//   등록된 우주선이 없으면 스폰 전이므로 종료, 등록된 우주선에 태그가 없을 때만 기존 스캔.
+	if (const UHellunaActorRegistrySubsystem* Registry = World->GetSubsystem<UHellunaActorRegistrySubsystem>())
+	{
+		AActor* Ship = Registry->GetSpaceShip();
+		if (!Ship) return;
+		if (Ship->ActorHasTag(SpaceShipTag))
+		{
+			UEnvQueryItemType_Actor::SetContextHelper(ContextData, Ship);
+			return;
+		}
+	}
+
 	for (TActorIterator<AActor> It(World); It; ++It)
 	{
 		if (It->ActorHasTag(SpaceShipTag))
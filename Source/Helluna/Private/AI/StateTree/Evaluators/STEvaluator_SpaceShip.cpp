@@ -17,6 +17,31 @@
 #include "AI/SpaceShipAttackSlotManager.h"
 #include "Components/PrimitiveComponent.h"
 #include "AI/HellunaAIAttackZone.h" // [SurfaceDistanceV1] 공용 표면거리 헬퍼
+#include "Utils/HellunaActorRegistrySubsystem.h"
+
+// [ActorRegistryV1] 우주선 탐색 — 레지스트리 우선.
+//   레지스트리에 우주선이 없으면 아직 스폰 전이므로 스캔 생략 (매 프레임 재탐색 경로의 비용 제거).
+//   태그를 바꾼 에셋 호환을 위해, 등록된 우주선에 SpaceShipTag가 없을 때만 기존 태그 스캔.
+static AActor* FindSpaceShipByTag(const UWorld* World, const FName& SpaceShipTag)
+{
+	if (const UHellunaActorRegistrySubsystem* Registry = World->GetSubsystem<UHellunaActorRegistrySubsystem>())
+	{
+		AActor* Ship = Registry->GetSpaceShip();
+		if (!Ship || Ship->ActorHasTag(SpaceShipTag))
+		{
+			return Ship;
+		}
+	}
+
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		if (It->ActorHasTag(SpaceShipTag))
+		{
+			return *It;
+		}
+	}
+	return nullptr;
+}
 
 // ============================================================================
 // TreeStart — 우주선을 첫 틱 전에 탐색해서 캐싱
@@ -37,14 +62,7 @@ void FSTEvaluator_SpaceShip::TreeStart(FStateTreeExecutionContext& Context) cons
 	if (!CachedSpaceShip.IsValid())
 	{
 		CacheMissCount++;
-		for (TActorIterator<AActor> It(World); It; ++It)
-		{
-			if (It->ActorHasTag(SpaceShipTag))
-			{
-				CachedSpaceShip = *It;
-				break;
-			}
-		}
+		CachedSpaceShip = FindSpaceShipByTag(World, SpaceShipTag);
 		UE_LOG(LogTemp, Log, TEXT("[fast][SpaceShipEval] TreeStart 캐시 MISS (누적: Hit=%d Miss=%d)"),
 			CacheHitCount, CacheMissCount);
 	}
@@ -112,15 +130,11 @@ void FSTEvaluator_SpaceShip::Tick(FStateTreeExecutionContext& Context, const flo
 			const UWorld* World = Context.GetWorld();
 			if (!World) return;
 
-			for (TActorIterator<AActor> It(World); It; ++It)
+			if (AActor* Ship = FindSpaceShipByTag(World, SpaceShipTag))
 			{
-				if (It->ActorHasTag(SpaceShipTag))
-				{
-					CachedSpaceShip = *It;
-					SpaceShipData.TargetActor = *It;
-					SpaceShipData.TargetType  = EHellunaTargetType::SpaceShip;
-					break;
-				}
+				CachedSpaceShip = Ship;
+				SpaceShipData.TargetActor = Ship;
+				SpaceShipData.TargetType  = EHellunaTargetType::SpaceShip;
 			}
 		}
 
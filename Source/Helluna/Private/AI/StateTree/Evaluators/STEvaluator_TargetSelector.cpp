@@ -34,6 +34,7 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemInterface.h"
 #include "Character/HellunaEnemyCharacter.h" // [PlayerOnlyHunterV1] bPlayerOnlyTarget 읽기
+#include "Utils/HellunaActorRegistrySubsystem.h" // [ActorRegistryV1]
 
 // ============================================================================
 // 헬퍼: 우주선 캐시 가져오기
@@ -43,13 +44,10 @@ static AActor* GetCachedSpaceShip(const UWorld* World)
 	static TWeakObjectPtr<AActor> CachedSpaceShip;
 	if (!CachedSpaceShip.IsValid() && World)
 	{
-		for (TActorIterator<AActor> It(World); It; ++It)
+		// [ActorRegistryV1] 캐시 미스 시에도 월드 스캔 없이 레지스트리 조회
+		if (const UHellunaActorRegistrySubsystem* Registry = World->GetSubsystem<UHellunaActorRegistrySubsystem>())
 		{
-			if (It->ActorHasTag(FName("SpaceShip")))
-			{
-				CachedSpaceShip = *It;
-				break;
-			}
+			CachedSpaceShip = Registry->GetSpaceShip();
 		}
 	}
 	return CachedSpaceShip.Get();
@@ -377,9 +375,14 @@ void FSTEvaluator_TargetSelector::Tick(FStateTreeExecutionContext& Context, cons
 	// 터렛 탐색 (어그로 수 제한 적용)
 	// 공격/회복 포탑 모두 어그로 — 공통 부모 AHellunaTurretBase로 일괄 검색.
 	int32 TurretSeen = 0, TurretInRange = 0, TurretBlockedByCap = 0;
-	for (TActorIterator<AHellunaTurretBase> It(World); It; ++It)
+	// [ActorRegistryV1] 매 Evaluator Tick TActorIterator 대신 Turret 버킷
+	TArray<AHellunaTurretBase*> Turrets;
+	if (const UHellunaActorRegistrySubsystem* Registry = World->GetSubsystem<UHellunaActorRegistrySubsystem>())
+	{
+		Registry->GetActors<AHellunaTurretBase>(EHellunaActorBucket::Turret, Turrets);
+	}
+	for (AHellunaTurretBase* Turret : Turrets)
 	{
-		AHellunaTurretBase* Turret = *It;
 		// [TurretHP] 파괴된(망가진) 포탑은 어그로 후보에서 제외 — 사망 연출(20s) 동안 헛공격 방지
 		if (!Turret || Turret->IsActorBeingDestroyed() || Turret->IsTurretDestroyed()) continue;
 		++TurretSeen;
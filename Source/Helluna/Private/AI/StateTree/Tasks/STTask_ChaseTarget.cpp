@@ -37,6 +37,7 @@
 #include "Object/ResourceUsingObject/ResourceUsingObject_AttackTurret.h"
 #include "Object/ResourceUsingObject/HellunaTurretBase.h"
 #include "AI/TurretAggroTracker.h"
+#include "Utils/HellunaActorRegistrySubsystem.h"
 
 static int32 GAngleCounter = 0;
 
@@ -103,15 +104,10 @@ static AActor* FindSpaceShip(const UWorld* World)
 	static TWeakObjectPtr<AActor> CachedShip;
 	if (CachedShip.IsValid()) return CachedShip.Get();
 	if (!World) return nullptr;
-	for (TActorIterator<AActor> It(World); It; ++It)
-	{
-		if (It->ActorHasTag(FName("SpaceShip")))
-		{
-			CachedShip = *It;
-			return *It;
-		}
-	}
-	return nullptr;
+	// [ActorRegistryV1] 월드 스캔 대신 레지스트리
+	const UHellunaActorRegistrySubsystem* Registry = World->GetSubsystem<UHellunaActorRegistrySubsystem>();
+	CachedShip = Registry ? Registry->GetSpaceShip() : nullptr;
+	return CachedShip.Get();
 }
 
 /**
@@ -18,6 +18,7 @@
 #include "Character/HellunaEnemyCharacter.h"
 #include "EngineUtils.h"
 #include "Helluna.h"
+#include "Utils/HellunaActorRegistrySubsystem.h"
 
 namespace
 {
@@ -91,13 +92,10 @@ EStateTreeRunStatus FSTTask_Enrage::EnterState(
 		static TWeakObjectPtr<AActor> CachedSpaceShip;
 		if (!CachedSpaceShip.IsValid())
 		{
-			for (TActorIterator<AActor> It(World); It; ++It)
+			// [ActorRegistryV1] 월드 스캔 대신 레지스트리
+			if (const UHellunaActorRegistrySubsystem* Registry = World->GetSubsystem<UHellunaActorRegistrySubsystem>())
 			{
-				if (It->ActorHasTag(FName("SpaceShip")))
-				{
-					CachedSpaceShip = *It;
-					break;
-				}
+				CachedSpaceShip = Registry->GetSpaceShip();
 			}
 		}
 		if (CachedSpaceShip.IsValid())
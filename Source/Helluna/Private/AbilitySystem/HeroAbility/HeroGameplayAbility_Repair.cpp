@@ -15,6 +15,7 @@
 
 #include "DebugHelper.h"
 #include "Helluna.h"
+#include "Utils/HellunaActorRegistrySubsystem.h"
 
 UHeroGameplayAbility_Repair::UHeroGameplayAbility_Repair()
 {
@@ -102,13 +103,12 @@ void UHeroGameplayAbility_Repair::Repair(const FGameplayAbilityActorInfo* ActorI
 	AResourceUsingObject_SpaceShip* Ship = GS->GetSpaceShip();
 	if (!Ship)
 	{
-		TArray<AActor*> FoundShips;
-		UGameplayStatics::GetAllActorsWithTag(GetWorld(), FName("SpaceShip"), FoundShips);
-		if (FoundShips.Num() > 0)
+		// [ActorRegistryV1] 태그 월드 스캔 대신 레지스트리 (BeginPlay 등록이라 스트리밍 직후에도 잡힘)
+		if (const UHellunaActorRegistrySubsystem* Registry = UHellunaActorRegistrySubsystem::Get(this))
 		{
-			Ship = Cast<AResourceUsingObject_SpaceShip>(FoundShips[0]);
+			Ship = Cast<AResourceUsingObject_SpaceShip>(Registry->GetSpaceShip());
 		}
-		UE_LOG(LogTemp, Warning, TEXT("[Repair] GS->GetSpaceShip() null → 태그 폴백 결과: %s"),
+		UE_LOG(LogTemp, Warning, TEXT("[Repair] GS->GetSpaceShip() null → 레지스트리 폴백 결과: %s"),
 			Ship ? *Ship->GetName() : TEXT("여전히 NULL"));
 	}
 	if (!Ship)
@@ -11,6 +11,7 @@
 #include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
 #include "HellunaGameplayTags.h"
+#include "Combat/HellunaLagCompensationSubsystem.h"
 
 #include "DebugHelper.h"
 
@@ -159,7 +160,8 @@ void UHeroGameplayAbility_Shoot::Shoot()
 		}
 		else
 		{
-			Weapon->ServerCacheClientAimPoint(AimPoint);
+			// [LagCompV1] 조준 시점의 화면 기준 서버 시각도 함께 보고 → 서버가 그 시각으로 되감아 판정
+			Weapon->ServerCacheClientAimPoint(AimPoint, UHellunaLagCompensationSubsystem::GetLocalViewServerTime(Hero));
 		}
 	}
 
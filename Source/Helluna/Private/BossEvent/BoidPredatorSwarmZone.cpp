@@ -6,26 +6,41 @@
 #include "NiagaraFunctionLibrary.h"
 #include "NiagaraComponent.h"
 #include "NiagaraSystem.h"
+#include "NiagaraDataInterfaceArrayFunctionLibrary.h"
 #include "Kismet/GameplayStatics.h"
-#include "EngineUtils.h"
+#include "Async/ParallelFor.h"
+#include "Net/UnrealNetwork.h"
+#include "Utils/HellunaActorRegistrySubsystem.h"
+
+namespace BoidSwarm
+{
+	/** 이 수 미만이면 ParallelFor 스케줄 비용이 더 커서 단일 스레드로 처리 */
+	constexpr int32 ParallelMinBoids = 48;
+}
 
 ABoidPredatorSwarmZone::ABoidPredatorSwarmZone()
 {
 	PrimaryActorTick.bCanEverTick = true;
 }
 
+void ABoidPredatorSwarmZone::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(ABoidPredatorSwarmZone, SwarmState);
+}
+
 void ABoidPredatorSwarmZone::ActivateZone()
 {
 	if (!OwnerEnemy) { NotifyPatternFinished(false); return; }
 
-	bZoneActive = true;
-	bInDiveMode = false;
-	DiveTimer = 0.f;
-	DiveElapsed = 0.f;
-	HashCellSize = FMath::Max(NeighborRadius, 100.f);
+	// [BoidSoAV1] 시드 + 중심만 복제 → 클라는 OnRep에서 같은 초기 배치로 시작
+	SwarmState.Seed = FMath::Rand();
+	SwarmState.Center = GetActorLocation();
+	SwarmState.bActive = true;
+	ForceNetUpdate();
 
-	SpawnBoids();
-	SetActorTickEnabled(true);
+	StartSwarm(SwarmState.Seed, SwarmState.Center);
 
 	GetWorldTimerManager().SetTimer(PatternEndTimerHandle, [this]()
 	{
@@ -36,160 +51,161 @@ void ABoidPredatorSwarmZone::ActivateZone()
 void ABoidPredatorSwarmZone::DeactivateZone()
 {
 	if (!bZoneActive) return;
-	bZoneActive = false;
-	SetActorTickEnabled(false);
 
-	for (FBoid& B : Boids)
-	{
-		if (B.VFXComp.IsValid())
-		{
-			B.VFXComp->DestroyComponent();
-		}
-	}
-	Boids.Empty();
-	SpatialHash.Empty();
+	SwarmState.bActive = false;
+	ForceNetUpdate();
+
+	StopSwarm();
 	GetWorldTimerManager().ClearTimer(PatternEndTimerHandle);
 	NotifyPatternFinished(false);
 }
 
-void ABoidPredatorSwarmZone::SpawnBoids()
+void ABoidPredatorSwarmZone::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Boids.Empty();
-	Boids.Reserve(BoidCount);
-	const FVector Center = GetActorLocation();
-
-	for (int32 i = 0; i < BoidCount; ++i)
-	{
-		FBoid B;
-		const float Ang = FMath::FRandRange(0.f, 2.f * PI);
-		const float R = FMath::FRandRange(0.f, SpawnRadius);
-		B.Position = Center + FVector(FMath::Cos(Ang) * R, FMath::Sin(Ang) * R, FlightHeight);
-		const FVector InitDir(FMath::Cos(Ang + PI * 0.5f), FMath::Sin(Ang + PI * 0.5f), 0.f);
-		B.Velocity = InitDir * BaseSpeed;
+	// 클라는 DeactivateZone이 불리지 않으므로 Actor 파괴 시 VFX 정리
+	StopSwarm();
 
-		if (BoidVFX)
-		{
-			UNiagaraComponent* NC = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-				GetWorld(), BoidVFX, B.Position, FRotator::ZeroRotator,
-				FVector(BoidVFXScale), false, true, ENCPoolMethod::None);
-			B.VFXComp = NC;
-		}
-
-		Boids.Add(B);
-	}
+	Super::EndPlay(EndPlayReason);
 }
 
-int64 ABoidPredatorSwarmZone::HashKey(const FVector& Pos) const
+void ABoidPredatorSwarmZone::OnRep_SwarmState()
 {
-	const int32 x = FMath::FloorToInt(Pos.X / HashCellSize);
-	const int32 y = FMath::FloorToInt(Pos.Y / HashCellSize);
-	return (int64)x * 73856093LL ^ (int64)y * 19349663LL;
-}
-
-void ABoidPredatorSwarmZone::BuildSpatialHash()
-{
-	SpatialHash.Empty();
-	for (int32 i = 0; i < Boids.Num(); ++i)
+	if (SwarmState.bActive && !bZoneActive)
+	{
+		StartSwarm(SwarmState.Seed, SwarmState.Center);
+	}
+	else if (!SwarmState.bActive && bZoneActive)
 	{
-		const int64 Key = HashKey(Boids[i].Position);
-		SpatialHash.FindOrAdd(Key).Add(i);
+		StopSwarm();
 	}
 }
 
-void ABoidPredatorSwarmZone::GatherNeighbors(int32 BoidIdx, TArray<int32>& OutNeighbors) const
+// ============================================================================
+// 시작 / 종료
+// ============================================================================
+
+void ABoidPredatorSwarmZone::StartSwarm(int32 Seed, const FVector& Center)
 {
-	OutNeighbors.Reset();
-	const FVector Pos = Boids[BoidIdx].Position;
-	const int32 cx = FMath::FloorToInt(Pos.X / HashCellSize);
-	const int32 cy = FMath::FloorToInt(Pos.Y / HashCellSize);
+	bZoneActive = true;
+	bInDiveMode = false;
+	DiveTimer = 0.f;
+	DiveElapsed = 0.f;
+	CorrectionTimer = 0.f;
+	HashCellSize = FMath::Max(NeighborRadius, 100.f);
 
-	const float NeighborSq = NeighborRadius * NeighborRadius;
+	// 서버/클라가 같은 시드 → 같은 초기 배치
+	FRandomStream Rng(Seed);
+	Positions.SetNumUninitialized(BoidCount);
+	Velocities.SetNumUninitialized(BoidCount);
+	Accelerations.Init(FVector::ZeroVector, BoidCount);
+	PendingCorrections.Init(FVector::ZeroVector, BoidCount);
 
-	for (int32 dx = -1; dx <= 1; ++dx)
+	for (int32 i = 0; i < BoidCount; ++i)
+	{
+		const float Ang = Rng.FRandRange(0.f, 2.f * PI);
+		const float R = Rng.FRandRange(0.f, SpawnRadius);
+		Positions[i] = Center + FVector(FMath::Cos(Ang) * R, FMath::Sin(Ang) * R, FlightHeight);
+		const FVector InitDir(FMath::Cos(Ang + PI * 0.5f), FMath::Sin(Ang + PI * 0.5f), 0.f);
+		Velocities[i] = InitDir * BaseSpeed;
+	}
+
+	// 렌더링 — 데디케이티드 서버는 생략
+	if (GetNetMode() != NM_DedicatedServer)
 	{
-		for (int32 dy = -1; dy <= 1; ++dy)
+		if (SwarmVFX)
+		{
+			SwarmVFXComp = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+				GetWorld(), SwarmVFX, Center, FRotator::ZeroRotator,
+				FVector::OneVector, false, true, ENCPoolMethod::None);
+			if (SwarmVFXComp)
+			{
+				SwarmVFXComp->SetVariableFloat(FName("BoidScale"), BoidVFXScale);
+			}
+		}
+		else if (BoidVFX)
 		{
-			const int64 Key = (int64)(cx + dx) * 73856093LL ^ (int64)(cy + dy) * 19349663LL;
-			const TArray<int32>* Bucket = SpatialHash.Find(Key);
-			if (!Bucket) continue;
-			for (int32 j : *Bucket)
+			LegacyBoidVFXComps.Reserve(BoidCount);
+			for (int32 i = 0; i < BoidCount; ++i)
 			{
-				if (j == BoidIdx) continue;
-				if (FVector::DistSquared(Boids[j].Position, Pos) <= NeighborSq)
-				{
-					OutNeighbors.Add(j);
-				}
+				LegacyBoidVFXComps.Add(UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+					GetWorld(), BoidVFX, Positions[i], FRotator::ZeroRotator,
+					FVector(BoidVFXScale), false, true, ENCPoolMethod::None));
 			}
 		}
+		UpdateVFX();
 	}
+
+	SetActorTickEnabled(true);
 }
 
-FVector ABoidPredatorSwarmZone::ComputeSeparation(int32 Idx, const TArray<int32>& Neighbors) const
+void ABoidPredatorSwarmZone::StopSwarm()
 {
-	FVector Steer = FVector::ZeroVector;
-	int32 Count = 0;
-	const float SepSq = SeparationRadius * SeparationRadius;
-	for (int32 n : Neighbors)
+	bZoneActive = false;
+	SetActorTickEnabled(false);
+
+	if (SwarmVFXComp)
+	{
+		SwarmVFXComp->DestroyComponent();
+		SwarmVFXComp = nullptr;
+	}
+	for (const TWeakObjectPtr<UNiagaraComponent>& Comp : LegacyBoidVFXComps)
 	{
-		const FVector Diff = Boids[Idx].Position - Boids[n].Position;
-		const float DistSq = Diff.SizeSquared();
-		if (DistSq > 0.f && DistSq < SepSq)
+		if (Comp.IsValid())
 		{
-			Steer += Diff.GetSafeNormal() / FMath::Sqrt(DistSq + 1.f);
-			++Count;
+			Comp->DestroyComponent();
 		}
 	}
-	if (Count > 0) Steer /= (float)Count;
-	return Steer * MaxForce;
+	LegacyBoidVFXComps.Empty();
+
+	Positions.Empty();
+	Velocities.Empty();
+	Accelerations.Empty();
+	PendingCorrections.Empty();
+	HeroSnapshot.Empty();
+	HeroPositions.Empty();
+	SpatialHash.Reset();
 }
 
-FVector ABoidPredatorSwarmZone::ComputeAlignment(int32 Idx, const TArray<int32>& Neighbors) const
-{
-	if (Neighbors.Num() == 0) return FVector::ZeroVector;
-	FVector AvgVel = FVector::ZeroVector;
-	for (int32 n : Neighbors) AvgVel += Boids[n].Velocity;
-	AvgVel /= (float)Neighbors.Num();
-	AvgVel = AvgVel.GetSafeNormal() * MaxSpeed;
-	FVector Steer = AvgVel - Boids[Idx].Velocity;
-	return LimitVector(Steer, MaxForce);
-}
+// ============================================================================
+// 시뮬레이션
+// ============================================================================
 
-FVector ABoidPredatorSwarmZone::ComputeCohesion(int32 Idx, const TArray<int32>& Neighbors) const
+void ABoidPredatorSwarmZone::GatherHeroes()
 {
-	if (Neighbors.Num() == 0) return FVector::ZeroVector;
-	FVector Center = FVector::ZeroVector;
-	for (int32 n : Neighbors) Center += Boids[n].Position;
-	Center /= (float)Neighbors.Num();
-	FVector Desired = (Center - Boids[Idx].Position).GetSafeNormal() * MaxSpeed;
-	FVector Steer = Desired - Boids[Idx].Velocity;
-	return LimitVector(Steer, MaxForce);
+	// 스텝당 1회 — 드론마다 월드를 훑지 않도록 위치 스냅샷
+	HeroSnapshot.Reset();
+	HeroPositions.Reset();
+
+	if (const UHellunaActorRegistrySubsystem* Registry = UHellunaActorRegistrySubsystem::Get(this))
+	{
+		Registry->ForEach<AHellunaHeroCharacter>(EHellunaActorBucket::Hero, [this](AHellunaHeroCharacter* Hero)
+		{
+			HeroSnapshot.Add(Hero);
+			HeroPositions.Add(Hero->GetActorLocation());
+			return true;
+		});
+	}
 }
 
-FVector ABoidPredatorSwarmZone::ComputeChase(int32 Idx) const
+FVector ABoidPredatorSwarmZone::ComputeChase(const FVector& Self, const FVector& Velocity, float ChaseZ) const
 {
-	UWorld* World = GetWorld();
-	if (!World) return FVector::ZeroVector;
-
-	AHellunaHeroCharacter* Closest = nullptr;
+	int32 Closest = INDEX_NONE;
 	float ClosestSq = FLT_MAX;
-	const FVector Self = Boids[Idx].Position;
 
-	for (TActorIterator<AHellunaHeroCharacter> It(World); It; ++It)
+	for (int32 h = 0; h < HeroPositions.Num(); ++h)
 	{
-		AHellunaHeroCharacter* Hero = *It;
-		if (!IsValid(Hero)) continue;
-		const float DSq = FVector::DistSquared(Hero->GetActorLocation(), Self);
-		if (DSq < ClosestSq) { ClosestSq = DSq; Closest = Hero; }
+		const float DSq = FVector::DistSquared(HeroPositions[h], Self);
+		if (DSq < ClosestSq) { ClosestSq = DSq; Closest = h; }
 	}
-	if (!Closest) return FVector::ZeroVector;
+	if (Closest == INDEX_NONE) return FVector::ZeroVector;
 
-	FVector Target = Closest->GetActorLocation();
-	Target.Z = FlightHeight + GetActorLocation().Z;
-	FVector Desired = (Target - Self).GetSafeNormal() * MaxSpeed;
-	return LimitVector(Desired - Boids[Idx].Velocity, MaxForce);
+	FVector Target = HeroPositions[Closest];
+	Target.Z = ChaseZ;
+	const FVector Desired = (Target - Self).GetSafeNormal() * MaxSpeed;
+	return LimitVector(Desired - Velocity, MaxForce);
 }
 
-FVector ABoidPredatorSwarmZone::LimitVector(const FVector& V, float MaxLen) const
+FVector ABoidPredatorSwarmZone::LimitVector(const FVector& V, float MaxLen)
 {
 	const float Sq = V.SizeSquared();
 	if (Sq > MaxLen * MaxLen)
@@ -201,41 +217,90 @@ FVector ABoidPredatorSwarmZone::LimitVector(const FVector& V, float MaxLen) cons
 
 void ABoidPredatorSwarmZone::UpdateBoids(float DeltaTime)
 {
-	BuildSpatialHash();
+	const int32 Num = Positions.Num();
+	if (Num == 0) return;
+
+	SpatialHash.Build(Positions, HashCellSize);
 
 	const float ChaseW = bInDiveMode ? DiveChaseWeight : ChaseWeight;
 	const float SpeedCap = bInDiveMode ? MaxSpeed * DiveSpeedMultiplier : MaxSpeed;
-
-	TArray<int32> Neighbors;
-	Neighbors.Reserve(32);
+	const float NeighborSq = NeighborRadius * NeighborRadius;
+	const float SepSq = SeparationRadius * SeparationRadius;
+	const float FloorZ = GetActorLocation().Z + FlightHeight;
+	const EParallelForFlags ParallelFlags = Num >= BoidSwarm::ParallelMinBoids
+		? EParallelForFlags::None
+		: EParallelForFlags::ForceSingleThread;
 
 	// 1단계: acceleration 계산
-	for (int32 i = 0; i < Boids.Num(); ++i)
+	//   - 읽기: Positions / Velocities / SpatialHash / HeroPositions (불변)
+	//   - 쓰기: Accelerations[i] (드론별 독립)
+	ParallelFor(Num, [&](int32 i)
 	{
-		GatherNeighbors(i, Neighbors);
+		const FVector Self = Positions[i];
+		const FVector Vel = Velocities[i];
 
-		const FVector Sep = ComputeSeparation(i, Neighbors) * SeparationWeight;
-		const FVector Ali = ComputeAlignment(i, Neighbors) * AlignmentWeight;
-		const FVector Coh = ComputeCohesion(i, Neighbors) * CohesionWeight;
-		const FVector Cha = ComputeChase(i) * ChaseW;
+		FVector SepSum = FVector::ZeroVector;
+		FVector VelSum = FVector::ZeroVector;
+		FVector PosSum = FVector::ZeroVector;
+		int32 SepCount = 0;
+		int32 NeighborCount = 0;
 
-		Boids[i].Acceleration = Sep + Ali + Coh + Cha;
-		Boids[i].Acceleration = LimitVector(Boids[i].Acceleration, MaxForce);
-	}
+		// 이웃 1회 순회로 분리/정렬/응집 누적값을 한 번에 계산
+		SpatialHash.ForEachInCellNeighborhood(Self, [&](int32 j, const FVector& PosJ)
+		{
+			if (j == i) return;
+
+			const FVector Diff = Self - PosJ;
+			const float DistSq = Diff.SizeSquared();
+			if (DistSq > NeighborSq) return;
+
+			++NeighborCount;
+			VelSum += Velocities[j];
+			PosSum += PosJ;
+
+			if (DistSq > 0.f && DistSq < SepSq)
+			{
+				SepSum += Diff.GetSafeNormal() / FMath::Sqrt(DistSq + 1.f);
+				++SepCount;
+			}
+		});
+
+		const FVector Sep = SepCount > 0 ? SepSum / (float)SepCount * MaxForce : FVector::ZeroVector;
+
+		FVector Ali = FVector::ZeroVector;
+		FVector Coh = FVector::ZeroVector;
+		if (NeighborCount > 0)
+		{
+			const FVector AvgVel = (VelSum / (float)NeighborCount).GetSafeNormal() * MaxSpeed;
+			Ali = LimitVector(AvgVel - Vel, MaxForce);
+
+			const FVector Center = PosSum / (float)NeighborCount;
+			const FVector Desired = (Center - Self).GetSafeNormal() * MaxSpeed;
+			Coh = LimitVector(Desired - Vel, MaxForce);
+		}
+
+		const FVector Cha = ComputeChase(Self, Vel, FloorZ);
+
+		Accelerations[i] = LimitVector(
+			Sep * SeparationWeight + Ali * AlignmentWeight + Coh * CohesionWeight + Cha * ChaseW,
+			MaxForce);
+	}, ParallelFlags);
 
 	// 2단계: 속도 + 위치 업데이트
-	const float FloorZ = GetActorLocation().Z + FlightHeight;
-	for (FBoid& B : Boids)
+	ParallelFor(Num, [&](int32 i)
 	{
-		B.Velocity += B.Acceleration * DeltaTime;
-		B.Velocity.Z = 0.f; // 평면 유지
-		if (B.Velocity.SizeSquared() > SpeedCap * SpeedCap)
+		FVector& V = Velocities[i];
+		V += Accelerations[i] * DeltaTime;
+		V.Z = 0.f; // 평면 유지
+		if (V.SizeSquared() > SpeedCap * SpeedCap)
 		{
-			B.Velocity = B.Velocity.GetSafeNormal() * SpeedCap;
+			V = V.GetSafeNormal() * SpeedCap;
 		}
-		B.Position += B.Velocity * DeltaTime;
-		B.Position.Z = FloorZ; // 평면 유지
-	}
+
+		FVector& P = Positions[i];
+		P += V * DeltaTime;
+		P.Z = FloorZ; // 평면 유지
+	}, ParallelFlags);
 }
 
 void ABoidPredatorSwarmZone::UpdateDiveMode(float DeltaTime)
@@ -260,6 +325,75 @@ void ABoidPredatorSwarmZone::UpdateDiveMode(float DeltaTime)
 	}
 }
 
+// ============================================================================
+// 네트워크 보정
+// ============================================================================
+
+void ABoidPredatorSwarmZone::SendCorrection(float DeltaTime)
+{
+	if (GetNetMode() == NM_Standalone) return;
+
+	CorrectionTimer += DeltaTime;
+	if (CorrectionTimer < CorrectionInterval) return;
+	CorrectionTimer = 0.f;
+
+	TArray<FVector_NetQuantize> NetPositions;
+	TArray<FVector_NetQuantize> NetVelocities;
+	NetPositions.Reserve(Positions.Num());
+	NetVelocities.Reserve(Velocities.Num());
+	for (int32 i = 0; i < Positions.Num(); ++i)
+	{
+		NetPositions.Add(Positions[i]);
+		NetVelocities.Add(Velocities[i]);
+	}
+
+	Multicast_SwarmCorrection(NetPositions, NetVelocities, bInDiveMode, DiveTimer, DiveElapsed);
+}
+
+void ABoidPredatorSwarmZone::Multicast_SwarmCorrection_Implementation(const TArray<FVector_NetQuantize>& InPositions,
+	const TArray<FVector_NetQuantize>& InVelocities, bool bInDive, float InDiveTimer, float InDiveElapsed)
+{
+	if (HasAuthority() || !bZoneActive) return;
+	if (InPositions.Num() != Positions.Num() || InVelocities.Num() != Velocities.Num()) return;
+
+	bInDiveMode = bInDive;
+	DiveTimer = InDiveTimer;
+	DiveElapsed = InDiveElapsed;
+
+	const float SnapSq = CorrectionSnapDistance * CorrectionSnapDistance;
+	for (int32 i = 0; i < Positions.Num(); ++i)
+	{
+		const FVector Error = InPositions[i] - Positions[i];
+		if (Error.SizeSquared() > SnapSq || CorrectionBlendTime <= 0.f)
+		{
+			Positions[i] = InPositions[i];
+			PendingCorrections[i] = FVector::ZeroVector;
+		}
+		else
+		{
+			PendingCorrections[i] = Error;
+		}
+		Velocities[i] = InVelocities[i];
+	}
+}
+
+void ABoidPredatorSwarmZone::ApplyPendingCorrections(float DeltaTime)
+{
+	if (CorrectionBlendTime <= 0.f) return;
+
+	const float Alpha = FMath::Min(1.f, DeltaTime / CorrectionBlendTime);
+	for (int32 i = 0; i < Positions.Num(); ++i)
+	{
+		const FVector Step = PendingCorrections[i] * Alpha;
+		Positions[i] += Step;
+		PendingCorrections[i] -= Step;
+	}
+}
+
+// ============================================================================
+// 데미지 / VFX
+// ============================================================================
+
 void ABoidPredatorSwarmZone::ProcessContactDamage()
 {
 	UWorld* World = GetWorld();
@@ -268,20 +402,20 @@ void ABoidPredatorSwarmZone::ProcessContactDamage()
 	const double Now = World->GetTimeSeconds();
 	const float ContactSq = ContactRadius * ContactRadius;
 
-	for (TActorIterator<AHellunaHeroCharacter> It(World); It; ++It)
+	for (int32 h = 0; h < HeroSnapshot.Num(); ++h)
 	{
-		AHellunaHeroCharacter* Hero = *It;
+		AHellunaHeroCharacter* Hero = HeroSnapshot[h].Get();
 		if (!IsValid(Hero)) continue;
 
 		double& LastTime = LastContactTime.FindOrAdd(Hero);
 		if (Now - LastTime < ContactCooldown) continue;
 
-		const FVector HeroPos = Hero->GetActorLocation();
-		for (const FBoid& B : Boids)
+		const FVector HeroPos = HeroPositions[h];
+		for (const FVector& BoidPos : Positions)
 		{
-			if (FVector::DistSquared(B.Position, HeroPos) <= ContactSq)
+			if (FVector::DistSquared(BoidPos, HeroPos) <= ContactSq)
 			{
-				const FVector HitFromDir = (HeroPos - B.Position).GetSafeNormal();
+				const FVector HitFromDir = (HeroPos - BoidPos).GetSafeNormal();
 				UGameplayStatics::ApplyPointDamage(
 					Hero, ContactDamage, HitFromDir, FHitResult(),
 					OwnerEnemy ? OwnerEnemy->GetController() : nullptr,
@@ -293,14 +427,21 @@ void ABoidPredatorSwarmZone::ProcessContactDamage()
 	}
 }
 
-void ABoidPredatorSwarmZone::UpdateVFXPositions()
+void ABoidPredatorSwarmZone::UpdateVFX()
 {
-	for (FBoid& B : Boids)
+	// 시스템 1개 — 배열 2개만 넘기면 Niagara가 드론 수만큼 그린다
+	if (SwarmVFXComp)
+	{
+		UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayPosition(SwarmVFXComp, SwarmPositionsParam, Positions);
+		UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector(SwarmVFXComp, SwarmVelocitiesParam, Velocities);
+		return;
+	}
+
+	for (int32 i = 0; i < LegacyBoidVFXComps.Num() && i < Positions.Num(); ++i)
 	{
-		if (B.VFXComp.IsValid())
+		if (LegacyBoidVFXComps[i].IsValid())
 		{
-			const FRotator Rot = B.Velocity.Rotation();
-			B.VFXComp->SetWorldLocationAndRotation(B.Position, Rot);
+			LegacyBoidVFXComps[i]->SetWorldLocationAndRotation(Positions[i], Velocities[i].Rotation());
 		}
 	}
 }
@@ -311,7 +452,21 @@ void ABoidPredatorSwarmZone::Tick(float DeltaTime)
 	if (!bZoneActive) return;
 
 	UpdateDiveMode(DeltaTime);
+	GatherHeroes();
 	UpdateBoids(DeltaTime);
-	ProcessContactDamage();
-	UpdateVFXPositions();
+
+	if (HasAuthority())
+	{
+		ProcessContactDamage();
+		SendCorrection(DeltaTime);
+	}
+	else
+	{
+		ApplyPendingCorrections(DeltaTime);
+	}
+
+	if (GetNetMode() != NM_DedicatedServer)
+	{
+		UpdateVFX();
+	}
 }
@@ -22,6 +22,7 @@
 #include "CollisionQueryParams.h"
 #include "HAL/IConsoleManager.h"
 #include "TimerManager.h"
+#include "Utils/HellunaActorRegistrySubsystem.h"
 
 ABossDeathCinematicTrigger::ABossDeathCinematicTrigger()
 {
@@ -34,10 +35,20 @@ void ABossDeathCinematicTrigger::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// [ActorRegistryV1] 시네마틱 트리거 목록
+	UHellunaActorRegistrySubsystem::RegisterActor(this, EHellunaActorBucket::CinematicTrigger);
+
 	// [BPDefaultSyncV1] placement instance override 무시.
 	SyncFromBPDefault();
 }
 
+void ABossDeathCinematicTrigger::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UHellunaActorRegistrySubsystem::UnregisterActor(this, EHellunaActorBucket::CinematicTrigger);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 // [BPDefaultSyncV1] BP CDO 의 Edit-가능 property 를 instance 에 강제 복사.
 //   AActor 부모 property 는 skip — placement 위치 reset 방지.
 void ABossDeathCinematicTrigger::SyncFromBPDefault()
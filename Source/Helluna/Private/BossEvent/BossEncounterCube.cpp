@@ -25,6 +25,7 @@
 #include "EngineUtils.h"
 #include "Engine/StaticMeshActor.h"
 #include "Engine/PostProcessVolume.h"
+#include "Utils/HellunaActorRegistrySubsystem.h"
 
 // ============================================================================
 // 생성자
@@ -66,6 +67,9 @@ void ABossEncounterCube::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// [ActorRegistryV1] 보스 조우 큐브 목록
+	UHellunaActorRegistrySubsystem::RegisterActor(this, EHellunaActorBucket::BossEncounterCube);
+
 	// 3D 상호작용 위젯 클래스 설정 (클라이언트+리슨서버)
 	if (InteractWidgetComp && InteractWidgetClass)
 	{
@@ -143,6 +147,13 @@ void ABossEncounterCube::BeginPlay()
 	}
 }
 
+void ABossEncounterCube::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UHellunaActorRegistrySubsystem::UnregisterActor(this, EHellunaActorBucket::BossEncounterCube);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ABossEncounterCube::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
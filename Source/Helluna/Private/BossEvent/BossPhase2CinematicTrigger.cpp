@@ -22,6 +22,7 @@
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "Blueprint/UserWidget.h"
+#include "Utils/HellunaActorRegistrySubsystem.h"
 
 // [Phase2FaceMatchDeathV1] 단계1a 만 head 본 anchor 사용 — 사망 시네마틱과 동일 close-up 구도.
 FVector ABossPhase2CinematicTrigger::ComputeFaceAnchor(const APawn* Boss) const
@@ -56,10 +57,20 @@ void ABossPhase2CinematicTrigger::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// [ActorRegistryV1] 시네마틱 트리거 목록
+	UHellunaActorRegistrySubsystem::RegisterActor(this, EHellunaActorBucket::CinematicTrigger);
+
 	// [BPDefaultSyncV1] placement instance override 무시.
 	SyncFromBPDefault();
 }
 
+void ABossPhase2CinematicTrigger::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UHellunaActorRegistrySubsystem::UnregisterActor(this, EHellunaActorBucket::CinematicTrigger);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 // [BPDefaultSyncV1] BP CDO 의 Edit-가능 property 를 instance 에 강제 복사.
 //   AActor 부모 property 는 skip — placement 위치 reset 방지.
 void ABossPhase2CinematicTrigger::SyncFromBPDefault()
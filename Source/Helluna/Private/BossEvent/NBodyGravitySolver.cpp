@@ -0,0 +1,283 @@
+// Capstone Project Helluna
+
+#include "BossEvent/NBodyGravitySolver.h"
+#include "Async/ParallelFor.h"
+
+namespace NBodySolver
+{
+	/** 같은 위치에 겹친 바디로 무한 분할되는 것을 막는 최대 깊이 */
+	constexpr int32 MaxTreeDepth = 24;
+
+	/** a_i += G * m_j / (r² + eps²) * (p_j - p_i) / r */
+	FORCEINLINE void AccumulatePair(FVector& Acc, const FVector& Self, const FVector& Other, double OtherMass,
+		double SoftSq, double G)
+	{
+		const FVector Delta = Other - Self;
+		const double RSq = Delta.SizeSquared() + SoftSq;
+		const double R = FMath::Sqrt(RSq);
+		if (R < KINDA_SMALL_NUMBER) return;
+		Acc += Delta * (G * OtherMass / (RSq * R));
+	}
+
+	FORCEINLINE FVector ClampAcceleration(const FVector& Acc, float MaxAcceleration)
+	{
+		return Acc.SizeSquared() > FMath::Square(MaxAcceleration)
+			? Acc.GetSafeNormal() * MaxAcceleration
+			: Acc;
+	}
+
+	FORCEINLINE EParallelForFlags GetFlags(const FNBodySolverParams& Params)
+	{
+		return Params.bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+	}
+}
+
+// ============================================================================
+// 진입점
+// ============================================================================
+
+void FNBodyGravitySolver::ComputeAccelerations(FNBodyState& State, const FNBodySolverParams& Params)
+{
+	if (Params.Theta <= 0.f)
+	{
+		ComputeExact(State, Params);
+		return;
+	}
+
+	int32 AliveCount = 0;
+	for (const uint8 bAlive : State.Alive)
+	{
+		AliveCount += bAlive ? 1 : 0;
+	}
+
+	if (AliveCount < Params.MinBodiesForTree)
+	{
+		ComputeExact(State, Params);
+	}
+	else
+	{
+		ComputeBarnesHut(State, Params);
+	}
+}
+
+void FNBodyGravitySolver::Step(FNBodyState& State, const FNBodySolverParams& Params, float Dt)
+{
+	ComputeAccelerations(State, Params);
+
+	// Semi-implicit Euler: v += a*dt, p += v*dt
+	for (int32 i = 0; i < State.Num(); ++i)
+	{
+		if (!State.Alive[i]) continue;
+		State.Velocities[i] += State.Accelerations[i] * Dt;
+		State.Positions[i] += State.Velocities[i] * Dt;
+	}
+}
+
+// ============================================================================
+// 정확 해 — 바디별 독립 합산 (ParallelFor)
+// ============================================================================
+
+void FNBodyGravitySolver::ComputeExact(FNBodyState& State, const FNBodySolverParams& Params)
+{
+	const int32 Num = State.Num();
+	const double SoftSq = FMath::Square((double)Params.Softening);
+	const double G = Params.GravityConstant;
+
+	ParallelFor(Num, [&](int32 i)
+	{
+		FVector Acc = FVector::ZeroVector;
+		if (State.Alive[i])
+		{
+			const FVector Self = State.Positions[i];
+			for (int32 j = 0; j < Num; ++j)
+			{
+				if (j == i || !State.Alive[j]) continue;
+				NBodySolver::AccumulatePair(Acc, Self, State.Positions[j], State.Masses[j], SoftSq, G);
+			}
+			Acc = NBodySolver::ClampAcceleration(Acc, Params.MaxAcceleration);
+		}
+		State.Accelerations[i] = Acc;
+	}, NBodySolver::GetFlags(Params));
+}
+
+// ============================================================================
+// Barnes–Hut
+// ============================================================================
+
+void FNBodyGravitySolver::ComputeBarnesHut(FNBodyState& State, const FNBodySolverParams& Params)
+{
+	BuildTree(State);
+
+	const double ThetaSq = FMath::Square((double)FMath::Max(Params.Theta, 0.f));
+	const double SoftSq = FMath::Square((double)Params.Softening);
+	const double G = Params.GravityConstant;
+
+	// 트리는 읽기 전용 → 바디별 평가 병렬
+	ParallelFor(State.Num(), [&](int32 i)
+	{
+		State.Accelerations[i] = State.Alive[i]
+			? NBodySolver::ClampAcceleration(EvaluateBody(State, i, ThetaSq, SoftSq, G), Params.MaxAcceleration)
+			: FVector::ZeroVector;
+	}, NBodySolver::GetFlags(Params));
+}
+
+int32 FNBodyGravitySolver::GetOctant(const FVector& Center, const FVector& Position)
+{
+	return (Position.X >= Center.X ? 1 : 0)
+		| (Position.Y >= Center.Y ? 2 : 0)
+		| (Position.Z >= Center.Z ? 4 : 0);
+}
+
+void FNBodyGravitySolver::BuildTree(const FNBodyState& State)
+{
+	Nodes.Reset();
+	NextBody.Init(INDEX_NONE, State.Num());
+
+	// 살아있는 바디를 감싸는 정육면체 루트
+	FBox Bounds(ForceInit);
+	for (int32 i = 0; i < State.Num(); ++i)
+	{
+		if (State.Alive[i])
+		{
+			Bounds += State.Positions[i];
+		}
+	}
+	if (!Bounds.IsValid)
+		return;
+
+	FNode& Root = Nodes.AddDefaulted_GetRef();
+	Root.Center = Bounds.GetCenter();
+	Root.HalfSize = Bounds.GetExtent().GetMax() + 1.0;
+
+	for (int32 i = 0; i < State.Num(); ++i)
+	{
+		if (State.Alive[i])
+		{
+			InsertBody(State, i);
+		}
+	}
+}
+
+void FNBodyGravitySolver::InsertBody(const FNBodyState& State, int32 Body)
+{
+	const FVector& P = State.Positions[Body];
+	const double M = State.Masses[Body];
+
+	int32 NodeIdx = 0;
+	int32 Depth = 0;
+	Nodes[NodeIdx].Mass += M;
+	Nodes[NodeIdx].WeightedPosSum += P * M;
+
+	while (true)
+	{
+		// 내부 노드 → 해당 옥턴트로 내려가며 질량 누적
+		if (Nodes[NodeIdx].FirstChild != INDEX_NONE)
+		{
+			NodeIdx = Nodes[NodeIdx].FirstChild + GetOctant(Nodes[NodeIdx].Center, P);
+			Nodes[NodeIdx].Mass += M;
+			Nodes[NodeIdx].WeightedPosSum += P * M;
+			++Depth;
+			continue;
+		}
+
+		// 빈 리프
+		if (Nodes[NodeIdx].FirstBody == INDEX_NONE)
+		{
+			Nodes[NodeIdx].FirstBody = Body;
+			return;
+		}
+
+		// 최대 깊이 — 분할 대신 체인에 추가 (겹친 바디)
+		if (Depth >= NBodySolver::MaxTreeDepth)
+		{
+			NextBody[Body] = Nodes[NodeIdx].FirstBody;
+			Nodes[NodeIdx].FirstBody = Body;
+			return;
+		}
+
+		// 바디 1개짜리 리프 → 8분할 후 기존 바디를 자식으로 이동
+		const int32 Existing = Nodes[NodeIdx].FirstBody;
+		const int32 First = Nodes.Num();
+		Nodes.AddDefaulted(8);
+
+		FNode& Parent = Nodes[NodeIdx];
+		Parent.FirstBody = INDEX_NONE;
+		Parent.FirstChild = First;
+
+		const double ChildHalf = Parent.HalfSize * 0.5;
+		for (int32 k = 0; k < 8; ++k)
+		{
+			FNode& Child = Nodes[First + k];
+			Child.HalfSize = ChildHalf;
+			Child.Center = Parent.Center + FVector(
+				(k & 1) ? ChildHalf : -ChildHalf,
+				(k & 2) ? ChildHalf : -ChildHalf,
+				(k & 4) ? ChildHalf : -ChildHalf);
+		}
+
+		const FVector& ExistingPos = State.Positions[Existing];
+		const double ExistingMass = State.Masses[Existing];
+		FNode& ExistingChild = Nodes[First + GetOctant(Parent.Center, ExistingPos)];
+		ExistingChild.FirstBody = Existing;
+		ExistingChild.Mass = ExistingMass;
+		ExistingChild.WeightedPosSum = ExistingPos * ExistingMass;
+		// 다음 루프에서 새 바디가 자식으로 내려감
+	}
+}
+
+FVector FNBodyGravitySolver::EvaluateBody(const FNBodyState& State, int32 Body, double ThetaSq, double SoftSq, double G) const
+{
+	FVector Acc = FVector::ZeroVector;
+	if (Nodes.IsEmpty())
+		return Acc;
+
+	const FVector Self = State.Positions[Body];
+
+	TArray<int32, TInlineAllocator<64>> Stack;
+	Stack.Add(0);
+
+	while (!Stack.IsEmpty())
+	{
+		const FNode& N = Nodes[Stack.Pop(EAllowShrinking::No)];
+		if (N.Mass <= 0.0)
+			continue;
+
+		// 리프 — 체인의 바디를 직접 합산 (자기 자신 제외)
+		if (N.FirstChild == INDEX_NONE)
+		{
+			for (int32 b = N.FirstBody; b != INDEX_NONE; b = NextBody[b])
+			{
+				if (b == Body) continue;
+				NBodySolver::AccumulatePair(Acc, Self, State.Positions[b], State.Masses[b], SoftSq, G);
+			}
+			continue;
+		}
+
+		// 자신이 들어있는 노드는 질량중심에 자기 질량이 섞여 있으므로 항상 연다
+		const FVector Offset = Self - N.Center;
+		const bool bContainsSelf = FMath::Abs(Offset.X) <= N.HalfSize
+			&& FMath::Abs(Offset.Y) <= N.HalfSize
+			&& FMath::Abs(Offset.Z) <= N.HalfSize;
+
+		if (!bContainsSelf)
+		{
+			const FVector MassCenter = N.WeightedPosSum / N.Mass;
+			const double DistSq = FVector::DistSquared(Self, MassCenter);
+			const double SizeSq = FMath::Square(N.HalfSize * 2.0);
+
+			// s / d < θ  ⇔  s² < θ² · d²
+			if (SizeSq < ThetaSq * DistSq)
+			{
+				NBodySolver::AccumulatePair(Acc, Self, MassCenter, N.Mass, SoftSq, G);
+				continue;
+			}
+		}
+
+		for (int32 k = 7; k >= 0; --k)
+		{
+			Stack.Add(N.FirstChild + k);
+		}
+	}
+
+	return Acc;
+}
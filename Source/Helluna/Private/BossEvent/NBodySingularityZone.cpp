@@ -7,7 +7,7 @@
 #include "NiagaraComponent.h"
 #include "NiagaraSystem.h"
 #include "Kismet/GameplayStatics.h"
-#include "EngineUtils.h"
+#include "Utils/HellunaActorRegistrySubsystem.h"
 
 ANBodySingularityZone::ANBodySingularityZone()
 {
@@ -19,6 +19,7 @@ void ANBodySingularityZone::ActivateZone()
 	if (!OwnerEnemy) { NotifyPatternFinished(false); return; }
 
 	bZoneActive = true;
+	FixedStepAccumulator = 0.f;
 	InitializeSingularities();
 	SetActorTickEnabled(true);
 
@@ -35,14 +36,17 @@ void ANBodySingularityZone::DeactivateZone()
 	SetActorTickEnabled(false);
 
 	// VFX 컴포넌트 정리
-	for (FSingularity& S : Singularities)
+	for (const TWeakObjectPtr<UNiagaraComponent>& Comp : BodyVFXComps)
 	{
-		if (S.VFXComp.IsValid())
+		if (Comp.IsValid())
 		{
-			S.VFXComp->DestroyComponent();
+			Comp->DestroyComponent();
 		}
 	}
-	Singularities.Empty();
+	BodyVFXComps.Empty();
+	Bodies.Reset();
+	MergerHash.Reset();
+	HeroSnapshot.Empty();
 
 	GetWorldTimerManager().ClearTimer(PatternEndTimerHandle);
 	NotifyPatternFinished(false);
@@ -50,8 +54,8 @@ void ANBodySingularityZone::DeactivateZone()
 
 void ANBodySingularityZone::InitializeSingularities()
 {
-	Singularities.Empty();
-	Singularities.Reserve(SingularityCount);
+	Bodies.Reset();
+	BodyVFXComps.Reset(SingularityCount);
 
 	const FVector Center = GetActorLocation();
 
@@ -61,78 +65,53 @@ void ANBodySingularityZone::InitializeSingularities()
 		const float Cos = FMath::Cos(Angle);
 		const float Sin = FMath::Sin(Angle);
 
-		FSingularity S;
-		S.Position = Center + FVector(Cos * InitialRadius, Sin * InitialRadius, 150.f);
+		const FVector Position = Center + FVector(Cos * InitialRadius, Sin * InitialRadius, 150.f);
 		// 접선 방향 (반시계): (-sin, cos)
-		S.Velocity = FVector(-Sin * InitialTangentialSpeed, Cos * InitialTangentialSpeed, 0.f);
-		S.Mass = Mass;
-		S.bAlive = true;
+		const FVector Velocity(-Sin * InitialTangentialSpeed, Cos * InitialTangentialSpeed, 0.f);
+		Bodies.Add(Position, Velocity, Mass);
 
 		// VFX 스폰
+		UNiagaraComponent* NC = nullptr;
 		if (SingularityVFX)
 		{
-			UNiagaraComponent* NC = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
-				GetWorld(), SingularityVFX, S.Position, FRotator::ZeroRotator,
+			NC = UNiagaraFunctionLibrary::SpawnSystemAtLocation(
+				GetWorld(), SingularityVFX, Position, FRotator::ZeroRotator,
 				FVector(SingularityVFXScale), false, true, ENCPoolMethod::None);
-			S.VFXComp = NC;
 		}
-
-		Singularities.Add(S);
+		BodyVFXComps.Add(NC);
 	}
 }
 
-void ANBodySingularityZone::ComputeForces()
+FNBodySolverParams ANBodySingularityZone::MakeSolverParams() const
 {
-	// O(N²) 쌍별 중력 계산
-	const float SoftSq = Softening * Softening;
-
-	for (FSingularity& S : Singularities)
-	{
-		S.Acceleration = FVector::ZeroVector;
-	}
-
-	for (int32 i = 0; i < Singularities.Num(); ++i)
-	{
-		if (!Singularities[i].bAlive) continue;
-		for (int32 j = i + 1; j < Singularities.Num(); ++j)
-		{
-			if (!Singularities[j].bAlive) continue;
-
-			const FVector Delta = Singularities[j].Position - Singularities[i].Position;
-			const float RSq = Delta.SizeSquared() + SoftSq;
-			const float R = FMath::Sqrt(RSq);
-			if (R < KINDA_SMALL_NUMBER) continue;
-
-			// F = G * m_i * m_j / r²
-			// a_i = F / m_i = G * m_j / r² (방향: Delta)
-			const FVector Direction = Delta / R;
-			const float ForcePerMass_i = GravityConstant * Singularities[j].Mass / RSq;
-			const float ForcePerMass_j = GravityConstant * Singularities[i].Mass / RSq;
-
-			Singularities[i].Acceleration += Direction * ForcePerMass_i;
-			Singularities[j].Acceleration -= Direction * ForcePerMass_j;
-		}
-	}
+	FNBodySolverParams Params;
+	Params.GravityConstant = GravityConstant;
+	Params.Softening = Softening;
+	Params.MaxAcceleration = MaxAcceleration;
+	Params.Theta = BarnesHutTheta;
+	Params.MinBodiesForTree = BarnesHutMinBodies;
+	return Params;
+}
 
-	// 최대 가속도 클램프
-	for (FSingularity& S : Singularities)
+void ANBodySingularityZone::GatherHeroes()
+{
+	HeroSnapshot.Reset();
+	if (const UHellunaActorRegistrySubsystem* Registry = UHellunaActorRegistrySubsystem::Get(this))
 	{
-		if (S.Acceleration.SizeSquared() > MaxAcceleration * MaxAcceleration)
+		Registry->ForEach<AHellunaHeroCharacter>(EHellunaActorBucket::Hero, [this](AHellunaHeroCharacter* Hero)
 		{
-			S.Acceleration = S.Acceleration.GetSafeNormal() * MaxAcceleration;
-		}
+			HeroSnapshot.Add(Hero);
+			return true;
+		});
 	}
 }
 
-void ANBodySingularityZone::IntegrateMotion(float DeltaTime)
+void ANBodySingularityZone::SimulateStep(float StepDt)
 {
-	// Semi-implicit Euler: v += a*dt, p += v*dt
-	for (FSingularity& S : Singularities)
-	{
-		if (!S.bAlive) continue;
-		S.Velocity += S.Acceleration * DeltaTime;
-		S.Position += S.Velocity * DeltaTime;
-	}
+	// 중력 (정확 해 / Barnes–Hut) + semi-implicit Euler
+	Solver.Step(Bodies, MakeSolverParams(), StepDt);
+	HandleMergers();
+	EnforceBoundaryReflection();
 }
 
 void ANBodySingularityZone::EnforceBoundaryReflection()
@@ -140,25 +119,27 @@ void ANBodySingularityZone::EnforceBoundaryReflection()
 	const FVector Center = GetActorLocation();
 	const float MaxDistSq = MaxOrbitRadius * MaxOrbitRadius;
 
-	for (FSingularity& S : Singularities)
+	for (int32 i = 0; i < Bodies.Num(); ++i)
 	{
-		if (!S.bAlive) continue;
-		const FVector ToCenter = Center - S.Position;
+		if (!Bodies.Alive[i]) continue;
+		FVector& Position = Bodies.Positions[i];
+		FVector& Velocity = Bodies.Velocities[i];
+
+		const FVector ToCenter = Center - Position;
 		const float DistSq = ToCenter.SizeSquared2D();
 		if (DistSq > MaxDistSq)
 		{
 			const FVector Inward = FVector(ToCenter.X, ToCenter.Y, 0.f).GetSafeNormal();
 			// 현재 속도의 바깥 방향 성분을 반사
-			const float VDotN = FVector::DotProduct(S.Velocity, -Inward);
+			const float VDotN = FVector::DotProduct(Velocity, -Inward);
 			if (VDotN > 0.f)
 			{
-				S.Velocity -= 2.f * VDotN * (-Inward);
+				Velocity -= 2.f * VDotN * (-Inward);
 			}
 			// 위치도 경계 안으로 당기기
-			const float CurDist = FMath::Sqrt(DistSq);
 			const FVector Clamped = Center - Inward * MaxOrbitRadius;
-			S.Position.X = Clamped.X;
-			S.Position.Y = Clamped.Y;
+			Position.X = Clamped.X;
+			Position.Y = Clamped.Y;
 		}
 	}
 }
@@ -167,58 +148,57 @@ void ANBodySingularityZone::HandleMergers()
 {
 	const float MergeDistSq = MergerDistance * MergerDistance;
 
-	for (int32 i = 0; i < Singularities.Num(); ++i)
+	// 인접 셀만 검사 — 셀 크기 = 머저 거리이므로 3x3 셀이 후보 전부를 덮는다
+	MergerHash.Build(Bodies.Positions, FMath::Max(MergerDistance, 50.f));
+
+	for (int32 i = 0; i < Bodies.Num(); ++i)
 	{
-		if (!Singularities[i].bAlive) continue;
-		for (int32 j = i + 1; j < Singularities.Num(); ++j)
+		if (!Bodies.Alive[i]) continue;
+
+		MergerHash.ForEachInCellNeighborhood(Bodies.Positions[i], [&](int32 j, const FVector&)
 		{
-			if (!Singularities[j].bAlive) continue;
+			// 쌍 (i, j)는 i < j 에서 한 번만. 위치는 이번 스텝 머저 결과를 반영해 원본 배열에서 읽음
+			if (j <= i || !Bodies.Alive[i] || !Bodies.Alive[j]) return;
 
-			const float DistSq = FVector::DistSquared(
-				Singularities[i].Position, Singularities[j].Position);
-			if (DistSq < MergeDistSq)
+			const float DistSq = FVector::DistSquared(Bodies.Positions[i], Bodies.Positions[j]);
+			if (DistSq >= MergeDistSq) return;
+
+			// 머저: 질량 합산, 운동량 보존
+			const float M1 = Bodies.Masses[i];
+			const float M2 = Bodies.Masses[j];
+			const float TotalMass = M1 + M2;
+			const FVector MergedPos = (Bodies.Positions[i] * M1 + Bodies.Positions[j] * M2) / TotalMass;
+			const FVector MergedVel = (Bodies.Velocities[i] * M1 + Bodies.Velocities[j] * M2) / TotalMass;
+
+			SpawnMergerExplosion(MergedPos);
+
+			Bodies.Positions[i] = MergedPos;
+			Bodies.Velocities[i] = MergedVel;
+			Bodies.Masses[i] = TotalMass;
+			Bodies.Alive[j] = 0;
+
+			// j의 VFX 제거
+			if (BodyVFXComps.IsValidIndex(j) && BodyVFXComps[j].IsValid())
 			{
-				// 머저: 질량 합산, 운동량 보존
-				const float M1 = Singularities[i].Mass;
-				const float M2 = Singularities[j].Mass;
-				const float TotalMass = M1 + M2;
-				const FVector MergedPos = (Singularities[i].Position * M1 + Singularities[j].Position * M2) / TotalMass;
-				const FVector MergedVel = (Singularities[i].Velocity * M1 + Singularities[j].Velocity * M2) / TotalMass;
-
-				SpawnMergerExplosion(MergedPos);
-
-				Singularities[i].Position = MergedPos;
-				Singularities[i].Velocity = MergedVel;
-				Singularities[i].Mass = TotalMass;
-				Singularities[j].bAlive = false;
-
-				// j의 VFX 제거
-				if (Singularities[j].VFXComp.IsValid())
-				{
-					Singularities[j].VFXComp->DestroyComponent();
-				}
+				BodyVFXComps[j]->DestroyComponent();
+			}
 
-				// 범위 데미지
-				UWorld* World = GetWorld();
-				if (World)
+			// 범위 데미지
+			const float RSq = MergerExplosionRadius * MergerExplosionRadius;
+			for (const TWeakObjectPtr<AHellunaHeroCharacter>& HeroPtr : HeroSnapshot)
+			{
+				AHellunaHeroCharacter* Hero = HeroPtr.Get();
+				if (!IsValid(Hero)) continue;
+				if (FVector::DistSquared(Hero->GetActorLocation(), MergedPos) <= RSq)
 				{
-					const float RSq = MergerExplosionRadius * MergerExplosionRadius;
-					for (TActorIterator<AHellunaHeroCharacter> It(World); It; ++It)
-					{
-						AHellunaHeroCharacter* Hero = *It;
-						if (!IsValid(Hero)) continue;
-						if (FVector::DistSquared(Hero->GetActorLocation(), MergedPos) <= RSq)
-						{
-							const FVector MergerHitDir = (Hero->GetActorLocation() - MergedPos).GetSafeNormal();
-							UGameplayStatics::ApplyPointDamage(
-								Hero, MergerExplosionDamage, MergerHitDir, FHitResult(),
-								OwnerEnemy ? OwnerEnemy->GetController() : nullptr,
-								OwnerEnemy, UDamageType::StaticClass());
-						}
-					}
+					const FVector MergerHitDir = (Hero->GetActorLocation() - MergedPos).GetSafeNormal();
+					UGameplayStatics::ApplyPointDamage(
+						Hero, MergerExplosionDamage, MergerHitDir, FHitResult(),
+						OwnerEnemy ? OwnerEnemy->GetController() : nullptr,
+						OwnerEnemy, UDamageType::StaticClass());
 				}
 			}
-		}
+		});
 	}
 }
 
@@ -234,26 +214,23 @@ void ANBodySingularityZone::SpawnMergerExplosion(const FVector& Location)
 
 void ANBodySingularityZone::ApplyGravityToPlayers(float DeltaTime)
 {
-	UWorld* World = GetWorld();
-	if (!World) return;
-
 	const float SoftSq = Softening * Softening;
 
-	for (TActorIterator<AHellunaHeroCharacter> It(World); It; ++It)
+	for (const TWeakObjectPtr<AHellunaHeroCharacter>& HeroPtr : HeroSnapshot)
 	{
-		AHellunaHeroCharacter* Hero = *It;
+		AHellunaHeroCharacter* Hero = HeroPtr.Get();
 		if (!IsValid(Hero)) continue;
 
 		const FVector HeroPos = Hero->GetActorLocation();
 		FVector TotalAccel = FVector::ZeroVector;
 
-		for (const FSingularity& S : Singularities)
+		for (int32 i = 0; i < Bodies.Num(); ++i)
 		{
-			if (!S.bAlive) continue;
-			const FVector Delta = S.Position - HeroPos;
+			if (!Bodies.Alive[i]) continue;
+			const FVector Delta = Bodies.Positions[i] - HeroPos;
 			const float RSq = Delta.SizeSquared2D() + SoftSq;
 			const FVector Dir = FVector(Delta.X, Delta.Y, 0.f).GetSafeNormal();
-			const float Accel = GravityConstant * S.Mass / RSq * PlayerPullMultiplier;
+			const float Accel = GravityConstant * Bodies.Masses[i] / RSq * PlayerPullMultiplier;
 			TotalAccel += Dir * Accel;
 		}
 
@@ -274,21 +251,21 @@ void ANBodySingularityZone::ProcessContactDamage()
 	const double Now = World->GetTimeSeconds();
 	const float ContactSq = ContactRadius * ContactRadius;
 
-	for (TActorIterator<AHellunaHeroCharacter> It(World); It; ++It)
+	for (const TWeakObjectPtr<AHellunaHeroCharacter>& HeroPtr : HeroSnapshot)
 	{
-		AHellunaHeroCharacter* Hero = *It;
+		AHellunaHeroCharacter* Hero = HeroPtr.Get();
 		if (!IsValid(Hero)) continue;
 
 		double& LastTime = LastContactTime.FindOrAdd(Hero);
 		if (Now - LastTime < ContactCooldown) continue;
 
 		const FVector HeroPos = Hero->GetActorLocation();
-		for (const FSingularity& S : Singularities)
+		for (int32 i = 0; i < Bodies.Num(); ++i)
 		{
-			if (!S.bAlive) continue;
-			if (FVector::DistSquared(S.Position, HeroPos) <= ContactSq)
+			if (!Bodies.Alive[i]) continue;
+			if (FVector::DistSquared(Bodies.Positions[i], HeroPos) <= ContactSq)
 			{
-				const FVector HitFromDir = (HeroPos - S.Position).GetSafeNormal();
+				const FVector HitFromDir = (HeroPos - Bodies.Positions[i]).GetSafeNormal();
 				UGameplayStatics::ApplyPointDamage(
 					Hero, ContactDamage, HitFromDir, FHitResult(),
 					OwnerEnemy ? OwnerEnemy->GetController() : nullptr,
@@ -302,12 +279,12 @@ void ANBodySingularityZone::ProcessContactDamage()
 
 void ANBodySingularityZone::UpdateVFXPositions()
 {
-	for (FSingularity& S : Singularities)
+	for (int32 i = 0; i < Bodies.Num() && i < BodyVFXComps.Num(); ++i)
 	{
-		if (!S.bAlive) continue;
-		if (S.VFXComp.IsValid())
+		if (!Bodies.Alive[i]) continue;
+		if (BodyVFXComps[i].IsValid())
 		{
-			S.VFXComp->SetWorldLocation(S.Position);
+			BodyVFXComps[i]->SetWorldLocation(Bodies.Positions[i]);
 		}
 	}
 }
@@ -317,15 +294,34 @@ void ANBodySingularityZone::Tick(float DeltaTime)
 	Super::Tick(DeltaTime);
 	if (!bZoneActive) return;
 
-	// 수치 안정성을 위해 서브 스텝
-	const int32 Substeps = 2;
-	const float SubDt = DeltaTime / Substeps;
-	for (int32 s = 0; s < Substeps; ++s)
+	// 히어로는 프레임당 1회만 수집 (머저 데미지 / 흡인 / 접촉 공용)
+	GatherHeroes();
+
+	if (bDeterministicFixedStep)
+	{
+		// 고정 스텝 — 같은 초기 상태면 프레임레이트와 무관하게 같은 궤도
+		FixedStepAccumulator += DeltaTime;
+		int32 StepCount = 0;
+		while (FixedStepAccumulator >= FixedStepSeconds && StepCount < MaxFixedStepsPerFrame)
+		{
+			SimulateStep(FixedStepSeconds);
+			FixedStepAccumulator -= FixedStepSeconds;
+			++StepCount;
+		}
+		if (StepCount == MaxFixedStepsPerFrame)
+		{
+			FixedStepAccumulator = FMath::Min(FixedStepAccumulator, FixedStepSeconds);
+		}
+	}
+	else
 	{
-		ComputeForces();
-		IntegrateMotion(SubDt);
-		HandleMergers();
-		EnforceBoundaryReflection();
+		// 수치 안정성을 위해 서브 스텝
+		const int32 NumSubsteps = FMath::Max(Substeps, 1);
+		const float SubDt = DeltaTime / NumSubsteps;
+		for (int32 s = 0; s < NumSubsteps; ++s)
+		{
+			SimulateStep(SubDt);
+		}
 	}
 
 	ApplyGravityToPlayers(DeltaTime);
@@ -0,0 +1,193 @@
+// File: Source/Helluna/Private/BossEvent/Tests/NBodyGravitySolver.spec.cpp
+//
+// 자동화 테스트 — N-Body 중력 솔버 (정확 해 vs Barnes–Hut)
+//
+// 테스트 경로: Helluna.BossEvent.NBody.Solver
+// 실행: Session Frontend → Automation → "Helluna.BossEvent.NBody.Solver" 체크 후 RunTests
+// 또는 콘솔: Automation RunTests Helluna.BossEvent.NBody.Solver
+//
+// 검증 범위:
+//   - Theta = 0 Barnes–Hut 가 쌍별 정확 해와 일치 (합산 순서 차이만큼의 오차 허용)
+//   - Theta = 0.5 가속도 상대 오차 상한
+//   - 고정 스텝 K회 적분 후 궤도 편차 상한
+//   - 같은 입력 2회 실행 시 결과 비트 단위 동일 (ParallelFor 결정성)
+//   - 죽은 바디는 가속도 0 + 다른 바디에 영향 없음
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "BossEvent/NBodyGravitySolver.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace NBodySolverTest
+{
+	/** 구 안에 무작위 분포된 바디 세트 (시드 고정) */
+	static void MakeRandomBodies(FNBodyState& OutState, int32 Count, int32 Seed)
+	{
+		FRandomStream Stream(Seed);
+		OutState.Reset();
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const FVector Position = Stream.GetUnitVector() * Stream.FRandRange(100.f, 3000.f);
+			const FVector Velocity = Stream.GetUnitVector() * Stream.FRandRange(0.f, 300.f);
+			OutState.Add(Position, Velocity, Stream.FRandRange(50.f, 200.f));
+		}
+	}
+
+	static FNBodySolverParams MakeParams(float Theta)
+	{
+		FNBodySolverParams Params;
+		Params.GravityConstant = 50000.f;
+		Params.Softening = 100.f;
+		// 클램프가 오차 비교를 가리지 않도록 충분히 크게
+		Params.MaxAcceleration = 1.e9f;
+		Params.Theta = Theta;
+		Params.MinBodiesForTree = 0;
+		return Params;
+	}
+
+	/** 가속도 배열의 최대 상대 오차 (|a - ref| / |ref|, 분모는 전체 평균 크기로 하한) */
+	static double MaxRelativeError(const TArray<FVector>& Test, const TArray<FVector>& Reference)
+	{
+		double MeanMag = 0.0;
+		for (const FVector& A : Reference)
+		{
+			MeanMag += A.Size();
+		}
+		MeanMag = FMath::Max(MeanMag / FMath::Max(Reference.Num(), 1), UE_KINDA_SMALL_NUMBER);
+
+		double MaxErr = 0.0;
+		for (int32 i = 0; i < Reference.Num(); ++i)
+		{
+			const double Denom = FMath::Max(Reference[i].Size(), MeanMag * 0.1);
+			MaxErr = FMath::Max(MaxErr, (Test[i] - Reference[i]).Size() / Denom);
+		}
+		return MaxErr;
+	}
+}
+
+BEGIN_DEFINE_SPEC(FHellunaNBodySolverTest,
+	"Helluna.BossEvent.NBody.Solver",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+	FNBodyGravitySolver Solver;
+
+END_DEFINE_SPEC(FHellunaNBodySolverTest)
+
+void FHellunaNBodySolverTest::Define()
+{
+	using namespace NBodySolverTest;
+
+	Describe("Barnes-Hut", [this]()
+	{
+		It("Theta 0 이면 정확 해와 일치", [this]()
+		{
+			FNBodyState Exact;
+			MakeRandomBodies(Exact, 128, 1234);
+			FNBodyState Tree = Exact;
+
+			const FNBodySolverParams Params = MakeParams(0.f);
+			FNBodyGravitySolver::ComputeExact(Exact, Params);
+			Solver.ComputeBarnesHut(Tree, Params);
+
+			const double Err = MaxRelativeError(Tree.Accelerations, Exact.Accelerations);
+			TestTrue(FString::Printf(TEXT("Theta 0 상대 오차 %.2e < 1e-4"), Err), Err < 1.e-4);
+			TestTrue(TEXT("트리 노드 생성됨"), Solver.GetLastNodeCount() > 0);
+		});
+
+		It("Theta 0.5 상대 오차 상한", [this]()
+		{
+			FNBodyState Exact;
+			MakeRandomBodies(Exact, 200, 42);
+			FNBodyState Tree = Exact;
+
+			const FNBodySolverParams Params = MakeParams(0.5f);
+			FNBodyGravitySolver::ComputeExact(Exact, Params);
+			Solver.ComputeBarnesHut(Tree, Params);
+
+			const double Err = MaxRelativeError(Tree.Accelerations, Exact.Accelerations);
+			TestTrue(FString::Printf(TEXT("Theta 0.5 상대 오차 %.3f < 0.05"), Err), Err < 0.05);
+		});
+
+		It("고정 스텝 적분 후 궤도 편차 상한", [this]()
+		{
+			FNBodyState Exact;
+			MakeRandomBodies(Exact, 64, 7);
+			FNBodyState Tree = Exact;
+
+			FNBodySolverParams ExactParams = MakeParams(0.5f);
+			ExactParams.MinBodiesForTree = MAX_int32;	// ComputeAccelerations → 항상 정확 해
+			const FNBodySolverParams TreeParams = MakeParams(0.5f);
+
+			constexpr float Dt = 1.f / 60.f;
+			constexpr int32 NumSteps = 60;
+			FNBodyGravitySolver ExactSolver;
+			for (int32 s = 0; s < NumSteps; ++s)
+			{
+				ExactSolver.Step(Exact, ExactParams, Dt);
+				Solver.Step(Tree, TreeParams, Dt);
+			}
+
+			double MaxDrift = 0.0;
+			for (int32 i = 0; i < Exact.Num(); ++i)
+			{
+				MaxDrift = FMath::Max(MaxDrift, FVector::Dist(Exact.Positions[i], Tree.Positions[i]));
+			}
+			TestTrue(FString::Printf(TEXT("1초 적분 후 최대 편차 %.2fcm < 10cm"), MaxDrift), MaxDrift < 10.0);
+		});
+	});
+
+	Describe("결정성", [this]()
+	{
+		It("같은 입력은 비트 단위로 같은 결과", [this]()
+		{
+			FNBodyState A;
+			MakeRandomBodies(A, 150, 99);
+			FNBodyState B = A;
+
+			const FNBodySolverParams Params = MakeParams(0.5f);
+			FNBodyGravitySolver OtherSolver;
+			for (int32 s = 0; s < 30; ++s)
+			{
+				Solver.Step(A, Params, 1.f / 60.f);
+				OtherSolver.Step(B, Params, 1.f / 60.f);
+			}
+
+			bool bIdentical = true;
+			for (int32 i = 0; i < A.Num() && bIdentical; ++i)
+			{
+				bIdentical = A.Positions[i] == B.Positions[i] && A.Velocities[i] == B.Velocities[i];
+			}
+			TestTrue(TEXT("병렬 실행 2회 결과 동일"), bIdentical);
+		});
+	});
+
+	Describe("죽은 바디", [this]()
+	{
+		It("가속도 0 이고 다른 바디에 영향 없음", [this]()
+		{
+			FNBodyState WithDead;
+			MakeRandomBodies(WithDead, 32, 5);
+			FNBodyState Without = WithDead;
+
+			// 0번을 죽이고, 비교군에서는 질량을 0으로 만들어 같은 효과
+			WithDead.Alive[0] = 0;
+			Without.Masses[0] = 0.f;
+
+			const FNBodySolverParams Params = MakeParams(0.5f);
+			Solver.ComputeBarnesHut(WithDead, Params);
+			FNBodyGravitySolver::ComputeExact(Without, Params);
+
+			TestTrue(TEXT("죽은 바디 가속도 0"), WithDead.Accelerations[0].IsZero());
+
+			TArray<FVector> TestAcc(WithDead.Accelerations);
+			TArray<FVector> RefAcc(Without.Accelerations);
+			TestAcc.RemoveAt(0);
+			RefAcc.RemoveAt(0);
+			const double Err = MaxRelativeError(TestAcc, RefAcc);
+			TestTrue(FString::Printf(TEXT("나머지 바디 상대 오차 %.3f < 0.05"), Err), Err < 0.05);
+		});
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -68,9 +68,20 @@
 // [AttackHitbox] Overlap 기반 공격 판정용 — 전용 Box 타입
 #include "Combat/HellunaAttackRangeComponent.h"
 #include "Engine/OverlapResult.h"
+#include "Utils/HellunaActorRegistrySubsystem.h"
+
+// [AnimBudgetV1] 서버 스켈레톤 스킵 CVar
+#include "HAL/IConsoleManager.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogHellunaEnemyDissolve, Log, All);
 
+// [AnimBudgetV1] 데디 서버 스켈레톤 스킵 토글
+static TAutoConsoleVariable<int32> CVarEnemyServerSkipIdleSkeleton(
+	TEXT("Helluna.Enemy.ServerSkipIdleSkeleton"),
+	1,
+	TEXT("1 = 데디 서버에서 몽타주/공격 포즈가 없는 적은 스켈레톤 갱신을 생략 (bNoSkeletonUpdate).\n 몽타주가 시작되면 즉시 복구되어 노티파이/종료 콜백은 그대로 동작한다."),
+	ECVF_Default);
+
 namespace
 {
 	float HellunaDeathDissolveSmoothStep(float Edge0, float Edge1, float Value)
@@ -359,6 +370,9 @@ void AHellunaEnemyCharacter::BeginPlay()
 
 	Super::BeginPlay();
 
+	// [ActorRegistryV1] 킥 프롬프트 등 적 목록 조회용 (풀링 비활성 Actor 포함 — 기존 GetAllActorsOfClass와 동일)
+	UHellunaActorRegistrySubsystem::RegisterActor(this, EHellunaActorBucket::Enemy);
+
 	if (!HasAuthority()) return;
 
 	// [공격 히트박스] BP 에 배치된 "Hitbox_*" 박스들의 BeginOverlap 바인딩. 서버만.
@@ -448,10 +462,28 @@ void AHellunaEnemyCharacter::BeginPlay()
 		}
 	}
 
+	// [AnimBudgetV1] 몽타주 시작/종료 시 데디 서버 스켈레톤 스킵 재평가.
+	//   Prewarm 이후에 바인딩 — 예열용 Play/Stop 은 콜백 대상 아님.
+	if (USkeletalMeshComponent* SkelMesh = GetMesh())
+	{
+		if (UAnimInstance* AnimInst = SkelMesh->GetAnimInstance())
+		{
+			AnimInst->OnMontageStarted.AddUniqueDynamic(this, &AHellunaEnemyCharacter::OnServerAnimMontageStarted);
+			AnimInst->OnMontageEnded.AddUniqueDynamic(this, &AHellunaEnemyCharacter::OnServerAnimMontageEnded);
+		}
+	}
+
 	// 레벨 배치(비풀) 액터용 — Pool 경로는 SpawnProcessor 에서 색을 결정해 ActivateActor 가 ApplyTeamColor 호출.
 	ApplyRandomTeamColor();
 }
 
+void AHellunaEnemyCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UHellunaActorRegistrySubsystem::UnregisterActor(this, EHellunaActorBucket::Enemy);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AHellunaEnemyCharacter::ApplyRandomTeamColor()
 {
 	if (!HasAuthority()) return;
@@ -1310,7 +1342,8 @@ void AHellunaEnemyCharacter::ApplyDeathDissolveAmount(float Amount)
 }
 
 // ============================================================
-// UpdateAnimationLOD — 거리 기반 그림자/스켈레톤 품질 조절
+// UpdateAnimationLOD — 거리 기반 그림자/URO 갱신 주기 조절
+// [AnimBudgetV1] 밴드별 URO 기본 주기 + 데디 서버 스켈레톤 스킵 재평가
 // @author 김기현
 // ============================================================
 void AHellunaEnemyCharacter::UpdateAnimationLOD(float DistanceToCamera)
@@ -1321,24 +1354,97 @@ void AHellunaEnemyCharacter::UpdateAnimationLOD(float DistanceToCamera)
 	const float NearDist = 2000.f;
 	const float MidDist  = 4000.f;
 
+	// 엔진 기본 비렌더 주기(4)가 하한 — 데디 서버는 항상 비렌더라 이보다 낮추면 평가가 오히려 늘어난다
 	if (DistanceToCamera < NearDist)
 	{
-		// 가까운 거리: 풀 품질
-		SkelMesh->bNoSkeletonUpdate = false;
+		// 가까운 거리: 그림자 유지, 엔진 기본 주기(4프레임)
 		SkelMesh->SetCastShadow(true);
+		BandAnimUpdateRate = EngineNonRenderedAnimUpdateRate;
 	}
 	else if (DistanceToCamera < MidDist)
 	{
-		// 중간 거리: 그림자 제거
-		SkelMesh->bNoSkeletonUpdate = false;
+		// 중간 거리: 그림자 제거, 8프레임마다 평가
 		SkelMesh->SetCastShadow(false);
+		BandAnimUpdateRate = EngineNonRenderedAnimUpdateRate * 2;
 	}
 	else
 	{
-		// 먼 거리: 그림자 제거
-		SkelMesh->bNoSkeletonUpdate = false;
+		// 먼 거리: 그림자 제거, 16프레임마다 평가
 		SkelMesh->SetCastShadow(false);
+		BandAnimUpdateRate = EngineNonRenderedAnimUpdateRate * 4;
+	}
+
+	// 예산 분배 전 기본값 — 예산을 넘으면 Processor 가 같은 프레임에 더 늘린다
+	SetServerAnimUpdateRate(BandAnimUpdateRate);
+	RefreshServerSkeletonUpdate();
+}
+
+// ============================================================
+// [AnimBudgetV1] SetServerAnimUpdateRate — URO 비렌더 갱신 주기 적용
+//   데디 서버는 항상 비렌더 상태이므로 BaseNonRenderedUpdateRate 가 실제 평가 주기.
+//   URO 가 건너뛴 프레임의 DeltaTime 은 누적되어 다음 평가에 반영 → 몽타주 노티파이 누락 없음.
+//   엔진 기본값 미만으로는 내리지 않는다 (예산은 주기를 늘리기만 함).
+// ============================================================
+void AHellunaEnemyCharacter::SetServerAnimUpdateRate(int32 UpdateRate)
+{
+	UpdateRate = FMath::Max(EngineNonRenderedAnimUpdateRate, UpdateRate);
+	if (UpdateRate == AppliedAnimUpdateRate) return;
+
+	USkeletalMeshComponent* SkelMesh = GetMesh();
+	if (!SkelMesh || !SkelMesh->AnimUpdateRateParams) return;
+
+	SkelMesh->AnimUpdateRateParams->BaseNonRenderedUpdateRate = UpdateRate;
+	AppliedAnimUpdateRate = UpdateRate;
+}
+
+bool AHellunaEnemyCharacter::IsEvaluatingSkeleton() const
+{
+	const USkeletalMeshComponent* SkelMesh = GetMesh();
+	return SkelMesh && !SkelMesh->bNoSkeletonUpdate && !SkelMesh->bPauseAnims;
+}
+
+// ============================================================
+// [AnimBudgetV1] RefreshServerSkeletonUpdate — 데디 서버 스켈레톤 스킵
+//
+// 데디 서버에서 스켈레톤 포즈가 필요한 경우:
+//   - 몽타주 재생 중 (노티파이/종료 콜백이 GA/StateTree 를 진행시킴 — 몽타주가 멈추면 GA 가 끝나지 않음)
+//   - 공격 포즈 틱 강제 중 (히트박스 소켓 위치)
+//   - 사망 처리 중
+// 그 외(이동/대기)에는 포즈를 아무도 읽지 않으므로 bNoSkeletonUpdate 로 평가 자체를 생략.
+// Pool 비활성 Actor 는 EnemyActorPool 이 bNoSkeletonUpdate 를 관리하므로 건드리지 않는다.
+// ============================================================
+void AHellunaEnemyCharacter::RefreshServerSkeletonUpdate()
+{
+	if (GetNetMode() != NM_DedicatedServer) return;
+	if (IsHidden()) return;
+
+	USkeletalMeshComponent* SkelMesh = GetMesh();
+	if (!SkelMesh) return;
+
+	bool bNeedsSkeleton = CVarEnemyServerSkipIdleSkeleton.GetValueOnGameThread() == 0
+		|| bPoseTickSaved
+		|| (HealthComponent && HealthComponent->IsDead());
+
+	if (!bNeedsSkeleton)
+	{
+		const UAnimInstance* AnimInst = SkelMesh->GetAnimInstance();
+		bNeedsSkeleton = !AnimInst || AnimInst->IsAnyMontagePlaying();
 	}
+
+	SkelMesh->bNoSkeletonUpdate = !bNeedsSkeleton;
+}
+
+void AHellunaEnemyCharacter::OnServerAnimMontageStarted(UAnimMontage* Montage)
+{
+	// 스킵 중 몽타주가 시작되면 다음 틱부터 바로 진행되도록 즉시 복구
+	RefreshServerSkeletonUpdate();
+}
+
+void AHellunaEnemyCharacter::OnServerAnimMontageEnded(UAnimMontage* Montage, bool bInterrupted)
+{
+	// 종료 콜백 시점엔 인스턴스가 아직 정리 전일 수 있어 다음 틱에 재평가
+	if (GetNetMode() != NM_DedicatedServer) return;
+	GetWorldTimerManager().SetTimerForNextTick(this, &AHellunaEnemyCharacter::RefreshServerSkeletonUpdate);
 }
 
 void AHellunaEnemyCharacter::TestDamage(AActor* DamagedActor, float DamageAmount)
@@ -1440,6 +1546,8 @@ void AHellunaEnemyCharacter::OnMonsterDeath(AActor* DeadActor, AActor* KillerAct
 			AnimInst->StopAllMontages(0.f);
 		}
 	}
+	// [AnimBudgetV1] 사망 연출(GA_Death 몽타주) 전 스켈레톤 스킵 해제
+	RefreshServerSkeletonUpdate();
 	// [HitReactFreezeV1] 피격 정지 중 사망 시: 타이머 정리 + 속도 복원.
 	//   풀 재사용 시 MaxWalkSpeed=0 이 남아 멈춰버리는 것을 방지.
 	if (UWorld* World = GetWorld())
@@ -2443,6 +2551,9 @@ void AHellunaEnemyCharacter::SetServerAttackPoseTickEnabled(bool bEnable)
 		M->bEnableUpdateRateOptimizations  = bSavedURO;
 		bPoseTickSaved = false;
 	}
+
+	// [AnimBudgetV1] 공격 포즈 중에는 스켈레톤 스킵 해제, 종료 후 재평가
+	RefreshServerSkeletonUpdate();
 }
 
 // ============================================================
@@ -59,6 +59,7 @@
 
 // [BossDissolveComponentV1]
 #include "Character/EnemyComponent/BossDissolveComponent.h"
+#include "Utils/HellunaActorRegistrySubsystem.h"
 
 AHellunaEnemyCharacter_Boss::AHellunaEnemyCharacter_Boss()
 {
@@ -123,6 +124,9 @@ void AHellunaEnemyCharacter_Boss::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// [ActorRegistryV1] 보스 목록 (Enemy 버킷은 부모에서 등록)
+	UHellunaActorRegistrySubsystem::RegisterActor(this, EHellunaActorBucket::Boss);
+
 	// bDebugStartInPhase2 가 켜져 있으면 1페이즈 전투를 건너뛰고 바로 2페이즈 보스/사망을
 	//   테스트할 수 있게 스폰 직후 EnterBossPhase2 호출. AI possess / ASC / HealthComponent
 	//   초기화를 기다리려 1초 지연. 서버 권한에서만.
@@ -150,6 +154,13 @@ void AHellunaEnemyCharacter_Boss::BeginPlay()
 	}
 }
 
+void AHellunaEnemyCharacter_Boss::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UHellunaActorRegistrySubsystem::UnregisterActor(this, EHellunaActorBucket::Boss);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 // ============================================================
 // [BossCinematicFreezeV1] 시네마틱 중 무적
 //   소환/페이즈2/사망 시네마틱이 재생 중이면 들어오는 데미지를 전부 무시(0).
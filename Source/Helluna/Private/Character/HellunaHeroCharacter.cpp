@@ -78,6 +78,7 @@
 #include "Engine/OverlapResult.h"
 #include "Widgets/HUD/Inv_InteractPromptWidget.h"
 #include "Components/Image.h"
+#include "Utils/HellunaActorRegistrySubsystem.h"
 
 
 
@@ -188,6 +189,9 @@ void AHellunaHeroCharacter::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// [ActorRegistryV1] 월드 스캔 없이 Hero 목록 조회용
+	UHellunaActorRegistrySubsystem::RegisterActor(this, EHellunaActorBucket::Hero);
+
 	// [MoveSpeedBaseV1] ActiveBaseWalkSpeed 를 BaseWalkSpeed 로 동기화 + 초기 MaxWalkSpeed 보정.
 	//   BP 에서 BaseWalkSpeed 를 기본값(400) 과 다르게 설정해도 시작부터 올바른 속도가 적용됨.
 	ActiveBaseWalkSpeed = BaseWalkSpeed;
@@ -616,6 +620,8 @@ void AHellunaHeroCharacter::InitWeaponHUD()
 // ============================================
 void AHellunaHeroCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	UHellunaActorRegistrySubsystem::UnregisterActor(this, EHellunaActorBucket::Hero);
+
 	// [Downed/Revive] 타이머 + 관계 정리
 	if (UWorld* World = GetWorld())
 	{
@@ -1054,11 +1060,11 @@ void AHellunaHeroCharacter::Server_RepairSpaceShip_Implementation(FGameplayTag M
 		return;
 	}
 
-	// World에서 "SpaceShip" 태그를 가진 Actor 찾기
-	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsWithTag(GetWorld(), FName("SpaceShip"), FoundActors);
+	// [ActorRegistryV1] 레지스트리에서 우주선 조회 (GetAllActorsWithTag 월드 스캔 제거)
+	const UHellunaActorRegistrySubsystem* Registry = UHellunaActorRegistrySubsystem::Get(this);
+	AActor* FoundShip = Registry ? Registry->GetSpaceShip() : nullptr;
 
-	if (FoundActors.Num() == 0)
+	if (!FoundShip)
 	{
 #if HELLUNA_DEBUG_HERO
 		UE_LOG(LogTemp, Error, TEXT("  ❌ SpaceShip을 찾을 수 없음! 'SpaceShip' 태그 확인 필요"));
@@ -1067,7 +1073,7 @@ void AHellunaHeroCharacter::Server_RepairSpaceShip_Implementation(FGameplayTag M
 	}
 
 	// SpaceShip 찾음
-	if (AResourceUsingObject_SpaceShip* SpaceShip = Cast<AResourceUsingObject_SpaceShip>(FoundActors[0]))
+	if (AResourceUsingObject_SpaceShip* SpaceShip = Cast<AResourceUsingObject_SpaceShip>(FoundShip))
 	{
 #if HELLUNA_DEBUG_HERO
 		UE_LOG(LogTemp, Warning, TEXT("  ✅ SpaceShip 찾음: %s"), *SpaceShip->GetName());
@@ -1193,11 +1199,8 @@ void AHellunaHeroCharacter::Server_HealShipFromMaterials_Implementation(FGamepla
 	const int32 TotalMaterials = Material1Amount + Material2Amount;
 	if (TotalMaterials <= 0) return;
 
-	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsWithTag(GetWorld(), FName("SpaceShip"), FoundActors);
-	if (FoundActors.Num() == 0) return;
-
-	AResourceUsingObject_SpaceShip* SpaceShip = Cast<AResourceUsingObject_SpaceShip>(FoundActors[0]);
+	const UHellunaActorRegistrySubsystem* Registry = UHellunaActorRegistrySubsystem::Get(this);
+	AResourceUsingObject_SpaceShip* SpaceShip = Registry ? Cast<AResourceUsingObject_SpaceShip>(Registry->GetSpaceShip()) : nullptr;
 	if (!SpaceShip) return;
 
 	UHellunaHealthComponent* ShipHC = SpaceShip->GetShipHealthComponent();
@@ -1295,9 +1298,8 @@ void AHellunaHeroCharacter::ToggleShipHealMenu()
 		}
 	}
 
-	TArray<AActor*> FoundShips;
-	UGameplayStatics::GetAllActorsWithTag(GetWorld(), FName("SpaceShip"), FoundShips);
-	AResourceUsingObject_SpaceShip* Ship = (FoundShips.Num() > 0) ? Cast<AResourceUsingObject_SpaceShip>(FoundShips[0]) : nullptr;
+	const UHellunaActorRegistrySubsystem* Registry = UHellunaActorRegistrySubsystem::Get(this);
+	AResourceUsingObject_SpaceShip* Ship = Registry ? Cast<AResourceUsingObject_SpaceShip>(Registry->GetSpaceShip()) : nullptr;
 	if (!Ship) return;
 
 	URepairComponent* RepairComp = Ship->FindComponentByClass<URepairComponent>();
@@ -3316,12 +3318,16 @@ AHellunaHeroCharacter* AHellunaHeroCharacter::FindNearestDownedHero() const
 	int32 CheckedCount = 0;
 
 	// [Fix] 클라이언트에서도 동작하도록 PlayerControllerIterator 대신 캐릭터 직접 탐색
-	TArray<AActor*> AllHeroes;
-	UGameplayStatics::GetAllActorsOfClass(World, AHellunaHeroCharacter::StaticClass(), AllHeroes);
+	// [ActorRegistryV1] 월드 스캔 대신 Hero 버킷 사용
+	UHellunaActorRegistrySubsystem* Registry = World->GetSubsystem<UHellunaActorRegistrySubsystem>();
+	TArray<AHellunaHeroCharacter*> AllHeroes;
+	if (Registry)
+	{
+		Registry->GetActors<AHellunaHeroCharacter>(EHellunaActorBucket::Hero, AllHeroes);
+	}
 
-	for (AActor* Actor : AllHeroes)
+	for (AHellunaHeroCharacter* OtherHero : AllHeroes)
 	{
-		AHellunaHeroCharacter* OtherHero = Cast<AHellunaHeroCharacter>(Actor);
 		if (!OtherHero || OtherHero == this) continue;
 
 		CheckedCount++;
@@ -3958,39 +3964,38 @@ void AHellunaHeroCharacter::UpdateKickPrompt(float DeltaTime)
 	AHellunaEnemyCharacter* BestEnemy = nullptr;
 	float BestDistSq = RangeSq;
 
-	// GetAllActorsOfClass로 모든 적을 순회 (OverlapMulti보다 안정적)
-	TArray<AActor*> AllEnemies;
-	UGameplayStatics::GetAllActorsOfClass(World, AHellunaEnemyCharacter::StaticClass(), AllEnemies);
+	// 모든 적을 순회 (OverlapMulti보다 안정적)
+	// [ActorRegistryV1] 매 틱 GetAllActorsOfClass(월드 전체 스캔) 대신 Enemy 버킷만 순회
+	UHellunaActorRegistrySubsystem* Registry = World->GetSubsystem<UHellunaActorRegistrySubsystem>();
+	if (!Registry) return;
 
-	for (AActor* Actor : AllEnemies)
+	Registry->ForEach<AHellunaEnemyCharacter>(EHellunaActorBucket::Enemy, [&](AHellunaEnemyCharacter* Enemy)
 	{
-		AHellunaEnemyCharacter* Enemy = Cast<AHellunaEnemyCharacter>(Actor);
-		if (!Enemy) continue;
-
 		// 거리 체크
 		const float DistSq = FVector::DistSquared(MyLocation, Enemy->GetActorLocation());
-		if (DistSq > RangeSq) continue;
+		if (DistSq > RangeSq) return true;
 
 		// Staggered 태그 체크
 		if (!UHellunaFunctionLibrary::NativeDoesActorHaveTag(Enemy, HellunaGameplayTags::Enemy_State_Staggered))
-			continue;
+			return true;
 
 		// 사망 체크
 		if (UHellunaHealthComponent* HC = Enemy->FindComponentByClass<UHellunaHealthComponent>())
 		{
-			if (HC->IsDead()) continue;
+			if (HC->IsDead()) return true;
 		}
 
 		// 전방각 체크
 		const FVector ToEnemy = (Enemy->GetActorLocation() - MyLocation).GetSafeNormal();
-		if (FVector::DotProduct(MyForward, ToEnemy) < CosHalfAngle) continue;
+		if (FVector::DotProduct(MyForward, ToEnemy) < CosHalfAngle) return true;
 
 		if (DistSq < BestDistSq)
 		{
 			BestDistSq = DistSq;
 			BestEnemy = Enemy;
 		}
-	}
+		return true;
+	});
 
 	if (BestEnemy)
 	{
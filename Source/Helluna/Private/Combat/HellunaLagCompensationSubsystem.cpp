@@ -0,0 +1,453 @@
+/**
+ * HellunaLagCompensationSubsystem.cpp
+ *
+ * [LagCompV1] 히트스캔 래그 보상 구현.
+ *
+ * @author 김민우
+ */
+
+// File: Source/Helluna/Private/Combat/HellunaLagCompensationSubsystem.cpp
+
+#include "Combat/HellunaLagCompensationSubsystem.h"
+
+#include "Utils/HellunaActorRegistrySubsystem.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarLagCompEnable(
+	TEXT("Helluna.LagComp.Enable"),
+	1,
+	TEXT("1 = 히트스캔 발사 시 클라 화면 시각으로 영웅/적 캡슐을 되감아 판정. 0 = 서버 현재 위치로만 판정."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarLagCompMaxRewindMs(
+	TEXT("Helluna.LagComp.MaxRewindMs"),
+	200.f,
+	TEXT("되감기 최대 시간(ms). 이보다 과거를 보고한 발사는 이 시각으로 잘린다.\n 보관 히스토리(HistorySize / RecordHz)보다 길게 잡아도 히스토리 길이가 상한."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarLagCompRecordHz(
+	TEXT("Helluna.LagComp.RecordHz"),
+	30.f,
+	TEXT("캡슐 히스토리 기록 주기(Hz). 서버 넷 틱과 맞춘다."),
+	ECVF_Default);
+
+namespace LagComp
+{
+	/** 현재 트레이스가 추적 대상을 맞췄을 때, 고정 장애물을 찾기 위해 다시 쏘는 최대 횟수 */
+	constexpr int32 MaxBlockerRetraces = 4;
+
+	/** 되감은 후보가 죽었거나 Pool 로 돌아갔을 때 다음 후보를 찾는 최대 횟수 (초과 시 현재 트레이스 결과 유지) */
+	constexpr int32 MaxRewindCandidates = 4;
+}
+
+// ============================================================================
+// 접근
+// ============================================================================
+UHellunaLagCompensationSubsystem* UHellunaLagCompensationSubsystem::Get(const UObject* WorldContext)
+{
+	if (!WorldContext || !GEngine)
+		return nullptr;
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UHellunaLagCompensationSubsystem>() : nullptr;
+}
+
+double UHellunaLagCompensationSubsystem::GetLocalViewServerTime(const APawn* ShooterPawn)
+{
+	if (!ShooterPawn)
+		return -1.0;
+
+	const UWorld* World = ShooterPawn->GetWorld();
+	const AGameStateBase* GS = World ? World->GetGameState() : nullptr;
+	if (!GS)
+		return -1.0;
+
+	// 리슨 서버 호스트/Standalone: 화면 = 서버 현재 상태 → 되감기 불필요
+	if (ShooterPawn->HasAuthority())
+		return -1.0;
+
+	double OneWaySeconds = 0.0;
+	if (const APlayerState* PS = ShooterPawn->GetPlayerState())
+	{
+		OneWaySeconds = PS->GetPingInMilliseconds() * 0.0005;
+	}
+
+	return GS->GetServerWorldTimeSeconds() - OneWaySeconds;
+}
+
+bool UHellunaLagCompensationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UHellunaLagCompensationSubsystem::Deinitialize()
+{
+	Targets.Empty();
+	TargetIndexByActor.Empty();
+	StaleTargets.Empty();
+	FrameSerial = 0;
+
+	Super::Deinitialize();
+}
+
+TStatId UHellunaLagCompensationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UHellunaLagCompensationSubsystem, STATGROUP_Tickables);
+}
+
+double UHellunaLagCompensationSubsystem::GetServerTime() const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+		return 0.0;
+
+	const AGameStateBase* GS = World->GetGameState();
+	return GS ? GS->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
+
+bool UHellunaLagCompensationSubsystem::IsRecordingWorld() const
+{
+	// 원격 클라가 있는 서버만 — Standalone/클라는 되감을 대상이 없다
+	const UWorld* World = GetWorld();
+	if (!World)
+		return false;
+
+	const ENetMode NetMode = World->GetNetMode();
+	return NetMode == NM_ListenServer || NetMode == NM_DedicatedServer;
+}
+
+// ============================================================================
+// 기록
+// ============================================================================
+void UHellunaLagCompensationSubsystem::Tick(float DeltaTime)
+{
+	if (!IsRecordingWorld())
+		return;
+
+	TimeUntilRecord -= DeltaTime;
+	if (TimeUntilRecord > 0.f)
+		return;
+
+	// 히치 후 밀린 주기를 몰아서 기록하지 않는다 — 다음 주기부터 다시 센다
+	TimeUntilRecord = 1.f / FMath::Max(1.f, CVarLagCompRecordHz.GetValueOnGameThread());
+
+	RecordFrame();
+}
+
+void UHellunaLagCompensationSubsystem::RecordFrame()
+{
+	UHellunaActorRegistrySubsystem* Registry = UHellunaActorRegistrySubsystem::Get(this);
+	if (!Registry)
+		return;
+
+	const int32 Slot = static_cast<int32>(FrameSerial % HistorySize);
+	FrameTimes[Slot] = GetServerTime();
+
+	// 이번 슬롯은 먼저 전부 "맞을 수 없음"으로 — 보이지 않은 대상에 HistorySize 프레임 전 값이 남지 않도록
+	for (FTarget& Target : Targets)
+	{
+		Target.Samples[Slot].bValid = false;
+	}
+
+	auto Record = [this, Slot](AActor* Actor)
+	{
+		RecordActor(Actor, Slot);
+		return true;
+	};
+	Registry->ForEach<AActor>(EHellunaActorBucket::Hero, Record);
+	Registry->ForEach<AActor>(EHellunaActorBucket::Enemy, Record);
+
+	++FrameSerial;
+
+	// HistorySize 프레임 동안 한 번도 기록되지 않은 대상 제거 (파괴/Pool 반납)
+	StaleTargets.Reset();
+	for (auto It = Targets.CreateConstIterator(); It; ++It)
+	{
+		if (!It->Actor.IsValid() || FrameSerial - It->LastSeenSerial > HistorySize)
+		{
+			StaleTargets.Add(It.GetIndex());
+		}
+	}
+	for (const int32 Index : StaleTargets)
+	{
+		TargetIndexByActor.Remove(Targets[Index].ActorKey);
+		Targets.RemoveAt(Index);
+	}
+}
+
+void UHellunaLagCompensationSubsystem::RecordActor(AActor* Actor, int32 Slot)
+{
+	// Pool 비활성 적은 숨김 상태로 레지스트리에 남아 있음
+	if (Actor->IsHidden())
+		return;
+
+	const ACharacter* Character = Cast<ACharacter>(Actor);
+	const UCapsuleComponent* Capsule = Character ? Character->GetCapsuleComponent() : nullptr;
+	if (!Capsule)
+		return;
+
+	int32 Index;
+	if (const int32* Found = TargetIndexByActor.Find(Actor))
+	{
+		Index = *Found;
+	}
+	else
+	{
+		FTarget NewTarget;
+		NewTarget.Actor = Actor;
+		NewTarget.ActorKey = Actor;
+		NewTarget.Capsule = Capsule;
+		Index = Targets.Add(MoveTemp(NewTarget));
+		TargetIndexByActor.Add(Actor, Index);
+	}
+
+	FTarget& Target = Targets[Index];
+	FCapsuleSample& Sample = Target.Samples[Slot];
+	Sample.Center = Capsule->GetComponentLocation();
+	Sample.Up = Capsule->GetUpVector();
+	Sample.Radius = Capsule->GetScaledCapsuleRadius();
+	Sample.HalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+	// 사망 시 캡슐 충돌을 끄므로 그 프레임부터는 되감아도 맞지 않는다
+	Sample.bValid = Capsule->IsQueryCollisionEnabled();
+	Target.LastSeenSerial = FrameSerial;
+}
+
+// ============================================================================
+// 되감기
+// ============================================================================
+bool UHellunaLagCompensationSubsystem::FindFrames(double Time, int32& OutSlotA, int32& OutSlotB, float& OutAlpha) const
+{
+	if (FrameSerial == 0)
+		return false;
+
+	const uint64 NumFrames = FMath::Min<uint64>(FrameSerial, HistorySize);
+	const uint64 Newest = FrameSerial - 1;
+	const uint64 Oldest = FrameSerial - NumFrames;
+
+	// 히스토리 범위 밖은 양 끝 프레임으로 고정
+	if (Time >= FrameTimes[Newest % HistorySize] || NumFrames == 1)
+	{
+		OutSlotA = OutSlotB = static_cast<int32>(Newest % HistorySize);
+		OutAlpha = 0.f;
+		return true;
+	}
+	if (Time <= FrameTimes[Oldest % HistorySize])
+	{
+		OutSlotA = OutSlotB = static_cast<int32>(Oldest % HistorySize);
+		OutAlpha = 0.f;
+		return true;
+	}
+
+	// 최신 → 과거 순으로 Time 을 감싸는 두 프레임 탐색 (HistorySize 가 작아 선형)
+	for (uint64 Serial = Newest; Serial > Oldest; --Serial)
+	{
+		const int32 SlotB = static_cast<int32>(Serial % HistorySize);
+		const int32 SlotA = static_cast<int32>((Serial - 1) % HistorySize);
+		if (FrameTimes[SlotA] <= Time)
+		{
+			const double Span = FrameTimes[SlotB] - FrameTimes[SlotA];
+			OutSlotA = SlotA;
+			OutSlotB = SlotB;
+			OutAlpha = Span > UE_DOUBLE_SMALL_NUMBER
+				? static_cast<float>((Time - FrameTimes[SlotA]) / Span)
+				: 1.f;
+			return true;
+		}
+	}
+	return false;
+}
+
+float UHellunaLagCompensationSubsystem::IntersectCapsule(const FVector& Start, const FVector& Dir, const FCapsuleSample& Capsule)
+{
+	const float Radius = Capsule.Radius;
+	const FVector Axis = Capsule.Up * FMath::Max(0.f, Capsule.HalfHeight - Radius);
+	const FVector PA = Capsule.Center - Axis;
+	const FVector PB = Capsule.Center + Axis;
+
+	// 반구 하나와의 교차 (시작점이 안이면 -1)
+	auto IntersectSphere = [&Start, &Dir, Radius](const FVector& SphereCenter) -> double
+	{
+		const FVector OC = Start - SphereCenter;
+		const double B = FVector::DotProduct(Dir, OC);
+		const double C = OC.SizeSquared() - FMath::Square(Radius);
+		const double H = B * B - C;
+		if (C <= 0.0 || H < 0.0)
+			return -1.0;
+		const double T = -B - FMath::Sqrt(H);
+		return T >= 0.0 ? T : -1.0;
+	};
+
+	const FVector BA = PB - PA;
+	const FVector OA = Start - PA;
+	const double BABA = BA.SizeSquared();
+	const double BARD = FVector::DotProduct(BA, Dir);
+	const double BAOA = FVector::DotProduct(BA, OA);
+	const double RDOA = FVector::DotProduct(Dir, OA);
+	const double OAOA = OA.SizeSquared();
+
+	const double A = BABA - BARD * BARD;
+	if (BABA < UE_DOUBLE_SMALL_NUMBER || A < UE_DOUBLE_SMALL_NUMBER)
+	{
+		// 구형 캡슐 또는 축과 평행한 레이 — 양 끝 반구만 검사
+		const double TA = IntersectSphere(PA);
+		const double TB = IntersectSphere(PB);
+		if (TA < 0.0) return static_cast<float>(TB);
+		if (TB < 0.0) return static_cast<float>(TA);
+		return static_cast<float>(FMath::Min(TA, TB));
+	}
+
+	const double B = BABA * RDOA - BAOA * BARD;
+	const double C = BABA * OAOA - BAOA * BAOA - FMath::Square(Radius) * BABA;
+	const double H = B * B - A * C;
+	if (H < 0.0)
+		return -1.f;
+
+	// 원통 몸통
+	const double T = (-B - FMath::Sqrt(H)) / A;
+	const double Y = BAOA + T * BARD;
+	if (Y > 0.0 && Y < BABA)
+		return T >= 0.0 ? static_cast<float>(T) : -1.f;
+
+	// 몸통 밖이면 가까운 쪽 반구
+	return static_cast<float>(IntersectSphere(Y <= 0.0 ? PA : PB));
+}
+
+bool UHellunaLagCompensationSubsystem::RewindRay(const FVector& Start, const FVector& Dir, float MaxDistance,
+	double Time, ECollisionChannel Channel, const AActor* Shooter, TConstArrayView<int32> SkipTargets, FRewindHit& OutHit) const
+{
+	int32 SlotA, SlotB;
+	float Alpha;
+	if (!FindFrames(Time, SlotA, SlotB, Alpha))
+		return false;
+
+	const FVector End = Start + Dir * MaxDistance;
+	OutHit.Distance = MaxDistance;
+
+	for (auto It = Targets.CreateConstIterator(); It; ++It)
+	{
+		const FTarget& Target = *It;
+		const AActor* Actor = Target.Actor.Get();
+		if (!Actor || Actor == Shooter || SkipTargets.Contains(It.GetIndex()))
+			continue;
+
+		// 현재 트레이스와 같은 규칙 — 이 채널을 Block 하지 않는 캡슐(예: Visibility 무시 아군)은 총알을 막지 않는다
+		const UCapsuleComponent* Capsule = Target.Capsule.Get();
+		if (!Capsule || Capsule->GetCollisionResponseToChannel(Channel) != ECR_Block)
+			continue;
+
+		// 되감은 시각에 맞을 수 있었던 대상만 — 그 사이 생긴(승격된) Actor 는 클라가 보지 못했다
+		const FCapsuleSample& A = Target.Samples[SlotA];
+		const FCapsuleSample& B = Target.Samples[SlotB];
+		if (!A.bValid && !B.bValid)
+			continue;
+
+		FCapsuleSample Sample = B.bValid ? B : A;
+		if (A.bValid && B.bValid)
+		{
+			Sample.Center = FMath::Lerp(A.Center, B.Center, Alpha);
+		}
+
+		// 광역 컷: 캡슐을 감싸는 구가 레이 선분에 닿지 않으면 건너뜀
+		const float BoundRadius = FMath::Max(Sample.HalfHeight, Sample.Radius);
+		if (FMath::PointDistToSegmentSquared(Sample.Center, Start, End) > FMath::Square(BoundRadius))
+			continue;
+
+		const float Dist = IntersectCapsule(Start, Dir, Sample);
+		if (Dist < 0.f || Dist >= OutHit.Distance)
+			continue;
+
+		const FVector Point = Start + Dir * Dist;
+		const FVector Axis = Sample.Up * FMath::Max(0.f, Sample.HalfHeight - Sample.Radius);
+		const FVector Closest = FMath::ClosestPointOnSegment(Point, Sample.Center - Axis, Sample.Center + Axis);
+
+		OutHit.TargetIndex = It.GetIndex();
+		OutHit.Distance = Dist;
+		OutHit.Point = Point;
+		OutHit.Normal = (Point - Closest).GetSafeNormal();
+		OutHit.RewoundCenter = Sample.Center;
+	}
+
+	return OutHit.TargetIndex != INDEX_NONE;
+}
+
+bool UHellunaLagCompensationSubsystem::ResolveHitscan(const FVector& Start, const FVector& End, ECollisionChannel Channel,
+	const FCollisionQueryParams& Params, const AActor* Shooter, double ViewServerTime,
+	FHitResult& InOutHit, bool bCurrentHit) const
+{
+	if (ViewServerTime < 0.0 || FrameSerial == 0 || !CVarLagCompEnable.GetValueOnGameThread())
+		return bCurrentHit;
+
+	UWorld* World = GetWorld();
+	if (!World)
+		return bCurrentHit;
+
+	// 되감기 창 제한 — 미래 시각/너무 먼 과거 보고는 잘라낸다
+	const double Now = GetServerTime();
+	const double MaxRewind = FMath::Max(0.f, CVarLagCompMaxRewindMs.GetValueOnGameThread()) * 0.001;
+	const double RewindTime = FMath::Clamp(ViewServerTime, Now - MaxRewind, Now);
+
+	// 1) 고정 장애물까지의 거리 — 현재 트레이스가 추적 대상을 맞췄다면 걷어내고 다시 쏜다
+	//    (지금은 앞을 막고 있지만 클라 화면에선 없던 적이 총알을 가로채지 않도록)
+	FHitResult Blocker = InOutHit;
+	bool bBlocker = bCurrentHit;
+	if (bBlocker && IsTracked(Blocker.GetActor()))
+	{
+		FCollisionQueryParams RetraceParams = Params;
+		for (int32 i = 0; i < LagComp::MaxBlockerRetraces && bBlocker && IsTracked(Blocker.GetActor()); ++i)
+		{
+			RetraceParams.AddIgnoredActor(Blocker.GetActor());
+			bBlocker = World->LineTraceSingleByChannel(Blocker, Start, End, Channel, RetraceParams);
+		}
+	}
+
+	const FVector Ray = End - Start;
+	const float RayLength = Ray.Size();
+	if (RayLength <= KINDA_SMALL_NUMBER)
+		return bCurrentHit;
+
+	const FVector Dir = Ray / RayLength;
+	const float MaxDistance = bBlocker ? Blocker.Distance : RayLength;
+
+	// 2) 되감은 캡슐 판정 — 가까운 후보부터, 거절된 후보는 건너뛰고 다음 후보
+	TArray<int32, TInlineAllocator<LagComp::MaxRewindCandidates>> Rejected;
+	FRewindHit Rewound;
+	while (RewindRay(Start, Dir, MaxDistance, RewindTime, Channel, Shooter, Rejected, Rewound))
+	{
+		AActor* HitActor = Targets[Rewound.TargetIndex].Actor.Get();
+		const ACharacter* Character = Cast<ACharacter>(HitActor);
+		UCapsuleComponent* Capsule = Character ? Character->GetCapsuleComponent() : nullptr;
+
+		// 그 사이 죽었거나 Pool 로 돌아간 대상은 인정하지 않음 (중복 킬 방지)
+		if (Capsule && !HitActor->IsHidden() && Capsule->IsQueryCollisionEnabled())
+		{
+			// 맞은 지점을 Actor 의 현재 위치로 옮김 — OnTakePointDamage/FX 가 지금 몸에 표시되도록
+			const FVector Offset = Capsule->GetComponentLocation() - Rewound.RewoundCenter;
+			const FVector ImpactPoint = Rewound.Point + Offset;
+
+			InOutHit = FHitResult(HitActor, Capsule, ImpactPoint, Rewound.Normal);
+			InOutHit.bBlockingHit = true;
+			InOutHit.TraceStart = Start;
+			InOutHit.TraceEnd = End;
+			InOutHit.Distance = Rewound.Distance;
+			InOutHit.Time = Rewound.Distance / RayLength;
+			return true;
+		}
+
+		// 후보를 다 보지 못했으면 Blocker(추적 대상 제거됨)로 내려가지 않고 현재 트레이스 결과 유지
+		Rejected.Add(Rewound.TargetIndex);
+		if (Rejected.Num() >= LagComp::MaxRewindCandidates)
+			return bCurrentHit;
+
+		Rewound = FRewindHit();
+	}
+
+	// 3) 되감은 시각엔 레이 위에 대상이 없었음 → 고정 장애물(또는 허공)
+	InOutHit = Blocker;
+	return bBlocker;
+}
@@ -286,7 +286,7 @@ bool URepairComponent::ValidateMaterial(APlayerController* PlayerController, FGa
 	}
 
 	// 3. 인벤토리에 재료가 충분한지 확인
-	int32 AvailableAmount = InvComp->GetTotalMaterialCount(MaterialTag);
+	int32 AvailableAmount = InvComp->GetAuthoritativeMaterialCount(MaterialTag);
 	if (AvailableAmount < Amount)
 	{
 #if HELLUNA_DEBUG_REPAIR
@@ -329,7 +329,7 @@ void URepairComponent::ConsumeMaterialFromInventory(APlayerController* PlayerCon
 #endif
 
 	// ⭐ 소비 전 보유량 확인 (로그용)
-	int32 BeforeAmount = InvComp->GetTotalMaterialCount(MaterialTag);
+	int32 BeforeAmount = InvComp->GetAuthoritativeMaterialCount(MaterialTag);
 #if HELLUNA_DEBUG_REPAIR
 	UE_LOG(LogTemp, Warning, TEXT("      소비 전 보유량: %d"), BeforeAmount);
 #endif
@@ -341,7 +341,7 @@ void URepairComponent::ConsumeMaterialFromInventory(APlayerController* PlayerCon
 	if (bIsServer)
 	{
 #if HELLUNA_DEBUG_REPAIR
-		int32 AfterAmount = InvComp->GetTotalMaterialCount(MaterialTag);
+		int32 AfterAmount = InvComp->GetAuthoritativeMaterialCount(MaterialTag);
 		UE_LOG(LogTemp, Warning, TEXT("      소비 후 보유량: %d"), AfterAmount);
 		UE_LOG(LogTemp, Warning, TEXT("      실제 소비량: %d"), BeforeAmount - AfterAmount);
 #endif
@@ -599,7 +599,7 @@ void URepairComponent::Server_TestConsumeMaterial_Implementation(APlayerControll
 	}
 
 	// 소비 전 보유량
-	int32 BeforeAmount = InvComp->GetTotalMaterialCount(MaterialTag);
+	int32 BeforeAmount = InvComp->GetAuthoritativeMaterialCount(MaterialTag);
 #if HELLUNA_DEBUG_REPAIR
 	UE_LOG(LogTemp, Warning, TEXT("  📦 소비 전 보유량: %d"), BeforeAmount);
 #endif
@@ -619,7 +619,7 @@ void URepairComponent::Server_TestConsumeMaterial_Implementation(APlayerControll
 	InvComp->Server_ConsumeMaterialsMultiStack(MaterialTag, Amount);
 
 	// 소비 후 보유량 (서버에서만 즉시 확인 가능)
-	int32 AfterAmount = InvComp->GetTotalMaterialCount(MaterialTag);
+	int32 AfterAmount = InvComp->GetAuthoritativeMaterialCount(MaterialTag);
 #if HELLUNA_DEBUG_REPAIR
 	UE_LOG(LogTemp, Warning, TEXT("  📦 소비 후 보유량: %d"), AfterAmount);
 	UE_LOG(LogTemp, Warning, TEXT("  ✅ 실제 소비량: %d"), BeforeAmount - AfterAmount);
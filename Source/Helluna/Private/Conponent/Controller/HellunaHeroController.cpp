@@ -75,6 +75,9 @@
 // [Phase 22] 관전 시스템
 #include "GameFramework/SpectatorPawn.h"
 
+// [ActorRegistryV1] 우주선/퍼즐 큐브/보스/시네마틱 트리거 조회
+#include "Utils/HellunaActorRegistrySubsystem.h"
+
 // [PauseMenu] 위젯 애니메이션 재생
 // WidgetBlueprintGeneratedClass는 PauseMenuWidget 내부로 이동
 
@@ -122,13 +125,15 @@ void AHellunaHeroController::OnShipHealInteractE()
 	AHellunaHeroCharacter* Hero = Cast<AHellunaHeroCharacter>(GetPawn());
 	if (!Hero) return;
 
-	TArray<AActor*> Ships;
-	UGameplayStatics::GetAllActorsWithTag(GetWorld(), FName("SpaceShip"), Ships);
+	// [ActorRegistryV1] GetAllActorsWithTag("SpaceShip") 대신 레지스트리 버킷
+	TArray<AResourceUsingObject_SpaceShip*> Ships;
+	if (const UHellunaActorRegistrySubsystem* Registry = UHellunaActorRegistrySubsystem::Get(this))
+	{
+		Registry->GetActors<AResourceUsingObject_SpaceShip>(EHellunaActorBucket::SpaceShip, Ships);
+	}
 	float NearestDist = -1.f;
-	for (AActor* A : Ships)
+	for (AResourceUsingObject_SpaceShip* Ship : Ships)
 	{
-		AResourceUsingObject_SpaceShip* Ship = Cast<AResourceUsingObject_SpaceShip>(A);
-		if (!Ship) continue;
 
 		const float D = Hero->GetDistanceTo(Ship);
 		if (NearestDist < 0.f || D < NearestDist) NearestDist = D;
@@ -1107,20 +1112,19 @@ void AHellunaHeroController::OnPuzzleInteractInput(const FInputActionValue& Valu
 	APuzzleCubeActor* NearestCube = nullptr;
 	float NearestDist = FLT_MAX;
 
-	for (TActorIterator<APuzzleCubeActor> It(World); It; ++It)
+	// [ActorRegistryV1] TActorIterator 월드 스캔 대신 레지스트리 버킷
+	if (UHellunaActorRegistrySubsystem* Registry = World->GetSubsystem<UHellunaActorRegistrySubsystem>())
 	{
-		APuzzleCubeActor* Cube = *It;
-		if (!IsValid(Cube))
-		{
-			continue;
-		}
-
-		const float Dist = FVector::Dist(MyPawn->GetActorLocation(), Cube->GetActorLocation());
-		if (Dist < Cube->GetInteractionRadius() && Dist < NearestDist)
+		Registry->ForEach<APuzzleCubeActor>(EHellunaActorBucket::PuzzleCube, [&](APuzzleCubeActor* Cube)
 		{
-			NearestDist = Dist;
-			NearestCube = Cube;
-		}
+			const float Dist = FVector::Dist(MyPawn->GetActorLocation(), Cube->GetActorLocation());
+			if (Dist < Cube->GetInteractionRadius() && Dist < NearestDist)
+			{
+				NearestDist = Dist;
+				NearestCube = Cube;
+			}
+			return true;
+		});
 	}
 
 	if (!NearestCube)
@@ -1252,20 +1256,19 @@ void AHellunaHeroController::Server_PuzzleTryEnter_Implementation()
 	APuzzleCubeActor* NearestCube = nullptr;
 	float NearestDist = FLT_MAX;
 
-	for (TActorIterator<APuzzleCubeActor> It(World); It; ++It)
+	// [ActorRegistryV1] TActorIterator 월드 스캔 대신 레지스트리 버킷
+	if (UHellunaActorRegistrySubsystem* Registry = World->GetSubsystem<UHellunaActorRegistrySubsystem>())
 	{
-		APuzzleCubeActor* Cube = *It;
-		if (!IsValid(Cube))
-		{
-			continue;
-		}
-
-		const float Dist = FVector::Dist(MyPawn->GetActorLocation(), Cube->GetActorLocation());
-		if (Dist < Cube->GetInteractionRadius() && Dist < NearestDist)
+		Registry->ForEach<APuzzleCubeActor>(EHellunaActorBucket::PuzzleCube, [&](APuzzleCubeActor* Cube)
 		{
-			NearestDist = Dist;
-			NearestCube = Cube;
-		}
+			const float Dist = FVector::Dist(MyPawn->GetActorLocation(), Cube->GetActorLocation());
+			if (Dist < Cube->GetInteractionRadius() && Dist < NearestDist)
+			{
+				NearestDist = Dist;
+				NearestCube = Cube;
+			}
+			return true;
+		});
 	}
 
 	if (!NearestCube)
@@ -1679,20 +1682,19 @@ void AHellunaHeroController::Server_BossEncounterActivate_Implementation()
 	ABossEncounterCube* NearestCube = nullptr;
 	float NearestDist = FLT_MAX;
 
-	for (TActorIterator<ABossEncounterCube> It(World); It; ++It)
+	// [ActorRegistryV1] TActorIterator 월드 스캔 대신 레지스트리 버킷
+	if (UHellunaActorRegistrySubsystem* Registry = World->GetSubsystem<UHellunaActorRegistrySubsystem>())
 	{
-		ABossEncounterCube* Cube = *It;
-		if (!IsValid(Cube))
-		{
-			continue;
-		}
-
-		const float Dist = FVector::Dist(MyPawn->GetActorLocation(), Cube->GetActorLocation());
-		if (Dist < Cube->GetInteractionRadius() && Dist < NearestDist)
+		Registry->ForEach<ABossEncounterCube>(EHellunaActorBucket::BossEncounterCube, [&](ABossEncounterCube* Cube)
 		{
-			NearestDist = Dist;
-			NearestCube = Cube;
-		}
+			const float Dist = FVector::Dist(MyPawn->GetActorLocation(), Cube->GetActorLocation());
+			if (Dist < Cube->GetInteractionRadius() && Dist < NearestDist)
+			{
+				NearestDist = Dist;
+				NearestCube = Cube;
+			}
+			return true;
+		});
 	}
 
 	if (!NearestCube)
@@ -1737,12 +1739,9 @@ void AHellunaHeroController::Server_BossRealityFracture_Implementation()
 	}
 
 	// 보스 lookup — 월드에서 첫 번째 AHellunaEnemyCharacter_Boss
-	AHellunaEnemyCharacter_Boss* Boss = nullptr;
-	for (TActorIterator<AHellunaEnemyCharacter_Boss> It(World); It; ++It)
-	{
-		Boss = *It;
-		if (IsValid(Boss)) break;
-	}
+	const UHellunaActorRegistrySubsystem* Registry = World->GetSubsystem<UHellunaActorRegistrySubsystem>();
+	AHellunaEnemyCharacter_Boss* Boss = Registry
+		? Cast<AHellunaEnemyCharacter_Boss>(Registry->GetFirst(EHellunaActorBucket::Boss)) : nullptr;
 	if (!Boss)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[RealityFractureCheat] Boss not found in world"));
@@ -1804,12 +1803,9 @@ void AHellunaHeroController::Server_BossTimeDistortion_Implementation()
 		return;
 	}
 
-	AHellunaEnemyCharacter_Boss* Boss = nullptr;
-	for (TActorIterator<AHellunaEnemyCharacter_Boss> It(World); It; ++It)
-	{
-		Boss = *It;
-		if (IsValid(Boss)) break;
-	}
+	const UHellunaActorRegistrySubsystem* Registry = World->GetSubsystem<UHellunaActorRegistrySubsystem>();
+	AHellunaEnemyCharacter_Boss* Boss = Registry
+		? Cast<AHellunaEnemyCharacter_Boss>(Registry->GetFirst(EHellunaActorBucket::Boss)) : nullptr;
 	if (!Boss)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[TimeDistortionCheat] Boss not found in world"));
@@ -1864,12 +1860,9 @@ void AHellunaHeroController::Server_BossDashAttack_Implementation()
 		return;
 	}
 
-	AHellunaEnemyCharacter_Boss* Boss = nullptr;
-	for (TActorIterator<AHellunaEnemyCharacter_Boss> It(World); It; ++It)
-	{
-		Boss = *It;
-		if (IsValid(Boss)) break;
-	}
+	const UHellunaActorRegistrySubsystem* Registry = World->GetSubsystem<UHellunaActorRegistrySubsystem>();
+	AHellunaEnemyCharacter_Boss* Boss = Registry
+		? Cast<AHellunaEnemyCharacter_Boss>(Registry->GetFirst(EHellunaActorBucket::Boss)) : nullptr;
 	if (!Boss)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[DashAttackCheat] Boss not found in world"));
@@ -1948,12 +1941,9 @@ void AHellunaHeroController::Server_BossPhase2_Implementation()
 		return;
 	}
 
-	AHellunaEnemyCharacter_Boss* Boss = nullptr;
-	for (TActorIterator<AHellunaEnemyCharacter_Boss> It(World); It; ++It)
-	{
-		Boss = *It;
-		if (IsValid(Boss)) break;
-	}
+	const UHellunaActorRegistrySubsystem* Registry = World->GetSubsystem<UHellunaActorRegistrySubsystem>();
+	AHellunaEnemyCharacter_Boss* Boss = Registry
+		? Cast<AHellunaEnemyCharacter_Boss>(Registry->GetFirst(EHellunaActorBucket::Boss)) : nullptr;
 	if (!Boss)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[BossPhase2Cheat] Boss not found in world"));
@@ -2417,18 +2407,26 @@ void AHellunaHeroController::Server_VoteBossSummonSkip_Implementation()
 	}
 
 	// 활성 보스 시네마틱(소환/페이즈2/사망) 중 하나를 찾아 이 PC 의 표를 등록 (보통 1개만 활성).
-	for (TActorIterator<ABossSummonCinematicTrigger> It(World); It; ++It)
-	{
-		if (*It && (*It)->IsCinematicActive()) { (*It)->ServerRegisterSkipVote(this); return; }
-	}
-	for (TActorIterator<ABossPhase2CinematicTrigger> It(World); It; ++It)
-	{
-		if (*It && (*It)->IsCinematicActive()) { (*It)->ServerRegisterSkipVote(this); return; }
-	}
-	for (TActorIterator<ABossDeathCinematicTrigger> It(World); It; ++It)
+	// [ActorRegistryV1] 세 트리거 모두 CinematicTrigger 버킷에 등록됨 → 1회 순회
+	UHellunaActorRegistrySubsystem* Registry = World->GetSubsystem<UHellunaActorRegistrySubsystem>();
+	if (!Registry) return;
+
+	Registry->ForEach<AActor>(EHellunaActorBucket::CinematicTrigger, [this](AActor* Trigger)
 	{
-		if (*It && (*It)->IsCinematicActive()) { (*It)->ServerRegisterSkipVote(this); return; }
-	}
+		if (ABossSummonCinematicTrigger* Summon = Cast<ABossSummonCinematicTrigger>(Trigger))
+		{
+			if (Summon->IsCinematicActive()) { Summon->ServerRegisterSkipVote(this); return false; }
+		}
+		else if (ABossPhase2CinematicTrigger* Phase2 = Cast<ABossPhase2CinematicTrigger>(Trigger))
+		{
+			if (Phase2->IsCinematicActive()) { Phase2->ServerRegisterSkipVote(this); return false; }
+		}
+		else if (ABossDeathCinematicTrigger* Death = Cast<ABossDeathCinematicTrigger>(Trigger))
+		{
+			if (Death->IsCinematicActive()) { Death->ServerRegisterSkipVote(this); return false; }
+		}
+		return true;
+	});
 }
 
 // ════════════════════════════════════════════════════════════════════════════════
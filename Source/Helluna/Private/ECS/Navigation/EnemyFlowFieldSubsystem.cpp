@@ -0,0 +1,461 @@
+/**
+ * EnemyFlowFieldSubsystem.cpp
+ *
+ * ■ Bake 비용
+ *   - 샘플링: 칸당 ProjectPointToNavigation 1회. 기본 150x150 = 22,500칸 → 프레임당 BakeBudgetMs로 분산
+ *   - Integration: Dijkstra (이진 힙) 1회, 방향 결정 1회 — 마지막 프레임에서 한 번에 처리
+ *
+ * ■ 튜닝 CVar
+ *   Helluna.FlowField.CellSize       칸 크기 (cm, 기본 200)
+ *   Helluna.FlowField.HalfExtent     우주선 중심 기준 격자 반경 (cm, 기본 15000)
+ *   Helluna.FlowField.MaxStepHeight  인접 칸 연결 허용 높이 차 (cm, 기본 120)
+ *   Helluna.FlowField.BakeBudgetMs   프레임당 샘플링 예산 (ms, 기본 2)
+ */
+
+#include "ECS/Navigation/EnemyFlowFieldSubsystem.h"
+
+#include "Building/Actor/Inv_BuildingActor.h"
+#include "NavigationSystem.h"
+#include "Kismet/GameplayStatics.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Utils/HellunaActorRegistrySubsystem.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogEnemyFlowField, Log, All);
+
+static TAutoConsoleVariable<float> CVarFlowFieldCellSize(
+	TEXT("Helluna.FlowField.CellSize"),
+	200.f,
+	TEXT("Entity Flow Field 칸 크기 (cm). 다음 Bake부터 적용."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFlowFieldHalfExtent(
+	TEXT("Helluna.FlowField.HalfExtent"),
+	15000.f,
+	TEXT("우주선 중심 기준 Flow Field 격자 반경 (cm). 밖에 있는 Entity는 직선 이동으로 폴백."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFlowFieldMaxStepHeight(
+	TEXT("Helluna.FlowField.MaxStepHeight"),
+	120.f,
+	TEXT("인접 칸을 연결하는 최대 NavMesh 높이 차 (cm). 초과하면 절벽으로 간주."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFlowFieldBakeBudgetMs(
+	TEXT("Helluna.FlowField.BakeBudgetMs"),
+	2.f,
+	TEXT("Flow Field 샘플링에 프레임당 쓸 최대 시간 (ms)."),
+	ECVF_Default);
+
+// ============================================================================
+// FEnemyFlowField
+// ============================================================================
+const FIntPoint FEnemyFlowField::NeighborOffsets[8] =
+{
+	FIntPoint( 1,  0), FIntPoint(-1,  0), FIntPoint( 0,  1), FIntPoint( 0, -1),
+	FIntPoint( 1,  1), FIntPoint( 1, -1), FIntPoint(-1,  1), FIntPoint(-1, -1),
+};
+
+const FVector FEnemyFlowField::NeighborDirections[8] =
+{
+	FVector( 1.f,  0.f, 0.f), FVector(-1.f,  0.f, 0.f), FVector( 0.f,  1.f, 0.f), FVector( 0.f, -1.f, 0.f),
+	FVector( UE_INV_SQRT_2,  UE_INV_SQRT_2, 0.f), FVector( UE_INV_SQRT_2, -UE_INV_SQRT_2, 0.f),
+	FVector(-UE_INV_SQRT_2,  UE_INV_SQRT_2, 0.f), FVector(-UE_INV_SQRT_2, -UE_INV_SQRT_2, 0.f),
+};
+
+int32 FEnemyFlowField::WorldToIndex(const FVector& Location) const
+{
+	const int32 X = FMath::FloorToInt((Location.X - Origin.X) * InvCellSize);
+	const int32 Y = FMath::FloorToInt((Location.Y - Origin.Y) * InvCellSize);
+	if (X < 0 || Y < 0 || X >= SizeX || Y >= SizeY)
+		return INDEX_NONE;
+	return ToIndex(X, Y);
+}
+
+FVector FEnemyFlowField::GetCellCenter(int32 Index) const
+{
+	const int32 X = Index % SizeX;
+	const int32 Y = Index / SizeX;
+	return FVector(
+		Origin.X + (X + 0.5f) * CellSize,
+		Origin.Y + (Y + 0.5f) * CellSize,
+		NavZ.IsValidIndex(Index) ? NavZ[Index] : 0.f);
+}
+
+bool FEnemyFlowField::SampleDirection(const FVector& Location, FVector& OutDirection) const
+{
+	const int32 Index = WorldToIndex(Location);
+	if (Index == INDEX_NONE)
+		return false;
+
+	const uint8 Dir = Directions[Index];
+	if (Dir == NoDirection)
+		return false;
+
+	OutDirection = NeighborDirections[Dir];
+	return true;
+}
+
+bool FEnemyFlowField::SampleNavZ(const FVector& Location, float& OutZ) const
+{
+	const int32 Index = WorldToIndex(Location);
+	if (Index == INDEX_NONE || !Walkable[Index])
+		return false;
+
+	OutZ = NavZ[Index];
+	return true;
+}
+
+// ============================================================================
+// UWorldSubsystem 인터페이스
+// ============================================================================
+bool UEnemyFlowFieldSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEnemyFlowFieldSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 클라이언트는 Entity 이동을 하지 않으므로 Bake 불필요
+	bBakeEnabled = InWorld.GetNetMode() != NM_Client;
+	if (!bBakeEnabled)
+		return;
+
+	ActorSpawnedHandle = InWorld.AddOnActorSpawnedHandler(
+		FOnActorSpawned::FDelegate::CreateUObject(this, &UEnemyFlowFieldSubsystem::OnActorSpawned));
+	ActorDestroyedHandle = InWorld.AddOnActorDestroyedHandler(
+		FOnActorDestroyed::FDelegate::CreateUObject(this, &UEnemyFlowFieldSubsystem::OnActorDestroyed));
+}
+
+void UEnemyFlowFieldSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+		World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+	}
+
+	{
+		FScopeLock Lock(&FieldLock);
+		PublishedField.Reset();
+	}
+	PendingField.Reset();
+
+	Super::Deinitialize();
+}
+
+TStatId UEnemyFlowFieldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyFlowFieldSubsystem, STATGROUP_Tickables);
+}
+
+// ============================================================================
+// 외부 인터페이스
+// ============================================================================
+void UEnemyFlowFieldSubsystem::RequestRebuild(const TCHAR* Reason, float Delay)
+{
+	if (!bBakeEnabled)
+		return;
+
+	bRebuildRequested = true;
+	RebuildCountdown = FMath::Max(RebuildCountdown, Delay);
+
+	UE_LOG(LogEnemyFlowField, Log, TEXT("[FlowField] 재생성 요청 — 사유: %s, 지연: %.2fs"), Reason, Delay);
+}
+
+FEnemyFlowFieldPtr UEnemyFlowFieldSubsystem::GetFlowField() const
+{
+	FScopeLock Lock(&FieldLock);
+	return PublishedField;
+}
+
+// ============================================================================
+// Tick: 재생성 대기 → 프레임 분산 Bake
+// ============================================================================
+void UEnemyFlowFieldSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (bRebuildRequested)
+	{
+		RebuildCountdown -= DeltaTime;
+		if (RebuildCountdown > 0.f)
+			return;
+
+		bRebuildRequested = false;
+		RebuildCountdown = 0.f;
+		bBaking = BeginBake();
+	}
+
+	if (!bBaking)
+		return;
+
+	const double BudgetSeconds = FMath::Max(CVarFlowFieldBakeBudgetMs.GetValueOnGameThread(), 0.1f) / 1000.0;
+	if (StepBake(BudgetSeconds))
+	{
+		FinishBake();
+		bBaking = false;
+	}
+}
+
+// ============================================================================
+// Bake 단계
+// ============================================================================
+bool UEnemyFlowFieldSubsystem::BeginBake()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+		return false;
+
+	// [ActorRegistryV1] 월드 스캔 대신 레지스트리
+	const UHellunaActorRegistrySubsystem* Registry = World->GetSubsystem<UHellunaActorRegistrySubsystem>();
+	AActor* Ship = Registry ? Registry->GetSpaceShip() : nullptr;
+	if (!IsValid(Ship))
+	{
+		UE_LOG(LogEnemyFlowField, Warning, TEXT("[FlowField] 레지스트리에 SpaceShip 없음 — Bake 생략"));
+		return false;
+	}
+
+	FVector BoundsOrigin, BoundsExtent;
+	Ship->GetActorBounds(true, BoundsOrigin, BoundsExtent);
+	GoalCenter = Ship->GetActorLocation();
+
+	const float CellSize = FMath::Max(CVarFlowFieldCellSize.GetValueOnGameThread(), 50.f);
+	const float HalfExtent = FMath::Max(CVarFlowFieldHalfExtent.GetValueOnGameThread(), CellSize * 4.f);
+
+	// Goal 칸 = 우주선 외곽 + 2칸 여유 (우주선 자체는 NavMesh 구멍이므로 그 둘레를 목표로)
+	GoalRadius = BoundsExtent.Size2D() + CellSize * 2.f;
+
+	PendingField = MakeShared<FEnemyFlowField, ESPMode::ThreadSafe>();
+	FEnemyFlowField& Field = *PendingField;
+	Field.CellSize = CellSize;
+	Field.InvCellSize = 1.f / CellSize;
+	Field.SizeX = Field.SizeY = FMath::CeilToInt(HalfExtent * 2.f / CellSize);
+	Field.Origin = FVector2D(GoalCenter.X - HalfExtent, GoalCenter.Y - HalfExtent);
+
+	const int32 NumCells = Field.SizeX * Field.SizeY;
+	Field.NavZ.SetNumZeroed(NumCells);
+	Field.Walkable.Init(false, NumCells);
+	Field.Goal.Init(false, NumCells);
+	Field.Directions.Init(FEnemyFlowField::NoDirection, NumCells);
+
+	BakeCursor = 0;
+	BakeStartTime = FPlatformTime::Seconds();
+
+	UE_LOG(LogEnemyFlowField, Log, TEXT("[FlowField] Bake 시작 — %dx%d칸 (CellSize=%.0f, 중심=%s)"),
+		Field.SizeX, Field.SizeY, CellSize, *GoalCenter.ToString());
+	return true;
+}
+
+bool UEnemyFlowFieldSubsystem::StepBake(double BudgetSeconds)
+{
+	if (!PendingField.IsValid())
+		return false;
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if (!NavSys)
+		return false;
+
+	FEnemyFlowField& Field = *PendingField;
+	const int32 NumCells = Field.SizeX * Field.SizeY;
+	const FVector QueryExtent(Field.CellSize * 0.5f, Field.CellSize * 0.5f, 2000.f);
+	const double Deadline = FPlatformTime::Seconds() + BudgetSeconds;
+
+	while (BakeCursor < NumCells)
+	{
+		// 시간 체크는 32칸마다 (FPlatformTime 호출 비용 절감)
+		for (int32 Batch = 0; Batch < 32 && BakeCursor < NumCells; ++Batch, ++BakeCursor)
+		{
+			FVector Probe = Field.GetCellCenter(BakeCursor);
+			Probe.Z = GoalCenter.Z;
+
+			FNavLocation NavLoc;
+			if (NavSys->ProjectPointToNavigation(Probe, NavLoc, QueryExtent))
+			{
+				Field.Walkable[BakeCursor] = true;
+				Field.NavZ[BakeCursor] = NavLoc.Location.Z;
+			}
+		}
+
+		if (FPlatformTime::Seconds() >= Deadline)
+			break;
+	}
+
+	return BakeCursor >= NumCells;
+}
+
+void UEnemyFlowFieldSubsystem::FinishBake()
+{
+	if (!PendingField.IsValid())
+		return;
+
+	FEnemyFlowField& Field = *PendingField;
+	const int32 NumCells = Field.SizeX * Field.SizeY;
+	const float MaxStepHeight = CVarFlowFieldMaxStepHeight.GetValueOnGameThread();
+
+	// ------------------------------------------------------------------
+	// 1) Goal 칸 지정 — 우주선 둘레 반경 안의 걸을 수 있는 칸
+	// ------------------------------------------------------------------
+	TArray<int32> Cost;
+	Cost.Init(MAX_int32, NumCells);
+
+	struct FOpenNode
+	{
+		int32 Cost;
+		int32 Index;
+		bool operator<(const FOpenNode& Other) const { return Cost < Other.Cost; }
+	};
+	TArray<FOpenNode> Open;
+	Open.Reserve(NumCells / 4);
+
+	const float GoalRadiusSq = GoalRadius * GoalRadius;
+	int32 NumWalkable = 0;
+	int32 NearestWalkable = INDEX_NONE;
+	float NearestDistSq = MAX_FLT;
+
+	for (int32 i = 0; i < NumCells; ++i)
+	{
+		if (!Field.Walkable[i])
+			continue;
+
+		++NumWalkable;
+		const float DistSq = FVector::DistSquared2D(Field.GetCellCenter(i), GoalCenter);
+		if (DistSq <= GoalRadiusSq)
+		{
+			Field.Goal[i] = true;
+			Cost[i] = 0;
+			Open.HeapPush({ 0, i });
+		}
+		if (DistSq < NearestDistSq)
+		{
+			NearestDistSq = DistSq;
+			NearestWalkable = i;
+		}
+	}
+
+	// 둘레에 NavMesh가 전혀 없으면 가장 가까운 걸을 수 있는 칸 1개를 Goal로
+	if (Open.IsEmpty() && NearestWalkable != INDEX_NONE)
+	{
+		Field.Goal[NearestWalkable] = true;
+		Cost[NearestWalkable] = 0;
+		Open.HeapPush({ 0, NearestWalkable });
+	}
+
+	// ------------------------------------------------------------------
+	// 2) Dijkstra — 직교 10 / 대각 14 비용
+	// ------------------------------------------------------------------
+	auto IsConnected = [&Field, MaxStepHeight](int32 From, int32 FromX, int32 FromY, int32 Dir, int32& OutTo) -> bool
+	{
+		const FIntPoint Offset = FEnemyFlowField::NeighborOffsets[Dir];
+		const int32 NX = FromX + Offset.X;
+		const int32 NY = FromY + Offset.Y;
+		if (NX < 0 || NY < 0 || NX >= Field.SizeX || NY >= Field.SizeY)
+			return false;
+
+		const int32 To = Field.ToIndex(NX, NY);
+		if (!Field.Walkable[To] || FMath::Abs(Field.NavZ[To] - Field.NavZ[From]) > MaxStepHeight)
+			return false;
+
+		// 대각선: 양옆 직교 칸이 모두 걸을 수 있어야 (벽 모서리 관통 방지)
+		if (Offset.X != 0 && Offset.Y != 0)
+		{
+			if (!Field.Walkable[Field.ToIndex(NX, FromY)] || !Field.Walkable[Field.ToIndex(FromX, NY)])
+				return false;
+		}
+
+		OutTo = To;
+		return true;
+	};
+
+	while (Open.Num() > 0)
+	{
+		FOpenNode Node;
+		Open.HeapPop(Node, EAllowShrinking::No);
+		if (Node.Cost > Cost[Node.Index])
+			continue;
+
+		const int32 X = Node.Index % Field.SizeX;
+		const int32 Y = Node.Index / Field.SizeX;
+		for (int32 Dir = 0; Dir < 8; ++Dir)
+		{
+			int32 To;
+			if (!IsConnected(Node.Index, X, Y, Dir, To))
+				continue;
+
+			const int32 NewCost = Node.Cost + (Dir < 4 ? 10 : 14);
+			if (NewCost < Cost[To])
+			{
+				Cost[To] = NewCost;
+				Open.HeapPush({ NewCost, To });
+			}
+		}
+	}
+
+	// ------------------------------------------------------------------
+	// 3) 방향 결정 — 연결된 이웃 중 비용 최소
+	// ------------------------------------------------------------------
+	int32 NumReachable = 0;
+	for (int32 i = 0; i < NumCells; ++i)
+	{
+		if (!Field.Walkable[i] || Field.Goal[i] || Cost[i] == MAX_int32)
+			continue;
+
+		const int32 X = i % Field.SizeX;
+		const int32 Y = i / Field.SizeX;
+		int32 BestCost = Cost[i];
+		uint8 BestDir = FEnemyFlowField::NoDirection;
+		for (int32 Dir = 0; Dir < 8; ++Dir)
+		{
+			int32 To;
+			if (IsConnected(i, X, Y, Dir, To) && Cost[To] < BestCost)
+			{
+				BestCost = Cost[To];
+				BestDir = static_cast<uint8>(Dir);
+			}
+		}
+
+		Field.Directions[i] = BestDir;
+		if (BestDir != FEnemyFlowField::NoDirection)
+			++NumReachable;
+	}
+
+	// ------------------------------------------------------------------
+	// 4) Publish — 이후 PendingField는 읽기 전용 스냅샷
+	// ------------------------------------------------------------------
+	{
+		FScopeLock Lock(&FieldLock);
+		PublishedField = PendingField;
+	}
+	PendingField.Reset();
+
+	UE_LOG(LogEnemyFlowField, Log,
+		TEXT("[FlowField] Bake 완료 — 걸을 수 있는 칸 %d / 도달 가능 %d / 전체 %d (%.1fms, 분산 포함)"),
+		NumWalkable, NumReachable, NumCells, (FPlatformTime::Seconds() - BakeStartTime) * 1000.0);
+}
+
+// ============================================================================
+// 건물 설치/파괴 감지
+// ============================================================================
+bool UEnemyFlowFieldSubsystem::IsNavAffectingBuilding(const AActor* Actor)
+{
+	return Actor && Actor->IsA<AInv_BuildingActor>();
+}
+
+void UEnemyFlowFieldSubsystem::OnActorSpawned(AActor* Actor)
+{
+	if (IsNavAffectingBuilding(Actor))
+	{
+		// NavMesh 동적 재생성이 끝날 시간을 준 뒤 Bake
+		RequestRebuild(TEXT("BuildingPlaced"), 1.0f);
+	}
+}
+
+void UEnemyFlowFieldSubsystem::OnActorDestroyed(AActor* Actor)
+{
+	if (IsNavAffectingBuilding(Actor))
+	{
+		RequestRebuild(TEXT("BuildingDestroyed"), 1.0f);
+	}
+}
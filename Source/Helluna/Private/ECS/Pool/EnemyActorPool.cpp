@@ -20,6 +20,10 @@
  *   - GetInactiveCount() → GetInactiveCount(EnemyClass) 또는 GetTotalInactiveCount()
  *   - DeactivateActor(Actor): 변경 없음 (내부에서 Actor->GetClass()로 Pool 자동 탐색)
  *   - CleanupAndReplenish(): 변경 없음 (내부에서 모든 Pool 순회)
+ *
+ * ■ [PoolWarmUpV1] Actor 생성은 Tick으로 이동
+ *   - InitializePool / CleanupAndReplenish 는 더 이상 SpawnActor를 직접 호출하지 않는다.
+ *   - Tick이 클래스별 성장 정책(High/Low Watermark)에 따라 프레임당 ms 예산 내에서 생성/정리.
  */
 
 #include "ECS/Pool/EnemyActorPool.h"
@@ -38,6 +42,7 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/GameModeBase.h"
 #include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
 #include "Object/ResourceUsingObject/ResourceUsingObject_SpaceShip.h"
 
 namespace ShipJumpQuotaHelpers
@@ -105,6 +110,19 @@ namespace ShipJumpQuotaHelpers
 
 DEFINE_LOG_CATEGORY_STATIC(LogECSPool, Log, All);
 
+// [PoolWarmUpV1] 프레임당 Pool 성장/정리 예산 (Actor 1개 생성 ≈ 2ms)
+static TAutoConsoleVariable<float> CVarEnemyPoolWarmUpBudgetMs(
+	TEXT("Helluna.ECS.PoolWarmUpBudgetMs"),
+	4.0f,
+	TEXT("낮 Warm-up 단계에서 프레임당 Pool Actor 생성/정리에 쓸 최대 시간(ms)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEnemyPoolCombatBudgetMs(
+	TEXT("Helluna.ECS.PoolCombatBudgetMs"),
+	2.0f,
+	TEXT("밤(전투) 중 프레임당 Pool 보충에 쓸 최대 시간(ms).\n 0 = 전투 중 보충 안 함"),
+	ECVF_Default);
+
 /** Pool Actor 보관용 숨김 위치 (맵 아래 Z=-50000, 플레이어/물리/렌더링 범위 밖) */
 const FVector UEnemyActorPool::PoolHiddenLocation = FVector(0.0, 0.0, -50000.0);
 
@@ -167,6 +185,97 @@ void UEnemyActorPool::Deinitialize()
 	}
 
 	PerClassPools.Empty();
+	bWarmUpPhase = false;
+
+	Super::Deinitialize();
+}
+
+TStatId UEnemyActorPool::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEnemyActorPool, STATGROUP_Tickables);
+}
+
+// ============================================================================
+// [PoolWarmUpV1] Tick — 성장 정책에 따른 프레임 분산 생성/정리
+//
+// 클래스별 규칙:
+//   - 생성: Total < High 이고 (bFillToHigh 또는 Inactive < Low)
+//   - 정리: Warm-up 단계 && Total > High && 비활성 Actor 있음
+// 예산을 넘기면 다음 프레임으로 이월. 예산이 0보다 크면 프레임당 최소 1건은 처리.
+// ============================================================================
+void UEnemyActorPool::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client || PerClassPools.IsEmpty())
+	{
+		return;
+	}
+
+	const float BudgetMs = bWarmUpPhase
+		? CVarEnemyPoolWarmUpBudgetMs.GetValueOnGameThread()
+		: CVarEnemyPoolCombatBudgetMs.GetValueOnGameThread();
+	if (BudgetMs <= 0.f)
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double BudgetSeconds = BudgetMs * 0.001;
+	int32 Operations = 0;
+
+	for (auto& Pair : PerClassPools)
+	{
+		TSubclassOf<AHellunaEnemyCharacter> EnemyClass = Pair.Key;
+		FActorPoolData& PoolData = Pair.Value;
+
+		while (Operations == 0 || (FPlatformTime::Seconds() - StartTime) < BudgetSeconds)
+		{
+			const int32 Total = PoolData.InactiveActors.Num() + PoolData.ActiveActors.Num();
+
+			if (bWarmUpPhase && Total > PoolData.DesiredPoolSize && !PoolData.InactiveActors.IsEmpty())
+			{
+				DestroyPooledActor(PoolData.InactiveActors.Pop());
+				PoolData.TrimmedCount++;
+				Operations++;
+				continue;
+			}
+
+			const bool bWantsGrowth = PoolData.bFillToHigh
+				|| PoolData.InactiveActors.Num() < PoolData.LowWatermark;
+			if (Total >= PoolData.DesiredPoolSize || !bWantsGrowth)
+			{
+				if (PoolData.bFillToHigh && Total >= PoolData.DesiredPoolSize)
+				{
+					PoolData.bFillToHigh = false;
+					UE_LOG(LogECSPool, Log,
+						TEXT("[Pool] Warm-up 완료 — Class: %s | Total: %d (High=%d Low=%d) | 생성 누적: %d, 정리 누적: %d"),
+						*EnemyClass->GetName(), Total, PoolData.DesiredPoolSize, PoolData.LowWatermark,
+						PoolData.CreatedCount, PoolData.TrimmedCount);
+				}
+				break;
+			}
+
+			Operations++;
+			if (AHellunaEnemyCharacter* NewActor = CreatePooledActor(EnemyClass))
+			{
+				PoolData.InactiveActors.Add(NewActor);
+				PoolData.CreatedCount++;
+			}
+			else
+			{
+				// 생성 실패가 반복되면 매 프레임 예산을 낭비하므로 이번 Warm-up은 중단
+				PoolData.bFillToHigh = false;
+				break;
+			}
+		}
+
+		if (Operations > 0 && (FPlatformTime::Seconds() - StartTime) >= BudgetSeconds)
+		{
+			break;
+		}
+	}
 }
 
 // ============================================================================
@@ -198,27 +307,71 @@ void UEnemyActorPool::InitializePool(TSubclassOf<AHellunaEnemyCharacter> EnemyCl
 	}
 
 	// 이 클래스 전용 FActorPoolData를 TMap에 생성(없으면 기본값으로 추가)
+	// [PoolWarmUpV1] 여기서 SpawnActor를 하지 않는다 — Tick이 예산 내에서 High까지 채움.
+	//   Warm-up 없이 밤에 처음 등장한 클래스만 이 경로를 타며, 채워지기 전 요청은 Miss로 집계된다.
 	FActorPoolData& PoolData = PerClassPools.FindOrAdd(EnemyClass);
 	PoolData.DesiredPoolSize = InPoolSize;
+	PoolData.LowWatermark = FMath::Max(1, InPoolSize / 6);
+	PoolData.bFillToHigh = true;
 	PoolData.InactiveActors.Reserve(InPoolSize);
+	PoolData.bInitialized = true;
+
+	UE_LOG(LogECSPool, Log,
+		TEXT("[Pool] 초기화 예약! Class: %s | High: %d, Low: %d (Tick에서 프레임 분산 생성)"),
+		*EnemyClass->GetName(), PoolData.DesiredPoolSize, PoolData.LowWatermark);
+}
 
-	int32 SuccessCount = 0;
-	for (int32 i = 0; i < InPoolSize; ++i)
+// ============================================================================
+// [PoolWarmUpV1] RequestWarmUp / EndWarmUp
+// ============================================================================
+void UEnemyActorPool::RequestWarmUp(TSubclassOf<AHellunaEnemyCharacter> EnemyClass, int32 HighWatermark, int32 LowWatermark)
+{
+	if (!EnemyClass)
 	{
-		// 클래스를 명시적으로 전달하여 생성 — 이전엔 CachedEnemyClass 사용
-		AHellunaEnemyCharacter* Actor = CreatePooledActor(EnemyClass);
-		if (Actor)
-		{
-			PoolData.InactiveActors.Add(Actor);
-			SuccessCount++;
-		}
+		return;
 	}
 
+	FActorPoolData& PoolData = PerClassPools.FindOrAdd(EnemyClass);
+	PoolData.DesiredPoolSize = FMath::Max(0, HighWatermark);
+	PoolData.LowWatermark = FMath::Clamp(LowWatermark, 0, PoolData.DesiredPoolSize);
+	PoolData.bFillToHigh = true;
+	PoolData.InactiveActors.Reserve(PoolData.DesiredPoolSize);
 	PoolData.bInitialized = true;
+	bWarmUpPhase = true;
 
 	UE_LOG(LogECSPool, Log,
-		TEXT("[Pool] 초기화 완료! Class: %s | 요청: %d, 성공: %d, 실패: %d"),
-		*EnemyClass->GetName(), InPoolSize, SuccessCount, InPoolSize - SuccessCount);
+		TEXT("[Pool] Warm-up 요청 — Class: %s | 현재 Total: %d → High: %d, Low: %d | 누적 Hit: %d, Miss: %d"),
+		*EnemyClass->GetName(),
+		PoolData.InactiveActors.Num() + PoolData.ActiveActors.Num(),
+		PoolData.DesiredPoolSize, PoolData.LowWatermark,
+		PoolData.HitCount, PoolData.MissCount);
+}
+
+void UEnemyActorPool::EndWarmUp(bool bKeepFillingToHigh)
+{
+	if (!bWarmUpPhase)
+	{
+		return;
+	}
+	bWarmUpPhase = false;
+
+	// 밤에는 Low Watermark 기준으로만 보충 — High까지 채우던 Warm-up 요청은 여기서 해제
+	for (auto& Pair : PerClassPools)
+	{
+		FActorPoolData& PoolData = Pair.Value;
+		UE_LOG(LogECSPool, Log,
+			TEXT("[Pool] Warm-up 종료 (밤 시작) — Class: %s | Total: %d/%d%s"),
+			*Pair.Key->GetName(),
+			PoolData.InactiveActors.Num() + PoolData.ActiveActors.Num(),
+			PoolData.DesiredPoolSize,
+			!PoolData.bFillToHigh ? TEXT("")
+				: bKeepFillingToHigh ? TEXT(" (미완 — 전투 예산으로 계속 생성)")
+				: TEXT(" (미완 — 이후 Low Watermark 기준으로만 보충)"));
+		if (!bKeepFillingToHigh)
+		{
+			PoolData.bFillToHigh = false;
+		}
+	}
 }
 
 // ============================================================================
@@ -267,6 +420,10 @@ AHellunaEnemyCharacter* UEnemyActorPool::ActivateActor(
 	FActorPoolData* PoolData = PerClassPools.Find(EnemyClass);
 	if (!PoolData || PoolData->InactiveActors.IsEmpty())
 	{
+		if (PoolData)
+		{
+			PoolData->MissCount++;
+		}
 		UE_LOG(LogECSPool, Warning,
 			TEXT("[Pool] 비활성 Actor 없음! Pool 소진 — Class: %s | Active: %d, DesiredSize: %d"),
 			*EnemyClass->GetName(),
@@ -290,6 +447,7 @@ AHellunaEnemyCharacter* UEnemyActorPool::ActivateActor(
 	}
 
 	PoolData->ActiveActors.Add(Actor);
+	PoolData->HitCount++;
 
 	// 1. 위치 + Scale 설정 (SpawnTransform.Scale 은 Processor 가 Data.ActorSpawnScale 로 세팅).
 	Actor->SetActorTransform(SpawnTransform);
@@ -546,29 +704,14 @@ void UEnemyActorPool::CleanupAndReplenish()
 			continue;
 		}
 
-		// 부족분 보충 (DesiredPoolSize 유지)
-		const int32 TotalActors = PoolData.InactiveActors.Num() + PoolData.ActiveActors.Num();
-		const int32 ToCreate = PoolData.DesiredPoolSize - TotalActors;
-
-		int32 Created = 0;
-		for (int32 i = 0; i < ToCreate; ++i)
-		{
-			// 해당 클래스를 명시적으로 전달하여 보충
-			AHellunaEnemyCharacter* NewActor = CreatePooledActor(EnemyClass);
-			if (NewActor)
-			{
-				PoolData.InactiveActors.Add(NewActor);
-				Created++;
-			}
-		}
-
+		// [PoolWarmUpV1] 부족분은 즉시 생성하지 않는다 — 전투 중 SpawnActor(~2ms) 스파이크 방지.
+		//   Tick이 Low Watermark 기준(밤) 또는 High까지(낮) 예산 내에서 보충.
 		UE_LOG(LogECSPool, Log,
-			TEXT("[Pool] Replenish! Class: %s | 제거: %d (Inactive:%d Active:%d) | 보충: %d/%d | Total: %d/%d"),
+			TEXT("[Pool] Cleanup! Class: %s | 제거: %d (Inactive:%d Active:%d) | Total: %d/%d (Low=%d)"),
 			*EnemyClass->GetName(),
 			RemovedInactive + RemovedActive, RemovedInactive, RemovedActive,
-			Created, ToCreate,
 			PoolData.InactiveActors.Num() + PoolData.ActiveActors.Num(),
-			PoolData.DesiredPoolSize);
+			PoolData.DesiredPoolSize, PoolData.LowWatermark);
 	}
 }
 
@@ -635,6 +778,29 @@ AHellunaEnemyCharacter* UEnemyActorPool::CreatePooledActor(TSubclassOf<AHellunaE
 	return Actor;
 }
 
+// ============================================================================
+// [PoolWarmUpV1] DestroyPooledActor — High 초과분 비활성 Actor 정리
+// ============================================================================
+void UEnemyActorPool::DestroyPooledActor(AHellunaEnemyCharacter* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	// Deinitialize와 동일: StateTree Warning 방지를 위해 UnPossess 후 파괴
+	if (AController* Controller = Actor->GetController())
+	{
+		if (UStateTreeComponent* STComp = Controller->FindComponentByClass<UStateTreeComponent>())
+		{
+			STComp->SetComponentTickEnabled(false);
+		}
+		Controller->UnPossess();
+		Controller->Destroy();
+	}
+	Actor->Destroy();
+}
+
 // ============================================================================
 // 상태 조회 — 클래스별 / 전체 합산
 // ============================================================================
@@ -670,3 +836,42 @@ int32 UEnemyActorPool::GetTotalInactiveCount() const
 	}
 	return Total;
 }
+
+bool UEnemyActorPool::GetPoolStats(TSubclassOf<AHellunaEnemyCharacter> EnemyClass, FEnemyPoolStats& OutStats) const
+{
+	const FActorPoolData* PoolData = PerClassPools.Find(EnemyClass);
+	if (!PoolData)
+	{
+		return false;
+	}
+
+	OutStats.Active = PoolData->ActiveActors.Num();
+	OutStats.Inactive = PoolData->InactiveActors.Num();
+	OutStats.HighWatermark = PoolData->DesiredPoolSize;
+	OutStats.LowWatermark = PoolData->LowWatermark;
+	OutStats.Hits = PoolData->HitCount;
+	OutStats.Misses = PoolData->MissCount;
+	OutStats.Created = PoolData->CreatedCount;
+	OutStats.Trimmed = PoolData->TrimmedCount;
+	return true;
+}
+
+int32 UEnemyActorPool::GetTotalHitCount() const
+{
+	int32 Total = 0;
+	for (const auto& Pair : PerClassPools)
+	{
+		Total += Pair.Value.HitCount;
+	}
+	return Total;
+}
+
+int32 UEnemyActorPool::GetTotalMissCount() const
+{
+	int32 Total = 0;
+	for (const auto& Pair : PerClassPools)
+	{
+		Total += Pair.Value.MissCount;
+	}
+	return Total;
+}
@@ -5,7 +5,9 @@
  *
  * ■ 실행 분리
  *   - if (!bIsClient): 서버/Standalone에서만 Actor 스폰/디스폰 수행
- *   - 시각화 루프: 서버/클라이언트 공통 (ExecutionFlags::All)
+ *   - 시각화 루프: Entity가 있는 곳(Standalone/리슨 서버)
+ *   - [EntityRepProxyV1] 서버(Listen/Dedicated): Entity 상태 적 → 복제 프록시 Sync
+ *                        클라: Entity가 없어 이 Processor는 실행되지 않음 → AEnemyEntityReplicationProxy가 직접 표시
  *
  * ■ 디버깅 팁
  *   - LogECSEnemy 카테고리: 모든 스폰/디스폰/Soft Cap/상태 로그
@@ -19,8 +21,12 @@
 #include "MassExecutionContext.h"
 #include "ECS/Fragments/EnemyMassFragments.h"
 #include "ECS/Pool/EnemyActorPool.h"
+#include "ECS/Navigation/EnemyFlowFieldSubsystem.h"
+#include "ECS/Replication/EnemyEntityReplicationProxy.h"
 #include "Character/HellunaEnemyCharacter.h"
 #include "Character/EnemyComponent/HellunaHealthComponent.h"
+#include "GameMode/HellunaDefenseGameMode.h"
+#include "Kismet/GameplayStatics.h"
 
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
@@ -29,9 +35,55 @@
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Components/SceneComponent.h"
 #include "NavigationSystem.h"
+#include "HAL/IConsoleManager.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogECSEnemy, Log, All);
 
+// [PromotionSchedV1] Entity→Actor 승격 스케줄러 튜닝 값
+static TAutoConsoleVariable<float> CVarEnemyPromotionBudgetMs(
+	TEXT("Helluna.ECS.PromotionBudgetMs"),
+	1.5f,
+	TEXT("프레임당 Entity↔Actor 승격/강등에 쓸 수 있는 최대 시간(ms).\n 예산을 넘기면 남은 후보는 다음 프레임으로 이월된다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarEnemyMaxPromotionsPerFrame(
+	TEXT("Helluna.ECS.MaxPromotionsPerFrame"),
+	10,
+	TEXT("시간 예산과 별개로 프레임당 승격 수 상한 (안전장치)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEnemyPromotionSwapRatio(
+	TEXT("Helluna.ECS.PromotionSwapRatio"),
+	1.25f,
+	TEXT("Cap이 찬 상태에서 후보가 가장 먼 활성 Actor보다 이 배율 이상 가까울 때만 맞교환(강등+승격).\n 핑퐁 방지용 히스테리시스."),
+	ECVF_Default);
+
+// [EntityRepProxyV1] Entity 상태 적 복제 주기
+static TAutoConsoleVariable<float> CVarEnemyEntityRepHz(
+	TEXT("Helluna.ECS.EntityRepHz"),
+	4.f,
+	TEXT("Entity 상태 적(Actor 미승격)을 클라이언트 프록시로 복제하는 주기(Hz). 0 = 비활성.\n 클라이언트는 이 간격 동안 위치를 보간한다."),
+	ECVF_Default);
+
+// [AnimBudgetV1] 승격 Actor 애니메이션 평가 예산
+static TAutoConsoleVariable<float> CVarEnemyAnimBudgetMs(
+	TEXT("Helluna.ECS.AnimBudgetMs"),
+	3.f,
+	TEXT("프레임당 적 스켈레탈 메시 애니메이션 평가에 허용하는 시간(ms). 0 = 예산 비활성 (밴드 기본 주기만 사용).\n 초과하면 먼 Actor부터 URO 갱신 주기를 2배씩 늘린다."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarEnemyAnimEvalCostMs(
+	TEXT("Helluna.ECS.AnimEvalCostMs"),
+	0.05f,
+	TEXT("적 1마리 애니메이션 평가 1회의 추정 비용(ms). 서버 프로파일 기준으로 맞춘다.\n 프레임당 허용 평가 수 = AnimBudgetMs / AnimEvalCostMs."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarEnemyAnimMaxUpdateRate(
+	TEXT("Helluna.ECS.AnimMaxUpdateRate"),
+	64,
+	TEXT("예산 분배로 늘릴 수 있는 URO 갱신 주기 상한(프레임). 원거리 밴드 기본 주기(16)보다 커야 예산이 먼 Actor를 더 늦출 수 있다."),
+	ECVF_Default);
+
 // ============================================================================
 // 생성자
 // ============================================================================
@@ -60,6 +112,8 @@ void UEnemyActorSpawnProcessor::ConfigureQueries(const TSharedRef<FMassEntityMan
 	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadWrite);
 	EntityQuery.AddRequirement<FEnemySpawnStateFragment>(EMassFragmentAccess::ReadWrite);
 	EntityQuery.AddRequirement<FEnemyDataFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FEnemyVisualInstanceFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddConstSharedRequirement<FEnemyConfigSharedFragment>();
 
 	UE_LOG(LogECSEnemy, Log, TEXT("[EnemyActorSpawnProcessor] ConfigureQueries 완료"));
 }
@@ -125,31 +179,31 @@ void UEnemyActorSpawnProcessor::DespawnActorToEntity(
 void UEnemyActorSpawnProcessor::UpdateActorTickRate(
 	AActor* Actor,
 	float Distance,
-	const FEnemyDataFragment& Data)
+	const FEnemyConfigSharedFragment& Config)
 {
 	float TickInterval;
-	if (Distance < Data.NearDistance)
+	if (Distance < Config.NearDistance)
 	{
-		TickInterval = Data.NearTickInterval;
+		TickInterval = Config.NearTickInterval;
 	}
-	else if (Distance < Data.MidDistance)
+	else if (Distance < Config.MidDistance)
 	{
-		TickInterval = Data.MidTickInterval;
+		TickInterval = Config.MidTickInterval;
 	}
 	else
 	{
-		TickInterval = Data.FarTickInterval;
+		TickInterval = Config.FarTickInterval;
 	}
 
 	Actor->SetActorTickInterval(TickInterval);
 
 	// 거리별 NetUpdateFrequency 조절 — Tick은 줄였는데 레플리케이션만 100Hz인 불일치 방지
 	float NetFreq;
-	if (Distance < Data.NearDistance)
+	if (Distance < Config.NearDistance)
 	{
 		NetFreq = 15.f;   // 근거리: 15Hz
 	}
-	else if (Distance < Data.MidDistance)
+	else if (Distance < Config.MidDistance)
 	{
 		NetFreq = 8.f;    // 중거리: 8Hz
 	}
@@ -179,10 +233,11 @@ void UEnemyActorSpawnProcessor::UpdateActorTickRate(
 bool UEnemyActorSpawnProcessor::TrySpawnActor(
 	FEnemySpawnStateFragment& SpawnState,
 	FEnemyDataFragment& Data,
+	const FEnemyConfigSharedFragment& Config,
 	const FTransformFragment& Transform,
 	UEnemyActorPool* Pool)
 {
-	if (!Data.EnemyClass)
+	if (!Config.EnemyClass)
 	{
 		UE_LOG(LogECSEnemy, Error, TEXT("[Spawn] EnemyClass가 null! Trait에서 설정하세요."));
 		return false;
@@ -191,46 +246,53 @@ bool UEnemyActorSpawnProcessor::TrySpawnActor(
 	FTransform SpawnTransform = Transform.GetTransform();
 
 	// Entity→Actor 변환 시 NavMesh 밖에 스폰되는 문제 방지
-	// NavMesh 투영으로 위치 보정
+	// 1) Flow Field가 구워져 있고 현재 칸이 걸을 수 있으면 칸의 NavMesh 높이를 먼저 적용
+	//    Entity는 Flow Field를 따라 걸을 수 있는 칸으로만 이동하므로 절벽 건너편/벽 안으로 스냅되지 않는다
+	//    칸 높이는 칸 단위 샘플이라 칸 안의 턱/경사에서 NavMesh와 어긋날 수 있음 → 작은 범위로 한 번 더 투영
+	// 2) 아니면 넓은 범위 NavMesh 투영으로 위치 보정
+	bool bPlacedByFlowField = false;
+	if (const UEnemyFlowFieldSubsystem* FlowFieldSubsystem = Pool->GetWorld()->GetSubsystem<UEnemyFlowFieldSubsystem>())
+	{
+		const FEnemyFlowFieldPtr FlowField = FlowFieldSubsystem->GetFlowField();
+		float GroundZ;
+		if (FlowField.IsValid() && FlowField->SampleNavZ(SpawnTransform.GetLocation(), GroundZ))
+		{
+			FVector Loc = SpawnTransform.GetLocation();
+			Loc.Z = GroundZ;
+			SpawnTransform.SetLocation(Loc);
+			bPlacedByFlowField = true;
+		}
+	}
+
 	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(Pool->GetWorld()))
 	{
+		// Flow Field 스냅 후에는 이미 NavMesh 근처 → 작은 범위라 쿼리가 싸고, 다른 층/벽 너머로 튀지 않음
+		const FVector ProjectExtent = bPlacedByFlowField ? FVector(50.f, 50.f, 100.f) : FVector(200.f, 200.f, 500.f);
 		FNavLocation NavLoc;
-		if (NavSys->ProjectPointToNavigation(SpawnTransform.GetLocation(), NavLoc, FVector(200.f, 200.f, 500.f)))
+		if (NavSys->ProjectPointToNavigation(SpawnTransform.GetLocation(), NavLoc, ProjectExtent))
 		{
 			SpawnTransform.SetLocation(NavLoc.Location);
 		}
 	}
 
 	// [SpawnScaleV1] Trait 에서 지정한 Actor Scale 반영.
-	SpawnTransform.SetScale3D(Data.ActorSpawnScale);
+	SpawnTransform.SetScale3D(Config.ActorSpawnScale);
 
-	// 팀 컬러 RGB — 첫 스폰 시 CDO->TeamColorOptions 에서 랜덤 픽해 fragment 에 보존.
+	// 팀 컬러 RGB — 첫 스폰(또는 첫 Entity 시각화) 시 결정되어 fragment 에 보존.
 	// 풀 재사용/재활성화에도 같은 RGB 가 유지돼 같은 엔티티는 항상 같은 색.
-	if (!Data.bTeamColorAssigned)
-	{
-		if (const AHellunaEnemyCharacter* CDO =
-			Data.EnemyClass ? Data.EnemyClass->GetDefaultObject<AHellunaEnemyCharacter>() : nullptr)
-		{
-			const TArray<FLinearColor>& Options = CDO->TeamColorOptions;
-			if (Options.Num() > 0)
-			{
-				Data.TeamColor = Options[FMath::RandRange(0, Options.Num() - 1)];
-				Data.bTeamColorAssigned = true;
-			}
-		}
-	}
+	EnsureTeamColorAssigned(Data, Config);
 
 	// [수정 포인트] ActivateActor(Transform, HP, MaxHP) → ActivateActor(EnemyClass, Transform, HP, MaxHP)
 	// 멀티 Pool 구조에서 어떤 Pool에서 꺼낼지 클래스를 명시해야 올바른 Actor를 반환받음
 	AHellunaEnemyCharacter* SpawnedActor = Pool->ActivateActor(
-		Data.EnemyClass, SpawnTransform, Data.CurrentHP, Data.MaxHP, Data.MeshSpawnScale,
+		Config.EnemyClass, SpawnTransform, Data.CurrentHP, Data.MaxHP, Config.MeshSpawnScale,
 		Data.TeamColor, Data.bTeamColorAssigned);
 
 	if (!SpawnedActor)
 	{
 		UE_LOG(LogECSEnemy, Warning,
 			TEXT("[Spawn] Pool 소진! Active: %d, Inactive: %d"),
-			Pool->GetActiveCount(Data.EnemyClass), Pool->GetInactiveCount(Data.EnemyClass));
+			Pool->GetActiveCount(Config.EnemyClass), Pool->GetInactiveCount(Config.EnemyClass));
 		return false;
 	}
 
@@ -244,6 +306,10 @@ bool UEnemyActorSpawnProcessor::TrySpawnActor(
 	SpawnState.bHasSpawnedActor = true;
 	SpawnState.SpawnedActor = SpawnedActor;
 
+	// [AnimBudgetV1] Pool 재사용 Actor는 이전 Entity의 밴드 설정을 갖고 있으므로
+	// 다음 순회에서 UpdateActorTickRate(→ UpdateAnimationLOD)가 반드시 다시 적용되도록 리셋
+	Data.CachedDistanceBand = -1;
+
 	UE_LOG(LogECSEnemy, Verbose,
 		TEXT("[Spawn] Actor 활성화 성공 (Pool). 클래스: %s, 위치: %s, HP: %.1f"),
 		*SpawnedActor->GetClass()->GetName(),
@@ -282,6 +348,28 @@ void UEnemyActorSpawnProcessor::EnsureVisualizationRoot(UWorld* World)
 		(int32)World->GetNetMode());
 }
 
+// ============================================================================
+// 헬퍼: 팀 컬러 결정 — CDO->TeamColorOptions 에서 랜덤 픽
+// ============================================================================
+void UEnemyActorSpawnProcessor::EnsureTeamColorAssigned(FEnemyDataFragment& Data, const FEnemyConfigSharedFragment& Config)
+{
+	if (Data.bTeamColorAssigned)
+		return;
+
+	if (const AHellunaEnemyCharacter* CDO =
+		Config.EnemyClass ? Config.EnemyClass->GetDefaultObject<AHellunaEnemyCharacter>() : nullptr)
+	{
+		const TArray<FLinearColor>& Options = CDO->TeamColorOptions;
+		if (Options.Num() > 0)
+		{
+			const int32 PickedIndex = FMath::RandRange(0, Options.Num() - 1);
+			Data.TeamColor = Options[PickedIndex];
+			Data.TeamColorIndex = static_cast<int8>(FMath::Min(PickedIndex, static_cast<int32>(MAX_int8)));
+			Data.bTeamColorAssigned = true;
+		}
+	}
+}
+
 // ============================================================================
 // 시각화 헬퍼: Mesh별 ISMC 반환 (없으면 생성 후 Attach)
 // ============================================================================
@@ -308,6 +396,12 @@ UInstancedStaticMeshComponent* UEnemyActorSpawnProcessor::GetOrCreateISMC(UStati
 	ISMC->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	ISMC->SetIsReplicated(false);
 
+	// [ISMCBatchV1] 인스턴스 Custom Data 0~3 = TeamColor RGBA
+	//   Entity 메시 머티리얼에서 PerInstanceCustomData[0..3]을 읽어 틴트 (A=0이면 미지정 → 원본 색)
+	ISMC->NumCustomDataFloats = 4;
+	// RemoveInstance를 마지막 인스턴스와 스왑하는 방식으로 고정 (인덱스 보정 로직이 이를 전제)
+	ISMC->SetRemoveSwap();
+
 	ISMC->SetupAttachment(EntityVisualizationRootComp);
 
 	// ✅ Register는 설정 다 하고 나서
@@ -315,7 +409,7 @@ UInstancedStaticMeshComponent* UEnemyActorSpawnProcessor::GetOrCreateISMC(UStati
 	EntityVisualizationRoot->AddInstanceComponent(ISMC);
 	
 	MeshToISMC.Add(Mesh, ISMC);
-	MeshToInstanceEntities.FindOrAdd(Mesh);
+	MeshToBatch.FindOrAdd(Mesh);
 
 	UE_LOG(LogECSEnemy, Log,
 		TEXT("[Visualization] ISMC 생성 - Mesh: %s (NetMode: %d)"),
@@ -346,6 +440,11 @@ void UEnemyActorSpawnProcessor::Execute(
 	// =========================================================
 	if (!bIsClient)
 	{
+		// ------------------------------------------------------------------
+		// Step 0: [EntityTargetingV1] 포탑 등이 Entity에 준 데미지 적용 (Pool 유무와 무관)
+		// ------------------------------------------------------------------
+		ApplyPendingEntityDamage(EntityManager, World);
+
 		UEnemyActorPool* Pool = World->GetSubsystem<UEnemyActorPool>();
 		if (!Pool)
 		{
@@ -382,22 +481,14 @@ void UEnemyActorSpawnProcessor::Execute(
 			EntityQuery.ForEachEntityChunk(EntityManager, Context,
 				[&](FMassExecutionContext& ChunkCtx)
 				{
-					auto DataList = ChunkCtx.GetFragmentView<FEnemyDataFragment>();
-
-					// Chunk 내 모든 엔티티를 순회하여 미초기화 클래스 초기화.
-					// DataList[0]만 보면 Chunk에 다른 클래스가 섞여있을 때 누락되므로
-					// TSet으로 중복 초기화를 방지하면서 전체 순회.
-					TSet<TSubclassOf<AHellunaEnemyCharacter>> SeenThisChunk;
-					for (int32 di = 0; di < DataList.Num(); ++di)
+					// Const Shared Fragment 기준으로 Chunk가 분할되므로
+					// Chunk 내 모든 Entity는 같은 설정(=같은 EnemyClass)을 공유한다.
+					// → Entity 단위 순회/TSet 중복 체크 없이 Chunk당 1회만 확인.
+					const FEnemyConfigSharedFragment& Config =
+						ChunkCtx.GetConstSharedFragment<FEnemyConfigSharedFragment>();
+					if (Config.EnemyClass && !Pool->IsPoolInitialized(Config.EnemyClass))
 					{
-						const FEnemyDataFragment& Data = DataList[di];
-						if (!Data.EnemyClass || SeenThisChunk.Contains(Data.EnemyClass)) continue;
-						SeenThisChunk.Add(Data.EnemyClass);
-
-						if (!Pool->IsPoolInitialized(Data.EnemyClass))
-						{
-							Pool->InitializePool(Data.EnemyClass, Data.PoolSize);
-						}
+						Pool->InitializePool(Config.EnemyClass, Config.PoolSize);
 					}
 				});
 
@@ -440,15 +531,10 @@ void UEnemyActorSpawnProcessor::Execute(
 					int32 ActiveActorCount = 0;
 					int32 TickRateUpdatedCount = 0;  // #8 성능 로그용
 					int32 TickRateSkippedCount = 0;  // #8 성능 로그용
-					// 한 프레임에 스폰할 수 있는 최대 수 (대량 스폰 시 pathfinding 스파이크 방지)
-					// [SpawnThroughputV1] 5 → 10 — MaxCap 40 도달까지 더 빠르게 수렴.
-					// 프레임당 10 스폰도 pathfinding 큰 부담 없음 (큰 spike 는 50+ 에서).
-					int32 SpawnsThisFrame = 0;
-					static constexpr int32 MaxSpawnsPerFrame = 10;
-					// [주의] MaxConcurrentActorsValue는 엔티티 순회 중 마지막 Data값으로 덮어써짐.
-					// 클래스별로 MaxConcurrentActors가 다르면 순회 순서에 따라 Cap이 달라지는 버그가 있음.
-					int32 MaxConcurrentActorsValue = 50;
-					int32 FirstSeenMaxConcurrent = -1; // 불일치 감지용
+					// 전역 Soft Cap = 이번 프레임에 본 설정들 중 MaxConcurrentActors 최대값.
+					// 스폰 게이트는 Chunk의 설정값을 쓰므로 Cap이 작은 클래스는 자기 Cap 이상 스폰되지 않는다.
+					// (이전에는 순회 순서상 마지막 Entity 값으로 덮어써져 불일치 경고가 필요했음)
+					int32 MaxConcurrentActorsValue = 0;
 
 					struct FSoftCapEntry
 					{
@@ -461,6 +547,31 @@ void UEnemyActorSpawnProcessor::Execute(
 
 					TArray<FSoftCapEntry> SoftCapCandidates;
 
+					// [PromotionSchedV1] 승격 후보 — 순회 중에는 즉시 스폰하지 않고 모아두었다가
+					// Step 4에서 거리 우선순위 + 시간 예산으로 처리한다.
+					// (웨이브 시작 시 수십 개가 동시에 SpawnThreshold를 넘으면 Chunk 순서대로
+					//  스폰되면서 먼 적이 가까운 적보다 먼저 Actor가 되고 프레임이 튀던 문제)
+					struct FPromotionCandidate
+					{
+						float PriorityDistSq;  // min(플레이어 거리², 목표 거리²)
+						FEnemySpawnStateFragment* SpawnStatePtr;
+						FEnemyDataFragment* DataPtr;
+						const FEnemyConfigSharedFragment* ConfigPtr;
+						FTransformFragment* TransformPtr;
+					};
+
+					TArray<FPromotionCandidate> PromotionQueue;
+
+					// [AnimBudgetV1] 이번 프레임 활성 Actor — Step 5에서 애니메이션 예산 분배
+					struct FAnimBudgetEntry
+					{
+						TWeakObjectPtr<AHellunaEnemyCharacter> Enemy;
+						float DistSq;
+						int32 UpdateRate;
+					};
+
+					TArray<FAnimBudgetEntry> AnimBudgetEntries;
+
 					// ------------------------------------------------------------------
 					// Step 3: ForEachEntityChunk - 스폰/디스폰/틱 처리
 					// ------------------------------------------------------------------
@@ -470,30 +581,22 @@ void UEnemyActorSpawnProcessor::Execute(
 							auto TransformList = ChunkCtx.GetMutableFragmentView<FTransformFragment>();
 							auto SpawnStateList = ChunkCtx.GetMutableFragmentView<FEnemySpawnStateFragment>();
 							auto DataList = ChunkCtx.GetMutableFragmentView<FEnemyDataFragment>();
+							const FEnemyConfigSharedFragment& Config =
+								ChunkCtx.GetConstSharedFragment<FEnemyConfigSharedFragment>();
 							const int32 NumEntities = ChunkCtx.GetNumEntities();
 
+							MaxConcurrentActorsValue = FMath::Max(MaxConcurrentActorsValue, Config.MaxConcurrentActors);
+							const float SpawnSq = Config.SpawnThreshold * Config.SpawnThreshold;
+							const float DespawnSq = Config.DespawnThreshold * Config.DespawnThreshold;
+							const float GoalProtectDist = FMath::Max(Config.SpawnThreshold, Config.DespawnThreshold * 0.5f);
+							const float GoalProtectSq = GoalProtectDist * GoalProtectDist;
+
 							for (int32 i = 0; i < NumEntities; ++i)
 							{
 								FEnemySpawnStateFragment& SpawnState = SpawnStateList[i];
 								FEnemyDataFragment& Data = DataList[i];
 								FTransformFragment& Transform = TransformList[i];
 
-								MaxConcurrentActorsValue = Data.MaxConcurrentActors;
-
-								// 클래스별 MaxConcurrentActors 불일치 감지
-								if (FirstSeenMaxConcurrent < 0)
-								{
-									FirstSeenMaxConcurrent = MaxConcurrentActorsValue;
-								}
-								else if (FirstSeenMaxConcurrent != MaxConcurrentActorsValue)
-								{
-									UE_LOG(LogECSEnemy, Warning,
-										TEXT("[SoftCap] MaxConcurrentActors 불일치: 첫값=%d vs 현재=%d "
-										     "클래스별 동일값을 쓰거나 전역 Cap으로 분리하세요."),
-										FirstSeenMaxConcurrent, MaxConcurrentActorsValue);
-									FirstSeenMaxConcurrent = MaxConcurrentActorsValue;
-								}
-
 								if (SpawnState.bHasSpawnedActor)
 								{
 									AActor* Actor = SpawnState.SpawnedActor.Get();
@@ -508,9 +611,6 @@ void UEnemyActorSpawnProcessor::Execute(
 									}
 
 									const float MinDistSq = CalcMinDistSq(Actor->GetActorLocation(), PlayerLocations);
-									const float DespawnSq = Data.DespawnThreshold * Data.DespawnThreshold;
-									const float GoalProtectDist = FMath::Max(Data.SpawnThreshold, Data.DespawnThreshold * 0.5f);
-									const float GoalProtectSq = GoalProtectDist * GoalProtectDist;
 									const float GoalDistSq = Data.bGoalLocationCached
 										? FVector::DistSquared(Actor->GetActorLocation(), Data.GoalLocation)
 										: MAX_FLT;
@@ -525,10 +625,10 @@ void UEnemyActorSpawnProcessor::Execute(
 									const float ActualDist = FMath::Sqrt(MinDistSq);
 
 									// #8 최적화: 거리 밴드 변경 시에만 UpdateActorTickRate 호출
-									int32 NewBand;
-									if (ActualDist < Data.NearDistance)
+									int8 NewBand;
+									if (ActualDist < Config.NearDistance)
 										NewBand = 0;
-									else if (ActualDist < Data.MidDistance)
+									else if (ActualDist < Config.MidDistance)
 										NewBand = 1;
 									else
 										NewBand = 2;
@@ -536,7 +636,7 @@ void UEnemyActorSpawnProcessor::Execute(
 									if (NewBand != Data.CachedDistanceBand)
 									{
 										Data.CachedDistanceBand = NewBand;
-										UpdateActorTickRate(Actor, ActualDist, Data);
+										UpdateActorTickRate(Actor, ActualDist, Config);
 										TickRateUpdatedCount++;
 									}
 									else
@@ -545,6 +645,10 @@ void UEnemyActorSpawnProcessor::Execute(
 									}
 
 									ActiveActorCount++;
+									if (AHellunaEnemyCharacter* Enemy = Cast<AHellunaEnemyCharacter>(Actor))
+									{
+										AnimBudgetEntries.Add({ Enemy, MinDistSq, Enemy->GetBandAnimUpdateRate() });
+									}
 									if (!bNearGoal)
 									{
 										SoftCapCandidates.Add({
@@ -562,7 +666,6 @@ void UEnemyActorSpawnProcessor::Execute(
 
 									const FVector EntityLocation = Transform.GetTransform().GetLocation();
 									const float MinDistSq = CalcMinDistSq(EntityLocation, PlayerLocations);
-									const float SpawnSq = Data.SpawnThreshold * Data.SpawnThreshold;
 
 									// 플레이어 거리 OR 우주선 거리 중 하나라도 SpawnThreshold 이내면 스폰
 									const float GoalDistSq = Data.bGoalLocationCached
@@ -572,14 +675,12 @@ void UEnemyActorSpawnProcessor::Execute(
 									const bool bNearPlayer = MinDistSq < SpawnSq;
 									const bool bNearGoal   = GoalDistSq < SpawnSq;
 
-									if ((bNearPlayer || bNearGoal) && ActiveActorCount < MaxConcurrentActorsValue
-										&& SpawnsThisFrame < MaxSpawnsPerFrame)
+									if (bNearPlayer || bNearGoal)
 									{
-										if (TrySpawnActor(SpawnState, Data, Transform, Pool))
-										{
-											ActiveActorCount++;
-											SpawnsThisFrame++;
-										}
+										PromotionQueue.Add({
+											FMath::Min(MinDistSq, GoalDistSq),
+											&SpawnState, &Data, &Config, &Transform
+										});
 									}
 								}
 							}
@@ -587,38 +688,183 @@ void UEnemyActorSpawnProcessor::Execute(
 					);
 
 					// ------------------------------------------------------------------
-					// Step 4: Soft Cap 관리 (30프레임마다)
+					// Step 4: [PromotionSchedV1] 강등/승격 스케줄러 (단일 패스, 시간 예산)
+					//   a) Soft Cap 초과분: 가장 먼 Actor부터 강등
+					//   b) 승격 큐: 가장 가까운 후보부터 승격
+					//      - 해당 클래스 Cap이 찼으면 가장 먼 활성 Actor와 맞교환 (SwapRatio 히스테리시스)
+					//   - 모든 작업은 같은 시간 예산을 공유 → 웨이브 시작에도 프레임 스파이크 없음
+					//   - 최소 1건은 예산과 무관하게 처리 (후보 기아 방지)
+					//   - 처리하지 못한 후보는 다음 프레임 순회에서 다시 큐에 들어온다
 					// ------------------------------------------------------------------
-					static uint64 LastSoftCapFrame = 0;
-					if (CurrentFrame - LastSoftCapFrame >= 30 && ActiveActorCount > MaxConcurrentActorsValue)
 					{
-						LastSoftCapFrame = CurrentFrame;
+						const double SchedStartTime = FPlatformTime::Seconds();
+						const double BudgetSeconds = FMath::Max(0.f, CVarEnemyPromotionBudgetMs.GetValueOnGameThread()) * 0.001;
+						const int32 MaxPromotions = FMath::Max(1, CVarEnemyMaxPromotionsPerFrame.GetValueOnGameThread());
+						const float SwapRatio = FMath::Max(1.f, CVarEnemyPromotionSwapRatio.GetValueOnGameThread());
+						const float SwapRatioSq = SwapRatio * SwapRatio;
+
+						int32 Promotions = 0;
+						int32 Demotions = 0;
+						auto IsOverBudget = [&]()
+						{
+							return (Promotions + Demotions) > 0
+								&& (FPlatformTime::Seconds() - SchedStartTime) >= BudgetSeconds;
+						};
 
+						// 강등 후보: 먼 순서 (커서로 앞에서부터 소비)
 						SoftCapCandidates.Sort([](const FSoftCapEntry& A, const FSoftCapEntry& B)
 						{
 							return A.DistSq > B.DistSq;
 						});
+						int32 DemoteCursor = 0;
+
+						// 다음 강등 대상 (파괴된 항목은 건너뜀, 커서만 전진 — 강등은 하지 않음)
+						auto PeekDemote = [&]() -> AActor*
+						{
+							while (DemoteCursor < SoftCapCandidates.Num())
+							{
+								AActor* Actor = SoftCapCandidates[DemoteCursor].Actor.Get();
+								if (IsValid(Actor))
+									return Actor;
+								DemoteCursor++;
+							}
+							return nullptr;
+						};
+
+						auto DemoteNext = [&]() -> bool
+						{
+							while (DemoteCursor < SoftCapCandidates.Num())
+							{
+								FSoftCapEntry& Entry = SoftCapCandidates[DemoteCursor++];
+								AActor* Actor = Entry.Actor.Get();
+								if (!IsValid(Actor))
+									continue;
+
+								DespawnActorToEntity(*Entry.SpawnStatePtr, *Entry.DataPtr, *Entry.TransformPtr, Actor, Pool);
+								ActiveActorCount--;
+								Demotions++;
+								return true;
+							}
+							return false;
+						};
+
+						// a) Soft Cap 초과분 강등
+						while (ActiveActorCount > MaxConcurrentActorsValue && !IsOverBudget())
+						{
+							if (!DemoteNext())
+								break;
+						}
+
+						// b) 승격 큐 (거리 오름차순 최소 힙)
+						const int32 QueueDepth = PromotionQueue.Num();
+						auto CloserFirst = [](const FPromotionCandidate& A, const FPromotionCandidate& B)
+						{
+							return A.PriorityDistSq < B.PriorityDistSq;
+						};
+						PromotionQueue.Heapify(CloserFirst);
+
+						while (PromotionQueue.Num() > 0 && Promotions < MaxPromotions && !IsOverBudget())
+						{
+							FPromotionCandidate Candidate;
+							PromotionQueue.HeapPop(Candidate, CloserFirst, EAllowShrinking::No);
+
+							if (ActiveActorCount >= Candidate.ConfigPtr->MaxConcurrentActors)
+							{
+								// Cap이 찼다 — 충분히 먼 Actor가 있을 때만 맞교환
+								// 승격할 클래스의 Pool이 비었으면 강등만 하고 스폰은 실패하므로, 빈자리가 있거나
+								// 강등되는 Actor가 같은 클래스(= 그 Pool로 반납)일 때만 맞교환
+								const TSubclassOf<AHellunaEnemyCharacter> PromoteClass = Candidate.ConfigPtr->EnemyClass;
+								const AActor* SwapOut = PeekDemote();
+								const bool bCanSwap = SwapOut && PromoteClass
+									&& SoftCapCandidates[DemoteCursor].DistSq > Candidate.PriorityDistSq * SwapRatioSq
+									&& (Pool->GetInactiveCount(PromoteClass) > 0 || SwapOut->GetClass() == PromoteClass);
+								if (!bCanSwap || !DemoteNext())
+									continue;
+							}
+
+							if (TrySpawnActor(*Candidate.SpawnStatePtr, *Candidate.DataPtr, *Candidate.ConfigPtr,
+								*Candidate.TransformPtr, Pool))
+							{
+								ActiveActorCount++;
+								Promotions++;
+							}
+						}
 
-						const int32 ToRemove = ActiveActorCount - MaxConcurrentActorsValue;
-						int32 Removed = 0;
+						const float SchedMs = static_cast<float>((FPlatformTime::Seconds() - SchedStartTime) * 1000.0);
+						PromotionStats.QueueDepth = QueueDepth;
+						PromotionStats.Deferred = PromotionQueue.Num();
+						PromotionStats.Promotions = Promotions;
+						PromotionStats.Demotions = Demotions;
+						PromotionStats.TimeMs = SchedMs;
+						PromotionStats.PeakQueueDepth = FMath::Max(PromotionStats.PeakQueueDepth, QueueDepth);
+						PromotionStats.PeakTimeMs = FMath::Max(PromotionStats.PeakTimeMs, SchedMs);
+						PromotionStats.WindowPromotions += Promotions;
+						PromotionStats.WindowDemotions += Demotions;
+					}
 
-						for (int32 k = 0; k < ToRemove && k < SoftCapCandidates.Num(); ++k)
+					// ------------------------------------------------------------------
+					// Step 5: [AnimBudgetV1] 애니메이션 평가 예산 분배
+					//   - 부하 = Σ(1 / 갱신 주기) = 프레임당 평균 평가 횟수
+					//   - 허용 평가 수 = AnimBudgetMs / AnimEvalCostMs
+					//   - 초과 시 가장 먼 Actor부터 주기를 2배씩 (AnimMaxUpdateRate까지) 늘리고,
+					//     상한에 닿으면 그다음 먼 Actor로 넘어간다 → 가까운 적의 애니 품질 우선 보존
+					//   - 스켈레톤 스킵 중(데디 서버 대기 상태)인 Actor는 비용 0이므로 제외
+					//   - Step 4에서 강등된 Actor는 Pool이 스켈레톤을 끄므로 자연히 제외된다
+					// ------------------------------------------------------------------
+					int32 AnimEvaluating = 0;
+					int32 AnimThrottled = 0;
+					float AnimLoad = 0.f;
+					float AnimAllowed = 0.f;
+					{
+						AnimBudgetEntries.RemoveAllSwap([](const FAnimBudgetEntry& Entry)
 						{
-							AActor* Actor = SoftCapCandidates[k].Actor.Get();
-							if (!IsValid(Actor))
-								continue;
-
-							DespawnActorToEntity(
-								*SoftCapCandidates[k].SpawnStatePtr,
-								*SoftCapCandidates[k].DataPtr,
-								*SoftCapCandidates[k].TransformPtr,
-								Actor, Pool);
-							Removed++;
+							const AHellunaEnemyCharacter* Enemy = Entry.Enemy.Get();
+							return !IsValid(Enemy) || !Enemy->IsEvaluatingSkeleton();
+						}, EAllowShrinking::No);
+						AnimEvaluating = AnimBudgetEntries.Num();
+
+						for (const FAnimBudgetEntry& Entry : AnimBudgetEntries)
+						{
+							AnimLoad += 1.f / Entry.UpdateRate;
 						}
 
-						UE_LOG(LogECSEnemy, Log,
-							TEXT("[SoftCap] %d -> %d (Removed=%d)"),
-							ActiveActorCount, ActiveActorCount - Removed, Removed);
+						const float AnimBudgetMs = CVarEnemyAnimBudgetMs.GetValueOnGameThread();
+						const float AnimEvalCostMs = FMath::Max(KINDA_SMALL_NUMBER, CVarEnemyAnimEvalCostMs.GetValueOnGameThread());
+						const int32 MaxUpdateRate = FMath::Max(1, CVarEnemyAnimMaxUpdateRate.GetValueOnGameThread());
+						AnimAllowed = AnimBudgetMs > 0.f ? AnimBudgetMs / AnimEvalCostMs : MAX_FLT;
+
+						if (AnimLoad > AnimAllowed)
+						{
+							AnimBudgetEntries.Sort([](const FAnimBudgetEntry& A, const FAnimBudgetEntry& B)
+							{
+								return A.DistSq > B.DistSq;
+							});
+
+							for (FAnimBudgetEntry& Entry : AnimBudgetEntries)
+							{
+								if (AnimLoad <= AnimAllowed)
+									break;
+
+								const int32 BandRate = Entry.UpdateRate;
+								while (Entry.UpdateRate < MaxUpdateRate && AnimLoad > AnimAllowed)
+								{
+									const int32 NewRate = FMath::Min(Entry.UpdateRate * 2, MaxUpdateRate);
+									AnimLoad -= 1.f / Entry.UpdateRate - 1.f / NewRate;
+									Entry.UpdateRate = NewRate;
+								}
+								if (Entry.UpdateRate != BandRate)
+								{
+									AnimThrottled++;
+								}
+							}
+						}
+
+						// 예산 밖 Actor도 매 프레임 적용 — 부하가 줄면 밴드 기본 주기로 복귀
+						// (SetServerAnimUpdateRate는 값이 바뀔 때만 파라미터를 건드린다)
+						for (const FAnimBudgetEntry& Entry : AnimBudgetEntries)
+						{
+							Entry.Enemy->SetServerAnimUpdateRate(Entry.UpdateRate);
+						}
 					}
 
 					// [SpawnDiagV1] 주기 1초 (60 프레임) + Warning 레벨 — 필터 안 걸려서 즉시 확인
@@ -626,25 +872,41 @@ void UEnemyActorSpawnProcessor::Execute(
 					//  - MaxCap: 현재 Config 의 MaxConcurrentActors (둘 합쳐 이 값 초과 불가 — 기존 버그)
 					//  - Players: 플레이어 수
 					//  - PoolTotal: Pool 의 전체 Active/Inactive (합 = 미리 생성된 Actor 수 = PoolSize × Class수)
-					//  - SpawnsThisFrame: 이번 프레임에 새로 활성된 Actor
+					//               H/M = [PoolWarmUpV1] ActivateActor 누적 Hit/Miss
+					//  - Promo: [PromotionSchedV1] 이번 프레임 큐 깊이/이월/승격/강등/소요 ms
+					//  - Peak: 직전 로그 이후 최대 큐 깊이/최대 소요 ms, 누적 승격/강등
 					static uint64 LastDebugFrame = 0;
 					if (CurrentFrame - LastDebugFrame >= 60)
 					{
 						LastDebugFrame = CurrentFrame;
 						UE_LOG(LogECSEnemy, Warning,
 							TEXT("[SpawnDiagV1] ActiveTotal=%d / MaxCap=%d | Players=%d | "
-							     "Pool(A=%d I=%d) | SpawnsThisFrame=%d | TickRate(U=%d S=%d %.0f%%)"),
+							     "Pool(A=%d I=%d H=%d M=%d) | Promo(Q=%d Defer=%d +%d -%d %.2fms) | "
+							     "Peak(Q=%d %.2fms +%d -%d) | TickRate(U=%d S=%d %.0f%%) | "
+							     "Anim(Eval=%d Load=%.1f/%.1f Thr=%d)"),
 							ActiveActorCount, MaxConcurrentActorsValue, PlayerLocations.Num(),
 							Pool->GetTotalActiveCount(), Pool->GetTotalInactiveCount(),
-							SpawnsThisFrame,
+							Pool->GetTotalHitCount(), Pool->GetTotalMissCount(),
+							PromotionStats.QueueDepth, PromotionStats.Deferred,
+							PromotionStats.Promotions, PromotionStats.Demotions, PromotionStats.TimeMs,
+							PromotionStats.PeakQueueDepth, PromotionStats.PeakTimeMs,
+							PromotionStats.WindowPromotions, PromotionStats.WindowDemotions,
 							TickRateUpdatedCount, TickRateSkippedCount,
 							(TickRateUpdatedCount + TickRateSkippedCount) > 0
 								? (TickRateSkippedCount * 100.f / (TickRateUpdatedCount + TickRateSkippedCount))
-								: 0.f);
+								: 0.f,
+							AnimEvaluating, AnimLoad, AnimAllowed == MAX_FLT ? 0.f : AnimAllowed, AnimThrottled);
+						PromotionStats.ResetWindow();
 					}
 				}
 			}
 		}
+
+		// [EntityRepProxyV1] 네트워크 서버에서만 — Standalone은 복제 대상 없음
+		if (World->GetNetMode() == NM_ListenServer || World->GetNetMode() == NM_DedicatedServer)
+		{
+			SyncReplicationProxy(EntityManager, Context, World);
+		}
 	}
 
 	// =========================================================
@@ -654,6 +916,8 @@ void UEnemyActorSpawnProcessor::Execute(
 	if (World && World->GetNetMode() == NM_DedicatedServer)
 		return;  // 데디서버에서는 시각화 연산 완전 생략
 
+	const uint64 VisFrame = GFrameCounter;
+
 	EntityQuery.ForEachEntityChunk(EntityManager, Context,
 		[&](FMassExecutionContext& ChunkContext)
 		{
@@ -661,47 +925,60 @@ void UEnemyActorSpawnProcessor::Execute(
 
 			const TConstArrayView<FTransformFragment> TransformList =
 				ChunkContext.GetFragmentView<FTransformFragment>();
-			const TArrayView<FEnemySpawnStateFragment> SpawnStateList =
-				ChunkContext.GetMutableFragmentView<FEnemySpawnStateFragment>();
+			const TConstArrayView<FEnemySpawnStateFragment> SpawnStateList =
+				ChunkContext.GetFragmentView<FEnemySpawnStateFragment>();
 			const TArrayView<FEnemyDataFragment> DataList =
 				ChunkContext.GetMutableFragmentView<FEnemyDataFragment>();
+			const TArrayView<FEnemyVisualInstanceFragment> VisInstanceList =
+				ChunkContext.GetMutableFragmentView<FEnemyVisualInstanceFragment>();
+			const FEnemyConfigSharedFragment& Config =
+				ChunkContext.GetConstSharedFragment<FEnemyConfigSharedFragment>();
 
 			for (int32 i = 0; i < NumEntities; ++i)
 			{
-				const FMassEntityHandle Entity = ChunkContext.GetEntity(i);
-				const FTransformFragment& Transform = TransformList[i];
-				const FEnemySpawnStateFragment& SpawnState = SpawnStateList[i];
-				const FEnemyDataFragment& Data = DataList[i];
-
-				UpdateEntityVisualization(Entity, Transform, Data, SpawnState);
+				UpdateEntityVisualization(EntityManager, ChunkContext.GetEntity(i),
+					TransformList[i], Config, SpawnStateList[i], DataList[i], VisInstanceList[i], VisFrame);
 			}
 		}
 	);
+
+	FlushEntityVisualization(EntityManager, VisFrame);
 }
 
 
 // ============================================================================
 // 시각화: Entity 상태에 따라 ISMC 인스턴스 추가/갱신/제거
+// [ISMCBatchV1] 기존 인스턴스는 미러 배열만 갱신 — ISMC 반영은 Flush에서 Mesh당 1회
 // ============================================================================
 void UEnemyActorSpawnProcessor::UpdateEntityVisualization(
+	FMassEntityManager& EntityManager,
 	const FMassEntityHandle Entity,
 	const FTransformFragment& Transform,
-	const FEnemyDataFragment& Data,
-	const FEnemySpawnStateFragment& SpawnState)
+	const FEnemyConfigSharedFragment& Config,
+	const FEnemySpawnStateFragment& SpawnState,
+	FEnemyDataFragment& Data,
+	FEnemyVisualInstanceFragment& VisInstance,
+	uint64 FrameNumber)
 {
 	const bool bShouldVisualize =
 		!SpawnState.bHasSpawnedActor &&
 		!SpawnState.bDead &&
-		Data.bShowEntityVisualization &&
-		Data.EntityVisualizationMesh != nullptr;
+		Config.bShowEntityVisualization &&
+		Config.EntityVisualizationMesh != nullptr;
 
-	FEntityInstanceRef* ExistingRef = EntityToInstanceRef.Find(Entity);
+	UStaticMesh* Mesh = Config.EntityVisualizationMesh;
 
 	if (!bShouldVisualize)
 	{
-		if (ExistingRef)
+		if (VisInstance.InstanceIndex != INDEX_NONE)
 		{
-			CleanupEntityVisualization(Entity);
+			FEntityISMCBatch* Batch = Mesh ? MeshToBatch.Find(Mesh) : nullptr;
+			if (Batch && Batch->InstanceEntities.IsValidIndex(VisInstance.InstanceIndex)
+				&& Batch->InstanceEntities[VisInstance.InstanceIndex] == Entity)
+			{
+				RemoveEntityInstance(EntityManager, Mesh, *Batch, VisInstance.InstanceIndex);
+			}
+			VisInstance.InstanceIndex = INDEX_NONE;
 		}
 		return;
 	}
@@ -714,106 +991,313 @@ void UEnemyActorSpawnProcessor::UpdateEntityVisualization(
 	if (!EntityVisualizationRootComp)
 		return;
 
-	UStaticMesh* Mesh = Data.EntityVisualizationMesh;
 	UInstancedStaticMeshComponent* ISMC = GetOrCreateISMC(Mesh);
 	if (!ISMC)
 		return;
 
+	FEntityISMCBatch& Batch = MeshToBatch.FindOrAdd(Mesh);
+
 	FTransform InstanceTransform = Transform.GetTransform();
-	InstanceTransform.AddToTranslation(FVector(0.f, 0.f, Data.EntityMeshZOffset));
-	InstanceTransform.SetScale3D(Data.EntityMeshScale);
+	InstanceTransform.AddToTranslation(FVector(0.f, 0.f, Config.EntityMeshZOffset));
+	InstanceTransform.SetScale3D(Config.EntityMeshScale);
 
-	// 이미 존재하면 업데이트
-	if (ExistingRef && ExistingRef->Mesh == Mesh && ExistingRef->Index != INDEX_NONE)
+	// 이미 존재하면 미러만 갱신
+	const int32 Index = VisInstance.InstanceIndex;
+	if (Index != INDEX_NONE)
 	{
-		if (ExistingRef->Index < ISMC->GetInstanceCount())
+		if (Batch.InstanceEntities.IsValidIndex(Index) && Batch.InstanceEntities[Index] == Entity)
 		{
-			ISMC->UpdateInstanceTransform(ExistingRef->Index, InstanceTransform, true, true, true);
+			Batch.InstanceTransforms[Index] = InstanceTransform;
+			Batch.LastSeenFrame[Index] = FrameNumber;
+			Batch.MarkDirty(Index);
 			return;
 		}
-		// 인덱스가 깨졌으면 재생성
-		CleanupEntityVisualization(Entity);
+		// 인덱스가 깨졌으면 (다른 Mesh로 바뀌었거나 정리됨) 새로 생성
+		VisInstance.InstanceIndex = INDEX_NONE;
 	}
 
-	// 새 인스턴스 생성
-	const int32 NewIndex = ISMC->AddInstance(InstanceTransform, true);
-
-	TArray<FMassEntityHandle>& InstanceEntities = MeshToInstanceEntities.FindOrAdd(Mesh);
+	EnsureTeamColorAssigned(Data, Config);
+	VisInstance.InstanceIndex = AddBatchInstance(ISMC, Mesh, Batch, Entity, InstanceTransform,
+		Data.TeamColor, Data.bTeamColorAssigned, FrameNumber);
+}
 
-	// ISMC는 순서대로 Append하므로 NewIndex == InstanceEntities.Num()이어야 정상
-	if (NewIndex != InstanceEntities.Num())
+// ============================================================================
+// 시각화: 배치 끝에 인스턴스 추가
+// ============================================================================
+int32 UEnemyActorSpawnProcessor::AddBatchInstance(
+	UInstancedStaticMeshComponent* ISMC,
+	UStaticMesh* Mesh,
+	FEntityISMCBatch& Batch,
+	const FMassEntityHandle Owner,
+	const FTransform& InstanceTransform,
+	const FLinearColor& TeamColor,
+	bool bHasTeamColor,
+	uint64 FrameNumber)
+{
+	// 새 인스턴스 생성 — ISMC는 Append하므로 NewIndex == Batch 배열 길이
+	const int32 NewIndex = ISMC->AddInstance(InstanceTransform, /*bWorldSpace=*/true);
+	if (NewIndex != Batch.InstanceEntities.Num())
 	{
 		UE_LOG(LogECSEnemy, Warning,
 			TEXT("[Visualization] ISMC 인덱스 불일치: NewIndex=%d, InstanceEntities.Num()=%d "
 			     "— 인스턴스 매핑이 깨졌을 수 있습니다. Mesh: %s"),
-			NewIndex, InstanceEntities.Num(), *Mesh->GetName());
+			NewIndex, Batch.InstanceEntities.Num(), *Mesh->GetName());
 	}
 
-	FEntityInstanceRef NewRef;
-	NewRef.Mesh = Mesh;
-	NewRef.Index = NewIndex;
-	EntityToInstanceRef.Add(Entity, NewRef);
-
 	// 방어: NewIndex 위치까지 채우기
-	while (InstanceEntities.Num() < NewIndex)
-		InstanceEntities.Add(FMassEntityHandle());
-
-	InstanceEntities.Add(Entity);
+	while (Batch.InstanceEntities.Num() < NewIndex)
+	{
+		Batch.InstanceEntities.Add(FMassEntityHandle());
+		Batch.InstanceTransforms.Add(FTransform::Identity);
+		Batch.LastSeenFrame.Add(0);
+	}
+	Batch.InstanceEntities.Add(Owner);
+	Batch.InstanceTransforms.Add(InstanceTransform);
+	Batch.LastSeenFrame.Add(FrameNumber);
+
+	// TeamColor → Custom Data (스왑 삭제 시 ISMC가 Custom Data도 함께 옮김)
+	const float CustomData[4] = {
+		TeamColor.R, TeamColor.G, TeamColor.B,
+		bHasTeamColor ? TeamColor.A : 0.f
+	};
+	ISMC->SetCustomData(NewIndex, MakeArrayView(CustomData, 4), /*bMarkRenderStateDirty=*/false);
+	return NewIndex;
 }
 
 // ============================================================================
-// 시각화: 인스턴스 제거 (RemoveInstance 스왑 방식에 맞춰 인덱스 매핑 갱신)
+// 시각화: 인스턴스 제거 (RemoveInstance 스왑 방식에 맞춰 미러 + Fragment 인덱스 갱신)
 // ============================================================================
-void UEnemyActorSpawnProcessor::CleanupEntityVisualization(const FMassEntityHandle Entity)
+void UEnemyActorSpawnProcessor::RemoveEntityInstance(
+	FMassEntityManager& EntityManager,
+	UStaticMesh* Mesh,
+	FEntityISMCBatch& Batch,
+	int32 RemoveIndex)
 {
-	FEntityInstanceRef* Ref = EntityToInstanceRef.Find(Entity);
-	if (!Ref || !Ref->Mesh || Ref->Index == INDEX_NONE)
+	const int32 LastIndex = Batch.InstanceEntities.Num() - 1;
+	if (RemoveIndex < 0 || RemoveIndex > LastIndex)
 		return;
 
-	UInstancedStaticMeshComponent* ISMC = nullptr;
-	if (TObjectPtr<UInstancedStaticMeshComponent>* Found = MeshToISMC.Find(Ref->Mesh))
+	if (TObjectPtr<UInstancedStaticMeshComponent>* Found = MeshToISMC.Find(Mesh))
 	{
-		ISMC = Found->Get();
+		if (UInstancedStaticMeshComponent* ISMC = Found->Get())
+		{
+			ISMC->RemoveInstance(RemoveIndex);
+		}
 	}
-	if (!ISMC)
+
+	// RemoveInstance는 마지막↔제거 위치 스왑 → 미러와 옮겨진 Entity의 Fragment도 동일하게 처리
+	if (RemoveIndex != LastIndex)
 	{
-		EntityToInstanceRef.Remove(Entity);
-		return;
+		const FMassEntityHandle SwappedEntity = Batch.InstanceEntities[LastIndex];
+		if (EntityManager.IsEntityValid(SwappedEntity))
+		{
+			if (FEnemyVisualInstanceFragment* SwappedVis =
+				EntityManager.GetFragmentDataPtr<FEnemyVisualInstanceFragment>(SwappedEntity))
+			{
+				SwappedVis->InstanceIndex = RemoveIndex;
+			}
+		}
+		Batch.MarkDirty(RemoveIndex);
 	}
 
-	TArray<FMassEntityHandle>* InstanceEntitiesPtr = MeshToInstanceEntities.Find(Ref->Mesh);
-	if (!InstanceEntitiesPtr)
+	Batch.InstanceEntities.RemoveAtSwap(RemoveIndex, EAllowShrinking::No);
+	Batch.InstanceTransforms.RemoveAtSwap(RemoveIndex, EAllowShrinking::No);
+	Batch.LastSeenFrame.RemoveAtSwap(RemoveIndex, EAllowShrinking::No);
+}
+
+// ============================================================================
+// 시각화: 프레임 마무리 — 고아 인스턴스 정리 + Mesh당 BatchUpdateInstancesTransforms 1회
+// ============================================================================
+void UEnemyActorSpawnProcessor::FlushEntityVisualization(FMassEntityManager& EntityManager, uint64 FrameNumber)
+{
+	for (auto& Pair : MeshToBatch)
 	{
-		EntityToInstanceRef.Remove(Entity);
-		return;
+		UStaticMesh* Mesh = Pair.Key;
+		FEntityISMCBatch& Batch = Pair.Value;
+
+		// 이번 프레임 순회에서 보이지 않은 인스턴스 = 파괴된 Entity (DestroyEntity 경로)
+		// 뒤에서부터 제거해야 스왑으로 당겨온 인스턴스가 이미 검사된 것이 된다.
+		for (int32 i = Batch.LastSeenFrame.Num() - 1; i >= 0; --i)
+		{
+			if (Batch.LastSeenFrame[i] != FrameNumber)
+			{
+				RemoveEntityInstance(EntityManager, Mesh, Batch, i);
+			}
+		}
+
+		const int32 Num = Batch.InstanceTransforms.Num();
+		Batch.DirtyMax = FMath::Min(Batch.DirtyMax, Num - 1);
+		if (Batch.DirtyMax < Batch.DirtyMin)
+		{
+			Batch.DirtyMin = MAX_int32;
+			Batch.DirtyMax = INDEX_NONE;
+			continue;
+		}
+
+		TObjectPtr<UInstancedStaticMeshComponent>* Found = MeshToISMC.Find(Mesh);
+		UInstancedStaticMeshComponent* ISMC = Found ? Found->Get() : nullptr;
+		if (ISMC)
+		{
+			if (Batch.DirtyMin == 0 && Batch.DirtyMax == Num - 1)
+			{
+				ISMC->BatchUpdateInstancesTransforms(0, Batch.InstanceTransforms,
+					/*bWorldSpace=*/true, /*bMarkRenderStateDirty=*/true, /*bTeleport=*/true);
+			}
+			else
+			{
+				BatchScratchTransforms.Reset();
+				BatchScratchTransforms.Append(&Batch.InstanceTransforms[Batch.DirtyMin], Batch.DirtyMax - Batch.DirtyMin + 1);
+				ISMC->BatchUpdateInstancesTransforms(Batch.DirtyMin, BatchScratchTransforms,
+					/*bWorldSpace=*/true, /*bMarkRenderStateDirty=*/true, /*bTeleport=*/true);
+			}
+		}
+
+		Batch.DirtyMin = MAX_int32;
+		Batch.DirtyMax = INDEX_NONE;
 	}
+}
 
-	TArray<FMassEntityHandle>& InstanceEntities = *InstanceEntitiesPtr;
-	const int32 RemoveIndex = Ref->Index;
-	const int32 LastIndex = InstanceEntities.Num() - 1;
+// ============================================================================
+// [EntityTargetingV1] Entity 직접 데미지
+//   큐잉(게임 스레드) → 이 Processor(게임 스레드)에서 적용하므로
+//   워커 스레드 이동 Processor와 Fragment 쓰기가 겹치지 않는다.
+// ============================================================================
+void UEnemyActorSpawnProcessor::ApplyPendingEntityDamage(FMassEntityManager& EntityManager, UWorld* World)
+{
+	UEnemyEntitySpatialSubsystem* SpatialSubsystem = World->GetSubsystem<UEnemyEntitySpatialSubsystem>();
+	if (!SpatialSubsystem || !SpatialSubsystem->HasPendingDamage())
+		return;
 
-	if (RemoveIndex < 0 || RemoveIndex > LastIndex)
+	SpatialSubsystem->ConsumePendingDamage(PendingDamageScratch);
+
+	AHellunaDefenseGameMode* DefenseGM = Cast<AHellunaDefenseGameMode>(World->GetAuthGameMode());
+	int32 KilledCount = 0;
+
+	for (const FEnemyEntityPendingDamage& Hit : PendingDamageScratch)
+	{
+		if (!EntityManager.IsEntityValid(Hit.Entity))
+			continue;
+
+		FEnemySpawnStateFragment* SpawnState = EntityManager.GetFragmentDataPtr<FEnemySpawnStateFragment>(Hit.Entity);
+		FEnemyDataFragment* Data = EntityManager.GetFragmentDataPtr<FEnemyDataFragment>(Hit.Entity);
+		if (!SpawnState || !Data || SpawnState->bDead)
+			continue;
+
+		// 큐잉 이후 Actor로 승격됨 → 일반 데미지 경로(HealthComponent/GA_Death)로 전달
+		if (SpawnState->bHasSpawnedActor)
+		{
+			if (AActor* Actor = SpawnState->SpawnedActor.Get())
+			{
+				UGameplayStatics::ApplyDamage(Actor, Hit.Damage, nullptr, Hit.DamageCauser.Get(), UDamageType::StaticClass());
+			}
+			continue;
+		}
+
+		// 첫 스폰 전(-1)이면 EnemyClass 기본 최대 체력으로 시작
+		if (Data->CurrentHP < 0.f)
+		{
+			const FEnemyConfigSharedFragment* Config = EntityManager.GetConstSharedFragmentDataPtr<FEnemyConfigSharedFragment>(Hit.Entity);
+			Data->MaxHP = SpatialSubsystem->GetDefaultMaxHP(Config ? Config->EnemyClass : nullptr, Data->MaxHP);
+			Data->CurrentHP = Data->MaxHP;
+		}
+
+		Data->CurrentHP -= Hit.Damage;
+		if (Data->CurrentHP > 0.f)
+			continue;
+
+		// Entity 상태 사망 — ISMC/복제 프록시는 bDead를 보고 다음 시각화 패스에서 정리된다
+		SpawnState->bDead = true;
+		SpawnState->EntityOnlyFrames = 0;
+		Data->CurrentHP = -1.f;
+		++KilledCount;
+
+		if (DefenseGM)
+		{
+			const FEnemyConfigSharedFragment* Config = EntityManager.GetConstSharedFragmentDataPtr<FEnemyConfigSharedFragment>(Hit.Entity);
+			DefenseGM->NotifyEntityMonsterDied(Config ? Config->EnemyGrade : EEnemyGrade::Normal);
+		}
+	}
+
+	if (KilledCount > 0)
 	{
-		EntityToInstanceRef.Remove(Entity);
+		UE_LOG(LogECSEnemy, Verbose, TEXT("[EntityTargetingV1] Entity 데미지 %d건 적용, 사망 %d"),
+			PendingDamageScratch.Num(), KilledCount);
+	}
+}
+
+// ============================================================================
+// [EntityRepProxyV1] 서버: Entity 상태 적 → 복제 프록시 Sync
+//   - Actor 상태/사망 Entity는 항목에서 빠진다 (Actor는 자체 복제로 보임)
+//   - 양자화 값이 바뀐 항목만 Dirty → FastArray가 변경분만 전송
+// ============================================================================
+void UEnemyActorSpawnProcessor::SyncReplicationProxy(
+	FMassEntityManager& EntityManager,
+	FMassExecutionContext& Context,
+	UWorld* World)
+{
+	const float RepHz = CVarEnemyEntityRepHz.GetValueOnGameThread();
+	if (RepHz <= 0.f)
+		return;
+
+	const double Now = World->GetTimeSeconds();
+	if (Now - LastEntityRepSyncTime < 1.0 / RepHz)
 		return;
+	LastEntityRepSyncTime = Now;
+
+	AEnemyEntityReplicationProxy* Proxy = ReplicationProxy.Get();
+	if (!Proxy)
+	{
+		Proxy = AEnemyEntityReplicationProxy::FindOrSpawn(World);
+		ReplicationProxy = Proxy;
+		if (!Proxy)
+			return;
 	}
 
-	// RemoveInstance는 내부적으로 마지막↔제거 위치 스왑 → 매핑도 동일하게 처리
-	if (RemoveIndex != LastIndex)
+	if (!FMath::IsNearlyEqual(Proxy->GetNetUpdateFrequency(), RepHz))
 	{
-		const FMassEntityHandle SwappedEntity = InstanceEntities[LastIndex];
-		InstanceEntities[RemoveIndex] = SwappedEntity;
+		Proxy->SetNetUpdateFrequency(RepHz);
+	}
 
-		if (FEntityInstanceRef* SwappedRef = EntityToInstanceRef.Find(SwappedEntity))
+	Proxy->BeginSync();
+
+	EntityQuery.ForEachEntityChunk(EntityManager, Context,
+		[&](FMassExecutionContext& ChunkCtx)
 		{
-			SwappedRef->Index = RemoveIndex;
-		}
-	}
+			const FEnemyConfigSharedFragment& Config =
+				ChunkCtx.GetConstSharedFragment<FEnemyConfigSharedFragment>();
+			if (!Config.bShowEntityVisualization || !Config.EntityVisualizationMesh)
+				return;
+
+			// Chunk당 1회 — 같은 Chunk는 같은 설정
+			const uint8 VisualType = Proxy->GetOrAddVisualType(
+				Config.EnemyClass, Config.EntityVisualizationMesh, Config.EntityMeshScale, Config.EntityMeshZOffset);
+
+			const TConstArrayView<FTransformFragment> TransformList = ChunkCtx.GetFragmentView<FTransformFragment>();
+			const TConstArrayView<FEnemySpawnStateFragment> SpawnStateList = ChunkCtx.GetFragmentView<FEnemySpawnStateFragment>();
+			const TArrayView<FEnemyDataFragment> DataList = ChunkCtx.GetMutableFragmentView<FEnemyDataFragment>();
 
-	InstanceEntities.Pop();
-	ISMC->RemoveInstance(RemoveIndex);
+			for (int32 i = 0; i < ChunkCtx.GetNumEntities(); ++i)
+			{
+				const FEnemySpawnStateFragment& SpawnState = SpawnStateList[i];
+				if (SpawnState.bHasSpawnedActor || SpawnState.bDead)
+					continue;
+
+				FEnemyDataFragment& Data = DataList[i];
+				EnsureTeamColorAssigned(Data, Config);
+
+				const FTransform& EntityTransform = TransformList[i].GetTransform();
+				const FMassEntityHandle Entity = ChunkCtx.GetEntity(i);
+				Proxy->UpdateEntity(
+					static_cast<uint32>(Entity.Index),
+					Entity.SerialNumber,
+					EntityTransform.GetLocation(),
+					EntityTransform.Rotator().Yaw,
+					VisualType,
+					Data.TeamColorIndex >= 0 ? static_cast<uint8>(Data.TeamColorIndex) : EnemyEntityRepQuant::NoTeamColor);
+			}
+		});
 
-	EntityToInstanceRef.Remove(Entity);
+	Proxy->EndSync();
 }
 
 // ============================================================================
@@ -821,9 +1305,10 @@ void UEnemyActorSpawnProcessor::CleanupEntityVisualization(const FMassEntityHand
 // ============================================================================
 //
 // ■ 증상: 멀티에서 클라이언트에 메시 안 보임
-//   1. Output Log에서 "[Visualization] Root Actor 생성 (NetMode: 1)" 확인
-//      → 없으면 ExecutionFlags::Client 미적용 또는 Entity가 클라에 없음
-//   2. "[Visualization] ISMC 생성" 로그 확인
+//   1. 클라에는 Entity가 없음 → Entity 상태 적은 AEnemyEntityReplicationProxy가 표시
+//      Output Log에서 "[EntityRepProxyV1] 클라 ISMC 생성" 확인
+//      → 없으면 Helluna.ECS.EntityRepHz=0 또는 서버 Sync 대상 없음
+//   2. 서버 "[EntityRepProxyV1] 프록시 생성" 로그 확인
 //      → 없으면 bShowEntityVisualization=false 또는 EntityVisualizationMesh=null
 //
 // ■ 증상: 적이 가까이 와도 Actor로 전환되지 않음
@@ -0,0 +1,203 @@
+/**
+ * EnemyGoalCacheProcessor.cpp
+ *
+ * 60프레임마다 우주선 슬롯/ShipCombatCollision/링 정보를 모아
+ * Entity별 해시 기반으로 GoalLocation을 분산 배정한다.
+ * (기존 UEnemyEntityMovementProcessor Step 0를 게임 스레드 전용으로 분리)
+ */
+
+#include "ECS/Processors/EnemyGoalCacheProcessor.h"
+
+#include "MassCommonFragments.h"
+#include "MassExecutionContext.h"
+#include "ECS/Fragments/EnemyMassFragments.h"
+#include "ECS/Processors/EnemyEntityMovementProcessor.h"
+#include "AI/SpaceShipAttackSlotManager.h"
+
+#include "EngineUtils.h"
+#include "Engine/World.h"
+#include "Components/PrimitiveComponent.h"
+#include "Utils/HellunaActorRegistrySubsystem.h"
+
+// ============================================================================
+// 생성자
+// ============================================================================
+UEnemyGoalCacheProcessor::UEnemyGoalCacheProcessor()
+{
+	ExecutionFlags = (uint8)(
+		EProcessorExecutionFlags::Server |
+		EProcessorExecutionFlags::Standalone
+	);
+
+	// 우주선 Actor/컴포넌트 접근 → 게임 스레드 필수
+	bRequiresGameThreadExecution = true;
+	ExecutionOrder.ExecuteBefore.Add(UEnemyEntityMovementProcessor::StaticClass()->GetFName());
+	RegisterQuery(GoalCacheQuery);
+}
+
+// ============================================================================
+// ConfigureQueries
+// ============================================================================
+void UEnemyGoalCacheProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	GoalCacheQuery.RegisterWithProcessor(*this);
+	GoalCacheQuery.AddRequirement<FEnemyDataFragment>(EMassFragmentAccess::ReadWrite);
+	GoalCacheQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadOnly);
+}
+
+// ============================================================================
+// Execute
+// ============================================================================
+void UEnemyGoalCacheProcessor::Execute(
+	FMassEntityManager& EntityManager,
+	FMassExecutionContext& Context)
+{
+	// ----------------------------------------------------------------
+	// GoalLocation 캐싱 (StateTree에 의존하지 않고 직접 처리)
+	// 60프레임마다 갱신한다. Actor 단계는 슬롯 시스템이 분산을 담당하므로
+	// Entity 단계도 같은 슬롯/링 정보를 사용해 우주선 주변으로 퍼지게 만든다.
+	//
+	// [버그 수정] 우주선 중심점(GetActorLocation)을 GoalLocation으로 쓰면
+	// Entity가 콜리전 없이 순수 수학 이동을 하므로 우주선 메쉬를 관통해
+	// 중심까지 파고드는 현상이 발생.
+	//
+	// 해결:
+	//   1) 우주선 슬롯이 있으면 엔티티별 해시 기반으로 슬롯/근처 지점을 선택
+	//   2) 슬롯이 없으면 ShipCombatCollision 컴포넌트 주변으로 분산
+	//   3) 그것도 없으면 우주선 둘레 링으로 분산
+	// ----------------------------------------------------------------
+	if (GFrameCounter % 60 == 0)
+	{
+		UWorld* World = Context.GetWorld();
+		if (World)
+		{
+			// 우주선 Actor와 ShipCombatCollision 박스들을 미리 수집 (모든 Entity 공통)
+			// #2 최적화: TActorIterator 반복 스캔 대신 캐시 사용
+			TArray<FVector> ApproachPoints;
+			TArray<FVector> SlotPoints;
+			TArray<FVector> SlotNormals;
+
+			if (!CachedSpaceShip.IsValid())
+			{
+				// [ActorRegistryV1] 월드 전체 TActorIterator 대신 레지스트리
+				if (const UHellunaActorRegistrySubsystem* Registry = World->GetSubsystem<UHellunaActorRegistrySubsystem>())
+				{
+					CachedSpaceShip = Registry->GetSpaceShip();
+				}
+			}
+			AActor* GoalActor = CachedSpaceShip.Get();
+
+			if (GoalActor)
+			{
+				// ShipCombatCollision 태그 컴포넌트 수집
+				TArray<UPrimitiveComponent*> Prims;
+				GoalActor->GetComponents<UPrimitiveComponent>(Prims);
+				for (UPrimitiveComponent* Prim : Prims)
+				{
+					if (Prim && Prim->ComponentHasTag(TEXT("ShipCombatCollision")))
+						ApproachPoints.Add(Prim->GetComponentLocation());
+				}
+
+				if (USpaceShipAttackSlotManager* SlotManager =
+					GoalActor->FindComponentByClass<USpaceShipAttackSlotManager>())
+				{
+					for (const FAttackSlot& Slot : SlotManager->GetSlots())
+					{
+						if (Slot.IsValid())
+						{
+							const FVector SlotAnchor = Slot.SurfaceLocation.IsZero() ? Slot.WorldLocation : Slot.SurfaceLocation;
+							const FVector SlotNormal =
+								Slot.SurfaceNormal.IsNearlyZero()
+									? (SlotAnchor - GoalActor->GetActorLocation()).GetSafeNormal2D()
+									: Slot.SurfaceNormal.GetSafeNormal2D();
+							SlotPoints.Add(SlotAnchor);
+							SlotNormals.Add(SlotNormal);
+						}
+					}
+				}
+
+				FVector BoundsOrigin = FVector::ZeroVector;
+				FVector BoundsExtent = FVector::ZeroVector;
+				GoalActor->GetActorBounds(true, BoundsOrigin, BoundsExtent);
+				const float RingRadius = FMath::Max(BoundsExtent.Size2D() + 220.f, 260.f);
+				for (int32 RingIndex = 0; RingIndex < 8; ++RingIndex)
+				{
+					const float AngleRad = FMath::DegreesToRadians(360.f * static_cast<float>(RingIndex) / 8.f);
+					const FVector RingDir(FMath::Cos(AngleRad), FMath::Sin(AngleRad), 0.f);
+					ApproachPoints.Add(GoalActor->GetActorLocation() + RingDir * RingRadius);
+				}
+			}
+
+			if (GoalActor)
+			{
+				const FVector FallbackLoc = GoalActor->GetActorLocation();
+				auto MakeSpreadOffset = [](uint32 Seed, const FVector& BasisDir, float MinRadius, float MaxRadius)
+				{
+					FVector Forward = FVector(BasisDir.X, BasisDir.Y, 0.f).GetSafeNormal();
+					if (Forward.IsNearlyZero())
+					{
+						const float FallbackAngle = FMath::DegreesToRadians(static_cast<float>(Seed % 360));
+						Forward = FVector(FMath::Cos(FallbackAngle), FMath::Sin(FallbackAngle), 0.f);
+					}
+
+					const FVector Right(-Forward.Y, Forward.X, 0.f);
+					const float AngleDeg = static_cast<float>((Seed >> 8) % 360);
+					const float RadiusAlpha = static_cast<float>((Seed >> 16) & 0xFF) / 255.f;
+					const float Radius = FMath::Lerp(MinRadius, MaxRadius, RadiusAlpha);
+					const float AngleRad = FMath::DegreesToRadians(AngleDeg);
+					return (Forward * FMath::Cos(AngleRad) + Right * FMath::Sin(AngleRad)) * Radius;
+				};
+
+				GoalCacheQuery.ForEachEntityChunk(Context,
+					[&](FMassExecutionContext& ChunkCtx)
+					{
+						const TArrayView<FEnemyDataFragment> DataList =
+							ChunkCtx.GetMutableFragmentView<FEnemyDataFragment>();
+						const TConstArrayView<FTransformFragment> TransformList =
+							ChunkCtx.GetFragmentView<FTransformFragment>();
+
+						for (int32 i = 0; i < ChunkCtx.GetNumEntities(); ++i)
+						{
+							FEnemyDataFragment& Data = DataList[i];
+							const FMassEntityHandle Entity = ChunkCtx.GetEntity(i);
+							const uint32 EntitySeed = GetTypeHash(Entity);
+							const FVector EntityLoc = TransformList[i].GetTransform().GetLocation();
+
+							if (SlotPoints.Num() > 0)
+							{
+								const int32 SlotIndex = static_cast<int32>(EntitySeed % SlotPoints.Num());
+								const FVector SlotLoc = SlotPoints[SlotIndex];
+								const FVector BasisDir =
+									SlotNormals.IsValidIndex(SlotIndex) && !SlotNormals[SlotIndex].IsNearlyZero()
+										? SlotNormals[SlotIndex]
+										: (SlotLoc - FallbackLoc).GetSafeNormal2D();
+								const FVector Tangent(-BasisDir.Y, BasisDir.X, 0.f);
+								const float ForwardAlpha = static_cast<float>((EntitySeed >> 16) & 0xFF) / 255.f;
+								const float SideAlpha = static_cast<float>((EntitySeed >> 24) & 0xFF) / 255.f;
+								const float ForwardOffset = FMath::Lerp(70.f, 150.f, ForwardAlpha);
+								const float SideOffset = FMath::Lerp(-120.f, 120.f, SideAlpha);
+								Data.GoalLocation = SlotLoc + BasisDir * ForwardOffset + Tangent * SideOffset;
+							}
+							else if (ApproachPoints.Num() > 0)
+							{
+								const int32 PointIndex = static_cast<int32>(EntitySeed % ApproachPoints.Num());
+								const FVector AnchorPoint = ApproachPoints[PointIndex];
+								const FVector BasisDir = (AnchorPoint - FallbackLoc).GetSafeNormal2D();
+								Data.GoalLocation = AnchorPoint + MakeSpreadOffset(EntitySeed, BasisDir, 90.f, 240.f);
+							}
+							else
+							{
+								const FVector ShipDir = (EntityLoc - FallbackLoc).GetSafeNormal2D();
+								Data.GoalLocation = FallbackLoc + MakeSpreadOffset(EntitySeed, ShipDir, 220.f, 520.f);
+							}
+
+							Data.GoalLocation.Z = FallbackLoc.Z;
+							Data.bGoalLocationCached = true;
+						}
+					}
+				);
+			}
+		}
+	}
+
+}
@@ -0,0 +1,462 @@
+/**
+ * EnemyEntityReplicationProxy.cpp
+ *
+ * [EntityRepProxyV1] Entity 상태 적 경량 복제 프록시 구현.
+ *   서버: Processor Sync → FastArray / 클라: FastArray 콜백 → 프록시 소유 ISMC
+ *
+ * @author 김민우
+ */
+
+// File: Source/Helluna/Private/ECS/Replication/EnemyEntityReplicationProxy.cpp
+
+#include "ECS/Replication/EnemyEntityReplicationProxy.h"
+
+#include "Character/HellunaEnemyCharacter.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Net/UnrealNetwork.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogECSEntityRep, Log, All);
+
+// ============================================================================
+// FEnemyEntityProxyItem
+// ============================================================================
+bool FEnemyEntityProxyItem::SetQuantized(const FVector& Location, float YawDegrees, uint8 InVisualType, uint8 InTeamColor)
+{
+	using namespace EnemyEntityRepQuant;
+
+	const int16 NewX = QuantizeAxis(Location.X, PositionQuantStep);
+	const int16 NewY = QuantizeAxis(Location.Y, PositionQuantStep);
+	const int16 NewZ = QuantizeAxis(Location.Z, HeightQuantStep);
+	const uint8 NewYaw = QuantizeYaw(YawDegrees);
+
+	if (NewX == X && NewY == Y && NewZ == Z && NewYaw == Yaw
+		&& InVisualType == VisualType && InTeamColor == TeamColorIndex)
+	{
+		return false;
+	}
+
+	X = NewX;
+	Y = NewY;
+	Z = NewZ;
+	Yaw = NewYaw;
+	VisualType = InVisualType;
+	TeamColorIndex = InTeamColor;
+	return true;
+}
+
+void FEnemyEntityProxyItem::PostReplicatedAdd(const FEnemyEntityProxyArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnItemAdded(*this);
+	}
+}
+
+void FEnemyEntityProxyItem::PostReplicatedChange(const FEnemyEntityProxyArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnItemChanged(*this);
+	}
+}
+
+void FEnemyEntityProxyItem::PreReplicatedRemove(const FEnemyEntityProxyArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner)
+	{
+		InArraySerializer.Owner->OnItemRemoved(*this);
+	}
+}
+
+// ============================================================================
+// 생성자
+// ============================================================================
+AEnemyEntityReplicationProxy::AEnemyEntityReplicationProxy()
+{
+	// 클라 보간 전용 — 보간 중인 항목이 있을 때만 켠다
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+
+	bReplicates = true;
+	bAlwaysRelevant = true;
+	SetReplicatingMovement(false);
+	SetNetUpdateFrequency(4.f);
+	SetMinNetUpdateFrequency(1.f);
+
+	SetRootComponent(CreateDefaultSubobject<USceneComponent>(TEXT("Root")));
+
+	EntityArray.Owner = this;
+}
+
+void AEnemyEntityReplicationProxy::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(AEnemyEntityReplicationProxy, EntityArray);
+	DOREPLIFETIME(AEnemyEntityReplicationProxy, VisualTypes);
+}
+
+// ============================================================================
+// 검색 / 스폰
+// ============================================================================
+AEnemyEntityReplicationProxy* AEnemyEntityReplicationProxy::Find(UWorld* World)
+{
+	if (!World)
+		return nullptr;
+
+	for (TActorIterator<AEnemyEntityReplicationProxy> It(World); It; ++It)
+	{
+		if (IsValid(*It))
+		{
+			return *It;
+		}
+	}
+	return nullptr;
+}
+
+AEnemyEntityReplicationProxy* AEnemyEntityReplicationProxy::FindOrSpawn(UWorld* World)
+{
+	if (!World || World->GetNetMode() == NM_Client)
+		return nullptr;
+
+	if (AEnemyEntityReplicationProxy* Existing = Find(World))
+	{
+		return Existing;
+	}
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	AEnemyEntityReplicationProxy* Proxy = World->SpawnActor<AEnemyEntityReplicationProxy>(Params);
+
+	UE_LOG(LogECSEntityRep, Log, TEXT("[EntityRepProxyV1] 프록시 생성 (NetMode: %d)"), (int32)World->GetNetMode());
+	return Proxy;
+}
+
+// ============================================================================
+// 서버 Sync
+// ============================================================================
+void AEnemyEntityReplicationProxy::BeginSync()
+{
+	++CurrentGeneration;
+}
+
+uint8 AEnemyEntityReplicationProxy::GetOrAddVisualType(TSubclassOf<AHellunaEnemyCharacter> EnemyClass, UStaticMesh* Mesh,
+	const FVector& Scale, float ZOffset)
+{
+	for (int32 i = 0; i < VisualTypes.Num(); ++i)
+	{
+		const FEnemyEntityProxyVisualType& Type = VisualTypes[i];
+		if (Type.EnemyClass == EnemyClass && Type.Mesh == Mesh)
+		{
+			return static_cast<uint8>(i);
+		}
+	}
+
+	if (VisualTypes.Num() > MAX_uint8)
+	{
+		UE_LOG(LogECSEntityRep, Warning, TEXT("[EntityRepProxyV1] VisualType 테이블 초과 (256) — 0번 타입으로 대체"));
+		return 0;
+	}
+
+	FEnemyEntityProxyVisualType& NewType = VisualTypes.AddDefaulted_GetRef();
+	NewType.EnemyClass = EnemyClass;
+	NewType.Mesh = Mesh;
+	NewType.Scale = Scale;
+	NewType.ZOffset = ZOffset;
+	return static_cast<uint8>(VisualTypes.Num() - 1);
+}
+
+void AEnemyEntityReplicationProxy::UpdateEntity(uint32 EntityId, int32 EntitySerial, const FVector& Location, float YawDegrees,
+	uint8 VisualType, uint8 TeamColorIndex)
+{
+	// Index가 재사용되면 Serial이 달라 새 항목 — 이전 적의 항목은 EndSync에서 제거된다
+	const uint64 Key = FEnemyEntityProxyItem::MakeKey(EntityId, EntitySerial);
+	if (const int32* Found = KeyToIndex.Find(Key))
+	{
+		FEnemyEntityProxyItem& Item = EntityArray.Items[*Found];
+		Item.SyncGeneration = CurrentGeneration;
+		if (Item.SetQuantized(Location, YawDegrees, VisualType, TeamColorIndex))
+		{
+			EntityArray.MarkItemDirty(Item);
+		}
+		return;
+	}
+
+	FEnemyEntityProxyItem& Item = EntityArray.Items.AddDefaulted_GetRef();
+	Item.EntityId = EntityId;
+	Item.EntitySerial = EntitySerial;
+	Item.SyncGeneration = CurrentGeneration;
+	Item.SetQuantized(Location, YawDegrees, VisualType, TeamColorIndex);
+	EntityArray.MarkItemDirty(Item);
+	KeyToIndex.Add(Key, EntityArray.Items.Num() - 1);
+}
+
+void AEnemyEntityReplicationProxy::EndSync()
+{
+	bool bRemoved = false;
+	for (int32 i = EntityArray.Items.Num() - 1; i >= 0; --i)
+	{
+		if (EntityArray.Items[i].SyncGeneration == CurrentGeneration)
+			continue;
+
+		KeyToIndex.Remove(EntityArray.Items[i].GetKey());
+		EntityArray.Items.RemoveAtSwap(i, EAllowShrinking::No);
+		if (EntityArray.Items.IsValidIndex(i))
+		{
+			KeyToIndex.Add(EntityArray.Items[i].GetKey(), i);
+		}
+		bRemoved = true;
+	}
+
+	if (bRemoved)
+	{
+		EntityArray.MarkArrayDirty();
+	}
+}
+
+// ============================================================================
+// 클라 시각화 — FastArray 콜백
+//   Mass Entity가 없는 클라에서는 Processor가 실행되지 않으므로 프록시가 직접 그린다
+// ============================================================================
+void AEnemyEntityReplicationProxy::OnItemAdded(const FEnemyEntityProxyItem& Item)
+{
+	FClientVisual& Visual = ClientVisuals.FindOrAdd(Item.GetKey());
+	RemoveClientInstance(Visual);
+	CreateClientInstance(Item, Visual);
+}
+
+void AEnemyEntityReplicationProxy::OnItemChanged(const FEnemyEntityProxyItem& Item)
+{
+	FClientVisual* Visual = ClientVisuals.Find(Item.GetKey());
+	if (!Visual)
+	{
+		OnItemAdded(Item);
+		return;
+	}
+
+	// 타입(Mesh) 또는 팀 컬러가 바뀌면 인스턴스를 새로 만든다 (Custom Data 재설정)
+	if (Visual->InstanceIndex == INDEX_NONE
+		|| Visual->VisualType != Item.VisualType
+		|| Visual->TeamColorIndex != Item.TeamColorIndex)
+	{
+		RemoveClientInstance(*Visual);
+		CreateClientInstance(Item, *Visual);
+		return;
+	}
+
+	// 새 복제 값 도착 → 현재 표시 위치에서 새 위치로, 직전 수신 간격 동안 보간
+	const double Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+	const float PrevAlpha = Visual->BlendDuration > 0.f
+		? FMath::Clamp(static_cast<float>((Now - Visual->BlendStart) / Visual->BlendDuration), 0.f, 1.f)
+		: 1.f;
+	Visual->FromLocation = FMath::Lerp(Visual->FromLocation, Visual->ToLocation, PrevAlpha);
+	Visual->ToLocation = Item.GetLocation();
+	Visual->Yaw = EnemyEntityRepQuant::DequantizeYaw(Item.Yaw);
+	Visual->BlendStart = Now;
+	Visual->BlendDuration = Visual->LastReceiveTime > 0.0
+		? FMath::Clamp(static_cast<float>(Now - Visual->LastReceiveTime), 0.05f, 1.f)
+		: GetDefaultBlendDuration();
+	Visual->LastReceiveTime = Now;
+
+	SetActorTickEnabled(true);
+}
+
+void AEnemyEntityReplicationProxy::OnItemRemoved(const FEnemyEntityProxyItem& Item)
+{
+	const uint64 Key = Item.GetKey();
+	if (FClientVisual* Visual = ClientVisuals.Find(Key))
+	{
+		RemoveClientInstance(*Visual);
+		ClientVisuals.Remove(Key);
+	}
+}
+
+void AEnemyEntityReplicationProxy::OnRep_VisualTypes()
+{
+	// 타입 테이블보다 먼저 도착해 대기 중인 항목 생성
+	for (const FEnemyEntityProxyItem& Item : EntityArray.Items)
+	{
+		FClientVisual* Visual = ClientVisuals.Find(Item.GetKey());
+		if (Visual && Visual->InstanceIndex == INDEX_NONE)
+		{
+			CreateClientInstance(Item, *Visual);
+		}
+	}
+}
+
+void AEnemyEntityReplicationProxy::CreateClientInstance(const FEnemyEntityProxyItem& Item, FClientVisual& Visual)
+{
+	const FVector Location = Item.GetLocation();
+	const double Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+
+	Visual.VisualType = Item.VisualType;
+	Visual.TeamColorIndex = Item.TeamColorIndex;
+	Visual.Yaw = EnemyEntityRepQuant::DequantizeYaw(Item.Yaw);
+	Visual.FromLocation = Location;
+	Visual.ToLocation = Location;
+	Visual.BlendDuration = 0.f;
+	Visual.LastReceiveTime = Now;
+
+	const FEnemyEntityProxyVisualType* Type = GetVisualType(Item.VisualType);
+	UInstancedStaticMeshComponent* ISMC = Type ? GetOrCreateISMC(Type->Mesh) : nullptr;
+	if (!ISMC)
+	{
+		Visual.InstanceIndex = INDEX_NONE;  // OnRep_VisualTypes에서 재시도
+		return;
+	}
+
+	Visual.Mesh = Type->Mesh;
+	Visual.Scale = Type->Scale;
+	Visual.ZOffset = Type->ZOffset;
+
+	const FTransform InstanceTransform(
+		FRotator(0.f, Visual.Yaw, 0.f),
+		Location + FVector(0.f, 0.f, Visual.ZOffset),
+		Visual.Scale);
+
+	const int32 NewIndex = ISMC->AddInstance(InstanceTransform, /*bWorldSpace=*/true);
+
+	// ISMC는 Append → NewIndex == Keys.Num() (방어: 부족하면 채움)
+	TArray<uint64>& Keys = MeshInstanceKeys.FindOrAdd(Type->Mesh);
+	if (Keys.Num() <= NewIndex)
+	{
+		Keys.SetNumZeroed(NewIndex + 1);
+	}
+	Keys[NewIndex] = Item.GetKey();
+
+	// TeamColor → Custom Data 0~3 (Processor의 Entity ISMC와 같은 머티리얼 규약, A=0이면 미지정)
+	FLinearColor TeamColor = FLinearColor::Transparent;
+	if (const AHellunaEnemyCharacter* CDO =
+		Type->EnemyClass ? Type->EnemyClass->GetDefaultObject<AHellunaEnemyCharacter>() : nullptr)
+	{
+		if (CDO->TeamColorOptions.IsValidIndex(Item.TeamColorIndex))
+		{
+			TeamColor = CDO->TeamColorOptions[Item.TeamColorIndex];
+		}
+	}
+	const float CustomData[4] = { TeamColor.R, TeamColor.G, TeamColor.B, TeamColor.A };
+	ISMC->SetCustomData(NewIndex, MakeArrayView(CustomData, 4), /*bMarkRenderStateDirty=*/true);
+
+	Visual.InstanceIndex = NewIndex;
+}
+
+void AEnemyEntityReplicationProxy::RemoveClientInstance(FClientVisual& Visual)
+{
+	if (Visual.InstanceIndex == INDEX_NONE || !Visual.Mesh)
+	{
+		Visual.InstanceIndex = INDEX_NONE;
+		return;
+	}
+
+	const int32 RemoveIndex = Visual.InstanceIndex;
+	Visual.InstanceIndex = INDEX_NONE;
+
+	TArray<uint64>* Keys = MeshInstanceKeys.Find(Visual.Mesh);
+	if (!Keys || !Keys->IsValidIndex(RemoveIndex))
+		return;
+
+	if (UInstancedStaticMeshComponent* ISMC = MeshToISMC.FindRef(Visual.Mesh))
+	{
+		ISMC->RemoveInstance(RemoveIndex);
+	}
+
+	// RemoveInstance는 마지막↔제거 위치 스왑 (SetRemoveSwap) → 옮겨진 항목의 인덱스 보정
+	const int32 LastIndex = Keys->Num() - 1;
+	if (RemoveIndex != LastIndex)
+	{
+		if (FClientVisual* Swapped = ClientVisuals.Find((*Keys)[LastIndex]))
+		{
+			Swapped->InstanceIndex = RemoveIndex;
+		}
+	}
+	Keys->RemoveAtSwap(RemoveIndex, EAllowShrinking::No);
+}
+
+UInstancedStaticMeshComponent* AEnemyEntityReplicationProxy::GetOrCreateISMC(UStaticMesh* Mesh)
+{
+	if (!Mesh)
+		return nullptr;
+
+	if (TObjectPtr<UInstancedStaticMeshComponent>* Found = MeshToISMC.Find(Mesh))
+	{
+		return Found->Get();
+	}
+
+	UInstancedStaticMeshComponent* ISMC = NewObject<UInstancedStaticMeshComponent>(this);
+	ISMC->SetStaticMesh(Mesh);
+	ISMC->SetMobility(EComponentMobility::Movable);
+	ISMC->bNeverDistanceCull = true;
+	ISMC->SetCastShadow(false);
+	ISMC->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	ISMC->SetIsReplicated(false);
+	ISMC->NumCustomDataFloats = 4;
+	ISMC->SetRemoveSwap();
+	ISMC->SetupAttachment(GetRootComponent());
+	ISMC->RegisterComponent();
+	AddInstanceComponent(ISMC);
+
+	MeshToISMC.Add(Mesh, ISMC);
+
+	UE_LOG(LogECSEntityRep, Log, TEXT("[EntityRepProxyV1] 클라 ISMC 생성 - Mesh: %s"), *Mesh->GetName());
+	return ISMC;
+}
+
+float AEnemyEntityReplicationProxy::GetDefaultBlendDuration() const
+{
+	const float RepHz = GetNetUpdateFrequency();
+	return RepHz > 0.f ? 1.f / RepHz : 0.25f;
+}
+
+// ============================================================================
+// Tick — [클라] 보간 중인 인스턴스만 갱신, 모두 끝나면 Tick 비활성
+// ============================================================================
+void AEnemyEntityReplicationProxy::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	const double Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+	bool bAnyBlending = false;
+	TArray<UInstancedStaticMeshComponent*, TInlineAllocator<8>> TouchedISMCs;
+
+	for (TPair<uint64, FClientVisual>& Pair : ClientVisuals)
+	{
+		FClientVisual& Visual = Pair.Value;
+		if (Visual.BlendDuration <= 0.f || Visual.InstanceIndex == INDEX_NONE)
+			continue;
+
+		UInstancedStaticMeshComponent* ISMC = MeshToISMC.FindRef(Visual.Mesh);
+		if (!ISMC)
+			continue;
+
+		const float Alpha = FMath::Clamp(static_cast<float>((Now - Visual.BlendStart) / Visual.BlendDuration), 0.f, 1.f);
+		if (Alpha >= 1.f)
+		{
+			Visual.BlendDuration = 0.f;
+		}
+		else
+		{
+			bAnyBlending = true;
+		}
+
+		const FTransform InstanceTransform(
+			FRotator(0.f, Visual.Yaw, 0.f),
+			FMath::Lerp(Visual.FromLocation, Visual.ToLocation, Alpha) + FVector(0.f, 0.f, Visual.ZOffset),
+			Visual.Scale);
+		ISMC->UpdateInstanceTransform(Visual.InstanceIndex, InstanceTransform,
+			/*bWorldSpace=*/true, /*bMarkRenderStateDirty=*/false, /*bTeleport=*/true);
+		TouchedISMCs.AddUnique(ISMC);
+	}
+
+	for (UInstancedStaticMeshComponent* ISMC : TouchedISMCs)
+	{
+		ISMC->MarkRenderStateDirty();
+	}
+
+	if (!bAnyBlending)
+	{
+		SetActorTickEnabled(false);
+	}
+}
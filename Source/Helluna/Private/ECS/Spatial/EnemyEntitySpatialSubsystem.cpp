@@ -0,0 +1,146 @@
+/**
+ * EnemyEntitySpatialSubsystem.cpp
+ *
+ * [EntityTargetingV1] Entity 공간 스냅샷 질의 + 데미지 큐 구현.
+ *
+ * @author 김민우
+ */
+
+// File: Source/Helluna/Private/ECS/Spatial/EnemyEntitySpatialSubsystem.cpp
+
+#include "ECS/Spatial/EnemyEntitySpatialSubsystem.h"
+
+#include "Character/HellunaEnemyCharacter.h"
+#include "Character/EnemyComponent/HellunaHealthComponent.h"
+
+// ============================================================================
+// FEnemyEntitySpatialSnapshot
+// ============================================================================
+void FEnemyEntitySpatialSnapshot::FindNearest(const FVector& Origin, float Radius, int32 MaxCount, TArray<int32>& OutIndices) const
+{
+	OutIndices.Reset();
+	if (MaxCount <= 0)
+		return;
+
+	struct FCandidate
+	{
+		double DistSq;
+		int32 Index;
+	};
+	TArray<FCandidate, TInlineAllocator<64>> Candidates;
+
+	const double RadiusSq = FMath::Square(static_cast<double>(Radius));
+	Hash.ForEachInRadius2D(Origin, Radius, [&](int32 Index, const FVector& Position)
+	{
+		const double DistSq = FVector::DistSquared(Origin, Position);
+		if (DistSq <= RadiusSq)
+		{
+			Candidates.Add({ DistSq, Index });
+		}
+	});
+
+	// 포탑 사거리 안 Entity는 많아야 수백 — 전체 정렬로 충분
+	Candidates.Sort([](const FCandidate& A, const FCandidate& B) { return A.DistSq < B.DistSq; });
+
+	const int32 Count = FMath::Min(MaxCount, Candidates.Num());
+	OutIndices.Reserve(Count);
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutIndices.Add(Candidates[i].Index);
+	}
+}
+
+bool FEnemyEntitySpatialSnapshot::FindEntityNear(FMassEntityHandle Entity, const FVector& LastKnownLocation, FVector& OutLocation) const
+{
+	// 한 틱 이동량은 셀 크기(500cm)보다 훨씬 작으므로 인접 9셀이면 충분
+	bool bFound = false;
+	Hash.ForEachInCellNeighborhood(LastKnownLocation, [&](int32 Index, const FVector& Position)
+	{
+		if (!bFound && Entities[Index] == Entity)
+		{
+			OutLocation = Position;
+			bFound = true;
+		}
+	});
+	return bFound;
+}
+
+// ============================================================================
+// UWorldSubsystem 인터페이스
+// ============================================================================
+bool UEnemyEntitySpatialSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEnemyEntitySpatialSubsystem::Deinitialize()
+{
+	{
+		FScopeLock Lock(&SnapshotLock);
+		PublishedSnapshot.Reset();
+	}
+	PendingDamage.Empty();
+	DefaultMaxHPCache.Empty();
+
+	Super::Deinitialize();
+}
+
+// ============================================================================
+// 스냅샷
+// ============================================================================
+void UEnemyEntitySpatialSubsystem::Publish(FEnemyEntitySpatialSnapshotPtr InSnapshot)
+{
+	FScopeLock Lock(&SnapshotLock);
+	PublishedSnapshot = MoveTemp(InSnapshot);
+}
+
+FEnemyEntitySpatialSnapshotPtr UEnemyEntitySpatialSubsystem::GetSnapshot() const
+{
+	FScopeLock Lock(&SnapshotLock);
+	return PublishedSnapshot;
+}
+
+// ============================================================================
+// 데미지 큐
+// ============================================================================
+void UEnemyEntitySpatialSubsystem::QueueEntityDamage(FMassEntityHandle Entity, float Damage, AActor* DamageCauser)
+{
+	check(IsInGameThread());
+
+	if (!Entity.IsSet() || Damage <= 0.f)
+		return;
+
+	FEnemyEntityPendingDamage& Entry = PendingDamage.AddDefaulted_GetRef();
+	Entry.Entity = Entity;
+	Entry.Damage = Damage;
+	Entry.DamageCauser = DamageCauser;
+}
+
+void UEnemyEntitySpatialSubsystem::ConsumePendingDamage(TArray<FEnemyEntityPendingDamage>& OutDamage)
+{
+	check(IsInGameThread());
+
+	OutDamage.Reset();
+	Swap(OutDamage, PendingDamage);
+}
+
+float UEnemyEntitySpatialSubsystem::GetDefaultMaxHP(TSubclassOf<AHellunaEnemyCharacter> EnemyClass, float Fallback)
+{
+	if (!EnemyClass)
+		return Fallback;
+
+	if (const float* Cached = DefaultMaxHPCache.Find(EnemyClass.Get()))
+		return *Cached;
+
+	float MaxHP = Fallback;
+	if (const AHellunaEnemyCharacter* CDO = EnemyClass->GetDefaultObject<AHellunaEnemyCharacter>())
+	{
+		if (const UHellunaHealthComponent* HC = CDO->FindComponentByClass<UHellunaHealthComponent>())
+		{
+			MaxHP = HC->GetMaxHealth();
+		}
+	}
+
+	DefaultMaxHPCache.Add(EnemyClass.Get(), MaxHP);
+	return MaxHP;
+}
@@ -0,0 +1,83 @@
+/**
+ * EnemySpatialHash.cpp
+ *
+ * Counting Sort 2-pass로 해시를 구축한다.
+ *   1) 원본 인덱스별 셀 키/버킷 계산 + 버킷 카운트
+ *   2) Prefix Sum → BucketStart, 커서 기반으로 Sorted* 배열 채우기
+ * 전체 O(N), 할당은 용량이 부족할 때만 발생.
+ */
+
+// File: Source/Helluna/Private/ECS/Spatial/EnemySpatialHash.cpp
+
+#include "ECS/Spatial/EnemySpatialHash.h"
+
+void FEnemySpatialHash::Reset()
+{
+	BucketStart.Reset();
+	SortedIndices.Reset();
+	SortedPositions.Reset();
+	SortedCellKeys.Reset();
+	NumOccupiedCells = 0;
+}
+
+void FEnemySpatialHash::Build(TConstArrayView<FVector> Positions, float InCellSize)
+{
+	CellSize = FMath::Max(InCellSize, 1.f);
+	InvCellSize = 1.f / CellSize;
+
+	const int32 Num = Positions.Num();
+	Reset();
+	if (Num == 0)
+		return;
+
+	// 버킷 수 = Entity 수 * 2 이상인 2의 거듭제곱 (충돌 완화)
+	const uint32 NumBuckets = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(Num * 2, 64)));
+	BucketMask = NumBuckets - 1;
+
+	BucketStart.SetNumZeroed(NumBuckets + 1, EAllowShrinking::No);
+	ScratchCellKeys.SetNumUninitialized(Num, EAllowShrinking::No);
+	ScratchBuckets.SetNumUninitialized(Num, EAllowShrinking::No);
+
+	// 1) 셀 키 + 버킷 카운트
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const FVector& P = Positions[i];
+		const int64 Key = MakeCellKey(FMath::FloorToInt(P.X * InvCellSize), FMath::FloorToInt(P.Y * InvCellSize));
+		const uint32 Bucket = HashCellKey(Key) & BucketMask;
+		ScratchCellKeys[i] = Key;
+		ScratchBuckets[i] = Bucket;
+		++BucketStart[Bucket + 1];
+	}
+
+	// 2) Prefix Sum
+	for (uint32 b = 0; b < NumBuckets; ++b)
+	{
+		BucketStart[b + 1] += BucketStart[b];
+	}
+
+	// 3) 커서 기반 배치 (안정 정렬 — 같은 버킷 내에서는 원본 순서 유지)
+	ScratchCursor.SetNumUninitialized(NumBuckets, EAllowShrinking::No);
+	FMemory::Memcpy(ScratchCursor.GetData(), BucketStart.GetData(), NumBuckets * sizeof(int32));
+
+	SortedIndices.SetNumUninitialized(Num, EAllowShrinking::No);
+	SortedPositions.SetNumUninitialized(Num, EAllowShrinking::No);
+	SortedCellKeys.SetNumUninitialized(Num, EAllowShrinking::No);
+
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const int32 Slot = ScratchCursor[ScratchBuckets[i]]++;
+		SortedIndices[Slot] = i;
+		SortedPositions[Slot] = Positions[i];
+		SortedCellKeys[Slot] = ScratchCellKeys[i];
+	}
+
+	// 점유 셀 수 (통계용 근사치) — 정렬 결과에서 키가 바뀌는 지점 수.
+	// 한 버킷에 여러 셀이 섞이면 약간 크게 잡히지만 로그 비교 용도로는 충분하다.
+	for (int32 s = 0; s < Num; ++s)
+	{
+		if (s == 0 || SortedCellKeys[s] != SortedCellKeys[s - 1])
+		{
+			++NumOccupiedCells;
+		}
+	}
+}
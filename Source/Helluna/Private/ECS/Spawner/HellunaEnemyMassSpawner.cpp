@@ -6,6 +6,8 @@
 #include "GameMode/HellunaDefenseGameState.h"
 #include "Kismet/GameplayStatics.h"
 #include "NavigationInvokerComponent.h"
+#include "MassEntityConfigAsset.h"
+#include "ECS/Traits/EnemyMassTrait.h"
 
 DEFINE_LOG_CATEGORY(LogHellunaSpawner);
 
@@ -252,3 +254,25 @@ float AHellunaEnemyMassSpawner::GetEstimatedSpawnSequenceSpacing(int32 InSpawnCo
 	const int32 BatchCount = FMath::Max(1, FMath::DivideAndRoundUp(EffectiveSpawnCount, SpawnBatchSize));
 	return static_cast<float>(BatchCount) * SpawnBatchInterval;
 }
+
+// ============================================================
+// GetEnemyMassTraits — [PoolWarmUpV1] Pool Warm-up용 Trait 조회
+// ============================================================
+void AHellunaEnemyMassSpawner::GetEnemyMassTraits(TArray<const UEnemyMassTrait*>& OutTraits) const
+{
+	for (const FMassSpawnedEntityType& EntityType : EntityTypes)
+	{
+		const UMassEntityConfigAsset* ConfigAsset = EntityType.GetEntityConfig();
+		if (!ConfigAsset)
+		{
+			continue;
+		}
+
+		// FindTrait은 부모 Config까지 포함해 검색
+		if (const UEnemyMassTrait* Trait = Cast<UEnemyMassTrait>(
+			ConfigAsset->GetConfig().FindTrait(UEnemyMassTrait::StaticClass())))
+		{
+			OutTraits.AddUnique(Trait);
+		}
+	}
+}
@@ -1,8 +1,9 @@
 /**
  * EnemyMassTrait.cpp
  *
- * BuildTemplate에서 모든 Trait UPROPERTY 값을 FEnemyDataFragment에 복사한다.
- * CurrentHP/MaxHP는 런타임 상태이므로 기본값(-1/100) 유지.
+ * BuildTemplate에서 모든 Trait UPROPERTY 값을 FEnemyConfigSharedFragment(Const Shared)에 담는다.
+ * 같은 값이면 EntityManager가 기존 인스턴스를 재사용하므로 Entity마다 설정이 복사되지 않는다.
+ * FEnemyDataFragment(per-entity)는 런타임 상태라 기본값(CurrentHP -1 / MaxHP 100) 유지.
  * 
  * Entity 상태에서는 AI 없이 단순 이동만 수행한다.
  * Actor 전환 후에는 Actor 기반 StateTree가 AI를 담당한다.
@@ -13,6 +14,7 @@
 #include "ECS/Traits/EnemyMassTrait.h"
 #include "ECS/Fragments/EnemyMassFragments.h"
 #include "MassEntityTemplateRegistry.h"
+#include "MassEntityUtils.h"
 #include "MassCommonFragments.h"
 #include "Character/HellunaEnemyCharacter.h"
 #include "Helluna.h"
@@ -31,35 +33,49 @@ void UEnemyMassTrait::BuildTemplate(
 	// 스폰 상태 추적용
 	BuildContext.AddFragment<FEnemySpawnStateFragment>();
 
-	// 설정 데이터 Fragment
-	FEnemyDataFragment& Data = BuildContext.AddFragment_GetRef<FEnemyDataFragment>();
+	// per-entity 런타임 상태 (HP/목표/이동 방향/팀 컬러)
+	BuildContext.AddFragment<FEnemyDataFragment>();
+
+	// Entity 상태 시각화 ISMC 인스턴스 인덱스
+	BuildContext.AddFragment<FEnemyVisualInstanceFragment>();
+
+	// 불변 설정은 Const Shared Fragment로 — 같은 설정의 Entity들이 1개 인스턴스를 공유
+	FEnemyConfigSharedFragment Config;
 
 	// Trait UPROPERTY 값 복사
-	Data.EnemyClass = EnemyClass;
-	Data.SpawnThreshold = SpawnThreshold;
-	Data.DespawnThreshold = DespawnThreshold;
-	Data.MaxConcurrentActors = MaxConcurrentActors;
-	Data.PoolSize = PoolSize;
-	Data.NearDistance = NearDistance;
-	Data.MidDistance = MidDistance;
-	Data.NearTickInterval = NearTickInterval;
-	Data.MidTickInterval = MidTickInterval;
-	Data.FarTickInterval = FarTickInterval;
+	Config.EnemyClass = EnemyClass;
+	if (const AHellunaEnemyCharacter* EnemyCDO = EnemyClass ? EnemyClass->GetDefaultObject<AHellunaEnemyCharacter>() : nullptr)
+	{
+		Config.EnemyGrade = EnemyCDO->EnemyGrade;
+	}
+	Config.SpawnThreshold = SpawnThreshold;
+	Config.DespawnThreshold = DespawnThreshold;
+	Config.MaxConcurrentActors = MaxConcurrentActors;
+	Config.PoolSize = PoolSize;
+	Config.NearDistance = NearDistance;
+	Config.MidDistance = MidDistance;
+	Config.NearTickInterval = NearTickInterval;
+	Config.MidTickInterval = MidTickInterval;
+	Config.FarTickInterval = FarTickInterval;
 	// Entity 시각화 설정 복사
-	Data.EntityVisualizationMesh = EntityVisualizationMesh;
-	Data.EntityMeshScale = EntityMeshScale;
-	Data.EntityMeshZOffset = EntityMeshZOffset;
-	Data.bShowEntityVisualization = bShowEntityVisualization;
+	Config.EntityVisualizationMesh = EntityVisualizationMesh;
+	Config.EntityMeshScale = EntityMeshScale;
+	Config.EntityMeshZOffset = EntityMeshZOffset;
+	Config.bShowEntityVisualization = bShowEntityVisualization;
 	
 	//기본 이동
-	Data.GoalActorTag = GoalActorTag;
-	Data.EntityMoveSpeed = EntityMoveSpeed;
-	Data.EntitySeparationRadius = EntitySeparationRadius;
-	Data.bMove2DOnly = bMove2DOnly;
+	Config.GoalActorTag = GoalActorTag;
+	Config.EntityMoveSpeed = EntityMoveSpeed;
+	Config.EntitySeparationRadius = EntitySeparationRadius;
+	Config.bMove2DOnly = bMove2DOnly;
 
 	// [SpawnScaleV1] 소환 크기
-	Data.ActorSpawnScale = ActorSpawnScale;
-	Data.MeshSpawnScale = MeshSpawnScale;
+	Config.ActorSpawnScale = ActorSpawnScale;
+	Config.MeshSpawnScale = MeshSpawnScale;
+
+	FMassEntityManager& EntityManager = UE::Mass::Utils::GetEntityManagerChecked(World);
+	const FConstSharedStruct ConfigFragment = EntityManager.GetOrCreateConstSharedFragment(Config);
+	BuildContext.AddConstSharedFragment(ConfigFragment);
 	
 #if HELLUNA_DEBUG_ENEMY
 	UE_LOG(LogTemp, Log,
@@ -2,6 +2,9 @@
 #include "GameMode/HellunaDefenseGameState.h"
 #include "Object/ResourceUsingObject/ResourceUsingObject_SpaceShip.h"
 #include "ECS/Spawner/HellunaEnemyMassSpawner.h"
+#include "ECS/Navigation/EnemyFlowFieldSubsystem.h"
+#include "ECS/Pool/EnemyActorPool.h"
+#include "ECS/Traits/EnemyMassTrait.h"
 #include "Character/HellunaEnemyCharacter.h"
 #include "Engine/TargetPoint.h"
 #include "Kismet/GameplayStatics.h"
@@ -48,6 +51,7 @@
 #include "HAL/FileManager.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
+#include "Lobby/ServerManager/HellunaChannelRegistry.h"
 
 namespace HellunaPCGInternal
 {
@@ -164,21 +168,29 @@ void AHellunaDefenseGameMode::BeginPlay()
     }
     UE_LOG(LogHelluna, Warning, TEXT("[DefenseGameMode] LobbyServerURL = '%s'"), *LobbyServerURL);
 
+    // [WarmPoolV1] 로비 웜 풀이 띄운 서버 — 배정(assign) 전까지 "idle"로 대기
+    bWarmStandby = FParse::Param(FCommandLine::Get(), TEXT("WarmStandby"));
+    if (bWarmStandby)
+    {
+        UE_LOG(LogHelluna, Log, TEXT("[DefenseGameMode] [WarmPoolV1] 웜 스탠바이 모드로 시작"));
+    }
+
     // Phase 12b: 서버 레지스트리 초기화
     {
         const FString RegistryDir = GetRegistryDirectoryPath();
         IFileManager::Get().MakeDirectory(*RegistryDir, true);
-        WriteRegistryFile(TEXT("empty"), 0);
-        UE_LOG(LogHelluna, Log, TEXT("[DefenseGameMode] 서버 레지스트리 초기화 | Port=%d | Path=%s"), GetServerPort(), *GetRegistryFilePath());
 
-        // 30초마다 하트비트
+        // [ChannelRegistryV1] 로비 레지스트리 소켓 — 실패 시 파일 하트비트로 폴백
+        const bool bRegistrySocket = RegistryClient.Open(HellunaChannelRegistry::GetListenPort());
+        WriteRegistryFile(GetRegistryStatus(), 0);
+        UE_LOG(LogHelluna, Log, TEXT("[DefenseGameMode] 서버 레지스트리 초기화 | Port=%d | Path=%s | Socket=%s"),
+            GetServerPort(), *GetRegistryFilePath(), bRegistrySocket ? TEXT("ON") : TEXT("OFF"));
+
+        // 하트비트: 소켓 5초 / 파일 폴백 30초
         if (UWorld* W = GetWorld())
         {
-            W->GetTimerManager().SetTimer(RegistryHeartbeatTimer, [this]()
-            {
-                const FString Status = CurrentPlayerCount > 0 ? TEXT("playing") : TEXT("empty");
-                WriteRegistryFile(Status, CurrentPlayerCount);
-            }, 30.0f, true);
+            W->GetTimerManager().SetTimer(RegistryHeartbeatTimer, this,
+                &AHellunaDefenseGameMode::SendRegistryHeartbeat, bRegistrySocket ? 5.0f : 30.0f, true);
         }
     }
 
@@ -370,7 +382,8 @@ void AHellunaDefenseGameMode::BeginPlay()
     }
 
     // [Phase 16] 유휴 자동 종료 타이머 (접속자 0이면 IdleShutdownSeconds 후 자동 종료)
-    if (IdleShutdownSeconds > 0.f)
+    // [WarmPoolV1] 웜 스탠바이는 배정될 때까지 유휴 종료하지 않음 (HandleWarmAssign에서 시작)
+    if (IdleShutdownSeconds > 0.f && !bWarmStandby)
     {
         if (UWorld* W = GetWorld())
         {
@@ -1832,6 +1845,9 @@ void AHellunaDefenseGameMode::EnterDay()
     for (AHellunaEnemyMassSpawner* Spawner : CachedRangeSpawners)
         if (IsValid(Spawner)) Spawner->CancelPendingSpawn();
 
+    // [PoolWarmUpV1] 다음 밤 적 Actor를 낮 동안 프레임 분산으로 미리 생성
+    WarmUpEnemyPoolsForNight();
+
     if (AHellunaDefenseGameState* GS = GetGameState<AHellunaDefenseGameState>())
     {
         GS->SetInitialNightBootstrapActive(false);
@@ -1937,6 +1953,23 @@ void AHellunaDefenseGameMode::EnterNightCore(EHellunaNightStartMode StartMode)
     // 낮 카운트다운 타이머 정지
     GetWorldTimerManager().ClearTimer(TimerHandle_DayCountdown);
 
+    // Entity 이동용 Flow Field 재생성 (밤마다 1회, 프레임 분산 Bake — 완성 전까지 기존 필드/직선 이동 사용)
+    if (UEnemyFlowFieldSubsystem* FlowField = GetWorld()->GetSubsystem<UEnemyFlowFieldSubsystem>())
+    {
+        FlowField->RequestRebuild(TEXT("NightStart"));
+    }
+
+    // [PoolWarmUpV1] 낮을 거치지 않은 첫 밤은 여기서 Warm-up 예약 (스폰 지연 동안 전투 예산으로 채움)
+    const bool bBootstrapWarmUp = (StartMode == EHellunaNightStartMode::InitialBootstrap);
+    if (bBootstrapWarmUp)
+    {
+        WarmUpEnemyPoolsForNight();
+    }
+    if (UEnemyActorPool* Pool = GetWorld()->GetSubsystem<UEnemyActorPool>())
+    {
+        Pool->EndWarmUp(bBootstrapWarmUp);
+    }
+
     // 밤 워치독 시작 — 카운터와 실제 적 수 불일치 시 낮 전환 강제.
     // Why: NotifyMonsterDied가 호출되지 않는 사망 경로(맵 밖 낙사, ECS 디스폰 오류 등)가 있으면
     //      RemainingMonstersThisNight가 0이 되지 않아 낮으로 복귀 못 하는 회귀가 발생함.
@@ -2007,6 +2040,77 @@ void AHellunaDefenseGameMode::ScheduleDayTransitionAfterNightClear(const TCHAR*
     TimerManager.SetTimer(TimerHandle_ToDay, this, &ThisClass::EnterDay, Delay, false);
 }
 
+// ============================================================
+// WarmUpEnemyPoolsForNight — [PoolWarmUpV1] 다음 밤 Pool 사전 생성 예약
+//
+// 클래스별 성장 정책:
+//   Buffer = PoolSize - MaxConcurrentActors (에디터에서 설정한 여유분)
+//   High   = min(PoolSize, min(밤 소환 수, MaxConcurrentActors) + Buffer)  — 밤 소환 0이면 0 (낮에 정리)
+//   Low    = max(1, Buffer / 2)                                          — 전투 중 최소 대기 수
+// 근거리/원거리 스포너가 같은 EnemyClass를 쓰면 High/Low는 합산.
+// Trait 출처는 TriggerMassSpawning이 실제로 RequestSpawn할 스포너와 같게:
+//   생성된 스포너가 있으면 그 인스턴스, 아직 없으면(첫 밤 이전) 스포너 클래스 CDO.
+// ============================================================
+void AHellunaDefenseGameMode::WarmUpEnemyPoolsForNight()
+{
+    if (!HasAuthority()) return;
+
+    UEnemyActorPool* Pool = GetWorld() ? GetWorld()->GetSubsystem<UEnemyActorPool>() : nullptr;
+    if (!Pool) return;
+
+    int32 MeleeCount = MassSpawnCountPerNight;
+    int32 RangeCount = 0;
+    if (const FNightSpawnConfig* Config = GetCurrentNightConfig())
+    {
+        MeleeCount = Config->MeleeCount;
+        RangeCount = Config->RangeCount;
+    }
+
+    TMap<TSubclassOf<AHellunaEnemyCharacter>, FIntPoint> Watermarks; // X=High, Y=Low
+
+    auto ResolveSpawner = [](const TArray<TObjectPtr<AHellunaEnemyMassSpawner>>& Cached,
+        TSubclassOf<AHellunaEnemyMassSpawner> SpawnerClass) -> const AHellunaEnemyMassSpawner*
+    {
+        for (const AHellunaEnemyMassSpawner* Spawner : Cached)
+        {
+            if (IsValid(Spawner)) return Spawner;
+        }
+        return SpawnerClass ? SpawnerClass.GetDefaultObject() : nullptr;
+    };
+
+    auto Accumulate = [&Watermarks](const AHellunaEnemyMassSpawner* Spawner, int32 NightCount)
+    {
+        if (!Spawner) return;
+
+        TArray<const UEnemyMassTrait*> Traits;
+        Spawner->GetEnemyMassTraits(Traits);
+        for (const UEnemyMassTrait* Trait : Traits)
+        {
+            if (!Trait || !Trait->GetEnemyClass()) continue;
+
+            const int32 Buffer = FMath::Max(Trait->GetPoolSize() - Trait->GetMaxConcurrentActors(), 0);
+            const int32 Demand = FMath::Min(NightCount, Trait->GetMaxConcurrentActors());
+            const int32 High = (NightCount > 0) ? FMath::Min(Trait->GetPoolSize(), Demand + Buffer) : 0;
+            const int32 Low = (High > 0) ? FMath::Max(1, Buffer / 2) : 0;
+
+            FIntPoint& Entry = Watermarks.FindOrAdd(Trait->GetEnemyClass(), FIntPoint::ZeroValue);
+            Entry.X += High;
+            Entry.Y += Low;
+        }
+    };
+
+    Accumulate(ResolveSpawner(CachedMeleeSpawners, MeleeMassSpawnerClass), MeleeCount);
+    Accumulate(ResolveSpawner(CachedRangeSpawners, RangeMassSpawnerClass), RangeCount);
+
+    for (const TPair<TSubclassOf<AHellunaEnemyCharacter>, FIntPoint>& Pair : Watermarks)
+    {
+        Pool->RequestWarmUp(Pair.Key, Pair.Value.X, Pair.Value.Y);
+    }
+
+    UE_LOG(LogHelluna, Log, TEXT("[PoolWarmUpV1] Day%d 밤 대비 Pool Warm-up 예약 — 근거리:%d 원거리:%d | 클래스 수:%d"),
+        CurrentDay, MeleeCount, RangeCount, Watermarks.Num());
+}
+
 // ============================================================
 // TriggerMassSpawning — 밤 시작 시 근거리/원거리 몬스터 ECS 소환
 //
@@ -2017,7 +2121,7 @@ void AHellunaDefenseGameMode::ScheduleDayTransitionAfterNightClear(const TCHAR*
 // [Spawner 생성 규칙]
 //   - MeleeMassSpawnerClass가 설정되어 있으면 MeleeSpawnTag TargetPoint마다 근거리 Spawner 생성
 //   - RangeMassSpawnerClass가 설정되어 있으면 RangeSpawnTag TargetPoint마다 원거리 Spawner 생성
-//   - MeleeMassSpawnerClass가 없고 레거시 MassSpawnerClass가 있으면 MonsterSpawnTag로 폴백
+//   - 클래스가 없으면 해당 종류는 소환하지 않음 (WarmUpEnemyPoolsForNight도 같은 기준)
 //
 // [소환 수 = 설정 값 ÷ Spawner 수] (5/15 변경)
 //   MeleeCount=20 + TargetPoint 2개 → 각 Spawner 10마리, 총 20마리.
@@ -2198,17 +2302,37 @@ void AHellunaDefenseGameMode::NotifyMonsterDied(AActor* DeadMonster)
 {
     if (!HasAuthority() || !DeadMonster || !bGameInitialized) return;
 
+    const AHellunaEnemyCharacter* EnemyChar = Cast<AHellunaEnemyCharacter>(DeadMonster);
+    const EEnemyGrade Grade = EnemyChar ? EnemyChar->EnemyGrade : EEnemyGrade::Normal;
+    HandleMonsterDeath(Grade, DeadMonster->GetName(), TEXT("NotifyMonsterDied"));
+}
+
+// ============================================================
+// [EntityTargetingV1] NotifyEntityMonsterDied — Entity 상태 사망 통보
+// Actor가 없으므로 등급은 Entity Config(EnemyClass CDO)에서 받아 같은 사망 경로로 처리.
+// ============================================================
+void AHellunaDefenseGameMode::NotifyEntityMonsterDied(EEnemyGrade Grade)
+{
+    if (!HasAuthority() || !bGameInitialized) return;
+
+    HandleMonsterDeath(Grade, TEXT("Entity"), TEXT("NotifyEntityMonsterDied"));
+}
+
+// ============================================================
+// HandleMonsterDeath — Actor/Entity 사망 공통 처리
+//   Normal   → RemainingMonstersThisNight 차감 → 0이 되면 낮 전환 타이머 시작
+//   SemiBoss / Boss → HandleBossDeath
+// ============================================================
+void AHellunaDefenseGameMode::HandleMonsterDeath(EEnemyGrade Grade, const FString& MonsterName, const TCHAR* Source)
+{
     AHellunaDefenseGameState* GS = GetGameState<AHellunaDefenseGameState>();
     if (!GS) return;
 
     // ── 보스/세미보스 분기 ────────────────────────────────────────────
-    if (const AHellunaEnemyCharacter* EnemyChar = Cast<AHellunaEnemyCharacter>(DeadMonster))
+    if (Grade != EEnemyGrade::Normal)
     {
-        if (EnemyChar->EnemyGrade != EEnemyGrade::Normal)
-        {
-            NotifyBossDied(DeadMonster);
-            return;
-        }
+        HandleBossDeath(Grade, MonsterName);
+        return;
     }
 
     // ── 일반 몬스터: 카운터 차감 ──────────────────────────────────────
@@ -2217,7 +2341,7 @@ void AHellunaDefenseGameMode::NotifyMonsterDied(AActor* DeadMonster)
 
     if (RemainingMonstersThisNight <= 0)
     {
-        ScheduleDayTransitionAfterNightClear(TEXT("NotifyMonsterDied"));
+        ScheduleDayTransitionAfterNightClear(Source);
     }
 }
 
@@ -2438,6 +2562,18 @@ void AHellunaDefenseGameMode::NotifyBossDied(AActor* DeadBoss)
 {
     if (!HasAuthority() || !DeadBoss) return;
 
+    // 캐릭터 자체의 EnemyGrade로 등급 판별 (스케줄 조회 불필요)
+    EEnemyGrade Grade = EEnemyGrade::Boss;
+    if (const AHellunaEnemyCharacter* EnemyChar = Cast<AHellunaEnemyCharacter>(DeadBoss))
+    {
+        Grade = EnemyChar->EnemyGrade;
+    }
+
+    HandleBossDeath(Grade, DeadBoss->GetName());
+}
+
+void AHellunaDefenseGameMode::HandleBossDeath(EEnemyGrade Grade, const FString& BossName)
+{
     AliveBoss.Reset();
 
     // [BossFightTimeFreezeV1] 보스 사망 시 시간 진행 재개
@@ -2446,13 +2582,6 @@ void AHellunaDefenseGameMode::NotifyBossDied(AActor* DeadBoss)
         GS->SetBossFightTimeFrozen(false);
     }
 
-    // 캐릭터 자체의 EnemyGrade로 등급 판별 (스케줄 조회 불필요)
-    EEnemyGrade Grade = EEnemyGrade::Boss;
-    if (const AHellunaEnemyCharacter* EnemyChar = Cast<AHellunaEnemyCharacter>(DeadBoss))
-    {
-        Grade = EnemyChar->EnemyGrade;
-    }
-
     FString TypeLabel;
     switch (Grade)
     {
@@ -2463,7 +2592,7 @@ void AHellunaDefenseGameMode::NotifyBossDied(AActor* DeadBoss)
 
     Debug::Print(FString::Printf(
         TEXT("[%s 사망] %s 처치됨 — Day %d"),
-        *TypeLabel, *DeadBoss->GetName(), CurrentDay),
+        *TypeLabel, *BossName, CurrentDay),
         FColor::Red);
 
     // TODO: 보스/세미보스 사망 후속 처리 (보상, 연출, 클리어 조건 등) 이후 구현
@@ -3051,6 +3180,13 @@ void AHellunaDefenseGameMode::PostLogin(APlayerController* NewPlayer)
     Super::PostLogin(NewPlayer);
 
     // Phase 12b: 레지스트리 갱신
+    // [WarmPoolV1] 배정 없이 직접 접속해도 스탠바이 해제 (풀이 이 서버를 다시 내주지 않도록)
+    //   스탠바이용 0.25초 폴링도 HandleWarmAssign과 같이 일반 주기로 재설정
+    if (bWarmStandby)
+    {
+        bWarmStandby = false;
+        StartCommandPollTimer();
+    }
     CurrentPlayerCount++;
     WriteRegistryFile(TEXT("playing"), CurrentPlayerCount);
     UE_LOG(LogHelluna, Log, TEXT("[DefenseGameMode] PostLogin 레지스트리 갱신 | Players=%d"), CurrentPlayerCount);
@@ -3526,7 +3662,7 @@ void AHellunaDefenseGameMode::Logout(AController* Exiting)
 
     // Phase 12b: 레지스트리 갱신
     CurrentPlayerCount = FMath::Max(0, CurrentPlayerCount - 1);
-    WriteRegistryFile(CurrentPlayerCount > 0 ? TEXT("playing") : TEXT("empty"), CurrentPlayerCount);
+    WriteRegistryFile(GetRegistryStatus(), CurrentPlayerCount);
     UE_LOG(LogHelluna, Log, TEXT("[DefenseGameMode] Logout 레지스트리 갱신 | Players=%d"), CurrentPlayerCount);
 
     // [Phase 16] 전원 이탈 시 유휴 종료 타이머 재시작
@@ -3576,6 +3712,7 @@ void AHellunaDefenseGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
         W->GetTimerManager().ClearTimer(IdleShutdownTimer);
     }
     DeleteRegistryFile();
+    RegistryClient.Close();
     UE_LOG(LogHelluna, Log, TEXT("[DefenseGameMode] EndPlay: 레지스트리 파일 삭제"));
 
     Super::EndPlay(EndPlayReason);
@@ -3742,7 +3879,7 @@ FString AHellunaDefenseGameMode::GetRegistryFilePath() const
     return FPaths::Combine(GetRegistryDirectoryPath(), FString::Printf(TEXT("channel_%d.json"), Port));
 }
 
-void AHellunaDefenseGameMode::WriteRegistryFile(const FString& Status, int32 PlayerCount)
+FString AHellunaDefenseGameMode::BuildRegistryJson(const FString& Status, int32 PlayerCount) const
 {
     const int32 Port = GetServerPort();
     const FString ChannelId = FString::Printf(TEXT("channel_%d"), Port);
@@ -3762,7 +3899,7 @@ void AHellunaDefenseGameMode::WriteRegistryFile(const FString& Status, int32 Pla
     }
     DisconnectedArray += TEXT("]");
 
-    const FString JsonContent = FString::Printf(
+    return FString::Printf(
         TEXT("{\n")
         TEXT("  \"channelId\": \"%s\",\n")
         TEXT("  \"port\": %d,\n")
@@ -3775,6 +3912,14 @@ void AHellunaDefenseGameMode::WriteRegistryFile(const FString& Status, int32 Pla
         TEXT("}"),
         *ChannelId, Port, *Status, PlayerCount, *MapName, *LastUpdate, *DisconnectedArray
     );
+}
+
+void AHellunaDefenseGameMode::WriteRegistryFile(const FString& Status, int32 PlayerCount)
+{
+    const FString JsonContent = BuildRegistryJson(Status, PlayerCount);
+
+    // [ChannelRegistryV1] 상태 변경은 소켓으로 즉시 push + 파일에도 기록 (로비 재시작/소켓 폴백 대비)
+    RegistryClient.SendState(JsonContent);
 
     const FString FilePath = GetRegistryFilePath();
     if (!FFileHelper::SaveStringToFile(JsonContent, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
@@ -3783,8 +3928,31 @@ void AHellunaDefenseGameMode::WriteRegistryFile(const FString& Status, int32 Pla
     }
 }
 
+void AHellunaDefenseGameMode::SendRegistryHeartbeat()
+{
+    const FString Status = GetRegistryStatus();
+
+    // 소켓 하트비트는 디스크를 건드리지 않음 — 소켓이 없을 때만 파일 재기록
+    if (!RegistryClient.SendState(BuildRegistryJson(Status, CurrentPlayerCount)))
+    {
+        WriteRegistryFile(Status, CurrentPlayerCount);
+    }
+}
+
+FString AHellunaDefenseGameMode::GetRegistryStatus() const
+{
+    if (CurrentPlayerCount > 0)
+    {
+        return TEXT("playing");
+    }
+    return bWarmStandby ? TEXT("idle") : TEXT("empty");
+}
+
 void AHellunaDefenseGameMode::DeleteRegistryFile()
 {
+    // [ChannelRegistryV1] 로비에 즉시 Offline 통지 (하트비트 만료를 기다리지 않음)
+    RegistryClient.SendState(BuildRegistryJson(TEXT("offline"), 0));
+
     const FString FilePath = GetRegistryFilePath();
     if (IFileManager::Get().FileExists(*FilePath))
     {
@@ -3822,8 +3990,10 @@ void AHellunaDefenseGameMode::PollForCommand()
         GetRegistryDirectoryPath(),
         FString::Printf(TEXT("command_%d.json"), GetServerPort()));
 
+    // [ChannelRegistryV1] 로비 소켓 커맨드 우선, 없으면 커맨드 파일 (로비 소켓 폴백)
     FString JsonString;
-    if (!FFileHelper::LoadFileToString(JsonString, *CmdPath))
+    const bool bFromSocket = RegistryClient.ReceiveCommand(JsonString);
+    if (!bFromSocket && !FFileHelper::LoadFileToString(JsonString, *CmdPath))
     {
         return;
     }
@@ -3836,6 +4006,18 @@ void AHellunaDefenseGameMode::PollForCommand()
     }
 
     const FString Command = JsonObj->GetStringField(TEXT("command"));
+
+    // [WarmPoolV1] 웜 스탠바이 배정 — 프로세스 유지, 상태만 idle → empty
+    if (Command == TEXT("assign"))
+    {
+        if (!bFromSocket)
+        {
+            IFileManager::Get().Delete(*CmdPath);
+        }
+        HandleWarmAssign(JsonObj);
+        return;
+    }
+
     if (Command != TEXT("servertravel"))
     {
         return;
@@ -3848,7 +4030,10 @@ void AHellunaDefenseGameMode::PollForCommand()
     }
 
     // 커맨드 파일 삭제 (먼저 삭제 — 중복 실행 방지)
-    IFileManager::Get().Delete(*CmdPath);
+    if (!bFromSocket)
+    {
+        IFileManager::Get().Delete(*CmdPath);
+    }
 
     // 타이머 정리
     StopCommandPollTimer();
@@ -3863,12 +4048,61 @@ void AHellunaDefenseGameMode::PollForCommand()
     FGenericPlatformMisc::RequestExit(false);
 }
 
+void AHellunaDefenseGameMode::HandleWarmAssign(const TSharedPtr<FJsonObject>& Command)
+{
+    FString AssignedMapPath;
+    FString PartyIdString;
+    Command->TryGetStringField(TEXT("mapPath"), AssignedMapPath);
+    Command->TryGetStringField(TEXT("partyId"), PartyIdString);
+
+    if (!bWarmStandby)
+    {
+        UE_LOG(LogHelluna, Warning, TEXT("[WarmPoolV1] assign 수신 — 이미 배정된 서버, 무시 | Port=%d"), GetServerPort());
+        return;
+    }
+
+    // 맵은 프로세스 기동 시 고정 (ServerTravel은 World Partition 크래시) → 다른 맵 배정은 받을 수 없음
+    const FString CurrentMap = UWorld::RemovePIEPrefix(GetWorld() ? GetWorld()->GetMapName() : FString());
+    if (!AssignedMapPath.IsEmpty() && !HellunaChannelRegistry::DoesMapIdentifierMatch(AssignedMapPath, CurrentMap))
+    {
+        UE_LOG(LogHelluna, Error, TEXT("[WarmPoolV1] assign 맵 불일치 → 배정 거부 + 종료 | Assigned=%s | Current=%s"), *AssignedMapPath, *CurrentMap);
+        StopCommandPollTimer();
+        FGenericPlatformMisc::RequestExit(false);
+        return;
+    }
+
+    // 파티 배정 적용 — 첫 도착자의 PartyId가 비어도 Barrier가 배정 파티로 시작
+    int32 AssignedPartyId = 0;
+    LexFromString(AssignedPartyId, *PartyIdString);
+    WarmAssignedPartyId = FMath::Max(AssignedPartyId, 0);
+
+    bWarmStandby = false;
+    WriteRegistryFile(GetRegistryStatus(), CurrentPlayerCount);
+
+    // 일반 빈 서버와 동일하게 유휴 종료 타이머 시작 (배정 후 아무도 안 오면 정리)
+    if (IdleShutdownSeconds > 0.f)
+    {
+        if (UWorld* W = GetWorld())
+        {
+            W->GetTimerManager().SetTimer(IdleShutdownTimer, this,
+                &AHellunaDefenseGameMode::CheckIdleShutdown, IdleShutdownSeconds, false);
+        }
+    }
+
+    // 배정 후에는 일반 주기로 커맨드 폴링
+    StartCommandPollTimer();
+
+    UE_LOG(LogHelluna, Log, TEXT("[WarmPoolV1] 웜 서버 배정 완료 | Port=%d | Map=%s | PartyId=%d"),
+        GetServerPort(), *CurrentMap, WarmAssignedPartyId);
+}
+
 void AHellunaDefenseGameMode::StartCommandPollTimer()
 {
     if (UWorld* W = GetWorld())
     {
+        // [WarmPoolV1] 스탠바이 중에는 배정 지연을 줄이기 위해 짧은 주기로 폴링
         W->GetTimerManager().SetTimer(CommandPollTimer, this,
-            &AHellunaDefenseGameMode::PollForCommand, 2.0f, true);
+            &AHellunaDefenseGameMode::PollForCommand, bWarmStandby ? 0.25f : 2.0f, true);
     }
 }
 
@@ -4052,7 +4286,13 @@ void AHellunaDefenseGameMode::RegisterControllerInBarrier(APlayerController* New
     if (BarrierState == ELoadingBarrierState::Idle)
     {
         ExpectedPlayerIds = InExpectedIds;
-        BarrierPartyId = InPartyId;
+        // [WarmPoolV1] 배정된 웜 서버면 assign의 파티를 기본값으로 (불일치는 도착자 기준 + 경고)
+        BarrierPartyId = InPartyId != 0 ? InPartyId : WarmAssignedPartyId;
+        if (WarmAssignedPartyId != 0 && InPartyId != 0 && InPartyId != WarmAssignedPartyId)
+        {
+            UE_LOG(LogHelluna, Warning, TEXT("[WarmPoolV1] Barrier PartyId 불일치 | Assigned=%d | Arrived=%d"),
+                WarmAssignedPartyId, InPartyId);
+        }
         // 솔로 매칭 혹은 ExpectedIds 누락 시 → 해당 플레이어만 기대
         if (ExpectedPlayerIds.Num() == 0 && !PlayerId.IsEmpty())
         {
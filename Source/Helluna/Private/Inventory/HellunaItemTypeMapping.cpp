@@ -2,6 +2,103 @@
 
 #include "Inventory/HellunaItemTypeMapping.h"
 
+// ============================================
+// 📌 [ItemTypeMapCacheV1] DataTable별 해시 캐시
+// ============================================
+namespace
+{
+	struct FItemTypeMappingCache
+	{
+		TMap<FGameplayTag, TSoftClassPtr<AActor>> ClassByType;
+		TMap<FSoftObjectPath, FGameplayTag> TypeByClass;
+	};
+
+	/** 게임 스레드 전용. 빌드 후에는 교체만 하고 내용은 수정하지 않음 (불변) */
+	TMap<TWeakObjectPtr<const UDataTable>, TSharedPtr<const FItemTypeMappingCache>> GItemTypeMappingCaches;
+
+#if WITH_EDITOR
+	/** OnDataTableChanged 바인딩을 이미 건 테이블 (재빌드마다 중복 바인딩 방지) */
+	TSet<TWeakObjectPtr<const UDataTable>> GItemTypeMappingBoundTables;
+#endif
+
+	TSharedPtr<const FItemTypeMappingCache> BuildItemTypeMappingCache(const UDataTable* DataTable)
+	{
+		TSharedPtr<FItemTypeMappingCache> Cache = MakeShared<FItemTypeMappingCache>();
+
+		const FString ContextString(TEXT("ItemTypeMapping"));
+		TArray<FItemTypeToActorMapping*> AllRows;
+		DataTable->GetAllRows<FItemTypeToActorMapping>(ContextString, AllRows);
+
+		Cache->ClassByType.Reserve(AllRows.Num());
+		Cache->TypeByClass.Reserve(AllRows.Num());
+
+		for (const FItemTypeToActorMapping* Row : AllRows)
+		{
+			if (!Row || !Row->ItemType.IsValid()) continue;
+
+			// 중복 태그는 기존 선형 탐색과 동일하게 첫 행 우선
+			if (Cache->ClassByType.Contains(Row->ItemType))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[ItemTypeMapping] ItemType '%s' 중복 행 — 첫 행만 사용"),
+					*Row->ItemType.ToString());
+				continue;
+			}
+
+			// ActorClass가 비어 있어도 등록 (조회 시 "ActorClass가 nullptr" 경고를 그대로 유지)
+			Cache->ClassByType.Add(Row->ItemType, TSoftClassPtr<AActor>(Row->ItemActorClass.Get()));
+			if (Row->ItemActorClass)
+			{
+				Cache->TypeByClass.FindOrAdd(FSoftObjectPath(Row->ItemActorClass.Get()), Row->ItemType);
+			}
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("[ItemTypeMapping] 해시 캐시 빌드: %s (%d개 매핑)"),
+			*DataTable->GetName(), Cache->ClassByType.Num());
+		return Cache;
+	}
+
+	/**
+	 * 호출자가 공유 참조를 들고 있어야 함 — 조회 중 LoadSynchronous 등에서
+	 * InvalidateCache가 불려 맵에서 빠져도 캐시가 해제되지 않도록
+	 */
+	TSharedRef<const FItemTypeMappingCache> GetItemTypeMappingCache(const UDataTable* DataTable)
+	{
+		check(IsInGameThread());
+
+		if (const TSharedPtr<const FItemTypeMappingCache>* Found = GItemTypeMappingCaches.Find(DataTable))
+		{
+			return Found->ToSharedRef();
+		}
+
+		// GC된 테이블의 캐시 정리 (빌드는 드물므로 여기서만 수행)
+		for (auto It = GItemTypeMappingCaches.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+#if WITH_EDITOR
+		// 에디터에서 DataTable 수정/리임포트 시 캐시 무효화
+		TWeakObjectPtr<const UDataTable> WeakTable(DataTable);
+		if (!GItemTypeMappingBoundTables.Contains(WeakTable))
+		{
+			GItemTypeMappingBoundTables.Add(WeakTable);
+			const_cast<UDataTable*>(DataTable)->OnDataTableChanged().AddLambda([WeakTable]()
+			{
+				if (const UDataTable* Table = WeakTable.Get())
+				{
+					UHellunaItemTypeMapping::InvalidateCache(Table);
+				}
+			});
+		}
+#endif
+
+		return GItemTypeMappingCaches.Add(DataTable, BuildItemTypeMappingCache(DataTable)).ToSharedRef();
+	}
+}
+
 TSubclassOf<AActor> UHellunaItemTypeMapping::GetActorClassFromItemType(
 	const UDataTable* DataTable,
 	const FGameplayTag& ItemType)
@@ -19,29 +116,28 @@ TSubclassOf<AActor> UHellunaItemTypeMapping::GetActorClassFromItemType(
 		return nullptr;
 	}
 
-	// DataTable의 모든 Row 순회
-	const FString ContextString(TEXT("ItemTypeMapping"));
-	TArray<FItemTypeToActorMapping*> AllRows;
-	DataTable->GetAllRows<FItemTypeToActorMapping>(ContextString, AllRows);
-
-	for (const FItemTypeToActorMapping* Row : AllRows)
+	// [ItemTypeMapCacheV1] 해시 조회 (GetAllRows + 선형 비교 제거)
+	const TSharedRef<const FItemTypeMappingCache> Cache = GetItemTypeMappingCache(DataTable);
+	if (const TSoftClassPtr<AActor>* Found = Cache->ClassByType.Find(ItemType))
 	{
-		if (Row && Row->ItemType.MatchesTagExact(ItemType))
+		if (Found->IsNull())
 		{
-			if (Row->ItemActorClass)
-			{
-				UE_LOG(LogTemp, Log, TEXT("[ItemTypeMapping] 매핑 성공: %s → %s"),
-					*ItemType.ToString(),
-					*Row->ItemActorClass->GetName());
-				return Row->ItemActorClass;
-			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("[ItemTypeMapping] ItemType '%s'의 ActorClass가 nullptr입니다!"),
-					*ItemType.ToString());
-				return nullptr;
-			}
+			UE_LOG(LogTemp, Warning, TEXT("[ItemTypeMapping] ItemType '%s'의 ActorClass가 nullptr입니다!"),
+				*ItemType.ToString());
+			return nullptr;
 		}
+
+		// DataTable 행이 하드 참조이므로 보통 이미 로드됨 — 언로드된 경우에만 동기 로드
+		UClass* ActorClass = Found->Get();
+		if (!ActorClass)
+		{
+			ActorClass = Found->LoadSynchronous();
+		}
+
+		UE_LOG(LogTemp, Verbose, TEXT("[ItemTypeMapping] 매핑 성공: %s → %s"),
+			*ItemType.ToString(),
+			ActorClass ? *ActorClass->GetName() : TEXT("(로드 실패)"));
+		return ActorClass;
 	}
 
 	// 매핑을 찾지 못함
@@ -50,6 +146,29 @@ TSubclassOf<AActor> UHellunaItemTypeMapping::GetActorClassFromItemType(
 	return nullptr;
 }
 
+FGameplayTag UHellunaItemTypeMapping::GetItemTypeFromActorClass(
+	const UDataTable* DataTable,
+	TSubclassOf<AActor> ActorClass)
+{
+	if (!IsValid(DataTable) || !ActorClass)
+	{
+		return FGameplayTag::EmptyTag;
+	}
+
+	const TSharedRef<const FItemTypeMappingCache> Cache = GetItemTypeMappingCache(DataTable);
+	const FGameplayTag* Found = Cache->TypeByClass.Find(FSoftObjectPath(ActorClass.Get()));
+	return Found ? *Found : FGameplayTag::EmptyTag;
+}
+
+void UHellunaItemTypeMapping::InvalidateCache(const UDataTable* DataTable)
+{
+	if (GItemTypeMappingCaches.Remove(DataTable) > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[ItemTypeMapping] 해시 캐시 무효화: %s"),
+			IsValid(DataTable) ? *DataTable->GetName() : TEXT("(null)"));
+	}
+}
+
 void UHellunaItemTypeMapping::DebugPrintAllMappings(const UDataTable* DataTable)
 {
 	if (!IsValid(DataTable))
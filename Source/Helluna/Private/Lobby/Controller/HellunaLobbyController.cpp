@@ -777,17 +777,22 @@ void AHellunaLobbyController::Server_Deploy_Implementation()
 					return;
 				}
 
-				const int32 SpawnedPort = LobbyGM->GameServerManager->SpawnGameServer(MapPath);
+				// [WarmPoolV1] 웜 서버 우선 (assign ack까지는 아래 WaitAndDeploy가 대기), 없으면 새 프로세스
+				int32 SpawnedPort = LobbyGM->ClaimWarmServerForMap(DeployMapKey);
 				if (SpawnedPort < 0)
 				{
-					UE_LOG(LogHellunaLobby, Error, TEXT("[LobbyPC] Deploy: 서버 스폰 실패"));
-					Client_DeployFailed(TEXT("서버 용량 초과 또는 스폰 실패"));
-					bDeployInProgress = false;
-					return;
+					SpawnedPort = LobbyGM->GameServerManager->SpawnGameServer(MapPath);
+					if (SpawnedPort < 0)
+					{
+						UE_LOG(LogHellunaLobby, Error, TEXT("[LobbyPC] Deploy: 서버 스폰 실패"));
+						Client_DeployFailed(TEXT("서버 용량 초과 또는 스폰 실패"));
+						bDeployInProgress = false;
+						return;
+					}
+
+					LobbyGM->MarkChannelAsPendingDeploy(SpawnedPort);
 				}
 
-				LobbyGM->MarkChannelAsPendingDeploy(SpawnedPort);
-
 				// [§17+] 솔로 동적 서버 spawn 대기 동안 클라에 우주선 화면 미리 표시
 				Client_PreloadShipScene();
 				UE_LOG(LogHellunaLobby, Log, TEXT("[LobbyPC] [§17+] Solo 동적 spawn → Client_PreloadShipScene 전송"));
@@ -36,6 +36,11 @@
 //     게임 종료 → DB->MergeGameResultToStash(PlayerId, ResultItems)
 //       → BEGIN TRANSACTION → Stash INSERT (기존 유지) → COMMIT
 //
+//   📌 비동기 [DBAsyncV1]:
+//     Async*(…) → EnqueueDatabaseWrite → FHellunaDBWorker(FIFO) → 동기 함수 실행 → DispatchToGameThread
+//     AsyncLoad*(…) → EnqueueDatabaseRead → 스레드 풀 + ReadDatabase(WAL 읽기 전용) → DispatchToGameThread
+//     동기 함수 진입 → FDatabaseAccessScope → 같은 플레이어의 대기 중인 비동기 쓰기만 대기 + DatabaseMutex
+//
 //   📌 크래시 복구:
 //     로비 PostLogin → CheckAndRecoverFromCrash
 //       → DB->HasPendingLoadout(PlayerId)  — Loadout 잔존 확인 (COUNT > 0)
@@ -61,7 +66,121 @@
 #include "Dom/JsonObject.h"              // FJsonObject — JSON 오브젝트
 #include "Dom/JsonValue.h"               // FJsonValue — JSON 값
 #include "Misc/FileHelper.h"             // FFileHelper — JSON 파일 읽기/쓰기
+#include "Serialization/MemoryWriter.h"  // FMemoryWriter — 부착물 BLOB 직렬화
+#include "Serialization/MemoryReader.h"  // FMemoryReader — 부착물 BLOB 역직렬화
 #include "Helluna.h"                     // LogHelluna 로그 카테고리
+#include "HAL/Runnable.h"                // FRunnable — DB 워커 스레드
+#include "HAL/RunnableThread.h"          // FRunnableThread
+#include "HAL/Event.h"                   // FEvent — 워커 깨우기
+#include "Containers/Queue.h"            // TQueue — Mpsc 작업 큐
+#include "Misc/ScopeLock.h"              // FScopeLock — ReadDatabase 잠금
+#include "Async/Async.h"                 // AsyncTask / Async — 게임 스레드 콜백, 스레드 풀 읽기
+
+
+// ════════════════════════════════════════════════════════════════════════════════
+// [DBAsyncV1] DB 워커 스레드
+// ════════════════════════════════════════════════════════════════════════════════
+//
+// 단일 Writer 스레드. 어느 스레드에서든 Enqueue 가능(Mpsc), 실행은 FIFO.
+// PendingJobs는 "큐에 있음 + 실행 중" 작업 수 → 0이 되면 모든 쓰기가 커밋된 상태
+// ════════════════════════════════════════════════════════════════════════════════
+class FHellunaDBWorker : public FRunnable
+{
+public:
+	FHellunaDBWorker()
+	{
+		WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+		Thread = FRunnableThread::Create(this, TEXT("HellunaDBWorker"), 0, TPri_BelowNormal);
+	}
+
+	virtual ~FHellunaDBWorker() override
+	{
+		Stop();
+		if (Thread)
+		{
+			Thread->WaitForCompletion();
+			delete Thread;
+			Thread = nullptr;
+		}
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+
+	bool IsRunning() const { return Thread != nullptr; }
+
+	void Enqueue(TUniqueFunction<void()>&& Job)
+	{
+		PendingJobs.Increment();
+		Jobs.Enqueue(MoveTemp(Job));
+		WakeEvent->Trigger();
+	}
+
+	int32 GetPendingJobCount() const { return PendingJobs.GetValue(); }
+
+	bool IsWorkerThread() const
+	{
+		return Thread && FPlatformTLS::GetCurrentThreadId() == Thread->GetThreadID();
+	}
+
+	virtual uint32 Run() override
+	{
+		while (!bStopping)
+		{
+			DrainJobs();
+			WakeEvent->Wait(100);
+		}
+		// 종료 요청 후에도 남은 쓰기는 전부 처리 (저장 유실 방지)
+		DrainJobs();
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		bStopping = true;
+		if (WakeEvent)
+		{
+			WakeEvent->Trigger();
+		}
+	}
+
+private:
+	void DrainJobs()
+	{
+		TUniqueFunction<void()> Job;
+		while (Jobs.Dequeue(Job))
+		{
+			Job();
+			PendingJobs.Decrement();
+		}
+	}
+
+	TQueue<TUniqueFunction<void()>, EQueueMode::Mpsc> Jobs;
+	FThreadSafeCounter PendingJobs;
+	FEvent* WakeEvent = nullptr;
+	FRunnableThread* Thread = nullptr;
+	std::atomic<bool> bStopping{false};
+};
+
+namespace
+{
+	// 현재 스레드의 FDatabaseAccessScope 중첩 깊이 (바깥쪽 진입에서만 플레이어 큐 대기)
+	thread_local int32 GDatabaseAccessDepth = 0;
+
+	// ParseRowToSavedItem 컬럼 순서와 일치해야 함
+	const TCHAR* const StashSelectSQL = TEXT(
+		"SELECT item_type, stack_count, grid_position_x, grid_position_y, "
+		"grid_category, is_equipped, weapon_slot, serialized_manifest, attachments_blob, attachments_json "
+		"FROM player_stash WHERE player_id = ?1;"
+	);
+
+	// [Fix14] is_equipped 컬럼 포함하여 장착 상태 보존
+	// [AttachBlobV1] attachments_blob 우선, attachments_json은 레거시 행 폴백용
+	const TCHAR* const LoadoutSelectSQL = TEXT(
+		"SELECT item_type, stack_count, grid_position_x, grid_position_y, "
+		"grid_category, is_equipped, weapon_slot, serialized_manifest, attachments_blob, attachments_json "
+		"FROM player_loadout WHERE player_id = ?1;"
+	);
+}
 
 
 // ════════════════════════════════════════════════════════════════════════════════
@@ -166,6 +285,7 @@ void UHellunaSQLiteSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 void UHellunaSQLiteSubsystem::Deinitialize()
 {
 	UE_LOG(LogHelluna, Log, TEXT("[SQLite] ▶ Deinitialize — DB 닫기 시작"));
+	ShutdownDatabaseWorker();
 	CloseDatabase();
 	Super::Deinitialize();
 	UE_LOG(LogHelluna, Log, TEXT("[SQLite] ✓ Deinitialize 완료"));
@@ -192,11 +312,15 @@ bool UHellunaSQLiteSubsystem::OpenDatabase()
 {
 	UE_LOG(LogHelluna, Log, TEXT("[SQLite] ▶ OpenDatabase 시작 | 경로: %s"), *CachedDatabasePath);
 
+	// [DBAsyncV1] 큐 대기는 락을 잡기 전에 — 스코프 안에서 기다리면 워커가 DatabaseMutex에 막혀 교착
+	FlushDatabaseJobs();
+	FDatabaseAccessScope DBAccess(*this);
+
 	// 이미 열려있으면 경고 후 닫기 (보통 발생하면 안 됨)
 	if (Database != nullptr)
 	{
 		UE_LOG(LogHelluna, Warning, TEXT("[SQLite]   ⚠ 기존 DB가 이미 열려있음 — 닫고 재오픈"));
-		CloseDatabase();
+		CloseDatabaseLocked();
 	}
 
 	// 1. FSQLiteDatabase 인스턴스 생성
@@ -218,10 +342,13 @@ bool UHellunaSQLiteSubsystem::OpenDatabase()
 		if (!InitializeSchema())
 		{
 			UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ 스키마 초기화 실패 — DB를 닫습니다."));
-			CloseDatabase();
+			CloseDatabaseLocked();
 			return false;
 		}
 
+		// [DBAsyncV1] 비동기 읽기용 연결 (WAL 설정 이후에 열어야 함)
+		OpenReadConnection();
+
 		UE_LOG(LogHelluna, Log, TEXT("[SQLite] ✓ OpenDatabase 성공"));
 		return true;
 	}
@@ -241,12 +368,28 @@ bool UHellunaSQLiteSubsystem::OpenDatabase()
 // ──────────────────────────────────────────────────────────────
 void UHellunaSQLiteSubsystem::CloseDatabase()
 {
+	// [DBAsyncV1] 대기 중인 비동기 쓰기를 먼저 커밋한 뒤 닫음 (닫기는 모든 플레이어에 영향 → 큐 전체 대기)
+	FlushDatabaseJobs();
+	FDatabaseAccessScope DBAccess(*this);
+	CloseDatabaseLocked();
+}
+
+// ──────────────────────────────────────────────────────────────
+// CloseDatabaseLocked — DatabaseMutex를 잡은 상태에서 닫기 (큐 대기 없음)
+// ──────────────────────────────────────────────────────────────
+void UHellunaSQLiteSubsystem::CloseDatabaseLocked()
+{
+	CloseReadConnection();
+
 	if (Database == nullptr)
 	{
 		UE_LOG(LogHelluna, Log, TEXT("[SQLite] CloseDatabase — 이미 닫혀있음 (Database==nullptr)"));
 		return;
 	}
 
+	// [StmtCacheV1] 캐시된 Statement를 먼저 finalize (ReleaseDatabaseConnection도 여기를 거침)
+	ResetStatementCache();
+
 	Database->Close();
 	delete Database;
 	Database = nullptr;
@@ -307,6 +450,339 @@ void UHellunaSQLiteSubsystem::ReleaseDatabaseConnection()
 }
 
 
+// ════════════════════════════════════════════════════════════════════════════════
+// [DBAsyncV1] 비동기 작업 큐
+// ════════════════════════════════════════════════════════════════════════════════
+//
+// 📌 구조:
+//   쓰기 — FHellunaDBWorker(단일 스레드, FIFO)가 기존 동기 함수를 그대로 실행
+//          → 트랜잭션/로그/에러 처리는 동기 버전과 동일
+//   읽기 — ReadDatabase(WAL 읽기 전용 연결) + 스레드 풀 → Writer 트랜잭션과 동시 진행
+//   결과 — DispatchToGameThread → AsyncTask(GameThread), 서브시스템 파괴 후면 생략
+//
+// 📌 순서 보장 (플레이어 단위):
+//   PlayerId가 지정된 쓰기는 PendingJobsByPlayer에 "큐에 있음 + 실행 중" 수로 집계
+//   동기 함수는 FDatabaseAccessScope에서 같은 플레이어의 대기 중인 쓰기만 기다림
+//     → 다른 플레이어의 저장이 큐에 쌓여 있어도 게임 스레드는 막히지 않음
+//   비동기 읽기는 같은 플레이어의 쓰기가 대기 중이면 쓰기 큐 뒤로 → 방금 요청한 저장 결과를 읽음
+//   CloseDatabase만 큐 전체를 비움 (FlushDatabaseJobs)
+// ════════════════════════════════════════════════════════════════════════════════
+
+// ──────────────────────────────────────────────────────────────
+// FDatabaseAccessScope — 동기 DB 함수 진입 RAII
+// ──────────────────────────────────────────────────────────────
+UHellunaSQLiteSubsystem::FDatabaseAccessScope::FDatabaseAccessScope(UHellunaSQLiteSubsystem& InOwner, const FString& PlayerId)
+	: Owner(InOwner)
+{
+	// 바깥쪽 진입에서만 대기 — 이미 잠금을 쥔 채로 기다리면 워커와 교착
+	if (GDatabaseAccessDepth++ == 0 && !PlayerId.IsEmpty())
+	{
+		Owner.WaitForPlayerDatabaseJobs(PlayerId);
+	}
+	Owner.DatabaseMutex.Lock();
+}
+
+UHellunaSQLiteSubsystem::FDatabaseAccessScope::~FDatabaseAccessScope()
+{
+	Owner.DatabaseMutex.Unlock();
+	--GDatabaseAccessDepth;
+}
+
+// ──────────────────────────────────────────────────────────────
+// GetPendingDatabaseJobCount / FlushDatabaseJobs / WaitForPlayerDatabaseJobs
+// ──────────────────────────────────────────────────────────────
+int32 UHellunaSQLiteSubsystem::GetPendingDatabaseJobCount() const
+{
+	return DBWorker ? DBWorker->GetPendingJobCount() : 0;
+}
+
+int32 UHellunaSQLiteSubsystem::GetPendingDatabaseJobCount(const FString& PlayerId) const
+{
+	FScopeLock PendingLock(&PendingJobsMutex);
+	const int32* Count = PendingJobsByPlayer.Find(PlayerId);
+	return Count ? *Count : 0;
+}
+
+void UHellunaSQLiteSubsystem::FlushDatabaseJobs()
+{
+	// 워커 자신이 기다리면 영원히 끝나지 않음 (자기 작업이 Pending에 포함)
+	if (!DBWorker || DBWorker->IsWorkerThread() || DBWorker->GetPendingJobCount() == 0)
+	{
+		return;
+	}
+
+	// 스코프 안에서 기다리면 워커가 DatabaseMutex를 못 잡아 영원히 끝나지 않음
+	if (!ensureMsgf(GDatabaseAccessDepth == 0, TEXT("[SQLite] FlushDatabaseJobs: FDatabaseAccessScope 안에서 호출됨 — 대기 생략")))
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	while (DBWorker->GetPendingJobCount() > 0)
+	{
+		FPlatformProcess::SleepNoStats(0.0005f);
+	}
+
+	const double WaitMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	if (WaitMs > 5.0)
+	{
+		UE_LOG(LogHelluna, Log, TEXT("[SQLite] FlushDatabaseJobs: 비동기 쓰기 대기 %.1fms (동기 호출이 큐를 기다림)"), WaitMs);
+	}
+}
+
+void UHellunaSQLiteSubsystem::WaitForPlayerDatabaseJobs(const FString& PlayerId)
+{
+	// 워커 자신이 기다리면 영원히 끝나지 않음 (자기 작업이 Pending에 포함)
+	if (!DBWorker || DBWorker->IsWorkerThread() || GetPendingDatabaseJobCount(PlayerId) == 0)
+	{
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	while (GetPendingDatabaseJobCount(PlayerId) > 0)
+	{
+		FPlatformProcess::SleepNoStats(0.0005f);
+	}
+
+	const double WaitMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	if (WaitMs > 5.0)
+	{
+		UE_LOG(LogHelluna, Log, TEXT("[SQLite] WaitForPlayerDatabaseJobs: 비동기 쓰기 대기 %.1fms | PlayerId=%s"), WaitMs, *PlayerId);
+	}
+}
+
+// ──────────────────────────────────────────────────────────────
+// EnqueueDatabaseWrite — DB 워커 큐에 쓰기 작업 추가
+// ──────────────────────────────────────────────────────────────
+void UHellunaSQLiteSubsystem::EnqueueDatabaseWrite(TUniqueFunction<void()> Job, const FString& PlayerId)
+{
+	if (!DBWorker && FPlatformProcess::SupportsMultithreading())
+	{
+		DBWorker = new FHellunaDBWorker();
+		if (!DBWorker->IsRunning())
+		{
+			UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ DB 워커 스레드 생성 실패 — 비동기 요청을 동기로 실행"));
+			delete DBWorker;
+			DBWorker = nullptr;
+		}
+		else
+		{
+			UE_LOG(LogHelluna, Log, TEXT("[SQLite] ✓ DB 워커 스레드 시작"));
+		}
+	}
+
+	if (!DBWorker)
+	{
+		// 멀티스레드 미지원 → 즉시 실행 (콜백은 여전히 게임 스레드 태스크로 호출됨)
+		Job();
+		return;
+	}
+
+	if (PlayerId.IsEmpty())
+	{
+		DBWorker->Enqueue(MoveTemp(Job));
+		return;
+	}
+
+	// 플레이어 집계는 Enqueue 전에 증가 — 직후의 동기 호출이 이 작업을 놓치지 않도록
+	{
+		FScopeLock PendingLock(&PendingJobsMutex);
+		++PendingJobsByPlayer.FindOrAdd(PlayerId);
+	}
+	DBWorker->Enqueue([this, PlayerId, Job = MoveTemp(Job)]() mutable
+	{
+		Job();
+
+		FScopeLock PendingLock(&PendingJobsMutex);
+		int32& Count = PendingJobsByPlayer.FindChecked(PlayerId);
+		if (--Count <= 0)
+		{
+			PendingJobsByPlayer.Remove(PlayerId);
+		}
+	});
+}
+
+// ──────────────────────────────────────────────────────────────
+// EnqueueDatabaseRead — 읽기 작업 (읽기 전용 연결 우선)
+// ──────────────────────────────────────────────────────────────
+void UHellunaSQLiteSubsystem::EnqueueDatabaseRead(const FString& PlayerId, TUniqueFunction<void(FSQLiteDatabase*)> Job)
+{
+	const bool bWritesPending = GetPendingDatabaseJobCount(PlayerId) > 0;
+	if (ReadDatabase != nullptr && !bWritesPending && FPlatformProcess::SupportsMultithreading())
+	{
+		InFlightReads.Increment();
+		Async(EAsyncExecution::ThreadPool, [this, Job = MoveTemp(Job)]() mutable
+		{
+			{
+				// CloseReadConnection과 경합 시 nullptr을 받아 빈 결과 처리
+				FScopeLock ReadLock(&ReadDatabaseMutex);
+				Job(ReadDatabase);
+			}
+			InFlightReads.Decrement();
+		});
+		return;
+	}
+
+	// 폴백: 쓰기 큐 뒤에서 Writer 연결로 읽기
+	EnqueueDatabaseWrite([this, Job = MoveTemp(Job)]() mutable
+	{
+		FDatabaseAccessScope DBAccess(*this);
+		Job(IsDatabaseReady() ? Database : nullptr);
+	}, PlayerId);
+}
+
+// ──────────────────────────────────────────────────────────────
+// DispatchToGameThread — 결과 콜백을 게임 스레드로
+// ──────────────────────────────────────────────────────────────
+void UHellunaSQLiteSubsystem::DispatchToGameThread(TUniqueFunction<void()> Callback)
+{
+	TWeakObjectPtr<UHellunaSQLiteSubsystem> WeakThis(this);
+	AsyncTask(ENamedThreads::GameThread, [WeakThis, Callback = MoveTemp(Callback)]() mutable
+	{
+		if (WeakThis.IsValid())
+		{
+			Callback();
+		}
+	});
+}
+
+// ──────────────────────────────────────────────────────────────
+// OpenReadConnection / CloseReadConnection — WAL 읽기 전용 연결
+// ──────────────────────────────────────────────────────────────
+void UHellunaSQLiteSubsystem::OpenReadConnection()
+{
+	FScopeLock ReadLock(&ReadDatabaseMutex);
+	if (ReadDatabase != nullptr)
+	{
+		return;
+	}
+
+	ReadDatabase = new FSQLiteDatabase();
+	if (!ReadDatabase->Open(*CachedDatabasePath, ESQLiteDatabaseOpenMode::ReadOnly))
+	{
+		UE_LOG(LogHelluna, Warning, TEXT("[SQLite]   ⚠ 읽기 전용 연결 열기 실패 — 비동기 읽기는 쓰기 큐로 처리 | 에러: %s"),
+			*ReadDatabase->GetLastError());
+		delete ReadDatabase;
+		ReadDatabase = nullptr;
+		return;
+	}
+
+	// Writer 체크포인트와 겹칠 때 즉시 실패하지 않도록 (Writer와 동일한 3초)
+	ReadDatabase->Execute(TEXT("PRAGMA busy_timeout=3000;"));
+	UE_LOG(LogHelluna, Log, TEXT("[SQLite]   읽기 전용 연결 열림 (비동기 읽기용)"));
+}
+
+void UHellunaSQLiteSubsystem::CloseReadConnection()
+{
+	FScopeLock ReadLock(&ReadDatabaseMutex);
+	if (ReadDatabase == nullptr)
+	{
+		return;
+	}
+
+	ReadDatabase->Close();
+	delete ReadDatabase;
+	ReadDatabase = nullptr;
+}
+
+// ──────────────────────────────────────────────────────────────
+// ShutdownDatabaseWorker — Deinitialize 전용
+// ──────────────────────────────────────────────────────────────
+// 남은 쓰기는 전부 커밋(워커 Run()이 종료 전 큐를 비움), 실행 중인 읽기도 완료 대기
+// ──────────────────────────────────────────────────────────────
+void UHellunaSQLiteSubsystem::ShutdownDatabaseWorker()
+{
+	if (DBWorker)
+	{
+		UE_LOG(LogHelluna, Log, TEXT("[SQLite] DB 워커 종료 — 남은 작업 %d개 처리 후 종료"), DBWorker->GetPendingJobCount());
+		delete DBWorker;   // 소멸자: Stop → 큐 비움 → 스레드 Join
+		DBWorker = nullptr;
+	}
+
+	while (InFlightReads.GetValue() > 0)
+	{
+		FPlatformProcess::SleepNoStats(0.0005f);
+	}
+}
+
+// ──────────────────────────────────────────────────────────────
+// Async* — 동기 함수의 비동기 래퍼
+// ──────────────────────────────────────────────────────────────
+// 인자는 값으로 캡처(복사) → 호출자는 즉시 원본을 수정/파괴해도 됨
+// ──────────────────────────────────────────────────────────────
+void UHellunaSQLiteSubsystem::AsyncLoadPlayerStash(const FString& PlayerId, FOnStashLoaded OnComplete)
+{
+	EnqueueDatabaseRead(PlayerId, [this, PlayerId, OnComplete = MoveTemp(OnComplete)](FSQLiteDatabase* Db) mutable
+	{
+		TArray<FInv_SavedItemData> Items;
+		if (Db != nullptr && !PlayerId.IsEmpty())
+		{
+			Items = QueryItemRows(*Db, StashSelectSQL, PlayerId, TEXT("AsyncLoadPlayerStash"));
+		}
+		DispatchToGameThread([OnComplete = MoveTemp(OnComplete), Items = MoveTemp(Items)]()
+		{
+			OnComplete.ExecuteIfBound(Items);
+		});
+	});
+}
+
+void UHellunaSQLiteSubsystem::AsyncLoadPlayerLoadout(const FString& PlayerId, FOnStashLoaded OnComplete)
+{
+	EnqueueDatabaseRead(PlayerId, [this, PlayerId, OnComplete = MoveTemp(OnComplete)](FSQLiteDatabase* Db) mutable
+	{
+		TArray<FInv_SavedItemData> Items;
+		if (Db != nullptr && !PlayerId.IsEmpty())
+		{
+			Items = QueryItemRows(*Db, LoadoutSelectSQL, PlayerId, TEXT("AsyncLoadPlayerLoadout"));
+		}
+		DispatchToGameThread([OnComplete = MoveTemp(OnComplete), Items = MoveTemp(Items)]()
+		{
+			OnComplete.ExecuteIfBound(Items);
+		});
+	});
+}
+
+void UHellunaSQLiteSubsystem::AsyncSavePlayerStash(const FString& PlayerId, const TArray<FInv_SavedItemData>& Items, FOnOperationComplete OnComplete)
+{
+	EnqueueDatabaseWrite([this, PlayerId, Items, OnComplete = MoveTemp(OnComplete)]() mutable
+	{
+		const bool bSuccess = SavePlayerStash(PlayerId, Items);
+		DispatchToGameThread([OnComplete = MoveTemp(OnComplete), bSuccess]()
+		{
+			OnComplete.ExecuteIfBound(bSuccess);
+		});
+	}, PlayerId);
+}
+
+void UHellunaSQLiteSubsystem::AsyncSaveStashAndLoadoutAtomic(
+	const FString& PlayerId,
+	const TArray<FInv_SavedItemData>& StashItems,
+	const TArray<FInv_SavedItemData>& LoadoutItems,
+	FOnOperationComplete OnComplete)
+{
+	EnqueueDatabaseWrite([this, PlayerId, StashItems, LoadoutItems, OnComplete = MoveTemp(OnComplete)]() mutable
+	{
+		const bool bSuccess = SaveStashAndLoadoutAtomic(PlayerId, StashItems, LoadoutItems);
+		DispatchToGameThread([OnComplete = MoveTemp(OnComplete), bSuccess]()
+		{
+			OnComplete.ExecuteIfBound(bSuccess);
+		});
+	}, PlayerId);
+}
+
+void UHellunaSQLiteSubsystem::AsyncMergeGameResultToStash(const FString& PlayerId, const TArray<FInv_SavedItemData>& ResultItems, FOnOperationComplete OnComplete)
+{
+	EnqueueDatabaseWrite([this, PlayerId, ResultItems, OnComplete = MoveTemp(OnComplete)]() mutable
+	{
+		const bool bSuccess = MergeGameResultToStash(PlayerId, ResultItems);
+		DispatchToGameThread([OnComplete = MoveTemp(OnComplete), bSuccess]()
+		{
+			OnComplete.ExecuteIfBound(bSuccess);
+		});
+	}, PlayerId);
+}
+
+
 // ════════════════════════════════════════════════════════════════════════════════
 // 파일 기반 Loadout 전송
 // ════════════════════════════════════════════════════════════════════════════════
@@ -944,7 +1420,8 @@ TArray<FInv_SavedItemData> UHellunaSQLiteSubsystem::ImportGameResultFromFile(con
 // │ is_equipped (INTEGER)               ← 0/1 (bool)        │
 // │ weapon_slot (INTEGER)               ← -1=미장착          │
 // │ serialized_manifest (BLOB)          ← 매니페스트 바이너리│
-// │ attachments_json (TEXT)             ← 부착물 JSON        │
+// │ attachments_blob (BLOB)             ← 부착물 바이너리    │
+// │ attachments_json (TEXT)             ← 레거시 (v1 DB만)   │
 // │ updated_at (DATETIME)                                    │
 // └─────────────────────────────────────────────────────────┘
 //
@@ -954,7 +1431,7 @@ TArray<FInv_SavedItemData> UHellunaSQLiteSubsystem::ImportGameResultFromFile(con
 // └─────────────────────────────────────────────────────────┘
 //
 // ┌─ schema_version ────────────────────────────────────────┐
-// │ version (INTEGER)                                        │
+// │ version (INTEGER)          ← 2 = 부착물 BLOB 마이그레이션 완료│
 // │ applied_at (DATETIME)                                    │
 // └─────────────────────────────────────────────────────────┘
 //
@@ -1036,6 +1513,7 @@ bool UHellunaSQLiteSubsystem::InitializeSchema()
 		"    weapon_slot         INTEGER DEFAULT -1,"
 		"    serialized_manifest BLOB,"
 		"    attachments_json    TEXT,"
+		"    attachments_blob    BLOB,"
 		"    updated_at          DATETIME DEFAULT CURRENT_TIMESTAMP"
 		");"
 	)))
@@ -1068,6 +1546,7 @@ bool UHellunaSQLiteSubsystem::InitializeSchema()
 		"    weapon_slot         INTEGER DEFAULT -1,"
 		"    serialized_manifest BLOB,"
 		"    attachments_json    TEXT,"
+		"    attachments_blob    BLOB,"
 		"    created_at          DATETIME DEFAULT CURRENT_TIMESTAMP"
 		");"
 	)))
@@ -1108,6 +1587,15 @@ bool UHellunaSQLiteSubsystem::InitializeSchema()
 	// 기존 DB에 is_equipped 컬럼이 없을 수 있음 → ALTER TABLE로 추가 (이미 있으면 에러 무시)
 	Database->Execute(TEXT("ALTER TABLE player_loadout ADD COLUMN is_equipped INTEGER DEFAULT 0;"));
 
+	// ── [AttachBlobV1] 마이그레이션: 부착물 BLOB 컬럼 추가 + 기존 JSON 행 변환 (1회) ──
+	Database->Execute(TEXT("ALTER TABLE player_stash ADD COLUMN attachments_blob BLOB;"));
+	Database->Execute(TEXT("ALTER TABLE player_loadout ADD COLUMN attachments_blob BLOB;"));
+	if (!MigrateAttachmentsToBlob())
+	{
+		// 치명적이지 않음 — ParseRowToSavedItem이 JSON 행도 읽을 수 있음. 다음 실행 시 재시도
+		UE_LOG(LogHelluna, Warning, TEXT("[SQLite]   ⚠ 부착물 BLOB 마이그레이션 실패 — JSON 레거시 경로로 계속"));
+	}
+
 	// ── active_game_characters 테이블 생성 (캐릭터 중복 방지) ──
 	// TODO: [크래시 복구] 서버 비정상 종료 시 레코드가 남아있을 수 있음 → heartbeat/TTL 기반 자동 정리 필요
 	// TODO: [Race Condition] UNIQUE INDEX로 동시 등록은 방지되지만, UI 갱신에 지연 있음
@@ -1236,21 +1724,130 @@ bool UHellunaSQLiteSubsystem::InitializeSchema()
 	return true;
 }
 
-
-// ════════════════════════════════════════════════════════════════════════════════
-// DB 상태 확인
-// ════════════════════════════════════════════════════════════════════════════════
-
 // ──────────────────────────────────────────────────────────────
-// IsDatabaseReady — DB 사용 가능 여부
+// [AttachBlobV1] MigrateAttachmentsToBlob — attachments_json → attachments_blob (1회)
 // ──────────────────────────────────────────────────────────────
-// 모든 CRUD 함수 진입부에서 반드시 호출!
-// 세 가지 조건 모두 만족해야 true:
-//   1. bDatabaseOpen = true (OpenDatabase 성공)
-//   2. Database != nullptr (메모리 할당됨)
-//   3. Database->IsValid() (SQLite 내부 핸들 유효)
+// schema_version 1 → 2. 하나의 트랜잭션에서 두 테이블 변환 후 버전 갱신
+// → 중간 실패 시 ROLLBACK, 버전 1 유지 → 다음 실행 시 재시도
+// 변환된 행은 attachments_json = NULL (파일 크기 감소 + 레거시 경로 미사용)
 // ──────────────────────────────────────────────────────────────
-bool UHellunaSQLiteSubsystem::IsDatabaseReady() const
+bool UHellunaSQLiteSubsystem::MigrateAttachmentsToBlob()
+{
+	int64 Version = 1;
+	{
+		FSQLitePreparedStatement VersionStmt = Database->PrepareStatement(TEXT("SELECT version FROM schema_version WHERE rowid = 1;"));
+		if (VersionStmt.IsValid())
+		{
+			VersionStmt.Execute([&Version](const FSQLitePreparedStatement& Stmt) -> ESQLitePreparedStatementExecuteRowResult
+			{
+				Stmt.GetColumnValueByIndex(0, Version);
+				return ESQLitePreparedStatementExecuteRowResult::Stop;
+			});
+		}
+	}
+
+	if (Version >= 2)
+	{
+		return true;
+	}
+
+	UE_LOG(LogHelluna, Log, TEXT("[SQLite] ▶ 부착물 BLOB 마이그레이션 시작 (schema_version %lld → 2)"), Version);
+
+	if (!Database->Execute(TEXT("BEGIN IMMEDIATE TRANSACTION;")))
+	{
+		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ MigrateAttachmentsToBlob: BEGIN 실패 | 에러: %s"), *Database->GetLastError());
+		return false;
+	}
+
+	auto Fail = [this](const TCHAR* Where) -> bool
+	{
+		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ MigrateAttachmentsToBlob 실패: %s — ROLLBACK | 에러: %s"), Where, *Database->GetLastError());
+		if (!Database->Execute(TEXT("ROLLBACK;"))) { UE_LOG(LogHelluna, Error, TEXT("[SQLite] ROLLBACK 실패 | 에러: %s"), *Database->GetLastError()); }
+		return false;
+	};
+
+	int32 TotalConverted = 0;
+	for (const TCHAR* Table : { TEXT("player_stash"), TEXT("player_loadout") })
+	{
+		TArray<TPair<int64, FString>> LegacyRows;
+		{
+			FSQLitePreparedStatement SelectStmt = Database->PrepareStatement(*FString::Printf(
+				TEXT("SELECT id, attachments_json FROM %s WHERE attachments_blob IS NULL AND attachments_json IS NOT NULL AND attachments_json <> '';"), Table));
+			if (!SelectStmt.IsValid())
+			{
+				return Fail(TEXT("SELECT prepare"));
+			}
+			SelectStmt.Execute([&LegacyRows](const FSQLitePreparedStatement& Stmt) -> ESQLitePreparedStatementExecuteRowResult
+			{
+				TPair<int64, FString>& Row = LegacyRows.AddDefaulted_GetRef();
+				Stmt.GetColumnValueByIndex(0, Row.Key);
+				Stmt.GetColumnValueByIndex(1, Row.Value);
+				return ESQLitePreparedStatementExecuteRowResult::Continue;
+			});
+		}
+
+		FSQLitePreparedStatement UpdateStmt = Database->PrepareStatement(*FString::Printf(
+			TEXT("UPDATE %s SET attachments_blob = ?1, attachments_json = NULL WHERE id = ?2;"), Table),
+			ESQLitePreparedStatementFlags::Persistent);
+		if (!UpdateStmt.IsValid())
+		{
+			return Fail(TEXT("UPDATE prepare"));
+		}
+
+		for (const TPair<int64, FString>& Row : LegacyRows)
+		{
+			const TArray<uint8> Blob = SerializeAttachmentsToBlob(DeserializeAttachmentsFromJson(Row.Value));
+			if (Blob.Num() > 0)
+			{
+				UpdateStmt.SetBindingValueByIndex(1, TArrayView<const uint8>(Blob), true);
+			}
+			else
+			{
+				UpdateStmt.SetBindingValueByIndex(1); // 파싱 실패/빈 배열 → NULL (JSON도 비움)
+			}
+			UpdateStmt.SetBindingValueByIndex(2, Row.Key);
+
+			if (!UpdateStmt.Execute())
+			{
+				return Fail(TEXT("UPDATE"));
+			}
+			UpdateStmt.Reset();
+			UpdateStmt.ClearBindings();
+		}
+
+		UE_LOG(LogHelluna, Log, TEXT("[SQLite]   %s: 부착물 %d행 변환"), Table, LegacyRows.Num());
+		TotalConverted += LegacyRows.Num();
+	}
+
+	if (!Database->Execute(TEXT("UPDATE schema_version SET version = 2, applied_at = CURRENT_TIMESTAMP WHERE rowid = 1;")))
+	{
+		return Fail(TEXT("schema_version"));
+	}
+
+	if (!Database->Execute(TEXT("COMMIT;")))
+	{
+		return Fail(TEXT("COMMIT"));
+	}
+
+	UE_LOG(LogHelluna, Log, TEXT("[SQLite] ✓ 부착물 BLOB 마이그레이션 완료 | %d행"), TotalConverted);
+	return true;
+}
+
+
+// ════════════════════════════════════════════════════════════════════════════════
+// DB 상태 확인
+// ════════════════════════════════════════════════════════════════════════════════
+
+// ──────────────────────────────────────────────────────────────
+// IsDatabaseReady — DB 사용 가능 여부
+// ──────────────────────────────────────────────────────────────
+// 모든 CRUD 함수 진입부에서 반드시 호출!
+// 세 가지 조건 모두 만족해야 true:
+//   1. bDatabaseOpen = true (OpenDatabase 성공)
+//   2. Database != nullptr (메모리 할당됨)
+//   3. Database->IsValid() (SQLite 내부 핸들 유효)
+// ──────────────────────────────────────────────────────────────
+bool UHellunaSQLiteSubsystem::IsDatabaseReady() const
 {
 	const bool bReady = bDatabaseOpen && Database != nullptr && Database->IsValid();
 
@@ -1390,6 +1987,97 @@ TArray<FInv_SavedAttachmentData> UHellunaSQLiteSubsystem::DeserializeAttachments
 	return Result;
 }
 
+// ──────────────────────────────────────────────────────────────
+// [AttachBlobV1] SerializeAttachmentsToBlob / DeserializeAttachmentsFromBlob
+// ──────────────────────────────────────────────────────────────
+// JSON 대비: 파서/Base64 없음, 매니페스트 원본 바이트 그대로 → 로드 비용·파일 크기 감소
+// 형식 변경 시 AttachmentBlobVersion을 올리고 Deserialize에 이전 버전 분기 추가
+// ──────────────────────────────────────────────────────────────
+namespace
+{
+	constexpr uint8 AttachmentBlobVersion = 1;
+}
+
+TArray<uint8> UHellunaSQLiteSubsystem::SerializeAttachmentsToBlob(const TArray<FInv_SavedAttachmentData>& Attachments)
+{
+	TArray<uint8> Blob;
+	if (Attachments.Num() == 0)
+	{
+		return Blob;  // 빈 배열 → DB에 NULL
+	}
+
+	FMemoryWriter Writer(Blob);
+	uint8 Version = AttachmentBlobVersion;
+	int32 Count = Attachments.Num();
+	Writer << Version;
+	Writer << Count;
+
+	for (const FInv_SavedAttachmentData& Att : Attachments)
+	{
+		FString ItemTypeStr = Att.AttachmentItemType.ToString();
+		int32 SlotIndex = Att.SlotIndex;
+		FString AttachTypeStr = Att.AttachmentType.ToString();
+		Writer << ItemTypeStr;
+		Writer << SlotIndex;
+		Writer << AttachTypeStr;
+		Writer << const_cast<TArray<uint8>&>(Att.SerializedManifest);
+	}
+
+	return Blob;
+}
+
+TArray<FInv_SavedAttachmentData> UHellunaSQLiteSubsystem::DeserializeAttachmentsFromBlob(const TArray<uint8>& Blob)
+{
+	TArray<FInv_SavedAttachmentData> Result;
+	if (Blob.Num() == 0)
+	{
+		return Result;
+	}
+
+	FMemoryReader Reader(Blob);
+	uint8 Version = 0;
+	int32 Count = 0;
+	Reader << Version;
+	Reader << Count;
+
+	if (Version == 0 || Version > AttachmentBlobVersion)
+	{
+		UE_LOG(LogHelluna, Warning, TEXT("[SQLite] DeserializeAttachmentsFromBlob: 알 수 없는 버전 %d (현재 %d) — 부착물 무시"),
+			Version, AttachmentBlobVersion);
+		return Result;
+	}
+
+	// 손상된 Count로 거대 할당하지 않도록 남은 바이트 기준 상한 (원소당 최소 13바이트)
+	if (Count < 0 || Count > Blob.Num())
+	{
+		UE_LOG(LogHelluna, Warning, TEXT("[SQLite] DeserializeAttachmentsFromBlob: 잘못된 Count=%d (BLOB %d바이트)"), Count, Blob.Num());
+		return Result;
+	}
+
+	Result.Reserve(Count);
+	for (int32 i = 0; i < Count && !Reader.IsError(); ++i)
+	{
+		FString ItemTypeStr;
+		FString AttachTypeStr;
+		FInv_SavedAttachmentData& Att = Result.AddDefaulted_GetRef();
+		Reader << ItemTypeStr;
+		Reader << Att.SlotIndex;
+		Reader << AttachTypeStr;
+		Reader << Att.SerializedManifest;
+
+		Att.AttachmentItemType = FGameplayTag::RequestGameplayTag(FName(*ItemTypeStr), false);
+		Att.AttachmentType = FGameplayTag::RequestGameplayTag(FName(*AttachTypeStr), false);
+	}
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogHelluna, Warning, TEXT("[SQLite] DeserializeAttachmentsFromBlob: BLOB 손상 (%d바이트) — 부착물 무시"), Blob.Num());
+		Result.Reset();
+	}
+
+	return Result;
+}
+
 // ──────────────────────────────────────────────────────────────
 // ParseRowToSavedItem
 // ──────────────────────────────────────────────────────────────
@@ -1407,7 +2095,8 @@ TArray<FInv_SavedAttachmentData> UHellunaSQLiteSubsystem::DeserializeAttachments
 // is_equipped         → Item.bEquipped (bool) — [Fix14] Stash/Loadout 모두 사용
 // weapon_slot         → Item.WeaponSlotIndex (int32)
 // serialized_manifest → Item.SerializedManifest (TArray<uint8>)
-// attachments_json    → Item.Attachments (TArray<FInv_SavedAttachmentData>)
+// attachments_blob    → Item.Attachments (TArray<FInv_SavedAttachmentData>) — [AttachBlobV1]
+// attachments_json    → BLOB이 비어있을 때만 (레거시)
 // ──────────────────────────────────────────────────────────────
 FInv_SavedItemData UHellunaSQLiteSubsystem::ParseRowToSavedItem(const FSQLitePreparedStatement& Statement)
 {
@@ -1443,10 +2132,20 @@ FInv_SavedItemData UHellunaSQLiteSubsystem::ParseRowToSavedItem(const FSQLitePre
 	// ── serialized_manifest (BLOB — 아이템 매니페스트 바이너리 데이터) ──
 	Statement.GetColumnValueByName(TEXT("serialized_manifest"), Item.SerializedManifest);
 
-	// ── attachments_json → TArray<FInv_SavedAttachmentData> ──
-	FString AttJson;
-	Statement.GetColumnValueByName(TEXT("attachments_json"), AttJson);
-	Item.Attachments = DeserializeAttachmentsFromJson(AttJson);
+	// ── [AttachBlobV1] attachments_blob → TArray<FInv_SavedAttachmentData> ──
+	//    BLOB이 비어있는 행만 attachments_json 파싱 (마이그레이션 전 레거시 행)
+	TArray<uint8> AttBlob;
+	Statement.GetColumnValueByName(TEXT("attachments_blob"), AttBlob);
+	if (AttBlob.Num() > 0)
+	{
+		Item.Attachments = DeserializeAttachmentsFromBlob(AttBlob);
+	}
+	else
+	{
+		FString AttJson;
+		Statement.GetColumnValueByName(TEXT("attachments_json"), AttJson);
+		Item.Attachments = DeserializeAttachmentsFromJson(AttJson);
+	}
 
 	UE_LOG(LogHelluna, Verbose, TEXT("[SQLite] ParseRow: ItemType=%s | Stack=%d | Grid=(%d,%d) | Cat=%d | Equipped=%d | Slot=%d | Att=%d개"),
 		*ItemTypeStr, Item.StackCount, PosX, PosY, GridCat, Equipped, Item.WeaponSlotIndex, Item.Attachments.Num());
@@ -1456,51 +2155,440 @@ FInv_SavedItemData UHellunaSQLiteSubsystem::ParseRowToSavedItem(const FSQLitePre
 
 
 // ════════════════════════════════════════════════════════════════════════════════
-// IInventoryDatabase — Stash(창고) CRUD 구현
+// [StmtCacheV1] Prepared Statement 캐시 + Diff 기반 아이템 저장
 // ════════════════════════════════════════════════════════════════════════════════
+//
+// 📌 이전: 저장 1회 = DELETE 전체 + 아이템 수만큼 INSERT (매 호출 PrepareStatement 재컴파일)
+// 📌 현재:
+//   - 같은 SQL은 한 번만 컴파일 (StatementCache, CloseDatabase에서 초기화)
+//   - 기존 행과 새 상태를 비교 → 바뀐 행만 DELETE(id IN …) / 다중 행 INSERT
+//   - 배치 크기는 2의 거듭제곱(32,16,…,1) → 테이블당 SQL 변형 최대 6개만 캐시
+// ════════════════════════════════════════════════════════════════════════════════
+
+namespace
+{
+	// 한 문장에 넣는 최대 행 수 (10컬럼 × 32 = 320 바인딩 — SQLite 기본 한도 999 이내)
+	constexpr int32 MaxItemRowsPerStatement = 32;
+
+	// player_stash/player_loadout 공통 컬럼 수 (player_id 포함)
+	constexpr int32 ItemColumnCount = 10;
+
+	const TCHAR* const ItemColumnList = TEXT(
+		"player_id, item_type, stack_count, grid_position_x, grid_position_y, "
+		"grid_category, is_equipped, weapon_slot, serialized_manifest, attachments_blob");
+
+	/** Remaining 이하의 가장 큰 2의 거듭제곱 (MaxItemRowsPerStatement 상한, Remaining <= 0 이면 0) */
+	int32 GetItemBatchSize(int32 Remaining)
+	{
+		const int32 Capped = FMath::Min(Remaining, MaxItemRowsPerStatement);
+		if (Capped <= 0)
+		{
+			return 0;
+		}
+		return static_cast<int32>(1u << FMath::FloorLog2(static_cast<uint32>(Capped)));
+	}
+
+	/** "(?,?,…)" × NumGroups — 다중 행 VALUES / IN 목록 생성 */
+	FString BuildPlaceholderGroups(int32 NumGroups, int32 PerGroup)
+	{
+		FString Group = TEXT("(");
+		for (int32 i = 0; i < PerGroup; ++i)
+		{
+			Group += (i == 0) ? TEXT("?") : TEXT(",?");
+		}
+		Group += TEXT(")");
+
+		FString Out;
+		Out.Reserve((Group.Len() + 1) * NumGroups);
+		for (int32 i = 0; i < NumGroups; ++i)
+		{
+			if (i > 0)
+			{
+				Out += TEXT(",");
+			}
+			Out += Group;
+		}
+		return Out;
+	}
+}
 
 // ──────────────────────────────────────────────────────────────
-// LoadPlayerStash — 창고 아이템 전체 로드
+// FItemRow — 아이템 1행의 DB 컬럼 값
 // ──────────────────────────────────────────────────────────────
-// SQL: SELECT * FROM player_stash WHERE player_id = ?
-// → 각 행을 ParseRowToSavedItem으로 변환
-// → TArray<FInv_SavedItemData> 반환
-//
-// 호출 시점:
-//   - HellunaBaseGameMode::LoadAndSendInventoryToClient()
-//   - 디버그 콘솔: Helluna.SQLite.DebugLoad
+// 새 상태(FInv_SavedItemData)와 기존 행(SELECT)을 같은 형태로 만들어 비교.
+// 비교는 DB에 실제로 저장되는 값 기준 (attachments는 [AttachBlobV1] 직렬화 바이트)
 // ──────────────────────────────────────────────────────────────
-TArray<FInv_SavedItemData> UHellunaSQLiteSubsystem::LoadPlayerStash(const FString& PlayerId)
+struct UHellunaSQLiteSubsystem::FItemRow
 {
-	UE_LOG(LogHelluna, Log, TEXT("[SQLite] ▶ LoadPlayerStash | PlayerId=%s"), *PlayerId);
+	FString ItemType;
+	int32 StackCount = 0;
+	int32 GridX = -1;
+	int32 GridY = -1;
+	int32 GridCategory = 0;
+	int32 Equipped = 0;
+	int32 WeaponSlot = -1;
+	TArray<uint8> Manifest;
+	TArray<uint8> AttachmentsBlob;
+	uint32 Hash = 0;
+
+	/** 기존 행 전용 — BLOB 없이 attachments_json만 있는 레거시 행 (ParseRowToSavedItem이 JSON으로 폴백) */
+	bool bLegacyAttachmentsJson = false;
+
+	static FItemRow FromItem(const FInv_SavedItemData& Item)
+	{
+		FItemRow Row;
+		Row.ItemType = Item.ItemType.ToString();
+		Row.StackCount = Item.StackCount;
+		Row.GridX = Item.GridPosition.X;
+		Row.GridY = Item.GridPosition.Y;
+		Row.GridCategory = static_cast<int32>(Item.GridCategory);
+		Row.Equipped = Item.bEquipped ? 1 : 0;
+		Row.WeaponSlot = Item.WeaponSlotIndex;
+		Row.Manifest = Item.SerializedManifest;
+		Row.AttachmentsBlob = SerializeAttachmentsToBlob(Item.Attachments);
+		Row.ComputeHash();
+		return Row;
+	}
+
+	/** SELECT id, <ItemColumnList에서 player_id 제외> 결과 1행 — FirstColumn = item_type 인덱스 */
+	static FItemRow FromStatement(const FSQLitePreparedStatement& Stmt, int32 FirstColumn)
+	{
+		FItemRow Row;
+		Stmt.GetColumnValueByIndex(FirstColumn + 0, Row.ItemType);
+		Stmt.GetColumnValueByIndex(FirstColumn + 1, Row.StackCount);
+		Stmt.GetColumnValueByIndex(FirstColumn + 2, Row.GridX);
+		Stmt.GetColumnValueByIndex(FirstColumn + 3, Row.GridY);
+		Stmt.GetColumnValueByIndex(FirstColumn + 4, Row.GridCategory);
+		Stmt.GetColumnValueByIndex(FirstColumn + 5, Row.Equipped);
+		Stmt.GetColumnValueByIndex(FirstColumn + 6, Row.WeaponSlot);
+		Stmt.GetColumnValueByIndex(FirstColumn + 7, Row.Manifest);        // NULL → 빈 배열
+		Stmt.GetColumnValueByIndex(FirstColumn + 8, Row.AttachmentsBlob); // NULL → 빈 배열
+		Row.ComputeHash();
+		return Row;
+	}
+
+	void ComputeHash()
+	{
+		Hash = GetTypeHash(ItemType);
+		Hash = HashCombine(Hash, GetTypeHash(StackCount));
+		Hash = HashCombine(Hash, GetTypeHash(GridX));
+		Hash = HashCombine(Hash, GetTypeHash(GridY));
+		Hash = HashCombine(Hash, GetTypeHash(GridCategory));
+		Hash = HashCombine(Hash, GetTypeHash(Equipped));
+		Hash = HashCombine(Hash, GetTypeHash(WeaponSlot));
+		Hash = HashCombine(Hash, FCrc::MemCrc32(Manifest.GetData(), Manifest.Num()));
+		Hash = HashCombine(Hash, FCrc::MemCrc32(AttachmentsBlob.GetData(), AttachmentsBlob.Num()));
+	}
+
+	bool Equals(const FItemRow& Other) const
+	{
+		return Hash == Other.Hash
+			&& StackCount == Other.StackCount
+			&& GridX == Other.GridX && GridY == Other.GridY
+			&& GridCategory == Other.GridCategory
+			&& Equipped == Other.Equipped
+			&& WeaponSlot == Other.WeaponSlot
+			&& ItemType.Equals(Other.ItemType, ESearchCase::CaseSensitive)
+			&& Manifest == Other.Manifest
+			&& AttachmentsBlob == Other.AttachmentsBlob;
+	}
+
+	/** ?BaseIndex ~ ?BaseIndex+9 에 바인딩 (ItemColumnList 순서) */
+	void Bind(FSQLitePreparedStatement& Stmt, int32 BaseIndex, const FString& PlayerId) const
+	{
+		Stmt.SetBindingValueByIndex(BaseIndex + 0, PlayerId);
+		Stmt.SetBindingValueByIndex(BaseIndex + 1, ItemType);
+		Stmt.SetBindingValueByIndex(BaseIndex + 2, StackCount);
+		Stmt.SetBindingValueByIndex(BaseIndex + 3, GridX);
+		Stmt.SetBindingValueByIndex(BaseIndex + 4, GridY);
+		Stmt.SetBindingValueByIndex(BaseIndex + 5, GridCategory);
+		Stmt.SetBindingValueByIndex(BaseIndex + 6, Equipped);
+		Stmt.SetBindingValueByIndex(BaseIndex + 7, WeaponSlot);
+		if (Manifest.Num() > 0)
+		{
+			Stmt.SetBindingValueByIndex(BaseIndex + 8, TArrayView<const uint8>(Manifest), true);
+		}
+		else
+		{
+			Stmt.SetBindingValueByIndex(BaseIndex + 8); // NULL
+		}
+		if (AttachmentsBlob.Num() > 0)
+		{
+			Stmt.SetBindingValueByIndex(BaseIndex + 9, TArrayView<const uint8>(AttachmentsBlob), true);
+		}
+		else
+		{
+			Stmt.SetBindingValueByIndex(BaseIndex + 9); // NULL
+		}
+	}
+};
 
+// ──────────────────────────────────────────────────────────────
+// GetCachedStatement / ResetStatementCache
+// ──────────────────────────────────────────────────────────────
+FSQLitePreparedStatement* UHellunaSQLiteSubsystem::GetCachedStatement(const FString& SQL)
+{
+	if (Database == nullptr)
+	{
+		return nullptr;
+	}
 
-	if (PlayerId.IsEmpty())
+	if (FSQLitePreparedStatement** Found = StatementCache.Find(SQL))
 	{
-		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ LoadPlayerStash: PlayerId가 비어있음 — 중단"));
-		return TArray<FInv_SavedItemData>();
+		FSQLitePreparedStatement* Stmt = *Found;
+		Stmt->Reset();
+		Stmt->ClearBindings();
+		return Stmt;
 	}
 
-	if (!IsDatabaseReady())
+	FSQLitePreparedStatement* Stmt = new FSQLitePreparedStatement(*Database, *SQL, ESQLitePreparedStatementFlags::Persistent);
+	if (!Stmt->IsValid())
 	{
-		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ LoadPlayerStash: DB가 준비되지 않음"));
-		return TArray<FInv_SavedItemData>();
+		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ GetCachedStatement: Prepare 실패 | 에러: %s | SQL: %s"), *Database->GetLastError(), *SQL);
+		delete Stmt;
+		return nullptr;
 	}
 
-	// SELECT 쿼리 준비 (?1 = player_id 파라미터 바인딩)
-	const TCHAR* SelectSQL = TEXT(
-		"SELECT item_type, stack_count, grid_position_x, grid_position_y, "
-		"grid_category, is_equipped, weapon_slot, serialized_manifest, attachments_json "
-		"FROM player_stash WHERE player_id = ?1;"
-	);
+	StatementCache.Add(SQL, Stmt);
+	return Stmt;
+}
 
-	FSQLitePreparedStatement SelectStmt = Database->PrepareStatement(SelectSQL);
+void UHellunaSQLiteSubsystem::ResetStatementCache()
+{
+	if (StatementCache.Num() > 0)
+	{
+		UE_LOG(LogHelluna, Verbose, TEXT("[SQLite] Statement 캐시 해제 | %d개"), StatementCache.Num());
+	}
+
+	for (TPair<FString, FSQLitePreparedStatement*>& Pair : StatementCache)
+	{
+		// 연결이 닫히기 전에 finalize 해야 Close()가 SQLITE_BUSY로 실패하지 않음
+		Pair.Value->Destroy();
+		delete Pair.Value;
+	}
+	StatementCache.Reset();
+}
+
+// ──────────────────────────────────────────────────────────────
+// InsertItemRows — 다중 행 INSERT 배치
+// ──────────────────────────────────────────────────────────────
+bool UHellunaSQLiteSubsystem::InsertItemRows(const TCHAR* Table, const FString& PlayerId, TConstArrayView<const FItemRow*> Rows, const TCHAR* Context)
+{
+	int32 Offset = 0;
+	while (Offset < Rows.Num())
+	{
+		const int32 BatchRows = GetItemBatchSize(Rows.Num() - Offset);
+		const FString InsertSQL = FString::Printf(TEXT("INSERT INTO %s (%s) VALUES %s;"),
+			Table, ItemColumnList, *BuildPlaceholderGroups(BatchRows, ItemColumnCount));
+
+		FSQLitePreparedStatement* InsertStmt = GetCachedStatement(InsertSQL);
+		if (InsertStmt == nullptr)
+		{
+			UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ %s: %s INSERT Prepare 실패"), Context, Table);
+			return false;
+		}
+
+		for (int32 r = 0; r < BatchRows; ++r)
+		{
+			Rows[Offset + r]->Bind(*InsertStmt, r * ItemColumnCount + 1, PlayerId);
+		}
+
+		const bool bOk = InsertStmt->Execute();
+		InsertStmt->Reset();
+		if (!bOk)
+		{
+			UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ %s: %s INSERT 실패 (행 %d~%d) | 에러: %s"),
+				Context, Table, Offset, Offset + BatchRows - 1, *Database->GetLastError());
+			return false;
+		}
+
+		Offset += BatchRows;
+	}
+	return true;
+}
+
+// ──────────────────────────────────────────────────────────────
+// WriteItemRowsDiff — 변경된 행만 기록
+// ──────────────────────────────────────────────────────────────
+// 1. 기존 행 SELECT (id 포함)
+// 2. 해시 → 컬럼 값 비교로 1:1 매칭 (같은 아이템 여러 개도 개수만큼 매칭)
+//    레거시 JSON 행은 매칭 제외 → 항상 다시 기록 (attachments_json = NULL로 정리)
+// 3. 매칭 안 된 기존 행 DELETE, 매칭 안 된 새 행 INSERT
+//    (기존 행이 하나도 안 남으면 player_id 단위 DELETE 한 번)
+// ──────────────────────────────────────────────────────────────
+bool UHellunaSQLiteSubsystem::WriteItemRowsDiff(const TCHAR* Table, const FString& PlayerId, const TArray<FInv_SavedItemData>& Items, const TCHAR* Context)
+{
+	// (1) 기존 행
+	TArray<int64> OldIds;
+	TArray<FItemRow> OldRows;
+	{
+		FSQLitePreparedStatement* SelectStmt = GetCachedStatement(FString::Printf(
+			TEXT("SELECT id, item_type, stack_count, grid_position_x, grid_position_y, grid_category, "
+				"is_equipped, weapon_slot, serialized_manifest, attachments_blob, attachments_json FROM %s WHERE player_id = ?1;"), Table));
+		if (SelectStmt == nullptr)
+		{
+			UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ %s: %s SELECT Prepare 실패"), Context, Table);
+			return false;
+		}
+
+		SelectStmt->SetBindingValueByIndex(1, PlayerId);
+		const int64 NumRows = SelectStmt->Execute([&OldIds, &OldRows](const FSQLitePreparedStatement& Stmt) -> ESQLitePreparedStatementExecuteRowResult
+		{
+			int64 Id = 0;
+			Stmt.GetColumnValueByIndex(0, Id);
+			OldIds.Add(Id);
+			FItemRow& Row = OldRows.Add_GetRef(FItemRow::FromStatement(Stmt, 1));
+
+			// BLOB이 비어있고 JSON이 남아있으면 로드 시 JSON 부착물이 복원됨
+			// → 부착물 없는 새 행과 "같다"고 보면 안 됨
+			if (Row.AttachmentsBlob.Num() == 0)
+			{
+				FString LegacyJson;
+				Stmt.GetColumnValueByIndex(10, LegacyJson); // NULL → 빈 문자열
+				Row.bLegacyAttachmentsJson = !LegacyJson.IsEmpty();
+			}
+			return ESQLitePreparedStatementExecuteRowResult::Continue;
+		});
+		SelectStmt->Reset();
+
+		if (NumRows == INDEX_NONE)
+		{
+			UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ %s: %s SELECT 실패 | 에러: %s"), Context, Table, *Database->GetLastError());
+			return false;
+		}
+	}
+
+	// (2) 매칭
+	TMultiMap<uint32, int32> OldByHash;
+	OldByHash.Reserve(OldRows.Num());
+	for (int32 i = 0; i < OldRows.Num(); ++i)
+	{
+		if (!OldRows[i].bLegacyAttachmentsJson)
+		{
+			OldByHash.Add(OldRows[i].Hash, i);
+		}
+	}
+
+	TBitArray<> OldMatched(false, OldRows.Num());
+	TArray<FItemRow> NewRows;
+	NewRows.Reserve(Items.Num());
+	TArray<const FItemRow*> RowsToInsert;
+
+	for (const FInv_SavedItemData& Item : Items)
+	{
+		FItemRow& Row = NewRows.Add_GetRef(FItemRow::FromItem(Item));
+
+		bool bMatched = false;
+		for (auto It = OldByHash.CreateKeyIterator(Row.Hash); It; ++It)
+		{
+			const int32 OldIndex = It.Value();
+			if (OldRows[OldIndex].Equals(Row))
+			{
+				OldMatched[OldIndex] = true;
+				It.RemoveCurrent();
+				bMatched = true;
+				break;
+			}
+		}
+
+		if (!bMatched)
+		{
+			RowsToInsert.Add(&Row);
+		}
+	}
+
+	TArray<int64> IdsToDelete;
+	for (int32 i = 0; i < OldRows.Num(); ++i)
+	{
+		if (!OldMatched[i])
+		{
+			IdsToDelete.Add(OldIds[i]);
+		}
+	}
+
+	// (3-a) DELETE
+	if (IdsToDelete.Num() > 0 && IdsToDelete.Num() == OldRows.Num())
+	{
+		FSQLitePreparedStatement* DeleteStmt = GetCachedStatement(FString::Printf(TEXT("DELETE FROM %s WHERE player_id = ?1;"), Table));
+		if (DeleteStmt == nullptr)
+		{
+			return false;
+		}
+		DeleteStmt->SetBindingValueByIndex(1, PlayerId);
+		const bool bOk = DeleteStmt->Execute();
+		DeleteStmt->Reset();
+		if (!bOk)
+		{
+			UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ %s: %s DELETE 실패 | 에러: %s"), Context, Table, *Database->GetLastError());
+			return false;
+		}
+	}
+	else
+	{
+		int32 Offset = 0;
+		while (Offset < IdsToDelete.Num())
+		{
+			const int32 BatchRows = GetItemBatchSize(IdsToDelete.Num() - Offset);
+			FSQLitePreparedStatement* DeleteStmt = GetCachedStatement(FString::Printf(TEXT("DELETE FROM %s WHERE id IN %s;"),
+				Table, *BuildPlaceholderGroups(1, BatchRows)));
+			if (DeleteStmt == nullptr)
+			{
+				return false;
+			}
+
+			for (int32 r = 0; r < BatchRows; ++r)
+			{
+				DeleteStmt->SetBindingValueByIndex(r + 1, IdsToDelete[Offset + r]);
+			}
+
+			const bool bOk = DeleteStmt->Execute();
+			DeleteStmt->Reset();
+			if (!bOk)
+			{
+				UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ %s: %s DELETE(id) 실패 | 에러: %s"), Context, Table, *Database->GetLastError());
+				return false;
+			}
+			Offset += BatchRows;
+		}
+	}
+
+	// (3-b) INSERT
+	if (!InsertItemRows(Table, PlayerId, RowsToInsert, Context))
+	{
+		return false;
+	}
+
+	UE_LOG(LogHelluna, Log, TEXT("[SQLite]   %s: %s Diff | 유지 %d, 삭제 %d, 추가 %d"),
+		Context, Table, OldRows.Num() - IdsToDelete.Num(), IdsToDelete.Num(), RowsToInsert.Num());
+	return true;
+}
+
+
+// ════════════════════════════════════════════════════════════════════════════════
+// IInventoryDatabase — Stash(창고) CRUD 구현
+// ════════════════════════════════════════════════════════════════════════════════
+
+// ──────────────────────────────────────────────────────────────
+// QueryItemRows — 아이템 SELECT 공통 실행
+// ──────────────────────────────────────────────────────────────
+// 동기 로드(Database)와 [DBAsyncV1] 비동기 읽기(ReadDatabase)가 공유.
+// static이므로 멤버 상태에 접근하지 않음 → 어느 스레드에서든 호출 가능
+// (단, 같은 연결을 동시에 쓰지 않도록 호출자가 잠금 보장)
+// ──────────────────────────────────────────────────────────────
+TArray<FInv_SavedItemData> UHellunaSQLiteSubsystem::QueryItemRows(FSQLiteDatabase& Db, const TCHAR* SelectSQL, const FString& PlayerId, const TCHAR* Context)
+{
+	FSQLitePreparedStatement SelectStmt = Db.PrepareStatement(SelectSQL);
 	if (!SelectStmt.IsValid())
 	{
-		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ LoadPlayerStash: PrepareStatement 실패 | 에러: %s"), *Database->GetLastError());
+		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ %s: PrepareStatement 실패 | 에러: %s"), Context, *Db.GetLastError());
 		return TArray<FInv_SavedItemData>();
 	}
 
+	return ExecuteItemQuery(SelectStmt, PlayerId, Context);
+}
+
+TArray<FInv_SavedItemData> UHellunaSQLiteSubsystem::ExecuteItemQuery(FSQLitePreparedStatement& SelectStmt, const FString& PlayerId, const TCHAR* Context)
+{
 	// ?1에 PlayerId 바인딩
 	SelectStmt.SetBindingValueByIndex(1, PlayerId);
 
@@ -1508,7 +2596,7 @@ TArray<FInv_SavedItemData> UHellunaSQLiteSubsystem::LoadPlayerStash(const FStrin
 	TArray<FInv_SavedItemData> Result;
 	int32 TotalRows = 0;
 	int32 InvalidRows = 0;
-	SelectStmt.Execute([&Result, &TotalRows, &InvalidRows](const FSQLitePreparedStatement& Stmt) -> ESQLitePreparedStatementExecuteRowResult
+	SelectStmt.Execute([&Result, &TotalRows, &InvalidRows, Context](const FSQLitePreparedStatement& Stmt) -> ESQLitePreparedStatementExecuteRowResult
 	{
 		FInv_SavedItemData Item = ParseRowToSavedItem(Stmt);
 		TotalRows++;
@@ -1519,17 +2607,55 @@ TArray<FInv_SavedItemData> UHellunaSQLiteSubsystem::LoadPlayerStash(const FStrin
 		else
 		{
 			InvalidRows++;
-			UE_LOG(LogHelluna, Warning, TEXT("[SQLite] LoadPlayerStash: IsValid() 실패한 행 발견! | ItemType=%s | Stack=%d | (행 %d)"),
-				*Item.ItemType.ToString(), Item.StackCount, TotalRows);
+			UE_LOG(LogHelluna, Warning, TEXT("[SQLite] %s: IsValid() 실패한 행 발견! | ItemType=%s | Stack=%d | (행 %d)"),
+				Context, *Item.ItemType.ToString(), Item.StackCount, TotalRows);
 		}
 		return ESQLitePreparedStatementExecuteRowResult::Continue;  // 다음 행 계속
 	});
 
 	if (InvalidRows > 0)
 	{
-		UE_LOG(LogHelluna, Warning, TEXT("[SQLite] LoadPlayerStash: %d/%d 행이 IsValid() 실패 → 무시됨"), InvalidRows, TotalRows);
+		UE_LOG(LogHelluna, Warning, TEXT("[SQLite] %s: %d/%d 행이 IsValid() 실패 → 무시됨"), Context, InvalidRows, TotalRows);
+	}
+
+	// 캐시된 Statement일 수 있으므로 읽기 잠금 즉시 해제
+	SelectStmt.Reset();
+	return Result;
+}
+
+// ──────────────────────────────────────────────────────────────
+// LoadPlayerStash — 창고 아이템 전체 로드
+// ──────────────────────────────────────────────────────────────
+// SQL: SELECT * FROM player_stash WHERE player_id = ?
+// → 각 행을 ParseRowToSavedItem으로 변환
+// → TArray<FInv_SavedItemData> 반환
+//
+// 호출 시점:
+//   - HellunaBaseGameMode::LoadAndSendInventoryToClient()
+//   - 디버그 콘솔: Helluna.SQLite.DebugLoad
+// ──────────────────────────────────────────────────────────────
+TArray<FInv_SavedItemData> UHellunaSQLiteSubsystem::LoadPlayerStash(const FString& PlayerId)
+{
+	UE_LOG(LogHelluna, Log, TEXT("[SQLite] ▶ LoadPlayerStash | PlayerId=%s"), *PlayerId);
+
+
+	if (PlayerId.IsEmpty())
+	{
+		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ LoadPlayerStash: PlayerId가 비어있음 — 중단"));
+		return TArray<FInv_SavedItemData>();
+	}
+
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
+	if (!IsDatabaseReady())
+	{
+		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ LoadPlayerStash: DB가 준비되지 않음"));
+		return TArray<FInv_SavedItemData>();
 	}
 
+	FSQLitePreparedStatement* SelectStmt = GetCachedStatement(StashSelectSQL);
+	TArray<FInv_SavedItemData> Result = SelectStmt ? ExecuteItemQuery(*SelectStmt, PlayerId, TEXT("LoadPlayerStash")) : TArray<FInv_SavedItemData>();
+
 	UE_LOG(LogHelluna, Log, TEXT("[SQLite] ✓ LoadPlayerStash 완료 | PlayerId=%s | 아이템 %d개"), *PlayerId, Result.Num());
 	return Result;
 }
@@ -1539,9 +2665,8 @@ TArray<FInv_SavedItemData> UHellunaSQLiteSubsystem::LoadPlayerStash(const FStrin
 // ──────────────────────────────────────────────────────────────
 // 내부 처리 (하나의 트랜잭션):
 //   1. BEGIN TRANSACTION
-//   2. DELETE FROM player_stash WHERE player_id = ?  (기존 전부 삭제)
-//   3. INSERT INTO player_stash ... (Items 각각 INSERT)
-//   4. COMMIT (또는 실패 시 ROLLBACK)
+//   2. [StmtCacheV1] WriteItemRowsDiff — 기존 행과 비교해 바뀐 행만 DELETE / 다중 행 INSERT
+//   3. COMMIT (또는 실패 시 ROLLBACK)
 //
 // Items가 빈 배열이면 DELETE만 수행됨 = 창고 비우기
 //
@@ -1549,9 +2674,8 @@ TArray<FInv_SavedItemData> UHellunaSQLiteSubsystem::LoadPlayerStash(const FStrin
 //   - HellunaBaseGameMode::SaveCollectedItems()
 //   - 디버그 콘솔: Helluna.SQLite.DebugSave
 //
-// Persistent Statement:
-//   반복 INSERT에 ESQLitePreparedStatementFlags::Persistent 사용
-//   → SQLite가 쿼리 계획을 캐시하여 반복 실행 시 성능 향상
+// Statement 캐시:
+//   SELECT/DELETE/INSERT는 StatementCache에서 재사용 (연결당 1회 컴파일)
 // ──────────────────────────────────────────────────────────────
 bool UHellunaSQLiteSubsystem::SavePlayerStash(const FString& PlayerId, const TArray<FInv_SavedItemData>& Items)
 {
@@ -1563,6 +2687,8 @@ bool UHellunaSQLiteSubsystem::SavePlayerStash(const FString& PlayerId, const TAr
 		return false;
 	}
 
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ SavePlayerStash: DB가 준비되지 않음"));
@@ -1579,97 +2705,15 @@ bool UHellunaSQLiteSubsystem::SavePlayerStash(const FString& PlayerId, const TAr
 	}
 	UE_LOG(LogHelluna, Verbose, TEXT("[SQLite]   BEGIN IMMEDIATE TRANSACTION ✓"));
 
-	// (1) 기존 Stash 전부 삭제
-	{
-		FSQLitePreparedStatement DeleteStmt = Database->PrepareStatement(
-			TEXT("DELETE FROM player_stash WHERE player_id = ?1;"));
-		if (!DeleteStmt.IsValid())
-		{
-			UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ SavePlayerStash: DELETE Prepare 실패 | 에러: %s"), *Database->GetLastError());
-			if (!Database->Execute(TEXT("ROLLBACK;"))) { UE_LOG(LogHelluna, Error, TEXT("[SQLite] ROLLBACK 실패 | 에러: %s"), *Database->GetLastError()); }
-			return false;
-		}
-		DeleteStmt.SetBindingValueByIndex(1, PlayerId);
-		if (!DeleteStmt.Execute())
-		{
-			UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ SavePlayerStash: DELETE 실패 — ROLLBACK | 에러: %s"), *Database->GetLastError());
-			if (!Database->Execute(TEXT("ROLLBACK;"))) { UE_LOG(LogHelluna, Error, TEXT("[SQLite] ROLLBACK 실패 | 에러: %s"), *Database->GetLastError()); }
-			return false;
-		}
-		UE_LOG(LogHelluna, Verbose, TEXT("[SQLite]   DELETE old stash ✓"));
-	}
-
-	// (2) 새 아이템 INSERT (배치)
-	if (Items.Num() > 0)
+	// (1) [StmtCacheV1] 기존 행과 비교 → 바뀐 행만 DELETE/INSERT
+	if (!WriteItemRowsDiff(TEXT("player_stash"), PlayerId, Items, TEXT("SavePlayerStash")))
 	{
-		const TCHAR* InsertSQL = TEXT(
-			"INSERT INTO player_stash "
-			"(player_id, item_type, stack_count, grid_position_x, grid_position_y, "
-			"grid_category, is_equipped, weapon_slot, serialized_manifest, attachments_json) "
-			"VALUES (?1, ?2, ?3, ?4, ?5, ?6, ?7, ?8, ?9, ?10);"
-		);
-
-		// Persistent: 반복 INSERT 시 쿼리 계획 캐시
-		FSQLitePreparedStatement InsertStmt = Database->PrepareStatement(InsertSQL, ESQLitePreparedStatementFlags::Persistent);
-		if (!InsertStmt.IsValid())
-		{
-			UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ SavePlayerStash: INSERT Prepare 실패 — ROLLBACK | 에러: %s"), *Database->GetLastError());
-			if (!Database->Execute(TEXT("ROLLBACK;"))) { UE_LOG(LogHelluna, Error, TEXT("[SQLite] ROLLBACK 실패 | 에러: %s"), *Database->GetLastError()); }
-			return false;
-		}
-
-		for (int32 i = 0; i < Items.Num(); ++i)
-		{
-			const FInv_SavedItemData& Item = Items[i];
-
-			// 10개 파라미터 바인딩 (?1 ~ ?10)
-			InsertStmt.SetBindingValueByIndex(1, PlayerId);                                   // ?1: player_id
-			InsertStmt.SetBindingValueByIndex(2, Item.ItemType.ToString());                   // ?2: item_type
-			InsertStmt.SetBindingValueByIndex(3, Item.StackCount);                            // ?3: stack_count
-			InsertStmt.SetBindingValueByIndex(4, Item.GridPosition.X);                        // ?4: grid_position_x
-			InsertStmt.SetBindingValueByIndex(5, Item.GridPosition.Y);                        // ?5: grid_position_y
-			InsertStmt.SetBindingValueByIndex(6, static_cast<int32>(Item.GridCategory));       // ?6: grid_category
-			InsertStmt.SetBindingValueByIndex(7, Item.bEquipped ? 1 : 0);                     // ?7: is_equipped
-			InsertStmt.SetBindingValueByIndex(8, Item.WeaponSlotIndex);                       // ?8: weapon_slot
-
-			// ?9: serialized_manifest (BLOB — 있을 때만, 없으면 NULL)
-			if (Item.SerializedManifest.Num() > 0)
-			{
-				InsertStmt.SetBindingValueByIndex(9, TArrayView<const uint8>(Item.SerializedManifest), true);
-			}
-			else
-			{
-				InsertStmt.SetBindingValueByIndex(9); // NULL 바인딩
-			}
-
-			// ?10: attachments_json (JSON 문자열 — 부착물 목록)
-			const FString AttJson = SerializeAttachmentsToJson(Item.Attachments);
-			if (AttJson.IsEmpty())
-			{
-				InsertStmt.SetBindingValueByIndex(10, TEXT(""));
-			}
-			else
-			{
-				InsertStmt.SetBindingValueByIndex(10, AttJson);
-			}
-
-			if (!InsertStmt.Execute())
-			{
-				UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ SavePlayerStash: INSERT[%d] 실패 — ROLLBACK | 아이템=%s | 에러: %s"),
-					i, *Item.ItemType.ToString(), *Database->GetLastError());
-				if (!Database->Execute(TEXT("ROLLBACK;"))) { UE_LOG(LogHelluna, Error, TEXT("[SQLite] ROLLBACK 실패 | 에러: %s"), *Database->GetLastError()); }
-				return false;
-			}
-
-			// Reset + ClearBindings: 다음 행 INSERT 준비
-			// (Persistent Statement는 재사용해야 하므로 Reset 필수)
-			InsertStmt.Reset();
-			InsertStmt.ClearBindings();
-		}
-		UE_LOG(LogHelluna, Verbose, TEXT("[SQLite]   INSERT %d개 ✓"), Items.Num());
+		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ SavePlayerStash: Stash 기록 실패 — ROLLBACK"));
+		if (!Database->Execute(TEXT("ROLLBACK;"))) { UE_LOG(LogHelluna, Error, TEXT("[SQLite] ROLLBACK 실패 | 에러: %s"), *Database->GetLastError()); }
+		return false;
 	}
 
-	// (3) 커밋
+	// (2) 커밋
 	if (!Database->Execute(TEXT("COMMIT;")))
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ SavePlayerStash: COMMIT 실패 — ROLLBACK | 에러: %s"), *Database->GetLastError());
@@ -1694,6 +2738,8 @@ bool UHellunaSQLiteSubsystem::SaveStashAndLoadoutAtomic(
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ SaveStashAndLoadoutAtomic: PlayerId 비어있음 — 중단"));
 		return false;
 	}
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ SaveStashAndLoadoutAtomic: DB 미준비"));
@@ -1714,70 +2760,14 @@ bool UHellunaSQLiteSubsystem::SaveStashAndLoadoutAtomic(
 		return false;
 	};
 
-	// player_stash/player_loadout 공통 10컬럼 바인딩
-	auto BindItem = [](FSQLitePreparedStatement& Stmt, const FString& Pid, const FInv_SavedItemData& Item, const FString& AttJson)
-	{
-		Stmt.SetBindingValueByIndex(1, Pid);
-		Stmt.SetBindingValueByIndex(2, Item.ItemType.ToString());
-		Stmt.SetBindingValueByIndex(3, Item.StackCount);
-		Stmt.SetBindingValueByIndex(4, Item.GridPosition.X);
-		Stmt.SetBindingValueByIndex(5, Item.GridPosition.Y);
-		Stmt.SetBindingValueByIndex(6, static_cast<int32>(Item.GridCategory));
-		Stmt.SetBindingValueByIndex(7, Item.bEquipped ? 1 : 0);
-		Stmt.SetBindingValueByIndex(8, Item.WeaponSlotIndex);
-		if (Item.SerializedManifest.Num() > 0)
-		{
-			Stmt.SetBindingValueByIndex(9, TArrayView<const uint8>(Item.SerializedManifest), true);
-		}
-		else
-		{
-			Stmt.SetBindingValueByIndex(9);
-		}
-		Stmt.SetBindingValueByIndex(10, AttJson.IsEmpty() ? FString(TEXT("")) : AttJson);
-	};
-
-	// ── player_stash: DELETE 후 INSERT ──
-	{
-		FSQLitePreparedStatement Del = Database->PrepareStatement(TEXT("DELETE FROM player_stash WHERE player_id = ?1;"));
-		if (!Del.IsValid()) { return Fail(TEXT("stash DELETE prepare")); }
-		Del.SetBindingValueByIndex(1, PlayerId);
-		if (!Del.Execute()) { return Fail(TEXT("stash DELETE")); }
-	}
-	if (StashItems.Num() > 0)
-	{
-		FSQLitePreparedStatement Ins = Database->PrepareStatement(
-			TEXT("INSERT INTO player_stash (player_id, item_type, stack_count, grid_position_x, grid_position_y, grid_category, is_equipped, weapon_slot, serialized_manifest, attachments_json) VALUES (?1, ?2, ?3, ?4, ?5, ?6, ?7, ?8, ?9, ?10);"),
-			ESQLitePreparedStatementFlags::Persistent);
-		if (!Ins.IsValid()) { return Fail(TEXT("stash INSERT prepare")); }
-		for (const FInv_SavedItemData& Item : StashItems)
-		{
-			BindItem(Ins, PlayerId, Item, SerializeAttachmentsToJson(Item.Attachments));
-			if (!Ins.Execute()) { return Fail(TEXT("stash INSERT")); }
-			Ins.Reset();
-			Ins.ClearBindings();
-		}
-	}
-
-	// ── player_loadout: DELETE 후 INSERT ──
+	// ── [StmtCacheV1] 두 테이블 모두 바뀐 행만 기록 ──
+	if (!WriteItemRowsDiff(TEXT("player_stash"), PlayerId, StashItems, TEXT("SaveStashAndLoadoutAtomic")))
 	{
-		FSQLitePreparedStatement Del = Database->PrepareStatement(TEXT("DELETE FROM player_loadout WHERE player_id = ?1;"));
-		if (!Del.IsValid()) { return Fail(TEXT("loadout DELETE prepare")); }
-		Del.SetBindingValueByIndex(1, PlayerId);
-		if (!Del.Execute()) { return Fail(TEXT("loadout DELETE")); }
+		return Fail(TEXT("stash write"));
 	}
-	if (LoadoutItems.Num() > 0)
+	if (!WriteItemRowsDiff(TEXT("player_loadout"), PlayerId, LoadoutItems, TEXT("SaveStashAndLoadoutAtomic")))
 	{
-		FSQLitePreparedStatement Ins = Database->PrepareStatement(
-			TEXT("INSERT INTO player_loadout (player_id, item_type, stack_count, grid_position_x, grid_position_y, grid_category, is_equipped, weapon_slot, serialized_manifest, attachments_json) VALUES (?1, ?2, ?3, ?4, ?5, ?6, ?7, ?8, ?9, ?10);"),
-			ESQLitePreparedStatementFlags::Persistent);
-		if (!Ins.IsValid()) { return Fail(TEXT("loadout INSERT prepare")); }
-		for (const FInv_SavedItemData& Item : LoadoutItems)
-		{
-			BindItem(Ins, PlayerId, Item, SerializeAttachmentsToJson(Item.Attachments));
-			if (!Ins.Execute()) { return Fail(TEXT("loadout INSERT")); }
-			Ins.Reset();
-			Ins.ClearBindings();
-		}
+		return Fail(TEXT("loadout write"));
 	}
 
 	if (!Database->Execute(TEXT("COMMIT;")))
@@ -1806,6 +2796,8 @@ bool UHellunaSQLiteSubsystem::IsPlayerExists(const FString& PlayerId)
 		return false;
 	}
 
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ IsPlayerExists: DB가 준비되지 않음 | PlayerId=%s"), *PlayerId);
@@ -1860,38 +2852,16 @@ TArray<FInv_SavedItemData> UHellunaSQLiteSubsystem::LoadPlayerLoadout(const FStr
 		return TArray<FInv_SavedItemData>();
 	}
 
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ LoadPlayerLoadout: DB가 준비되지 않음"));
 		return TArray<FInv_SavedItemData>();
 	}
 
-	// [Fix14] is_equipped 컬럼 포함하여 장착 상태 보존
-	const TCHAR* SelectSQL = TEXT(
-		"SELECT item_type, stack_count, grid_position_x, grid_position_y, "
-		"grid_category, is_equipped, weapon_slot, serialized_manifest, attachments_json "
-		"FROM player_loadout WHERE player_id = ?1;"
-	);
-
-	FSQLitePreparedStatement SelectStmt = Database->PrepareStatement(SelectSQL);
-	if (!SelectStmt.IsValid())
-	{
-		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ LoadPlayerLoadout: PrepareStatement 실패 | 에러: %s"), *Database->GetLastError());
-		return TArray<FInv_SavedItemData>();
-	}
-
-	SelectStmt.SetBindingValueByIndex(1, PlayerId);
-
-	TArray<FInv_SavedItemData> Result;
-	SelectStmt.Execute([&Result](const FSQLitePreparedStatement& Stmt) -> ESQLitePreparedStatementExecuteRowResult
-	{
-		FInv_SavedItemData Item = ParseRowToSavedItem(Stmt);
-		if (Item.IsValid())
-		{
-			Result.Add(MoveTemp(Item));
-		}
-		return ESQLitePreparedStatementExecuteRowResult::Continue;
-	});
+	FSQLitePreparedStatement* SelectStmt = GetCachedStatement(LoadoutSelectSQL);
+	TArray<FInv_SavedItemData> Result = SelectStmt ? ExecuteItemQuery(*SelectStmt, PlayerId, TEXT("LoadPlayerLoadout")) : TArray<FInv_SavedItemData>();
 
 	UE_LOG(LogHelluna, Log, TEXT("[SQLite] ✓ LoadPlayerLoadout 완료 | PlayerId=%s | 아이템 %d개"), *PlayerId, Result.Num());
 	return Result;
@@ -1906,9 +2876,9 @@ TArray<FInv_SavedItemData> UHellunaSQLiteSubsystem::LoadPlayerLoadout(const FStr
 //
 // 내부 처리 (하나의 트랜잭션):
 //   1. BEGIN TRANSACTION
-//   2. Loadout INSERT (10개 바인딩 — [Fix14] is_equipped 포함)
-//   3. Stash DELETE (해당 플레이어 전체)
-//   4. COMMIT (또는 ROLLBACK)
+//   2. Loadout 교체 (10컬럼 — [Fix14] is_equipped 포함, [StmtCacheV1] 바뀐 행만)
+//   3. COMMIT (또는 ROLLBACK)
+//   ※ Stash는 건드리지 않음 (아래 [Fix] 참고)
 //
 // TODO: [SQL전환] 부분 차감이 필요하면 (3)의 전체 DELETE를 개별 아이템 DELETE로 교체
 //
@@ -1940,6 +2910,8 @@ bool UHellunaSQLiteSubsystem::SavePlayerLoadout(const FString& PlayerId, const T
 		return false;
 	}
 
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ SavePlayerLoadout: DB가 준비되지 않음"));
@@ -1960,84 +2932,19 @@ bool UHellunaSQLiteSubsystem::SavePlayerLoadout(const FString& PlayerId, const T
 	}
 	UE_LOG(LogHelluna, Verbose, TEXT("[SQLite]   BEGIN IMMEDIATE TRANSACTION ✓"));
 
-	// (0) 기존 Loadout 삭제 (중복 방지 — 더블 클릭 등)
-	{
-		FSQLitePreparedStatement DeleteOldLoadout = Database->PrepareStatement(
-			TEXT("DELETE FROM player_loadout WHERE player_id = ?1;"));
-		if (DeleteOldLoadout.IsValid())
-		{
-			DeleteOldLoadout.SetBindingValueByIndex(1, PlayerId);
-			DeleteOldLoadout.Execute();
-		}
-		UE_LOG(LogHelluna, Verbose, TEXT("[SQLite]   DELETE old loadout ✓"));
-	}
-
-	// (a) player_loadout에 Items INSERT
-	//     [Fix14] is_equipped 컬럼 추가 → 10개 바인딩 (?1~?10)
+	// (a) player_loadout을 Items 상태로 교체
+	//     [Fix14] is_equipped 포함 10컬럼
+	//     [StmtCacheV1] 기존 Loadout(더블 클릭 등)과 비교 → 바뀐 행만 DELETE/INSERT
 	UE_LOG(LogHelluna, Log, TEXT("[SQLite] SavePlayerLoadout detail | PlayerId=%s | Grid=%d | Equipped=%d | Attachments=%d"),
 		*PlayerId, GridCount, EquippedCount, AttachmentCount);
 
-	const TCHAR* InsertSQL = TEXT(
-		"INSERT INTO player_loadout "
-		"(player_id, item_type, stack_count, grid_position_x, grid_position_y, "
-		"grid_category, is_equipped, weapon_slot, serialized_manifest, attachments_json) "
-		"VALUES (?1, ?2, ?3, ?4, ?5, ?6, ?7, ?8, ?9, ?10);"
-	);
-
-	FSQLitePreparedStatement InsertStmt = Database->PrepareStatement(InsertSQL, ESQLitePreparedStatementFlags::Persistent);
-	if (!InsertStmt.IsValid())
+	if (!WriteItemRowsDiff(TEXT("player_loadout"), PlayerId, Items, TEXT("SavePlayerLoadout")))
 	{
-		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ SavePlayerLoadout: INSERT Prepare 실패 — ROLLBACK | 에러: %s"), *Database->GetLastError());
+		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ SavePlayerLoadout: Loadout 기록 실패 — ROLLBACK"));
 		if (!Database->Execute(TEXT("ROLLBACK;"))) { UE_LOG(LogHelluna, Error, TEXT("[SQLite] ROLLBACK 실패 | 에러: %s"), *Database->GetLastError()); }
 		return false;
 	}
-
-	for (int32 i = 0; i < Items.Num(); ++i)
-	{
-		const FInv_SavedItemData& Item = Items[i];
-
-		InsertStmt.SetBindingValueByIndex(1, PlayerId);                                   // ?1: player_id
-		InsertStmt.SetBindingValueByIndex(2, Item.ItemType.ToString());                   // ?2: item_type
-		InsertStmt.SetBindingValueByIndex(3, Item.StackCount);                            // ?3: stack_count
-		InsertStmt.SetBindingValueByIndex(4, Item.GridPosition.X);                        // ?4: grid_position_x
-		InsertStmt.SetBindingValueByIndex(5, Item.GridPosition.Y);                        // ?5: grid_position_y
-		InsertStmt.SetBindingValueByIndex(6, static_cast<int32>(Item.GridCategory));       // ?6: grid_category
-		InsertStmt.SetBindingValueByIndex(7, Item.bEquipped ? 1 : 0);                    // ?7: is_equipped [Fix14]
-		InsertStmt.SetBindingValueByIndex(8, Item.WeaponSlotIndex);                       // ?8: weapon_slot
-
-		// ?9: serialized_manifest (BLOB)
-		if (Item.SerializedManifest.Num() > 0)
-		{
-			InsertStmt.SetBindingValueByIndex(9, TArrayView<const uint8>(Item.SerializedManifest), true);
-		}
-		else
-		{
-			InsertStmt.SetBindingValueByIndex(9); // NULL
-		}
-
-		// ?10: attachments_json
-		const FString AttJson = SerializeAttachmentsToJson(Item.Attachments);
-		if (AttJson.IsEmpty())
-		{
-			InsertStmt.SetBindingValueByIndex(10, TEXT(""));
-		}
-		else
-		{
-			InsertStmt.SetBindingValueByIndex(10, AttJson);
-		}
-
-		if (!InsertStmt.Execute())
-		{
-			UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ SavePlayerLoadout: Loadout INSERT[%d] 실패 — ROLLBACK | 아이템=%s | 에러: %s"),
-				i, *Item.ItemType.ToString(), *Database->GetLastError());
-			if (!Database->Execute(TEXT("ROLLBACK;"))) { UE_LOG(LogHelluna, Error, TEXT("[SQLite] ROLLBACK 실패 | 에러: %s"), *Database->GetLastError()); }
-			return false;
-		}
-
-		InsertStmt.Reset();
-		InsertStmt.ClearBindings();
-	}
-	UE_LOG(LogHelluna, Verbose, TEXT("[SQLite]   Loadout INSERT %d개 ✓"), Items.Num());
+	UE_LOG(LogHelluna, Verbose, TEXT("[SQLite]   Loadout 기록 %d개 ✓"), Items.Num());
 
 	// ⭐ [Fix] Stash DELETE 제거 — 잔여 Stash 보존
 	// 이전: SavePlayerLoadout 안에서 player_stash 전부 DELETE (비행기표 패턴)
@@ -2077,22 +2984,26 @@ bool UHellunaSQLiteSubsystem::DeletePlayerLoadout(const FString& PlayerId)
 		return false;
 	}
 
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ DeletePlayerLoadout: DB가 준비되지 않음"));
 		return false;
 	}
 
-	FSQLitePreparedStatement DeleteStmt = Database->PrepareStatement(
-		TEXT("DELETE FROM player_loadout WHERE player_id = ?1;"));
-	if (!DeleteStmt.IsValid())
+	// [StmtCacheV1] WriteItemRowsDiff의 전체 DELETE와 같은 SQL → 캐시 공유
+	FSQLitePreparedStatement* DeleteStmt = GetCachedStatement(TEXT("DELETE FROM player_loadout WHERE player_id = ?1;"));
+	if (DeleteStmt == nullptr)
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ DeletePlayerLoadout: PrepareStatement 실패 | 에러: %s"), *Database->GetLastError());
 		return false;
 	}
 
-	DeleteStmt.SetBindingValueByIndex(1, PlayerId);
-	if (!DeleteStmt.Execute())
+	DeleteStmt->SetBindingValueByIndex(1, PlayerId);
+	const bool bDeleted = DeleteStmt->Execute();
+	DeleteStmt->Reset();
+	if (!bDeleted)
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ DeletePlayerLoadout: DELETE 실패 | 에러: %s"), *Database->GetLastError());
 		return false;
@@ -2127,6 +3038,8 @@ bool UHellunaSQLiteSubsystem::MergeGameResultToStash(const FString& PlayerId, co
 		return false;
 	}
 
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ MergeGameResultToStash: DB가 준비되지 않음"));
@@ -2146,22 +3059,11 @@ bool UHellunaSQLiteSubsystem::MergeGameResultToStash(const FString& PlayerId, co
 		return false;
 	}
 
-	// Stash INSERT (기존 DELETE 없음 → 합산!)
-	const TCHAR* InsertSQL = TEXT(
-		"INSERT INTO player_stash "
-		"(player_id, item_type, stack_count, grid_position_x, grid_position_y, "
-		"grid_category, is_equipped, weapon_slot, serialized_manifest, attachments_json) "
-		"VALUES (?1, ?2, ?3, ?4, ?5, ?6, ?7, ?8, ?9, ?10);"
-	);
-
-	FSQLitePreparedStatement InsertStmt = Database->PrepareStatement(InsertSQL, ESQLitePreparedStatementFlags::Persistent);
-	if (!InsertStmt.IsValid())
-	{
-		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ MergeGameResultToStash: Prepare 실패 — ROLLBACK | 에러: %s"), *Database->GetLastError());
-		if (!Database->Execute(TEXT("ROLLBACK;"))) { UE_LOG(LogHelluna, Error, TEXT("[SQLite] ROLLBACK 실패 | 에러: %s"), *Database->GetLastError()); }
-		return false;
-	}
-
+	// Stash INSERT (기존 DELETE 없음 → 합산!) — [StmtCacheV1] 다중 행 배치
+	TArray<FItemRow> MergeRows;
+	MergeRows.Reserve(ResultItems.Num());
+	TArray<const FItemRow*> MergeRowPtrs;
+	MergeRowPtrs.Reserve(ResultItems.Num());
 	for (int32 i = 0; i < ResultItems.Num(); ++i)
 	{
 		const FInv_SavedItemData& Item = ResultItems[i];
@@ -2172,46 +3074,19 @@ bool UHellunaSQLiteSubsystem::MergeGameResultToStash(const FString& PlayerId, co
 			Item.bEquipped ? TEXT("Y") : TEXT("N"),
 			Item.GridPosition.X, Item.GridPosition.Y);
 
-		InsertStmt.SetBindingValueByIndex(1, PlayerId);
-		InsertStmt.SetBindingValueByIndex(2, Item.ItemType.ToString());
-		InsertStmt.SetBindingValueByIndex(3, Item.StackCount);
+		FItemRow& Row = MergeRows.Add_GetRef(FItemRow::FromItem(Item));
 		// ⭐ 게임 그리드 위치를 (-1,-1)로 리셋 — 게임/로비 그리드 사이즈가 다르므로
 		// 로비에서 HasRoomForItem → 2D 순회로 자동 배치되게 함
-		InsertStmt.SetBindingValueByIndex(4, -1);  // grid_position_x = -1 (미배치)
-		InsertStmt.SetBindingValueByIndex(5, -1);  // grid_position_y = -1 (미배치)
-		InsertStmt.SetBindingValueByIndex(6, static_cast<int32>(Item.GridCategory));
-		InsertStmt.SetBindingValueByIndex(7, Item.bEquipped ? 1 : 0);
-		InsertStmt.SetBindingValueByIndex(8, Item.WeaponSlotIndex);
-
-		if (Item.SerializedManifest.Num() > 0)
-		{
-			InsertStmt.SetBindingValueByIndex(9, TArrayView<const uint8>(Item.SerializedManifest), true);
-		}
-		else
-		{
-			InsertStmt.SetBindingValueByIndex(9); // NULL
-		}
-
-		const FString AttJson = SerializeAttachmentsToJson(Item.Attachments);
-		if (AttJson.IsEmpty())
-		{
-			InsertStmt.SetBindingValueByIndex(10, TEXT(""));
-		}
-		else
-		{
-			InsertStmt.SetBindingValueByIndex(10, AttJson);
-		}
-
-		if (!InsertStmt.Execute())
-		{
-			UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ MergeGameResultToStash: INSERT[%d] 실패 — ROLLBACK | 아이템=%s | 에러: %s"),
-				i, *Item.ItemType.ToString(), *Database->GetLastError());
-			if (!Database->Execute(TEXT("ROLLBACK;"))) { UE_LOG(LogHelluna, Error, TEXT("[SQLite] ROLLBACK 실패 | 에러: %s"), *Database->GetLastError()); }
-			return false;
-		}
+		Row.GridX = -1;
+		Row.GridY = -1;
+		MergeRowPtrs.Add(&Row);
+	}
 
-		InsertStmt.Reset();
-		InsertStmt.ClearBindings();
+	if (!InsertItemRows(TEXT("player_stash"), PlayerId, MergeRowPtrs, TEXT("MergeGameResultToStash")))
+	{
+		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ MergeGameResultToStash: INSERT 실패 — ROLLBACK"));
+		if (!Database->Execute(TEXT("ROLLBACK;"))) { UE_LOG(LogHelluna, Error, TEXT("[SQLite] ROLLBACK 실패 | 에러: %s"), *Database->GetLastError()); }
+		return false;
 	}
 
 	if (!Database->Execute(TEXT("COMMIT;")))
@@ -2259,6 +3134,8 @@ bool UHellunaSQLiteSubsystem::HasPendingLoadout(const FString& PlayerId)
 		return false;
 	}
 
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ HasPendingLoadout: DB가 준비되지 않음"));
@@ -2319,6 +3196,8 @@ bool UHellunaSQLiteSubsystem::RecoverFromCrash(const FString& PlayerId)
 		return false;
 	}
 
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ RecoverFromCrash: DB가 준비되지 않음"));
@@ -2333,12 +3212,8 @@ bool UHellunaSQLiteSubsystem::RecoverFromCrash(const FString& PlayerId)
 	}
 
 	// (a) player_loadout에서 잔존 아이템 SELECT
-	// [Fix26] is_equipped 컬럼 추가 (누락 시 장비 장착 상태 복원 불가)
-	const TCHAR* SelectSQL = TEXT(
-		"SELECT item_type, stack_count, grid_position_x, grid_position_y, "
-		"grid_category, is_equipped, weapon_slot, serialized_manifest, attachments_json "
-		"FROM player_loadout WHERE player_id = ?1;"
-	);
+	// [Fix26] is_equipped 컬럼 추가 (누락 시 장비 장착 상태 복원 불가) — LoadoutSelectSQL 공용
+	const TCHAR* SelectSQL = LoadoutSelectSQL;
 
 	FSQLitePreparedStatement SelectStmt = Database->PrepareStatement(SelectSQL);
 	if (!SelectStmt.IsValid())
@@ -2371,65 +3246,25 @@ bool UHellunaSQLiteSubsystem::RecoverFromCrash(const FString& PlayerId)
 		return true;
 	}
 
-	// (b) player_stash에 복구 INSERT (Stash로 돌려보냄)
-	const TCHAR* InsertSQL = TEXT(
-		"INSERT INTO player_stash "
-		"(player_id, item_type, stack_count, grid_position_x, grid_position_y, "
-		"grid_category, is_equipped, weapon_slot, serialized_manifest, attachments_json) "
-		"VALUES (?1, ?2, ?3, ?4, ?5, ?6, ?7, ?8, ?9, ?10);"
-	);
-
-	FSQLitePreparedStatement InsertStmt = Database->PrepareStatement(InsertSQL, ESQLitePreparedStatementFlags::Persistent);
-	if (!InsertStmt.IsValid())
+	// (b) player_stash에 복구 INSERT (Stash로 돌려보냄) — [StmtCacheV1] 다중 행 배치
+	TArray<FItemRow> RecoverRows;
+	RecoverRows.Reserve(LoadoutItems.Num());
+	TArray<const FItemRow*> RecoverRowPtrs;
+	RecoverRowPtrs.Reserve(LoadoutItems.Num());
+	for (const FInv_SavedItemData& Item : LoadoutItems)
 	{
-		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ RecoverFromCrash: INSERT Prepare 실패 — ROLLBACK | 에러: %s"), *Database->GetLastError());
-		if (!Database->Execute(TEXT("ROLLBACK;"))) { UE_LOG(LogHelluna, Error, TEXT("[SQLite] ROLLBACK 실패 | 에러: %s"), *Database->GetLastError()); }
-		return false;
+		FItemRow& Row = RecoverRows.Add_GetRef(FItemRow::FromItem(Item));
+		// [Fix29-J] Loadout Grid 좌표는 Stash Grid와 크기가 다를 수 있음 → (-1,-1)로 리셋하여 클라에서 자동 배치
+		Row.GridX = -1;
+		Row.GridY = -1;
+		RecoverRowPtrs.Add(&Row);
 	}
 
-	for (int32 i = 0; i < LoadoutItems.Num(); ++i)
+	if (!InsertItemRows(TEXT("player_stash"), PlayerId, RecoverRowPtrs, TEXT("RecoverFromCrash")))
 	{
-		const FInv_SavedItemData& Item = LoadoutItems[i];
-
-		InsertStmt.SetBindingValueByIndex(1, PlayerId);
-		InsertStmt.SetBindingValueByIndex(2, Item.ItemType.ToString());
-		InsertStmt.SetBindingValueByIndex(3, Item.StackCount);
-		// [Fix29-J] Loadout Grid 좌표는 Stash Grid와 크기가 다를 수 있음 → (-1,-1)로 리셋하여 클라에서 자동 배치
-		InsertStmt.SetBindingValueByIndex(4, -1);
-		InsertStmt.SetBindingValueByIndex(5, -1);
-		InsertStmt.SetBindingValueByIndex(6, static_cast<int32>(Item.GridCategory));
-		InsertStmt.SetBindingValueByIndex(7, Item.bEquipped ? 1 : 0);
-		InsertStmt.SetBindingValueByIndex(8, Item.WeaponSlotIndex);
-
-		if (Item.SerializedManifest.Num() > 0)
-		{
-			InsertStmt.SetBindingValueByIndex(9, TArrayView<const uint8>(Item.SerializedManifest), true);
-		}
-		else
-		{
-			InsertStmt.SetBindingValueByIndex(9); // NULL
-		}
-
-		const FString AttJson = SerializeAttachmentsToJson(Item.Attachments);
-		if (AttJson.IsEmpty())
-		{
-			InsertStmt.SetBindingValueByIndex(10, TEXT(""));
-		}
-		else
-		{
-			InsertStmt.SetBindingValueByIndex(10, AttJson);
-		}
-
-		if (!InsertStmt.Execute())
-		{
-			UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ RecoverFromCrash: Stash INSERT[%d] 실패 — ROLLBACK | 아이템=%s | 에러: %s"),
-				i, *Item.ItemType.ToString(), *Database->GetLastError());
-			if (!Database->Execute(TEXT("ROLLBACK;"))) { UE_LOG(LogHelluna, Error, TEXT("[SQLite] ROLLBACK 실패 | 에러: %s"), *Database->GetLastError()); }
-			return false;
-		}
-
-		InsertStmt.Reset();
-		InsertStmt.ClearBindings();
+		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ RecoverFromCrash: Stash INSERT 실패 — ROLLBACK"));
+		if (!Database->Execute(TEXT("ROLLBACK;"))) { UE_LOG(LogHelluna, Error, TEXT("[SQLite] ROLLBACK 실패 | 에러: %s"), *Database->GetLastError()); }
+		return false;
 	}
 	UE_LOG(LogHelluna, Log, TEXT("[SQLite]   Stash INSERT %d개 ✓ (복구)"), LoadoutItems.Num());
 
@@ -2491,6 +3326,8 @@ bool UHellunaSQLiteSubsystem::SetPlayerDeployed(const FString& PlayerId, bool bD
 		return false;
 	}
 
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] [Fix36] ✗ SetPlayerDeployed: DB가 준비되지 않음"));
@@ -2536,6 +3373,8 @@ bool UHellunaSQLiteSubsystem::IsPlayerDeployed(const FString& PlayerId)
 		return false;
 	}
 
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] [Fix36] ✗ IsPlayerDeployed: DB가 준비되지 않음"));
@@ -2584,6 +3423,8 @@ bool UHellunaSQLiteSubsystem::SetPlayerDeployedWithPort(const FString& PlayerId,
 		return false;
 	}
 
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] [Phase14] ✗ SetPlayerDeployedWithPort: DB가 준비되지 않음"));
@@ -2622,6 +3463,8 @@ bool UHellunaSQLiteSubsystem::SetPlayerDeployedWithPort(const FString& PlayerId,
 // ──────────────────────────────────────────────────────────────
 int32 UHellunaSQLiteSubsystem::GetPlayerDeployedPort(const FString& PlayerId)
 {
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (PlayerId.IsEmpty() || !IsDatabaseReady()) return 0;
 
 	FSQLitePreparedStatement Statement;
@@ -2648,6 +3491,8 @@ int32 UHellunaSQLiteSubsystem::GetPlayerDeployedPort(const FString& PlayerId)
 // ──────────────────────────────────────────────────────────────
 int32 UHellunaSQLiteSubsystem::GetPlayerDeployedHeroType(const FString& PlayerId)
 {
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (PlayerId.IsEmpty() || !IsDatabaseReady()) return 3; // 3 = None
 
 	FSQLitePreparedStatement Statement;
@@ -2686,6 +3531,8 @@ bool UHellunaSQLiteSubsystem::SavePlayerEquipment(const FString& PlayerId, const
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ SavePlayerEquipment: PlayerId가 비어있음"));
 		return false;
 	}
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ SavePlayerEquipment: DB가 준비되지 않음"));
@@ -2766,6 +3613,8 @@ TArray<FHellunaEquipmentSlotData> UHellunaSQLiteSubsystem::LoadPlayerEquipment(c
 {
 	TArray<FHellunaEquipmentSlotData> Result;
 
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (PlayerId.IsEmpty() || !IsDatabaseReady())
 	{
 		return Result;
@@ -2802,6 +3651,8 @@ TArray<FHellunaEquipmentSlotData> UHellunaSQLiteSubsystem::LoadPlayerEquipment(c
 // ──────────────────────────────────────────────────────────────
 bool UHellunaSQLiteSubsystem::DeletePlayerEquipment(const FString& PlayerId)
 {
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (PlayerId.IsEmpty() || !IsDatabaseReady())
 	{
 		return false;
@@ -2835,6 +3686,9 @@ bool UHellunaSQLiteSubsystem::DeletePlayerEquipment(const FString& PlayerId)
 // ──────────────────────────────────────────────────────────────
 TArray<bool> UHellunaSQLiteSubsystem::GetActiveGameCharacters()
 {
+	// [DBAsyncV1] 워커에서 실행 중인 등록/해제와 캐시 무효화가 겹치지 않도록 캐시 확인 전에 잠금 (큐 전체는 기다리지 않음)
+	FDatabaseAccessScope DBAccess(*this);
+
 	// [Lag-Fix9] 캐시가 유효하면 DB 쿼리 없이 즉시 반환
 	if (!bActiveHeroTypesCacheDirty && CachedActiveHeroTypes.Num() == 3)
 	{
@@ -2894,6 +3748,8 @@ bool UHellunaSQLiteSubsystem::RegisterActiveGameCharacter(int32 HeroType, const
 	UE_LOG(LogHelluna, Log, TEXT("[SQLite] RegisterActiveGameCharacter | HeroType=%d | PlayerId=%s | ServerId=%s"),
 		HeroType, *PlayerId, *ServerId);
 
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] RegisterActiveGameCharacter: DB 미준비"));
@@ -2967,6 +3823,8 @@ bool UHellunaSQLiteSubsystem::RegisterActiveGameCharacter(int32 HeroType, const
 // ──────────────────────────────────────────────────────────────
 bool UHellunaSQLiteSubsystem::UnregisterActiveGameCharacter(const FString& PlayerId)
 {
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] UnregisterActiveGameCharacter: DB 미준비"));
@@ -3003,6 +3861,8 @@ bool UHellunaSQLiteSubsystem::UnregisterActiveGameCharacter(const FString& Playe
 // ──────────────────────────────────────────────────────────────
 bool UHellunaSQLiteSubsystem::UnregisterAllActiveGameCharactersForServer(const FString& ServerId)
 {
+	FDatabaseAccessScope DBAccess(*this);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] UnregisterAllForServer: DB 미준비"));
@@ -3039,6 +3899,8 @@ bool UHellunaSQLiteSubsystem::UnregisterAllActiveGameCharactersForServer(const F
 // ──────────────────────────────────────────────────────────────
 bool UHellunaSQLiteSubsystem::ClearAllActiveGameCharacters()
 {
+	FDatabaseAccessScope DBAccess(*this);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ClearAllActiveGameCharacters: DB 미준비"));
@@ -3424,6 +4286,8 @@ int32 UHellunaSQLiteSubsystem::CreateParty(const FString& LeaderId, const FStrin
 		return 0;
 	}
 
+	FDatabaseAccessScope DBAccess(*this);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ CreateParty: DB가 준비되지 않음"));
@@ -3529,6 +4393,8 @@ bool UHellunaSQLiteSubsystem::JoinParty(int32 PartyId, const FString& PlayerId,
 		return false;
 	}
 
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ JoinParty: DB가 준비되지 않음"));
@@ -3586,6 +4452,8 @@ bool UHellunaSQLiteSubsystem::LeaveParty(const FString& PlayerId)
 		return false;
 	}
 
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ LeaveParty: DB가 준비되지 않음"));
@@ -3743,6 +4611,8 @@ bool UHellunaSQLiteSubsystem::DisbandParty(int32 PartyId)
 		return false;
 	}
 
+	FDatabaseAccessScope DBAccess(*this);
+
 	if (!IsDatabaseReady())
 	{
 		UE_LOG(LogHelluna, Error, TEXT("[SQLite] ✗ DisbandParty: DB가 준비되지 않음"));
@@ -3807,6 +4677,8 @@ int32 UHellunaSQLiteSubsystem::FindPartyByCode(const FString& PartyCode)
 {
 	UE_LOG(LogHelluna, Verbose, TEXT("[SQLite] FindPartyByCode | Code=%s"), *PartyCode);
 
+	FDatabaseAccessScope DBAccess(*this);
+
 	if (PartyCode.IsEmpty() || !IsDatabaseReady())
 	{
 		return 0;
@@ -3838,6 +4710,8 @@ int32 UHellunaSQLiteSubsystem::FindPartyByCode(const FString& PartyCode)
 // ──────────────────────────────────────────────────────────────
 int32 UHellunaSQLiteSubsystem::GetPartyMemberCount(int32 PartyId)
 {
+	FDatabaseAccessScope DBAccess(*this);
+
 	if (PartyId <= 0 || !IsDatabaseReady())
 	{
 		return 0;
@@ -3866,6 +4740,8 @@ int32 UHellunaSQLiteSubsystem::GetPartyMemberCount(int32 PartyId)
 // ──────────────────────────────────────────────────────────────
 int32 UHellunaSQLiteSubsystem::GetPlayerPartyId(const FString& PlayerId)
 {
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (PlayerId.IsEmpty() || !IsDatabaseReady())
 	{
 		return 0;
@@ -3898,6 +4774,8 @@ FHellunaPartyInfo UHellunaSQLiteSubsystem::LoadPartyInfo(int32 PartyId)
 {
 	FHellunaPartyInfo Info;
 
+	FDatabaseAccessScope DBAccess(*this);
+
 	if (PartyId <= 0 || !IsDatabaseReady())
 	{
 		return Info;
@@ -3967,6 +4845,8 @@ FHellunaPartyInfo UHellunaSQLiteSubsystem::LoadPartyInfo(int32 PartyId)
 // ──────────────────────────────────────────────────────────────
 bool UHellunaSQLiteSubsystem::UpdateMemberReady(const FString& PlayerId, bool bReady)
 {
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (PlayerId.IsEmpty() || !IsDatabaseReady())
 	{
 		return false;
@@ -3996,6 +4876,8 @@ bool UHellunaSQLiteSubsystem::UpdateMemberReady(const FString& PlayerId, bool bR
 // ──────────────────────────────────────────────────────────────
 bool UHellunaSQLiteSubsystem::UpdateMemberHeroType(const FString& PlayerId, int32 HeroType)
 {
+	FDatabaseAccessScope DBAccess(*this, PlayerId);
+
 	if (PlayerId.IsEmpty() || !IsDatabaseReady())
 	{
 		return false;
@@ -4027,6 +4909,8 @@ bool UHellunaSQLiteSubsystem::TransferLeadership(int32 PartyId, const FString& N
 {
 	UE_LOG(LogHelluna, Log, TEXT("[SQLite] ▶ TransferLeadership | PartyId=%d | NewLeader=%s"), PartyId, *NewLeaderId);
 
+	FDatabaseAccessScope DBAccess(*this);
+
 	if (PartyId <= 0 || NewLeaderId.IsEmpty() || !IsDatabaseReady())
 	{
 		return false;
@@ -4110,6 +4994,8 @@ bool UHellunaSQLiteSubsystem::TransferLeadership(int32 PartyId, const FString& N
 // ──────────────────────────────────────────────────────────────
 bool UHellunaSQLiteSubsystem::ResetAllReadyStates(int32 PartyId)
 {
+	FDatabaseAccessScope DBAccess(*this);
+
 	if (PartyId <= 0 || !IsDatabaseReady())
 	{
 		return false;
@@ -4138,6 +5024,8 @@ bool UHellunaSQLiteSubsystem::ResetAllReadyStates(int32 PartyId)
 // ──────────────────────────────────────────────────────────────
 bool UHellunaSQLiteSubsystem::IsPartyCodeUnique(const FString& Code)
 {
+	FDatabaseAccessScope DBAccess(*this);
+
 	if (Code.IsEmpty() || !IsDatabaseReady())
 	{
 		return false;
@@ -4168,6 +5056,8 @@ int32 UHellunaSQLiteSubsystem::CleanupStaleParties(int32 HoursOld)
 {
 	UE_LOG(LogHelluna, Log, TEXT("[SQLite] ▶ CleanupStaleParties | HoursOld=%d"), HoursOld);
 
+	FDatabaseAccessScope DBAccess(*this);
+
 	if (!IsDatabaseReady())
 	{
 		return 0;
@@ -16,11 +16,11 @@
 // 📌 핵심 흐름 (서버에서만 실행됨):
 //   PostLogin:
 //     1) CheckAndRecoverFromCrash(PlayerId) — 이전 비정상 종료 시 Loadout→Stash 복구
-//     2) LoadStashToComponent(LobbyPC, PlayerId) — SQLite → FInv_PlayerSaveData → RestoreFromSaveData
+//     2) LoadStashToComponent(LobbyPC, PlayerId) — SQLite(비동기 읽기) → ApplyLoadedStash → RestoreFromSaveData
 //     3) RegisterControllerPlayerId() — Logout 시 PlayerId 찾기 위한 맵 등록
 //
 //   Logout:
-//     1) StashComp → CollectInventoryDataForSave() → SQLite SavePlayerStash
+//     1) StashComp → CollectInventoryDataForSave() → SQLite AsyncSavePlayerStash (DB 워커에서 커밋)
 //     2) LoadoutComp에 잔존 아이템 있으면 Stash에 병합해서 저장 (데이터 유실 방지)
 //
 // 📌 상속 구조:
@@ -37,6 +37,7 @@
 #include "Lobby/Controller/HellunaLobbyController.h"
 #include "Lobby/Database/HellunaSQLiteSubsystem.h"
 #include "Lobby/ServerManager/HellunaGameServerManager.h"
+#include "Lobby/ServerManager/HellunaChannelRegistry.h"
 #include "InventoryManagement/Components/Inv_InventoryComponent.h"
 #include "Persistence/Inv_SaveTypes.h"
 #include "Items/Components/Inv_ItemComponent.h"
@@ -53,6 +54,18 @@
 #include "Lobby/HellunaLobbyLog.h"
 DEFINE_LOG_CATEGORY(LogHellunaLobby);
 
+static TAutoConsoleVariable<float> CVarMatchRelaxSeconds(
+	TEXT("Helluna.Lobby.MatchRelaxSeconds"),
+	90.f,
+	TEXT("[MatchBucketV1] 버킷 최장 대기가 이 시간(초)을 넘으면 정원 미달 조합도 매칭 (0=완화 없음)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarMatchBucketStatsInterval(
+	TEXT("Helluna.Lobby.MatchBucketStatsInterval"),
+	30.f,
+	TEXT("[MatchBucketV1] 매칭 버킷 깊이/대기 통계 로그 주기(초, 0=끔)"),
+	ECVF_Default);
+
 namespace
 {
 void BuildEquipmentSlotsFromLoadout(
@@ -75,32 +88,143 @@ void BuildEquipmentSlotsFromLoadout(
 	}
 }
 
-FString NormalizeLobbyMapIdentifier(const FString& InValue)
+FMatchmakingBucketKey MakeMatchmakingBucketKey(const FMatchmakingQueueEntry& Entry)
+{
+	FMatchmakingBucketKey Key;
+	Key.MapKey = Entry.SelectedMapKey;
+	Key.GameMode = Entry.GameMode;
+	return Key;
+}
+
+/** [MatchBucketV1] 패킹 결과 1건 */
+struct FMatchmakingPackedGroup
 {
-	FString Normalized = InValue;
-	Normalized.TrimStartAndEndInline();
+	TArray<int32> EntryIds;
+	double OldestEnterTime = 0.0;
+};
 
-	if (Normalized.IsEmpty())
+void AddPackedGroup(TArray<FMatchmakingPackedGroup>& OutGroups, std::initializer_list<const FMatchmakingBucketSlot*> Slots)
+{
+	FMatchmakingPackedGroup& Group = OutGroups.AddDefaulted_GetRef();
+	Group.OldestEnterTime = TNumericLimits<double>::Max();
+	for (const FMatchmakingBucketSlot* Slot : Slots)
 	{
-		return Normalized;
+		Group.EntryIds.Add(Slot->EntryId);
+		Group.OldestEnterTime = FMath::Min(Group.OldestEnterTime, Slot->QueueEnterTime);
 	}
+}
+
+/**
+ * [MatchBucketV1] 버킷 1개 greedy 패킹 — 이번 패스에 만들 수 있는 매칭을 전부 OutGroups에 추가.
+ *   1) 단독으로 정원을 채우는 엔트리
+ *   2) SQUAD 2인 + 1인 (큐 진입 순)
+ *   3) 1인끼리 정원만큼 (DUO 1+1 / SQUAD 1+1+1)
+ *   4) 완화: 남은 엔트리 중 최장 대기가 RelaxSeconds 이상이면 정원 미달 조합도 매칭 (first-fit)
+ * 버킷 자체는 수정하지 않음 — 실제 제거는 StartMatchCountdown → RemoveQueueEntry.
+ */
+void PackMatchmakingBucket(const FMatchmakingBucket& Bucket, int32 Capacity, double Now, float RelaxSeconds,
+	TArray<FMatchmakingPackedGroup>& OutGroups)
+{
+	const TArray<FMatchmakingBucketSlot> NoSlots;
+	const TArray<FMatchmakingBucketSlot>& Solos = Capacity > 1 ? Bucket.SlotsBySize[0] : NoSlots;
+	const TArray<FMatchmakingBucketSlot>& Duos = Capacity > 2 ? Bucket.SlotsBySize[1] : NoSlots;
 
-	if (Normalized.Contains(TEXT("/")) || Normalized.Contains(TEXT("\\")))
+	for (const TArray<FMatchmakingBucketSlot>& Slots : Bucket.SlotsBySize)
 	{
-		Normalized = FPaths::GetBaseFilename(Normalized);
+		for (const FMatchmakingBucketSlot& Slot : Slots)
+		{
+			if (Slot.PlayerCount >= Capacity)
+			{
+				AddPackedGroup(OutGroups, { &Slot });
+			}
+		}
 	}
 
-	return Normalized;
-}
+	int32 SoloCursor = 0;
+	int32 DuoCursor = 0;
+	if (Capacity == 3)
+	{
+		for (; DuoCursor < Duos.Num() && SoloCursor < Solos.Num(); ++DuoCursor, ++SoloCursor)
+		{
+			AddPackedGroup(OutGroups, { &Duos[DuoCursor], &Solos[SoloCursor] });
+		}
+	}
 
-bool DoesLobbyRegistryMapMatch(const FString& RegistryMapName, const FString& RequestedMapIdentifier)
-{
-	const FString NormalizedRegistry = NormalizeLobbyMapIdentifier(RegistryMapName);
-	const FString NormalizedRequested = NormalizeLobbyMapIdentifier(RequestedMapIdentifier);
+	if (Capacity == 2)
+	{
+		for (; Solos.Num() - SoloCursor >= 2; SoloCursor += 2)
+		{
+			AddPackedGroup(OutGroups, { &Solos[SoloCursor], &Solos[SoloCursor + 1] });
+		}
+	}
+	else if (Capacity == 3)
+	{
+		for (; Solos.Num() - SoloCursor >= 3; SoloCursor += 3)
+		{
+			AddPackedGroup(OutGroups, { &Solos[SoloCursor], &Solos[SoloCursor + 1], &Solos[SoloCursor + 2] });
+		}
+	}
+
+	if (RelaxSeconds <= 0.f)
+	{
+		return;
+	}
+
+	TArray<const FMatchmakingBucketSlot*> Leftovers;
+	for (int32 i = DuoCursor; i < Duos.Num(); ++i)
+	{
+		Leftovers.Add(&Duos[i]);
+	}
+	for (int32 i = SoloCursor; i < Solos.Num(); ++i)
+	{
+		Leftovers.Add(&Solos[i]);
+	}
+	if (Leftovers.Num() == 0)
+	{
+		return;
+	}
+
+	Leftovers.Sort([](const FMatchmakingBucketSlot& A, const FMatchmakingBucketSlot& B)
+	{
+		return A.QueueEnterTime < B.QueueEnterTime;
+	});
+	if (Now - Leftovers[0]->QueueEnterTime < RelaxSeconds)
+	{
+		return;
+	}
 
-	return !NormalizedRegistry.IsEmpty()
-		&& !NormalizedRequested.IsEmpty()
-		&& NormalizedRegistry.Equals(NormalizedRequested, ESearchCase::IgnoreCase);
+	// 오래 기다린 순으로 first-fit — 그룹의 첫 슬롯이 곧 최장 대기
+	TArray<FMatchmakingPackedGroup> RelaxedGroups;
+	TArray<int32> RelaxedPlayerCounts;
+	for (const FMatchmakingBucketSlot* Slot : Leftovers)
+	{
+		int32 Target = INDEX_NONE;
+		for (int32 g = 0; g < RelaxedGroups.Num(); ++g)
+		{
+			if (RelaxedPlayerCounts[g] + Slot->PlayerCount <= Capacity)
+			{
+				Target = g;
+				break;
+			}
+		}
+		if (Target == INDEX_NONE)
+		{
+			Target = RelaxedGroups.Num();
+			FMatchmakingPackedGroup& NewGroup = RelaxedGroups.AddDefaulted_GetRef();
+			NewGroup.OldestEnterTime = Slot->QueueEnterTime;
+			RelaxedPlayerCounts.Add(0);
+		}
+		RelaxedGroups[Target].EntryIds.Add(Slot->EntryId);
+		RelaxedPlayerCounts[Target] += Slot->PlayerCount;
+	}
+
+	for (FMatchmakingPackedGroup& Group : RelaxedGroups)
+	{
+		if (Now - Group.OldestEnterTime >= RelaxSeconds)
+		{
+			OutGroups.Add(MoveTemp(Group));
+		}
+	}
 }
 }
 
@@ -196,9 +320,31 @@ void AHellunaLobbyGameMode::BeginPlay()
 		LobbyAccountSaveGame ? TEXT("로드 성공") : TEXT("로드 실패"),
 		LobbyAccountSaveGame ? LobbyAccountSaveGame->GetAccountCount() : 0);
 
+	// [ChannelRegistryV1] 채널 레지스트리 — 게임서버 하트비트 수신 + 폴더 감시 폴백
+	ChannelRegistry = NewObject<UHellunaChannelRegistry>(this);
+	ChannelRegistry->Initialize(GetRegistryDirectoryPath(), HellunaChannelRegistry::GetListenPort());
+
 	// [Phase 16] GameServerManager 초기화
 	GameServerManager = NewObject<UHellunaGameServerManager>(this);
 	GameServerManager->Initialize(GetWorld(), GetRegistryDirectoryPath(), LobbyReturnURL);
+	GameServerManager->SetChannelRegistry(ChannelRegistry);
+
+	// [WarmPoolV1] 맵 키 → 맵 경로로 변환해 웜 풀 목표 전달
+	if (WarmServersPerMap.Num() > 0)
+	{
+		TMap<FString, int32> WarmPoolTargets;
+		for (const TPair<FString, int32>& Pair : WarmServersPerMap)
+		{
+			const FString MapPath = GetMapPathByKey(Pair.Key);
+			if (MapPath.IsEmpty())
+			{
+				UE_LOG(LogHellunaLobby, Warning, TEXT("[LobbyGM] [WarmPoolV1] 알 수 없는 맵 키 — 웜 풀 제외 | MapKey=%s"), *Pair.Key);
+				continue;
+			}
+			WarmPoolTargets.Add(MapPath, Pair.Value);
+		}
+		GameServerManager->SetWarmPoolTargets(WarmPoolTargets);
+	}
 	UE_LOG(LogHellunaLobby, Log, TEXT("[LobbyGM] BeginPlay: GameServerManager 초기화 완료"));
 }
 
@@ -240,6 +386,11 @@ void AHellunaLobbyGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		GameServerManager->ShutdownAll();
 	}
 
+	if (ChannelRegistry)
+	{
+		ChannelRegistry->Shutdown();
+	}
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -533,9 +684,23 @@ void AHellunaLobbyGameMode::InitializeLobbyForPlayer(AHellunaLobbyController* Lo
 				else
 				{
 					UE_LOG(LogHellunaLobby, Error, TEXT("[LobbyGM] [0] [Fix23] SavePlayerLoadout 실패! Stash 폴백 | PlayerId=%s"), *PlayerId);
-					SQLiteSubsystem->MergeGameResultToStash(PlayerId, ResultItems);
-					SQLiteSubsystem->DeletePlayerLoadout(PlayerId);
-					SQLiteSubsystem->DeletePlayerEquipment(PlayerId);
+
+					// [DBAsyncV1] 병합 + 정리는 DB 워커에서 (같은 PlayerId 큐 → FIFO)
+					// 아래 Stash/Loadout 로드는 이 플레이어의 작업만 기다리므로 병합 결과를 읽음
+					SQLiteSubsystem->AsyncMergeGameResultToStash(PlayerId, ResultItems,
+						FOnOperationComplete::CreateLambda([PlayerId](bool bMergeOk)
+						{
+							UE_LOG(LogHellunaLobby, Log, TEXT("[LobbyGM] [0] Stash 폴백 병합 %s | PlayerId=%s"),
+								bMergeOk ? TEXT("성공") : TEXT("실패"), *PlayerId);
+						}));
+					SQLiteSubsystem->EnqueueDatabaseJob<bool>(
+						[PlayerId](UHellunaSQLiteSubsystem& DB)
+						{
+							const bool bDelLoadout = DB.DeletePlayerLoadout(PlayerId);
+							const bool bDelEquip = DB.DeletePlayerEquipment(PlayerId);
+							return bDelLoadout && bDelEquip;
+						},
+						nullptr, PlayerId);
 				}
 			}
 			else
@@ -967,10 +1132,36 @@ void AHellunaLobbyGameMode::LoadStashToComponent(AHellunaLobbyController* LobbyP
 		return;
 	}
 
-	// ── SQLite에서 Stash 로드 ──
-	TArray<FInv_SavedItemData> StashItems = SQLiteSubsystem->LoadPlayerStash(PlayerId);
+	// ── SQLite에서 Stash 로드 ([DBAsyncV1] 읽기 전용 연결 → 게임 스레드에서 ApplyLoadedStash) ──
+	// 완료 전 Logout이면 LoadedStashItemCount=-1 유지 → SaveComponentsToDatabase가 저장 차단 (기존 미로드 가드)
+	TWeakObjectPtr<AHellunaLobbyController> WeakPC = LobbyPC;
+	SQLiteSubsystem->AsyncLoadPlayerStash(PlayerId, FOnStashLoaded::CreateWeakLambda(this,
+		[this, WeakPC, PlayerId](const TArray<FInv_SavedItemData>& LoadedItems)
+		{
+			AHellunaLobbyController* PC = WeakPC.Get();
+			if (!PC)
+			{
+				UE_LOG(LogHellunaLobby, Warning, TEXT("[LobbyGM] LoadStash: 로드 완료 전 컨트롤러 소멸 → 복원 생략 | PlayerId=%s"), *PlayerId);
+				return;
+			}
+			ApplyLoadedStash(PC, PlayerId, LoadedItems);
+		}));
+}
+
+// ────────────────────────────────────────────────────────────────
+// ApplyLoadedStash — LoadStashToComponent의 비동기 로드 결과를 StashComp에 복원
+// ────────────────────────────────────────────────────────────────
+void AHellunaLobbyGameMode::ApplyLoadedStash(AHellunaLobbyController* LobbyPC, const FString& PlayerId, TArray<FInv_SavedItemData> StashItems)
+{
 	UE_LOG(LogHellunaLobby, Log, TEXT("[LobbyGM] SQLite Stash 로드 완료 | PlayerId=%s | 아이템 %d개"), *PlayerId, StashItems.Num());
 
+	UInv_InventoryComponent* StashComp = LobbyPC->GetStashComponent();
+	if (!StashComp)
+	{
+		UE_LOG(LogHellunaLobby, Error, TEXT("[LobbyGM] ApplyLoadedStash: StashComp가 nullptr! | PlayerId=%s"), *PlayerId);
+		return;
+	}
+
 	if (StashItems.Num() == 0)
 	{
 		// [Fix41] 빈 Stash도 정상 — 미로드(-1) 아닌 "0개 로드됨"으로 설정
@@ -1258,9 +1449,14 @@ void AHellunaLobbyGameMode::SaveComponentsToDatabase(AHellunaLobbyController* Lo
 		}
 		else
 		{
-			const bool bStashOk = SQLiteSubsystem->SavePlayerStash(PlayerId, StashItems);
-			UE_LOG(LogHellunaLobby, Log, TEXT("[LobbyGM] [Fix36] Stash SQLite 저장 %s | %d개 | PlayerId=%s"),
-				bStashOk ? TEXT("성공") : TEXT("실패"), StashItems.Num(), *PlayerId);
+			// [DBAsyncV1] Logout 저장은 DB 워커에서 — 게임 스레드는 커밋을 기다리지 않음
+			const int32 StashCount = StashItems.Num();
+			SQLiteSubsystem->AsyncSavePlayerStash(PlayerId, StashItems,
+				FOnOperationComplete::CreateLambda([PlayerId, StashCount](bool bStashOk)
+				{
+					UE_LOG(LogHellunaLobby, Log, TEXT("[LobbyGM] [Fix36] Stash SQLite 저장 %s | %d개 | PlayerId=%s"),
+						bStashOk ? TEXT("성공") : TEXT("실패"), StashCount, *PlayerId);
+				}));
 		}
 	}
 	else
@@ -1287,10 +1483,6 @@ void AHellunaLobbyGameMode::SaveComponentsToDatabase(AHellunaLobbyController* Lo
 			}
 			else
 			{
-				const bool bLoadoutOk = SQLiteSubsystem->SavePlayerLoadout(PlayerId, LoadoutItems);
-				UE_LOG(LogHellunaLobby, Log, TEXT("[LobbyGM] [Fix36] Loadout SQLite 저장 %s | %d개 | PlayerId=%s"),
-					bLoadoutOk ? TEXT("성공") : TEXT("실패"), LoadoutItems.Num(), *PlayerId);
-
 				// 3) 장착 상태 저장 (Loadout 아이템 중 bEquipped 추출)
 				TArray<FHellunaEquipmentSlotData> EquipSlots;
 				for (const FInv_SavedItemData& Item : LoadoutItems)
@@ -1303,30 +1495,48 @@ void AHellunaLobbyGameMode::SaveComponentsToDatabase(AHellunaLobbyController* Lo
 						EquipSlots.Add(Slot);
 					}
 				}
-				// [Fix44-C4] Equipment 저장 반환값 검증
-				const bool bEquipOk = SQLiteSubsystem->SavePlayerEquipment(PlayerId, EquipSlots);
-				if (!bEquipOk)
-				{
-					UE_LOG(LogHellunaLobby, Error, TEXT("[LobbyGM] [Fix44] SavePlayerEquipment 실패! Loadout/Equipment 불일치 가능 | PlayerId=%s"), *PlayerId);
-				}
+
+				// [DBAsyncV1] Loadout + Equipment 저장은 DB 워커에서 (같은 PlayerId 큐 → Stash 저장 다음 순서)
+				SQLiteSubsystem->EnqueueDatabaseJob<bool>(
+					[PlayerId, LoadoutItems = MoveTemp(LoadoutItems), EquipSlots = MoveTemp(EquipSlots)](UHellunaSQLiteSubsystem& DB)
+					{
+						const bool bLoadoutOk = DB.SavePlayerLoadout(PlayerId, LoadoutItems);
+						UE_LOG(LogHellunaLobby, Log, TEXT("[LobbyGM] [Fix36] Loadout SQLite 저장 %s | %d개 | PlayerId=%s"),
+							bLoadoutOk ? TEXT("성공") : TEXT("실패"), LoadoutItems.Num(), *PlayerId);
+
+						// [Fix44-C4] Equipment 저장 반환값 검증
+						const bool bEquipOk = DB.SavePlayerEquipment(PlayerId, EquipSlots);
+						if (!bEquipOk)
+						{
+							UE_LOG(LogHellunaLobby, Error, TEXT("[LobbyGM] [Fix44] SavePlayerEquipment 실패! Loadout/Equipment 불일치 가능 | PlayerId=%s"), *PlayerId);
+						}
+						return bLoadoutOk && bEquipOk;
+					},
+					nullptr, PlayerId);
 			}
 		}
 		else
 		{
 			// [Fix36] 빈 Loadout → player_loadout 삭제 (빈 행 정리, 크래시 감지와 무관)
 			// [Fix44-C3] Delete 반환값 검증
-			const bool bDelLoadout = SQLiteSubsystem->DeletePlayerLoadout(PlayerId);
-			const bool bDelEquip = SQLiteSubsystem->DeletePlayerEquipment(PlayerId);
-			if (!bDelLoadout || !bDelEquip)
-			{
-				UE_LOG(LogHellunaLobby, Error, TEXT("[LobbyGM] [Fix44] Delete 실패: Loadout=%s Equipment=%s | PlayerId=%s"),
-					bDelLoadout ? TEXT("OK") : TEXT("FAIL"), bDelEquip ? TEXT("OK") : TEXT("FAIL"), *PlayerId);
-			}
-			UE_LOG(LogHellunaLobby, Log, TEXT("[LobbyGM] [Fix36] Loadout 비어있음 → DeletePlayerLoadout (빈 행 정리) | PlayerId=%s"), *PlayerId);
+			SQLiteSubsystem->EnqueueDatabaseJob<bool>(
+				[PlayerId](UHellunaSQLiteSubsystem& DB)
+				{
+					const bool bDelLoadout = DB.DeletePlayerLoadout(PlayerId);
+					const bool bDelEquip = DB.DeletePlayerEquipment(PlayerId);
+					if (!bDelLoadout || !bDelEquip)
+					{
+						UE_LOG(LogHellunaLobby, Error, TEXT("[LobbyGM] [Fix44] Delete 실패: Loadout=%s Equipment=%s | PlayerId=%s"),
+							bDelLoadout ? TEXT("OK") : TEXT("FAIL"), bDelEquip ? TEXT("OK") : TEXT("FAIL"), *PlayerId);
+					}
+					return bDelLoadout && bDelEquip;
+				},
+				nullptr, PlayerId);
+			UE_LOG(LogHellunaLobby, Log, TEXT("[LobbyGM] [Fix36] Loadout 비어있음 → DeletePlayerLoadout 요청 (빈 행 정리) | PlayerId=%s"), *PlayerId);
 		}
 	}
 
-	UE_LOG(LogHellunaLobby, Log, TEXT("[LobbyGM] [Fix36] SaveComponentsToDatabase 완료 | PlayerId=%s"), *PlayerId);
+	UE_LOG(LogHellunaLobby, Log, TEXT("[LobbyGM] [Fix36] SaveComponentsToDatabase 요청 완료 (DB 워커에서 커밋) | PlayerId=%s"), *PlayerId);
 }
 
 // ════════════════════════════════════════════════════════════════════════════════
@@ -1486,7 +1696,8 @@ void AHellunaLobbyGameMode::UnregisterLobbyCharacterUse(const FString& PlayerId)
 
 
 // ════════════════════════════════════════════════════════════════════════════════
-// [Phase 12b] 채널 레지스트리 스캔
+// [Phase 12b] 채널 레지스트리 조회
+// [ChannelRegistryV1] 폴더 스캔 대신 UHellunaChannelRegistry의 상태/맵 인덱스 사용
 // ════════════════════════════════════════════════════════════════════════════════
 
 FString AHellunaLobbyGameMode::GetRegistryDirectoryPath() const
@@ -1495,99 +1706,45 @@ FString AHellunaLobbyGameMode::GetRegistryDirectoryPath() const
 		FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ServerRegistry")));
 }
 
-TArray<FGameChannelInfo> AHellunaLobbyGameMode::ScanAvailableChannels()
+bool AHellunaLobbyGameMode::FindEmptyChannel(FGameChannelInfo& OutChannel)
 {
-	TArray<FGameChannelInfo> Channels;
-	const FString RegistryDir = GetRegistryDirectoryPath();
-
-	// JSON 파일 목록 스캔
-	TArray<FString> FoundFiles;
-	IFileManager::Get().FindFiles(FoundFiles, *FPaths::Combine(RegistryDir, TEXT("channel_*.json")), true, false);
+	if (!ChannelRegistry)
+	{
+		UE_LOG(LogHellunaLobby, Error, TEXT("[LobbyGM] FindEmptyChannel: ChannelRegistry 없음"));
+		return false;
+	}
 
-	const FDateTime Now = FDateTime::UtcNow();
+	TArray<int32> EmptyPorts;
+	ChannelRegistry->GetPortsByStatus(EChannelStatus::Empty, EmptyPorts);
 
-	for (const FString& FileName : FoundFiles)
+	for (const int32 Port : EmptyPorts)
 	{
-		const FString FilePath = FPaths::Combine(RegistryDir, FileName);
-		FString JsonString;
-		if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+		if (PendingDeployChannels.Contains(Port))
 		{
 			continue;
 		}
 
-		TSharedPtr<FJsonObject> JsonObj;
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-		if (!FJsonSerializer::Deserialize(Reader, JsonObj) || !JsonObj.IsValid())
+		const FGameChannelInfo* Ch = ChannelRegistry->FindChannel(Port);
+		if (!Ch)
 		{
 			continue;
 		}
 
-		FGameChannelInfo Info;
-		Info.ChannelId = JsonObj->GetStringField(TEXT("channelId"));
-		Info.Port = static_cast<int32>(JsonObj->GetNumberField(TEXT("port")));
-		Info.CurrentPlayers = static_cast<int32>(JsonObj->GetNumberField(TEXT("currentPlayers")));
-		Info.MaxPlayers = static_cast<int32>(JsonObj->GetNumberField(TEXT("maxPlayers")));
-		Info.MapName = JsonObj->GetStringField(TEXT("mapName"));
-
-		// Status 문자열 → enum
-		const FString StatusStr = JsonObj->GetStringField(TEXT("status"));
-		if (StatusStr == TEXT("playing"))
+		if (!GameServerManager || !GameServerManager->IsTrackedServerRunning(Port))
 		{
-			Info.Status = EChannelStatus::Playing;
-		}
-		else if (StatusStr == TEXT("empty"))
-		{
-			Info.Status = EChannelStatus::Empty;
-		}
-		else
-		{
-			Info.Status = EChannelStatus::Offline;
-		}
-
-		// [Phase 12h] lastUpdate 60초 초과 → Offline (비정상 종료 대비)
-		FString LastUpdateStr = JsonObj->GetStringField(TEXT("lastUpdate"));
-		FDateTime LastUpdate;
-		if (FDateTime::ParseIso8601(*LastUpdateStr, LastUpdate))
-		{
-			const FTimespan Age = Now - LastUpdate;
-			if (Age.GetTotalSeconds() > 60.0)
-			{
-				Info.Status = EChannelStatus::Offline;
-				UE_LOG(LogHellunaLobby, Warning, TEXT("[LobbyGM] 채널 %s 타임아웃 (%.0f초) → Offline"),
-					*Info.ChannelId, Age.GetTotalSeconds());
-			}
+			UE_LOG(LogHellunaLobby, Warning,
+				TEXT("[LobbyGM] FindEmptyChannel: skip stale/untracked registry channel | Channel=%s | Port=%d"),
+				*Ch->ChannelId, Port);
+			continue;
 		}
 
-		Channels.Add(MoveTemp(Info));
-	}
-
-	UE_LOG(LogHellunaLobby, Log, TEXT("[LobbyGM] ScanAvailableChannels: %d개 채널 발견"), Channels.Num());
-	return Channels;
-}
-
-bool AHellunaLobbyGameMode::FindEmptyChannel(FGameChannelInfo& OutChannel)
-{
-	const TArray<FGameChannelInfo> Channels = ScanAvailableChannels();
-
-	for (const FGameChannelInfo& Ch : Channels)
-	{
-		if (Ch.Status == EChannelStatus::Empty && !PendingDeployChannels.Contains(Ch.Port))
-		{
-			if (!GameServerManager || !GameServerManager->IsTrackedServerRunning(Ch.Port))
-			{
-				UE_LOG(LogHellunaLobby, Warning,
-					TEXT("[LobbyGM] FindEmptyChannel: skip stale/untracked registry channel | Channel=%s | Port=%d"),
-					*Ch.ChannelId, Ch.Port);
-				continue;
-			}
-
-			OutChannel = Ch;
-			UE_LOG(LogHellunaLobby, Log, TEXT("[LobbyGM] FindEmptyChannel: %s (Port=%d)"), *Ch.ChannelId, Ch.Port);
-			return true;
-		}
+		OutChannel = *Ch;
+		UE_LOG(LogHellunaLobby, Log, TEXT("[LobbyGM] FindEmptyChannel: %s (Port=%d)"), *Ch->ChannelId, Port);
+		return true;
 	}
 
-	UE_LOG(LogHellunaLobby, Warning, TEXT("[LobbyGM] FindEmptyChannel: 빈 채널 없음"));
+	UE_LOG(LogHellunaLobby, Warning, TEXT("[LobbyGM] FindEmptyChannel: 빈 채널 없음 (채널 %d개)"),
+		ChannelRegistry->GetChannelCount());
 	return false;
 }
 
@@ -1597,77 +1754,90 @@ bool AHellunaLobbyGameMode::FindEmptyChannel(FGameChannelInfo& OutChannel)
 
 bool AHellunaLobbyGameMode::FindEmptyChannelForMap(const FString& MapKey, FGameChannelInfo& OutChannel)
 {
-	const bool bUseNormalizedMapMatching = FPlatformTime::Cycles64() >= 0;
-	if (bUseNormalizedMapMatching)
+	if (!ChannelRegistry)
 	{
-		const TArray<FGameChannelInfo> Channels = ScanAvailableChannels();
-		const FString ResolvedMapPath = GetMapPathByKey(MapKey);
-		const FString RequestedMapIdentifier = NormalizeLobbyMapIdentifier(ResolvedMapPath.IsEmpty() ? MapKey : ResolvedMapPath);
+		UE_LOG(LogHellunaLobby, Error, TEXT("[LobbyGM] FindEmptyChannelForMap: ChannelRegistry 없음"));
+		return false;
+	}
 
-		if (RequestedMapIdentifier.IsEmpty())
+	const FString ResolvedMapPath = GetMapPathByKey(MapKey);
+	const FString RequestedMapIdentifier = HellunaChannelRegistry::NormalizeMapIdentifier(ResolvedMapPath.IsEmpty() ? MapKey : ResolvedMapPath);
+
+	if (RequestedMapIdentifier.IsEmpty())
+	{
+		UE_LOG(LogHellunaLobby, Warning,
+			TEXT("[LobbyGM] FindEmptyChannelForMap: normalized map identifier is empty | MapKey=%s"),
+			*MapKey);
+		return false;
+	}
+
+	TArray<int32> EmptyPorts;
+	ChannelRegistry->GetPortsForMap(RequestedMapIdentifier, EChannelStatus::Empty, EmptyPorts);
+
+	for (const int32 Port : EmptyPorts)
+	{
+		if (PendingDeployChannels.Contains(Port))
 		{
-			UE_LOG(LogHellunaLobby, Warning,
-				TEXT("[LobbyGM] FindEmptyChannelForMap: normalized map identifier is empty | MapKey=%s"),
-				*MapKey);
-			return false;
+			continue;
 		}
 
-		for (const FGameChannelInfo& Ch : Channels)
+		const FGameChannelInfo* Ch = ChannelRegistry->FindChannel(Port);
+		if (!Ch)
 		{
-			if (Ch.Status == EChannelStatus::Empty && !PendingDeployChannels.Contains(Ch.Port))
-			{
-				if (DoesLobbyRegistryMapMatch(Ch.MapName, RequestedMapIdentifier))
-				{
-					if (!GameServerManager || !GameServerManager->IsTrackedServerRunning(Ch.Port))
-					{
-						UE_LOG(LogHellunaLobby, Warning,
-							TEXT("[LobbyGM] FindEmptyChannelForMap: skip stale/untracked registry channel | Channel=%s | Port=%d | RegistryMap=%s | RequestedMap=%s"),
-							*Ch.ChannelId, Ch.Port, *Ch.MapName, *RequestedMapIdentifier);
-						continue;
-					}
+			continue;
+		}
 
-					OutChannel = Ch;
-					UE_LOG(LogHellunaLobby, Log,
-						TEXT("[LobbyGM] FindEmptyChannelForMap: %s (Port=%d, RegistryMap=%s, RequestedMap=%s)"),
-						*Ch.ChannelId, Ch.Port, *Ch.MapName, *RequestedMapIdentifier);
-					return true;
-				}
-			}
+		if (!GameServerManager || !GameServerManager->IsTrackedServerRunning(Port))
+		{
+			UE_LOG(LogHellunaLobby, Warning,
+				TEXT("[LobbyGM] FindEmptyChannelForMap: skip stale/untracked registry channel | Channel=%s | Port=%d | RegistryMap=%s | RequestedMap=%s"),
+				*Ch->ChannelId, Port, *Ch->MapName, *RequestedMapIdentifier);
+			continue;
 		}
 
+		OutChannel = *Ch;
 		UE_LOG(LogHellunaLobby, Log,
-			TEXT("[LobbyGM] FindEmptyChannelForMap: no empty channel for MapKey=%s (RequestedMap=%s)"),
-			*MapKey, *RequestedMapIdentifier);
-		return false;
+			TEXT("[LobbyGM] FindEmptyChannelForMap: %s (Port=%d, RegistryMap=%s, RequestedMap=%s)"),
+			*Ch->ChannelId, Port, *Ch->MapName, *RequestedMapIdentifier);
+		return true;
 	}
 
-	const TArray<FGameChannelInfo> Channels = ScanAvailableChannels();
+	UE_LOG(LogHellunaLobby, Log,
+		TEXT("[LobbyGM] FindEmptyChannelForMap: no empty channel for MapKey=%s (RequestedMap=%s)"),
+		*MapKey, *RequestedMapIdentifier);
+	return false;
+}
 
-	for (const FGameChannelInfo& Ch : Channels)
+// ════════════════════════════════════════════════════════════════════════════════
+// [WarmPoolV1] ClaimWarmServerForMap
+// ════════════════════════════════════════════════════════════════════════════════
+
+int32 AHellunaLobbyGameMode::ClaimWarmServerForMap(const FString& MapKey, int32 PartyId)
+{
+	if (!GameServerManager)
 	{
-		if (Ch.Status == EChannelStatus::Empty && !PendingDeployChannels.Contains(Ch.Port))
-		{
-			// MapName 필드에 MapKey가 포함되어 있는지 확인
-			if (Ch.MapName.Contains(MapKey))
-			{
-				if (!GameServerManager || !GameServerManager->IsTrackedServerRunning(Ch.Port))
-				{
-					UE_LOG(LogHellunaLobby, Warning,
-						TEXT("[LobbyGM] FindEmptyChannelForMap: skip stale/untracked registry channel | Channel=%s | Port=%d | Map=%s"),
-						*Ch.ChannelId, Ch.Port, *Ch.MapName);
-					continue;
-				}
+		return -1;
+	}
 
-				OutChannel = Ch;
-				UE_LOG(LogHellunaLobby, Log, TEXT("[LobbyGM] FindEmptyChannelForMap: %s (Port=%d, Map=%s)"),
-					*Ch.ChannelId, Ch.Port, *Ch.MapName);
-				return true;
-			}
-		}
+	const FString ResolvedMapPath = GetMapPathByKey(MapKey);
+	const FString RequestedMapIdentifier = HellunaChannelRegistry::NormalizeMapIdentifier(ResolvedMapPath.IsEmpty() ? MapKey : ResolvedMapPath);
+	if (RequestedMapIdentifier.IsEmpty())
+	{
+		return -1;
 	}
 
-	UE_LOG(LogHellunaLobby, Log, TEXT("[LobbyGM] FindEmptyChannelForMap: 맵 '%s'의 빈 채널 없음"), *MapKey);
-	return false;
+	// 배정 직후 서버는 아직 "idle" — assign 처리 후 "empty" 보고가 곧 ack (WaitAndDeploy가 그때 클라를 보냄)
+	FGameChannelInfo WarmChannel;
+	if (!GameServerManager->ClaimWarmServer(RequestedMapIdentifier, WarmChannel, PartyId))
+	{
+		return -1;
+	}
+
+	MarkChannelAsPendingDeploy(WarmChannel.Port);
+	UE_LOG(LogHellunaLobby, Log,
+		TEXT("[LobbyGM] ClaimWarmServerForMap: warm server claimed → WaitAndDeploy | Port=%d | RequestedMap=%s | PartyId=%d"),
+		WarmChannel.Port, *RequestedMapIdentifier, PartyId);
+	return WarmChannel.Port;
 }
 
 // ════════════════════════════════════════════════════════════════════════════════
@@ -2705,39 +2875,20 @@ void AHellunaLobbyGameMode::ExecutePartyDeploy(int32 PartyId)
 
 bool AHellunaLobbyGameMode::IsGameServerRunning(int32 Port)
 {
-	const FString RegistryDir = GetRegistryDirectoryPath();
-	const FString FilePath = FPaths::Combine(RegistryDir, FString::Printf(TEXT("channel_%d.json"), Port));
-
-	FString JsonString;
-	if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
-	{
-		return false;
-	}
-
-	TSharedPtr<FJsonObject> JsonObj;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-	if (!FJsonSerializer::Deserialize(Reader, JsonObj) || !JsonObj.IsValid())
-	{
-		return false;
-	}
-
-	const FString StatusStr = JsonObj->GetStringField(TEXT("status"));
-	if (StatusStr != TEXT("playing"))
+	// [ChannelRegistryV1] 신선도(소켓 15초 / 파일 60초)는 레지스트리가 만료 시 Offline으로 반영
+	const FGameChannelInfo* Ch = ChannelRegistry ? ChannelRegistry->FindChannel(Port) : nullptr;
+	if (!Ch)
 	{
 		return false;
 	}
 
-	// lastUpdate 60초 이내 확인
-	FString LastUpdateStr = JsonObj->GetStringField(TEXT("lastUpdate"));
-	FDateTime LastUpdate;
-	if (FDateTime::ParseIso8601(*LastUpdateStr, LastUpdate))
+	if (Ch->Status != EChannelStatus::Playing)
 	{
-		const FTimespan Age = FDateTime::UtcNow() - LastUpdate;
-		if (Age.GetTotalSeconds() > 60.0)
+		if (Ch->Status == EChannelStatus::Offline)
 		{
-			UE_LOG(LogHellunaLobby, Warning, TEXT("[LobbyGM] IsGameServerRunning: Port=%d 타임아웃 (%.0f초)"), Port, Age.GetTotalSeconds());
-			return false;
+			UE_LOG(LogHellunaLobby, Warning, TEXT("[LobbyGM] IsGameServerRunning: Port=%d Offline (타임아웃/종료)"), Port);
 		}
+		return false;
 	}
 
 	return true;
@@ -3583,25 +3734,28 @@ void AHellunaLobbyGameMode::TickMatchmaking()
 
 	TryFormMatch();
 	BroadcastMatchmakingStatus();
+
+	const float StatsInterval = CVarMatchBucketStatsInterval.GetValueOnGameThread();
+	const double Now = FPlatformTime::Seconds();
+	if (StatsInterval > 0.f && Now - LastBucketStatsLogTime >= StatsInterval)
+	{
+		LastBucketStatsLogTime = Now;
+		LogMatchmakingBucketStats();
+	}
 }
 
 void AHellunaLobbyGameMode::BroadcastMatchmakingStatus()
 {
 	const double Now = FPlatformTime::Seconds();
 
-	// 같은 MapKey별 전체 대기 인원 합산
-	TMap<FString, int32> MapKeyPlayerCounts;
-	for (const FMatchmakingQueueEntry& Entry : MatchmakingQueue)
-	{
-		MapKeyPlayerCounts.FindOrAdd(Entry.SelectedMapKey) += Entry.GetPlayerCount();
-	}
-
 	for (const FMatchmakingQueueEntry& Entry : MatchmakingQueue)
 	{
 		FMatchmakingStatusInfo StatusInfo;
 		StatusInfo.Status = EMatchmakingStatus::Searching;
 		StatusInfo.ElapsedTime = static_cast<float>(Now - Entry.QueueEnterTime);
-		StatusInfo.CurrentPlayerCount = MapKeyPlayerCounts.FindRef(Entry.SelectedMapKey);
+		// [MatchBucketV1] 같은 버킷(맵 + 모드) 대기 인원 — 버킷이 유지하는 합계 사용
+		const FMatchmakingBucket* Bucket = MatchmakingBuckets.Find(MakeMatchmakingBucketKey(Entry));
+		StatusInfo.CurrentPlayerCount = Bucket ? Bucket->PlayerCount : Entry.GetPlayerCount();
 		StatusInfo.TargetPlayerCount = GetModeCapacity(Entry.GameMode);
 
 		for (const FString& PId : Entry.PlayerIds)
@@ -3617,102 +3771,119 @@ void AHellunaLobbyGameMode::BroadcastMatchmakingStatus()
 
 bool AHellunaLobbyGameMode::TryFormMatch()
 {
-	// Pass 1: 단일 엔트리가 모드 정원 이상 → 즉시 매칭 (SOLO=1, DUO=2, SQUAD=3)
-	for (int32 i = MatchmakingQueue.Num() - 1; i >= 0; --i)
+	// [MatchBucketV1] (맵 키 + 모드) 버킷별 greedy 패킹 — 한 패스에 가능한 매칭 전부 성사
+	const double Now = FPlatformTime::Seconds();
+	const float RelaxSeconds = CVarMatchRelaxSeconds.GetValueOnGameThread();
+
+	TArray<FMatchmakingPackedGroup> PackedGroups;
+	for (TPair<FMatchmakingBucketKey, FMatchmakingBucket>& Pair : MatchmakingBuckets)
 	{
-		const int32 Capacity = GetModeCapacity(MatchmakingQueue[i].GameMode);
-		if (MatchmakingQueue[i].GetPlayerCount() >= Capacity)
+		FMatchmakingBucket& Bucket = Pair.Value;
+		if (Bucket.EntryCount == 0)
 		{
-			TArray<FMatchmakingQueueEntry> Matched;
-			Matched.Add(MatchmakingQueue[i]);
-			auto ReassignedMap = ResolveHeroDuplication(Matched);
-			StartMatchCountdown(MoveTemp(Matched), MoveTemp(ReassignedMap));
-			return true;
+			continue;
 		}
-	}
 
-	// Pass 2: SQUAD 2인 + 1인 조합 — 같은 MapKey + 같은 GameMode
-	for (int32 a = 0; a < MatchmakingQueue.Num(); ++a)
-	{
-		if (MatchmakingQueue[a].GameMode != ELobbyGameMode::Squad) continue;
-		if (MatchmakingQueue[a].GetPlayerCount() != 2) continue;
+		const int32 FirstGroup = PackedGroups.Num();
+		PackMatchmakingBucket(Bucket, GetModeCapacity(Pair.Key.GameMode), Now, RelaxSeconds, PackedGroups);
 
-		for (int32 b = 0; b < MatchmakingQueue.Num(); ++b)
+		for (int32 g = FirstGroup; g < PackedGroups.Num(); ++g)
 		{
-			if (b == a) continue;
-			if (MatchmakingQueue[b].GameMode != ELobbyGameMode::Squad) continue;
-			if (MatchmakingQueue[b].GetPlayerCount() != 1) continue;
-			if (MatchmakingQueue[a].SelectedMapKey != MatchmakingQueue[b].SelectedMapKey) continue;
-
-			TArray<FMatchmakingQueueEntry> Matched;
-			Matched.Add(MatchmakingQueue[a]);
-			Matched.Add(MatchmakingQueue[b]);
-			auto ReassignedMap = ResolveHeroDuplication(Matched);
-			StartMatchCountdown(MoveTemp(Matched), MoveTemp(ReassignedMap));
-			return true;
+			++Bucket.MatchesFormed;
+			Bucket.TotalMatchedWaitSeconds += Now - PackedGroups[g].OldestEnterTime;
 		}
 	}
 
-	// Pass 3: DUO 1인 + 1인 조합 — 같은 MapKey + 같은 GameMode
-	for (int32 a = 0; a < MatchmakingQueue.Num(); ++a)
+	if (PackedGroups.Num() == 0)
 	{
-		if (MatchmakingQueue[a].GameMode != ELobbyGameMode::Duo) continue;
-		if (MatchmakingQueue[a].GetPlayerCount() != 1) continue;
+		return false;
+	}
 
-		for (int32 b = a + 1; b < MatchmakingQueue.Num(); ++b)
-		{
-			if (MatchmakingQueue[b].GameMode != ELobbyGameMode::Duo) continue;
-			if (MatchmakingQueue[b].GetPlayerCount() != 1) continue;
-			if (MatchmakingQueue[a].SelectedMapKey != MatchmakingQueue[b].SelectedMapKey) continue;
+	// StartMatchCountdown이 큐에서 제거하므로 엔트리 복사를 먼저 끝낸다
+	TMap<int32, int32> QueueIndexById;
+	QueueIndexById.Reserve(MatchmakingQueue.Num());
+	for (int32 i = 0; i < MatchmakingQueue.Num(); ++i)
+	{
+		QueueIndexById.Add(MatchmakingQueue[i].EntryId, i);
+	}
 
-			TArray<FMatchmakingQueueEntry> Matched;
-			Matched.Add(MatchmakingQueue[a]);
-			Matched.Add(MatchmakingQueue[b]);
-			auto ReassignedMap = ResolveHeroDuplication(Matched);
-			StartMatchCountdown(MoveTemp(Matched), MoveTemp(ReassignedMap));
-			return true;
+	TArray<TArray<FMatchmakingQueueEntry>> MatchedGroups;
+	MatchedGroups.Reserve(PackedGroups.Num());
+	for (const FMatchmakingPackedGroup& Group : PackedGroups)
+	{
+		TArray<FMatchmakingQueueEntry>& Matched = MatchedGroups.AddDefaulted_GetRef();
+		for (const int32 EntryId : Group.EntryIds)
+		{
+			if (const int32* Index = QueueIndexById.Find(EntryId))
+			{
+				Matched.Add(MatchmakingQueue[*Index]);
+			}
 		}
 	}
 
-	// Pass 4: SQUAD 1인 + 1인 + 1인 조합 — 같은 MapKey + 같은 GameMode
-	TArray<int32> SquadSoloIndices;
-	for (int32 i = 0; i < MatchmakingQueue.Num(); ++i)
+	UE_LOG(LogHellunaLobby, Log, TEXT("[LobbyGM] [MatchBucketV1] TryFormMatch: %d건 매칭 | QueueSize=%d"),
+		MatchedGroups.Num(), MatchmakingQueue.Num());
+
+	for (TArray<FMatchmakingQueueEntry>& Matched : MatchedGroups)
 	{
-		if (MatchmakingQueue[i].GameMode == ELobbyGameMode::Squad && MatchmakingQueue[i].GetPlayerCount() == 1)
+		if (Matched.Num() == 0)
 		{
-			SquadSoloIndices.Add(i);
+			continue;
 		}
+		auto ReassignedMap = ResolveHeroDuplication(Matched);
+		StartMatchCountdown(MoveTemp(Matched), MoveTemp(ReassignedMap));
 	}
 
-	if (SquadSoloIndices.Num() >= 3)
+	return true;
+}
+
+void AHellunaLobbyGameMode::GetMatchmakingBucketStats(TArray<FMatchmakingBucketStats>& OutStats) const
+{
+	OutStats.Reset();
+	const double Now = FPlatformTime::Seconds();
+
+	for (const TPair<FMatchmakingBucketKey, FMatchmakingBucket>& Pair : MatchmakingBuckets)
 	{
-		for (int32 a = 0; a < SquadSoloIndices.Num() - 2; ++a)
+		const FMatchmakingBucket& Bucket = Pair.Value;
+		if (Bucket.EntryCount == 0)
 		{
-			for (int32 b = a + 1; b < SquadSoloIndices.Num() - 1; ++b)
+			continue;
+		}
+
+		FMatchmakingBucketStats& Stats = OutStats.AddDefaulted_GetRef();
+		Stats.Key = Pair.Key;
+		Stats.EntryCount = Bucket.EntryCount;
+		Stats.PlayerCount = Bucket.PlayerCount;
+		Stats.MatchesFormed = Bucket.MatchesFormed;
+		Stats.AverageMatchedWaitSeconds = Bucket.MatchesFormed > 0
+			? static_cast<float>(Bucket.TotalMatchedWaitSeconds / Bucket.MatchesFormed) : 0.f;
+
+		double TotalWait = 0.0;
+		for (const TArray<FMatchmakingBucketSlot>& Slots : Bucket.SlotsBySize)
+		{
+			for (const FMatchmakingBucketSlot& Slot : Slots)
 			{
-				if (MatchmakingQueue[SquadSoloIndices[a]].SelectedMapKey != MatchmakingQueue[SquadSoloIndices[b]].SelectedMapKey)
-				{
-					continue;
-				}
-				for (int32 c = b + 1; c < SquadSoloIndices.Num(); ++c)
-				{
-					if (MatchmakingQueue[SquadSoloIndices[a]].SelectedMapKey != MatchmakingQueue[SquadSoloIndices[c]].SelectedMapKey)
-					{
-						continue;
-					}
-					TArray<FMatchmakingQueueEntry> Matched;
-					Matched.Add(MatchmakingQueue[SquadSoloIndices[a]]);
-					Matched.Add(MatchmakingQueue[SquadSoloIndices[b]]);
-					Matched.Add(MatchmakingQueue[SquadSoloIndices[c]]);
-					auto ReassignedMap = ResolveHeroDuplication(Matched);
-					StartMatchCountdown(MoveTemp(Matched), MoveTemp(ReassignedMap));
-					return true;
-				}
+				const double Wait = Now - Slot.QueueEnterTime;
+				TotalWait += Wait;
+				Stats.OldestWaitSeconds = FMath::Max(Stats.OldestWaitSeconds, static_cast<float>(Wait));
 			}
 		}
+		Stats.AverageWaitSeconds = static_cast<float>(TotalWait / Bucket.EntryCount);
 	}
+}
 
-	return false;
+void AHellunaLobbyGameMode::LogMatchmakingBucketStats() const
+{
+	TArray<FMatchmakingBucketStats> AllStats;
+	GetMatchmakingBucketStats(AllStats);
+
+	for (const FMatchmakingBucketStats& Stats : AllStats)
+	{
+		UE_LOG(LogHellunaLobby, Log,
+			TEXT("[LobbyGM] [MatchBucketV1] Bucket Map=%s Mode=%d | Entries=%d Players=%d | Wait 최장=%.1fs 평균=%.1fs | Matches=%d 평균매칭대기=%.1fs"),
+			*Stats.Key.MapKey, static_cast<int32>(Stats.Key.GameMode), Stats.EntryCount, Stats.PlayerCount,
+			Stats.OldestWaitSeconds, Stats.AverageWaitSeconds, Stats.MatchesFormed, Stats.AverageMatchedWaitSeconds);
+	}
 }
 
 void AHellunaLobbyGameMode::ExecuteMatchedDeploy(const TArray<FMatchmakingQueueEntry>& Matched, bool bRequeueOnFailure)
@@ -3771,6 +3942,14 @@ void AHellunaLobbyGameMode::ExecuteMatchedDeploy(const TArray<FMatchmakingQueueE
 				return;
 			}
 
+			// [WarmPoolV1] 웜 서버는 assign ack("empty") 이후에 클라를 보내야 함 → WaitAndDeploy 경유
+			const int32 WarmPort = ClaimWarmServerForMap(MapKey, Matched[0].PartyId);
+			if (WarmPort > 0)
+			{
+				WaitAndDeploy(WarmPort, Matched, MapKey, bRequeueOnFailure);
+				return;
+			}
+
 			const FString MapPath = GetMapPathByKey(MapKey);
 			if (MapPath.IsEmpty())
 			{
@@ -3933,6 +4112,20 @@ void AHellunaLobbyGameMode::ExecuteMatchedDeploy(const TArray<FMatchmakingQueueE
 			return;
 		}
 
+		// [WarmPoolV1] 웜 서버 배정 → assign ack("empty")까지 WaitAndDeploy로 대기
+		const int32 WarmPort = ClaimWarmServerForMap(MapKey, Matched.Num() > 0 ? Matched[0].PartyId : 0);
+		if (WarmPort > 0)
+		{
+			for (const FMatchmakingQueueEntry& Entry : Matched)
+			{
+				RemoveQueueEntry(Entry.EntryId);
+			}
+
+			TArray<FMatchmakingQueueEntry> MatchedCopy = Matched;
+			WaitAndDeploy(WarmPort, MoveTemp(MatchedCopy), MapKey);
+			return;
+		}
+
 		// [Phase 19] 아무 빈 서버 찾기 → 종료 후 같은 포트에 새 맵으로 재스폰
 		// (ServerTravel은 UE 5.7 World Partition 크래시 유발 → 프로세스 재시작 방식)
 		FGameChannelInfo AnyEmptyChannel;
@@ -4097,7 +4290,7 @@ void AHellunaLobbyGameMode::WaitAndDeploy(int32 Port, TArray<FMatchmakingQueueEn
 		constexpr double TimeoutSeconds = 30.0;
 		constexpr float PollInterval = 0.5f;
 		const FString ResolvedMapPath = GetMapPathByKey(MapKey);
-		const FString ExpectedMapIdentifier = NormalizeLobbyMapIdentifier(ResolvedMapPath.IsEmpty() ? MapKey : ResolvedMapPath);
+		const FString ExpectedMapIdentifier = HellunaChannelRegistry::NormalizeMapIdentifier(ResolvedMapPath.IsEmpty() ? MapKey : ResolvedMapPath);
 
 		FTimerHandle& TimerHandle = WaitAndDeployTimers.FindOrAdd(Port);
 		TWeakObjectPtr<AHellunaLobbyGameMode> WeakThis(this);
@@ -4719,6 +4912,14 @@ void AHellunaLobbyGameMode::WriteMapSwitchCommand(int32 Port, const FString& Map
 		TEXT("{\"command\":\"servertravel\",\"mapPath\":\"%s\",\"timestamp\":\"%s\"}"),
 		*MapPath, *FDateTime::UtcNow().ToIso8601());
 
+	// [ChannelRegistryV1] 하트비트 소켓이 살아 있는 서버는 소켓으로 즉시 전달, 아니면 커맨드 파일
+	if (ChannelRegistry && ChannelRegistry->SendCommand(Port, Json))
+	{
+		UE_LOG(LogHellunaLobby, Log, TEXT("[Phase19] WriteMapSwitchCommand (socket) | Port=%d | MapPath=%s"),
+			Port, *MapPath);
+		return;
+	}
+
 	FFileHelper::SaveStringToFile(Json, *CmdPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
 
 	UE_LOG(LogHellunaLobby, Log, TEXT("[Phase19] WriteMapSwitchCommand | Port=%d | MapPath=%s | Path=%s"),
@@ -4736,6 +4937,22 @@ void AHellunaLobbyGameMode::RemoveQueueEntry(int32 EntryId)
 			{
 				PlayerToQueueEntryMap.Remove(PId);
 			}
+
+			// [MatchBucketV1] 버킷에서 제거
+			if (FMatchmakingBucket* Bucket = MatchmakingBuckets.Find(MakeMatchmakingBucketKey(MatchmakingQueue[i])))
+			{
+				TArray<FMatchmakingBucketSlot>& Slots =
+					Bucket->SlotsBySize[FMatchmakingBucket::GetSizeIndex(MatchmakingQueue[i].GetPlayerCount())];
+				const int32 SlotIndex = Slots.IndexOfByPredicate(
+					[EntryId](const FMatchmakingBucketSlot& Slot) { return Slot.EntryId == EntryId; });
+				if (SlotIndex != INDEX_NONE)
+				{
+					Bucket->PlayerCount -= Slots[SlotIndex].PlayerCount;
+					--Bucket->EntryCount;
+					Slots.RemoveAt(SlotIndex);
+				}
+			}
+
 			MatchmakingQueue.RemoveAt(i);
 			break;
 		}
@@ -4753,6 +4970,17 @@ void AHellunaLobbyGameMode::EnqueueMatchmakingEntry(FMatchmakingQueueEntry Entry
 		PlayerToQueueEntryMap.Add(PId, Entry.EntryId);
 	}
 
+	// [MatchBucketV1] 버킷 인덱스 갱신 (큐 진입 순 유지)
+	{
+		FMatchmakingBucket& Bucket = MatchmakingBuckets.FindOrAdd(MakeMatchmakingBucketKey(Entry));
+		FMatchmakingBucketSlot& Slot = Bucket.SlotsBySize[FMatchmakingBucket::GetSizeIndex(Entry.GetPlayerCount())].AddDefaulted_GetRef();
+		Slot.EntryId = Entry.EntryId;
+		Slot.PlayerCount = Entry.GetPlayerCount();
+		Slot.QueueEnterTime = Entry.QueueEnterTime;
+		++Bucket.EntryCount;
+		Bucket.PlayerCount += Slot.PlayerCount;
+	}
+
 	UE_LOG(LogHellunaLobby, Log, TEXT("[LobbyGM] [Phase15] 큐 엔트리 추가 | EntryId=%d | PlayerCount=%d | QueueSize=%d"),
 		Entry.EntryId, Entry.GetPlayerCount(), MatchmakingQueue.Num());
 
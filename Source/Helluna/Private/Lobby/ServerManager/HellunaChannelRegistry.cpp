@@ -0,0 +1,596 @@
+// ============================================================================
+// HellunaChannelRegistry.cpp
+// ============================================================================
+
+#include "Lobby/ServerManager/HellunaChannelRegistry.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "Common/UdpSocketBuilder.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/CommandLine.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Dom/JsonObject.h"
+#include "Lobby/HellunaLobbyLog.h"
+
+static TAutoConsoleVariable<float> CVarChannelStaleSeconds(
+	TEXT("Helluna.Lobby.ChannelStaleSeconds"),
+	15.f,
+	TEXT("소켓 하트비트가 이 시간(초) 동안 없으면 채널을 Offline 처리 (게임서버 하트비트 5초)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarChannelRegistryScanInterval(
+	TEXT("Helluna.Lobby.ChannelRegistryScanInterval"),
+	2.f,
+	TEXT("ServerRegistry 폴더 mtime 감시 주기(초). 소켓 미사용 게임서버용 폴백"),
+	ECVF_Default);
+
+namespace
+{
+/** 파일 레지스트리 신선도 (게임서버 파일 하트비트 30초 x 2) */
+constexpr double FileChannelStaleSeconds = 60.0;
+
+/** UDP 최대 페이로드 */
+constexpr uint32 MaxPacketSize = 65507;
+
+/** "channel_7778.json" → 7778. 형식이 다르면 0 */
+int32 ParsePortFromFileName(const FString& FileName)
+{
+	FString Base = FPaths::GetBaseFilename(FileName);
+	if (!Base.RemoveFromStart(TEXT("channel_")))
+	{
+		return 0;
+	}
+	return Base.IsNumeric() ? FCString::Atoi(*Base) : 0;
+}
+
+FString BytesToString(const uint8* Data, int32 Num)
+{
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data), Num);
+	return FString(Converted.Length(), Converted.Get());
+}
+
+bool SendString(FSocket* Socket, const FString& Payload, const FInternetAddr& Dest)
+{
+	const FTCHARToUTF8 Utf8(*Payload);
+	int32 BytesSent = 0;
+	return Socket->SendTo(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length(), BytesSent, Dest)
+		&& BytesSent == Utf8.Length();
+}
+
+/** non-blocking 수신 1개. 없으면 false */
+bool ReceiveString(FSocket* Socket, FString& OutPayload, FInternetAddr& OutSender)
+{
+	uint32 PendingSize = 0;
+	if (!Socket->HasPendingData(PendingSize))
+	{
+		return false;
+	}
+
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(FMath::Clamp<uint32>(PendingSize, 1, MaxPacketSize));
+
+	int32 BytesRead = 0;
+	if (!Socket->RecvFrom(Buffer.GetData(), Buffer.Num(), BytesRead, OutSender) || BytesRead <= 0)
+	{
+		return false;
+	}
+
+	OutPayload = BytesToString(Buffer.GetData(), BytesRead);
+	return true;
+}
+
+void DestroySocket(FSocket*& Socket)
+{
+	if (!Socket)
+	{
+		return;
+	}
+	Socket->Close();
+	if (ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM))
+	{
+		SocketSubsystem->DestroySocket(Socket);
+	}
+	Socket = nullptr;
+}
+}
+
+// ============================================================================
+// 공용 헬퍼
+// ============================================================================
+
+int32 HellunaChannelRegistry::GetListenPort()
+{
+	int32 Port = DefaultListenPort;
+	FParse::Value(FCommandLine::Get(), TEXT("-ChannelRegistryPort="), Port);
+	return Port;
+}
+
+bool HellunaChannelRegistry::ParseChannelJson(const FString& JsonString, FGameChannelInfo& OutInfo, FDateTime& OutLastUpdate)
+{
+	TSharedPtr<FJsonObject> JsonObj;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObj) || !JsonObj.IsValid())
+	{
+		return false;
+	}
+
+	OutInfo.ChannelId = JsonObj->GetStringField(TEXT("channelId"));
+	OutInfo.Port = static_cast<int32>(JsonObj->GetNumberField(TEXT("port")));
+	OutInfo.CurrentPlayers = static_cast<int32>(JsonObj->GetNumberField(TEXT("currentPlayers")));
+	OutInfo.MaxPlayers = static_cast<int32>(JsonObj->GetNumberField(TEXT("maxPlayers")));
+	OutInfo.MapName = JsonObj->GetStringField(TEXT("mapName"));
+
+	// Status 문자열 → enum
+	const FString StatusStr = JsonObj->GetStringField(TEXT("status"));
+	if (StatusStr == TEXT("playing"))
+	{
+		OutInfo.Status = EChannelStatus::Playing;
+	}
+	else if (StatusStr == TEXT("empty"))
+	{
+		OutInfo.Status = EChannelStatus::Empty;
+	}
+	else if (StatusStr == TEXT("idle"))
+	{
+		OutInfo.Status = EChannelStatus::Idle;
+	}
+	else
+	{
+		OutInfo.Status = EChannelStatus::Offline;
+	}
+
+	if (!FDateTime::ParseIso8601(*JsonObj->GetStringField(TEXT("lastUpdate")), OutLastUpdate))
+	{
+		OutLastUpdate = FDateTime::MinValue();
+	}
+
+	return OutInfo.Port > 0;
+}
+
+FString HellunaChannelRegistry::NormalizeMapIdentifier(const FString& MapIdentifier)
+{
+	FString Normalized = MapIdentifier;
+	Normalized.TrimStartAndEndInline();
+
+	if (Normalized.Contains(TEXT("/")) || Normalized.Contains(TEXT("\\")))
+	{
+		Normalized = FPaths::GetBaseFilename(Normalized);
+	}
+
+	return Normalized;
+}
+
+bool HellunaChannelRegistry::DoesMapIdentifierMatch(const FString& A, const FString& B)
+{
+	const FString NormalizedA = NormalizeMapIdentifier(A);
+	const FString NormalizedB = NormalizeMapIdentifier(B);
+
+	return !NormalizedA.IsEmpty()
+		&& !NormalizedB.IsEmpty()
+		&& NormalizedA.Equals(NormalizedB, ESearchCase::IgnoreCase);
+}
+
+FString HellunaChannelRegistry::MakeMapIndexKey(const FString& MapIdentifier)
+{
+	return NormalizeMapIdentifier(MapIdentifier).ToLower();
+}
+
+// ============================================================================
+// Initialize / Shutdown
+// ============================================================================
+
+void UHellunaChannelRegistry::Initialize(const FString& InRegistryDir, int32 InListenPort)
+{
+	RegistryDir = InRegistryDir;
+
+	ListenSocket = FUdpSocketBuilder(TEXT("HellunaChannelRegistry"))
+		.AsNonBlocking()
+		.BoundToEndpoint(FIPv4Endpoint(FIPv4Address::InternalLoopback, InListenPort))
+		.WithReceiveBufferSize(256 * 1024)
+		.Build();
+
+	if (ListenSocket)
+	{
+		UE_LOG(LogHellunaLobby, Log, TEXT("[ChannelRegistry] 하트비트 소켓 수신 시작 | 127.0.0.1:%d"), InListenPort);
+	}
+	else
+	{
+		UE_LOG(LogHellunaLobby, Warning,
+			TEXT("[ChannelRegistry] 소켓 바인드 실패 → 폴더 감시만으로 동작 | Port=%d"), InListenPort);
+	}
+
+	// 로비 재시작 시 이미 떠 있는 게임서버 반영
+	ScanRegistryDirectory();
+
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UHellunaChannelRegistry::Tick));
+}
+
+void UHellunaChannelRegistry::Shutdown()
+{
+	if (TickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+		TickHandle.Reset();
+	}
+
+	DestroySocket(ListenSocket);
+
+	Entries.Empty();
+	PortsByStatus.Empty();
+	PortsByMap.Empty();
+	KnownFileTimes.Empty();
+}
+
+// ============================================================================
+// Tick — 소켓은 매 프레임, 폴더 감시/만료는 주기적으로
+// ============================================================================
+
+bool UHellunaChannelRegistry::Tick(float DeltaTime)
+{
+	DrainSocket();
+
+	const double Now = FPlatformTime::Seconds();
+
+	if (Now - LastFileScanTime >= CVarChannelRegistryScanInterval.GetValueOnGameThread())
+	{
+		ScanRegistryDirectory();
+	}
+
+	if (Now - LastExpireCheckTime >= 1.0)
+	{
+		LastExpireCheckTime = Now;
+		ExpireStaleChannels(Now);
+	}
+
+	return true;
+}
+
+void UHellunaChannelRegistry::DrainSocket()
+{
+	if (!ListenSocket)
+	{
+		return;
+	}
+
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (!SocketSubsystem)
+	{
+		return;
+	}
+
+	FString Payload;
+	TSharedRef<FInternetAddr> Sender = SocketSubsystem->CreateInternetAddr();
+	while (ReceiveString(ListenSocket, Payload, *Sender))
+	{
+		FGameChannelInfo Info;
+		FDateTime LastUpdate;
+		if (!HellunaChannelRegistry::ParseChannelJson(Payload, Info, LastUpdate))
+		{
+			UE_LOG(LogHellunaLobby, Warning, TEXT("[ChannelRegistry] 잘못된 하트비트 패킷 무시 | From=%s"),
+				*Sender->ToString(true));
+			continue;
+		}
+
+		ApplyUpdate(Info, FPlatformTime::Seconds(), true, Sender);
+
+		// 다음 패킷은 새 주소 객체로 받는다 (Endpoint로 보관되었으므로)
+		Sender = SocketSubsystem->CreateInternetAddr();
+	}
+}
+
+// ============================================================================
+// 폴더 감시 폴백 — mtime이 바뀐 파일만 파싱
+// ============================================================================
+
+void UHellunaChannelRegistry::ScanRegistryDirectory()
+{
+	LastFileScanTime = FPlatformTime::Seconds();
+
+	if (RegistryDir.IsEmpty())
+	{
+		return;
+	}
+
+	TMap<FString, FDateTime> CurrentFiles;
+	IFileManager::Get().IterateDirectoryStat(*RegistryDir,
+		[&CurrentFiles](const TCHAR* Path, const FFileStatData& Stat)
+		{
+			if (!Stat.bIsDirectory)
+			{
+				const FString FileName = FPaths::GetCleanFilename(Path);
+				if (FileName.StartsWith(TEXT("channel_")) && FileName.EndsWith(TEXT(".json")))
+				{
+					CurrentFiles.Add(FileName, Stat.ModificationTime);
+				}
+			}
+			return true;
+		});
+
+	// 삭제된 파일 → 소켓으로 살아있지 않은 채널 제거
+	for (auto It = KnownFileTimes.CreateIterator(); It; ++It)
+	{
+		if (CurrentFiles.Contains(It.Key()))
+		{
+			continue;
+		}
+
+		const int32 Port = ParsePortFromFileName(It.Key());
+		const FChannelEntry* Entry = Entries.Find(Port);
+		if (Entry && !Entry->bFromSocket)
+		{
+			RemoveChannel(Port);
+		}
+		It.RemoveCurrent();
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	const FDateTime UtcNow = FDateTime::UtcNow();
+	const double SocketStaleSeconds = CVarChannelStaleSeconds.GetValueOnGameThread();
+
+	for (const TPair<FString, FDateTime>& File : CurrentFiles)
+	{
+		const FDateTime* KnownTime = KnownFileTimes.Find(File.Key);
+		if (KnownTime && *KnownTime == File.Value)
+		{
+			continue;
+		}
+
+		FString JsonString;
+		if (!FFileHelper::LoadFileToString(JsonString, *FPaths::Combine(RegistryDir, File.Key)))
+		{
+			continue;
+		}
+
+		FGameChannelInfo Info;
+		FDateTime LastUpdate;
+		if (!HellunaChannelRegistry::ParseChannelJson(JsonString, Info, LastUpdate))
+		{
+			// 부분 기록 중일 수 있음 — mtime을 기록하지 않고 다음 스캔에서 재시도
+			continue;
+		}
+		KnownFileTimes.Add(File.Key, File.Value);
+
+		// 소켓 하트비트가 살아 있으면 소켓이 권위 — 파일 내용으로 덮어쓰지 않음
+		if (const FChannelEntry* Entry = Entries.Find(Info.Port))
+		{
+			if (Entry->bFromSocket && Now - Entry->LastSeenTime <= SocketStaleSeconds)
+			{
+				continue;
+			}
+		}
+
+		const FDateTime Stamp = (LastUpdate == FDateTime::MinValue()) ? File.Value : LastUpdate;
+		const double AgeSeconds = FMath::Max(0.0, (UtcNow - Stamp).GetTotalSeconds());
+		ApplyUpdate(Info, Now - AgeSeconds, false, nullptr);
+	}
+}
+
+void UHellunaChannelRegistry::ExpireStaleChannels(double Now)
+{
+	const double SocketStaleSeconds = CVarChannelStaleSeconds.GetValueOnGameThread();
+
+	TArray<int32> ExpiredPorts;
+	for (const TPair<int32, FChannelEntry>& Pair : Entries)
+	{
+		const FChannelEntry& Entry = Pair.Value;
+		if (Entry.Info.Status == EChannelStatus::Offline)
+		{
+			continue;
+		}
+
+		const double Limit = Entry.bFromSocket ? SocketStaleSeconds : FileChannelStaleSeconds;
+		if (Now - Entry.LastSeenTime > Limit)
+		{
+			ExpiredPorts.Add(Pair.Key);
+		}
+	}
+
+	for (const int32 Port : ExpiredPorts)
+	{
+		FChannelEntry& Entry = Entries[Port];
+		UE_LOG(LogHellunaLobby, Warning, TEXT("[ChannelRegistry] 채널 %s 타임아웃 (%.0f초) → Offline"),
+			*Entry.Info.ChannelId, Now - Entry.LastSeenTime);
+
+		UnindexEntry(Port, Entry);
+		Entry.Info.Status = EChannelStatus::Offline;
+		IndexEntry(Port, Entry);
+	}
+}
+
+// ============================================================================
+// 엔트리 / 인덱스
+// ============================================================================
+
+void UHellunaChannelRegistry::ApplyUpdate(const FGameChannelInfo& Info, double SeenTime, bool bFromSocket, const TSharedPtr<FInternetAddr>& Endpoint)
+{
+	FChannelEntry* Existing = Entries.Find(Info.Port);
+	const EChannelStatus PrevStatus = Existing ? Existing->Info.Status : EChannelStatus::Offline;
+
+	if (Existing)
+	{
+		UnindexEntry(Info.Port, *Existing);
+	}
+
+	FChannelEntry& Entry = Existing ? *Existing : Entries.Add(Info.Port);
+	Entry.Info = Info;
+	Entry.MapKey = HellunaChannelRegistry::MakeMapIndexKey(Info.MapName);
+	Entry.LastSeenTime = SeenTime;
+	Entry.bFromSocket = bFromSocket;
+	Entry.Endpoint = Endpoint;
+
+	// 파일로 읽은 lastUpdate가 이미 만료 범위면 곧바로 Offline
+	if (!bFromSocket && FPlatformTime::Seconds() - SeenTime > FileChannelStaleSeconds)
+	{
+		Entry.Info.Status = EChannelStatus::Offline;
+	}
+
+	IndexEntry(Info.Port, Entry);
+
+	if (!Existing || PrevStatus != Entry.Info.Status)
+	{
+		UE_LOG(LogHellunaLobby, Log, TEXT("[ChannelRegistry] %s | Port=%d | Status=%d | Players=%d | Map=%s | Source=%s"),
+			*Entry.Info.ChannelId, Info.Port, static_cast<int32>(Entry.Info.Status), Entry.Info.CurrentPlayers,
+			*Entry.Info.MapName, bFromSocket ? TEXT("socket") : TEXT("file"));
+	}
+}
+
+void UHellunaChannelRegistry::IndexEntry(int32 Port, const FChannelEntry& Entry)
+{
+	PortsByStatus.FindOrAdd(Entry.Info.Status).Add(Port);
+	if (!Entry.MapKey.IsEmpty())
+	{
+		PortsByMap.FindOrAdd(Entry.MapKey).Add(Port);
+	}
+}
+
+void UHellunaChannelRegistry::UnindexEntry(int32 Port, const FChannelEntry& Entry)
+{
+	if (TSet<int32>* StatusPorts = PortsByStatus.Find(Entry.Info.Status))
+	{
+		StatusPorts->Remove(Port);
+	}
+	if (TSet<int32>* MapPorts = PortsByMap.Find(Entry.MapKey))
+	{
+		MapPorts->Remove(Port);
+		if (MapPorts->IsEmpty())
+		{
+			PortsByMap.Remove(Entry.MapKey);
+		}
+	}
+}
+
+void UHellunaChannelRegistry::RemoveChannel(int32 Port)
+{
+	if (const FChannelEntry* Entry = Entries.Find(Port))
+	{
+		UnindexEntry(Port, *Entry);
+		Entries.Remove(Port);
+		UE_LOG(LogHellunaLobby, Log, TEXT("[ChannelRegistry] 채널 제거 | Port=%d"), Port);
+	}
+}
+
+// ============================================================================
+// 조회
+// ============================================================================
+
+const FGameChannelInfo* UHellunaChannelRegistry::FindChannel(int32 Port) const
+{
+	const FChannelEntry* Entry = Entries.Find(Port);
+	return Entry ? &Entry->Info : nullptr;
+}
+
+void UHellunaChannelRegistry::GetPortsByStatus(EChannelStatus Status, TArray<int32>& OutPorts) const
+{
+	OutPorts.Reset();
+	if (const TSet<int32>* Ports = PortsByStatus.Find(Status))
+	{
+		OutPorts = Ports->Array();
+		OutPorts.Sort();
+	}
+}
+
+void UHellunaChannelRegistry::GetPortsForMap(const FString& MapIdentifier, EChannelStatus Status, TArray<int32>& OutPorts) const
+{
+	OutPorts.Reset();
+
+	const TSet<int32>* MapPorts = PortsByMap.Find(HellunaChannelRegistry::MakeMapIndexKey(MapIdentifier));
+	const TSet<int32>* StatusPorts = PortsByStatus.Find(Status);
+	if (!MapPorts || !StatusPorts)
+	{
+		return;
+	}
+
+	// 작은 쪽을 순회하며 교집합
+	const TSet<int32>& Smaller = MapPorts->Num() <= StatusPorts->Num() ? *MapPorts : *StatusPorts;
+	const TSet<int32>& Larger = MapPorts->Num() <= StatusPorts->Num() ? *StatusPorts : *MapPorts;
+	for (const int32 Port : Smaller)
+	{
+		if (Larger.Contains(Port))
+		{
+			OutPorts.Add(Port);
+		}
+	}
+	OutPorts.Sort();
+}
+
+// ============================================================================
+// 로비 → 게임서버 커맨드
+// ============================================================================
+
+bool UHellunaChannelRegistry::SendCommand(int32 Port, const FString& JsonCommand)
+{
+	const FChannelEntry* Entry = Entries.Find(Port);
+	if (!ListenSocket || !Entry || !Entry->bFromSocket || !Entry->Endpoint.IsValid())
+	{
+		return false;
+	}
+
+	if (!SendString(ListenSocket, JsonCommand, *Entry->Endpoint))
+	{
+		UE_LOG(LogHellunaLobby, Warning, TEXT("[ChannelRegistry] 커맨드 전송 실패 | Port=%d"), Port);
+		return false;
+	}
+	return true;
+}
+
+// ============================================================================
+// FHellunaChannelRegistryClient (게임서버 측)
+// ============================================================================
+
+FHellunaChannelRegistryClient::~FHellunaChannelRegistryClient()
+{
+	Close();
+}
+
+bool FHellunaChannelRegistryClient::Open(int32 LobbyRegistryPort)
+{
+	Close();
+
+	// 임의 포트에 바인드 — 로비가 이 주소로 커맨드를 역전송
+	Socket = FUdpSocketBuilder(TEXT("HellunaChannelRegistryClient"))
+		.AsNonBlocking()
+		.BoundToEndpoint(FIPv4Endpoint(FIPv4Address::InternalLoopback, 0))
+		.Build();
+
+	if (!Socket)
+	{
+		return false;
+	}
+
+	LobbyAddr = FIPv4Endpoint(FIPv4Address::InternalLoopback, LobbyRegistryPort).ToInternetAddr();
+	return true;
+}
+
+void FHellunaChannelRegistryClient::Close()
+{
+	DestroySocket(Socket);
+	LobbyAddr.Reset();
+}
+
+bool FHellunaChannelRegistryClient::SendState(const FString& JsonState)
+{
+	return Socket && LobbyAddr.IsValid() && SendString(Socket, JsonState, *LobbyAddr);
+}
+
+bool FHellunaChannelRegistryClient::ReceiveCommand(FString& OutJsonCommand)
+{
+	if (!Socket)
+	{
+		return false;
+	}
+
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (!SocketSubsystem)
+	{
+		return false;
+	}
+
+	TSharedRef<FInternetAddr> Sender = SocketSubsystem->CreateInternetAddr();
+	return ReceiveString(Socket, OutJsonCommand, *Sender);
+}
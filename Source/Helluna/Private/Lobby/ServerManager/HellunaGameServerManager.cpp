@@ -3,46 +3,18 @@
 // ============================================================================
 
 #include "Lobby/ServerManager/HellunaGameServerManager.h"
+#include "Lobby/ServerManager/HellunaChannelRegistry.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "HAL/FileManager.h"
 #include "HAL/PlatformProcess.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Dom/JsonObject.h"
 #include "Lobby/HellunaLobbyLog.h"
 
-namespace
-{
-FString NormalizeServerRegistryMapIdentifier(const FString& InValue)
-{
-	FString Normalized = InValue;
-	Normalized.TrimStartAndEndInline();
-
-	if (Normalized.IsEmpty())
-	{
-		return Normalized;
-	}
-
-	if (Normalized.Contains(TEXT("/")) || Normalized.Contains(TEXT("\\")))
-	{
-		Normalized = FPaths::GetBaseFilename(Normalized);
-	}
-
-	return Normalized;
-}
-
-bool DoesServerRegistryMapMatch(const FString& RegistryMapName, const FString& RequestedMapIdentifier)
-{
-	const FString NormalizedRegistry = NormalizeServerRegistryMapIdentifier(RegistryMapName);
-	const FString NormalizedRequested = NormalizeServerRegistryMapIdentifier(RequestedMapIdentifier);
-
-	return !NormalizedRegistry.IsEmpty()
-		&& !NormalizedRequested.IsEmpty()
-		&& NormalizedRegistry.Equals(NormalizedRequested, ESearchCase::IgnoreCase);
-}
-}
-
 // ============================================================================
 // Initialize
 // ============================================================================
@@ -115,6 +87,9 @@ int32 UHellunaGameServerManager::SpawnGameServer(const FString& MapPath)
 			Port, *MapPath);
 	}
 
+	// [ChannelRegistryV1] 하트비트 수신 포트 전달
+	Args += FString::Printf(TEXT(" -ChannelRegistryPort=%d"), HellunaChannelRegistry::GetListenPort());
+
 	UE_LOG(LogHellunaLobby, Log, TEXT("[ServerManager] SpawnGameServer | Exe=%s | Args=%s"), *ServerExe, *Args);
 
 	FProcHandle Handle = FPlatformProcess::CreateProc(
@@ -151,7 +126,7 @@ int32 UHellunaGameServerManager::SpawnGameServer(const FString& MapPath)
 // [Phase 19] SpawnGameServerOnPort — 지정 포트에 스폰
 // ============================================================================
 
-int32 UHellunaGameServerManager::SpawnGameServerOnPort(int32 Port, const FString& MapPath)
+int32 UHellunaGameServerManager::SpawnGameServerOnPort(int32 Port, const FString& MapPath, bool bWarmStandby)
 {
 	const FString ServerExe = GetServerExecutablePath();
 	if (ServerExe.IsEmpty())
@@ -182,6 +157,14 @@ int32 UHellunaGameServerManager::SpawnGameServerOnPort(int32 Port, const FString
 			Port, *MapPath);
 	}
 
+	Args += FString::Printf(TEXT(" -ChannelRegistryPort=%d"), HellunaChannelRegistry::GetListenPort());
+
+	// [WarmPoolV1] 맵 로드 후 "idle"로 배정 대기
+	if (bWarmStandby)
+	{
+		Args += TEXT(" -WarmStandby");
+	}
+
 	UE_LOG(LogHellunaLobby, Log, TEXT("[ServerManager] SpawnGameServerOnPort | Port=%d | Args=%s"), Port, *Args);
 
 	FProcHandle Handle = FPlatformProcess::CreateProc(
@@ -198,6 +181,7 @@ int32 UHellunaGameServerManager::SpawnGameServerOnPort(int32 Port, const FString
 	Info.Port = Port;
 	Info.MapPath = MapPath;
 	Info.SpawnTime = FPlatformTime::Seconds();
+	Info.bWarmStandby = bWarmStandby;
 	ActiveServers.Add(MoveTemp(Info));
 
 	UE_LOG(LogHellunaLobby, Log, TEXT("[ServerManager] SpawnGameServerOnPort 성공 | Port=%d | MapPath=%s | ActiveCount=%d"),
@@ -252,8 +236,143 @@ int32 UHellunaGameServerManager::RespawnGameServer(int32 Port, const FString& Ne
 	return SpawnGameServerOnPort(Port, NewMapPath);
 }
 
+// ============================================================================
+// [WarmPoolV1] 웜 스탠바이 풀
+// ============================================================================
+
+void UHellunaGameServerManager::SetWarmPoolTargets(const TMap<FString, int32>& InTargets)
+{
+	WarmPoolTargets.Reset();
+	for (const TPair<FString, int32>& Pair : InTargets)
+	{
+		if (!Pair.Key.IsEmpty() && Pair.Value > 0)
+		{
+			WarmPoolTargets.Add(Pair.Key, Pair.Value);
+			UE_LOG(LogHellunaLobby, Log, TEXT("[ServerManager] [WarmPoolV1] 웜 풀 목표 | MapPath=%s | Count=%d"), *Pair.Key, Pair.Value);
+		}
+	}
+
+	if (!WorldRef.IsValid())
+	{
+		return;
+	}
+
+	FTimerManager& TimerManager = WorldRef->GetTimerManager();
+	if (WarmPoolTargets.Num() == 0)
+	{
+		TimerManager.ClearTimer(WarmPoolTimer);
+		return;
+	}
+
+	TimerManager.SetTimer(WarmPoolTimer, this, &UHellunaGameServerManager::RefillWarmPool,
+		WarmPoolRefillInterval, true, 0.f);
+}
+
+bool UHellunaGameServerManager::ClaimWarmServer(const FString& MapIdentifier, FGameChannelInfo& OutChannel, int32 PartyId)
+{
+	if (!ChannelRegistry || WarmPoolTargets.Num() == 0)
+	{
+		return false;
+	}
+
+	for (FActiveServerInfo& Info : ActiveServers)
+	{
+		if (!Info.bWarmStandby || !HellunaChannelRegistry::DoesMapIdentifierMatch(Info.MapPath, MapIdentifier))
+		{
+			continue;
+		}
+
+		if (!FPlatformProcess::IsProcRunning(Info.ProcessHandle))
+		{
+			continue;
+		}
+
+		// 아직 맵 로딩 중인 서버는 registry에 idle이 올라오기 전 → 건너뜀
+		const FGameChannelInfo* Ch = ChannelRegistry->FindChannel(Info.Port);
+		if (!Ch || Ch->Status != EChannelStatus::Idle)
+		{
+			continue;
+		}
+
+		const FString Json = FString::Printf(
+			TEXT("{\"command\":\"assign\",\"mapPath\":\"%s\",\"partyId\":\"%d\",\"timestamp\":\"%s\"}"),
+			*Info.MapPath, PartyId, *FDateTime::UtcNow().ToIso8601());
+
+		// 소켓 하트비트 중이면 즉시 전달, 아니면 커맨드 파일 (게임서버 PollForCommand가 둘 다 처리)
+		const bool bSentBySocket = ChannelRegistry->SendCommand(Info.Port, Json);
+		if (!bSentBySocket)
+		{
+			const FString CmdPath = FPaths::Combine(RegistryDir, FString::Printf(TEXT("command_%d.json"), Info.Port));
+			if (!FFileHelper::SaveStringToFile(Json, *CmdPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+			{
+				UE_LOG(LogHellunaLobby, Warning, TEXT("[ServerManager] [WarmPoolV1] assign 커맨드 쓰기 실패 | Port=%d | Path=%s"),
+					Info.Port, *CmdPath);
+				continue;
+			}
+		}
+
+		Info.bWarmStandby = false;
+		OutChannel = *Ch;
+
+		UE_LOG(LogHellunaLobby, Log, TEXT("[ServerManager] [WarmPoolV1] 웜 서버 배정 | Port=%d | MapPath=%s | PartyId=%d | Via=%s"),
+			Info.Port, *Info.MapPath, PartyId, bSentBySocket ? TEXT("socket") : TEXT("file"));
+
+		// 빠진 자리는 다음 틱에 바로 보충 (정기 타이머를 기다리지 않음)
+		if (WorldRef.IsValid())
+		{
+			WorldRef->GetTimerManager().SetTimerForNextTick(
+				FTimerDelegate::CreateUObject(this, &UHellunaGameServerManager::RefillWarmPool));
+		}
+		return true;
+	}
+
+	return false;
+}
+
+void UHellunaGameServerManager::RefillWarmPool()
+{
+	for (const TPair<FString, int32>& Pair : WarmPoolTargets)
+	{
+		int32 StandbyCount = 0;
+		for (const FActiveServerInfo& Info : ActiveServers)
+		{
+			if (Info.bWarmStandby && Info.MapPath == Pair.Key && FPlatformProcess::IsProcRunning(Info.ProcessHandle))
+			{
+				++StandbyCount;
+			}
+		}
+
+		if (StandbyCount >= Pair.Value)
+		{
+			continue;
+		}
+
+		const int32 Port = AllocatePort();
+		if (Port < 0)
+		{
+			UE_LOG(LogHellunaLobby, Verbose, TEXT("[ServerManager] [WarmPoolV1] 보충 보류 — 빈 포트 없음 | MapPath=%s"), *Pair.Key);
+			return;
+		}
+
+		UE_LOG(LogHellunaLobby, Log, TEXT("[ServerManager] [WarmPoolV1] 웜 서버 보충 | MapPath=%s | Standby=%d/%d | Port=%d"),
+			*Pair.Key, StandbyCount, Pair.Value, Port);
+		SpawnGameServerOnPort(Port, Pair.Key, true);
+		return;
+	}
+}
+
+void UHellunaGameServerManager::SetChannelRegistry(UHellunaChannelRegistry* InRegistry)
+{
+	ChannelRegistry = InRegistry;
+}
+
 void UHellunaGameServerManager::RemoveRegistryFileForPort(int32 Port)
 {
+	if (ChannelRegistry)
+	{
+		ChannelRegistry->RemoveChannel(Port);
+	}
+
 	if (Port <= 0 || RegistryDir.IsEmpty())
 	{
 		return;
@@ -312,6 +431,13 @@ bool UHellunaGameServerManager::IsServerReady(int32 Port)
 		return false;
 	}
 
+	// [ChannelRegistryV1] 메모리 조회 — 하트비트 만료는 레지스트리가 Offline으로 반영
+	if (ChannelRegistry)
+	{
+		const FGameChannelInfo* Ch = ChannelRegistry->FindChannel(Port);
+		return Ch && Ch->Status == EChannelStatus::Empty;
+	}
+
 	const FString FilePath = FPaths::Combine(RegistryDir, FString::Printf(TEXT("channel_%d.json"), Port));
 
 	FString JsonString;
@@ -362,6 +488,12 @@ bool UHellunaGameServerManager::IsServerReadyForMap(int32 Port, const FString& M
 		return false;
 	}
 
+	if (ChannelRegistry)
+	{
+		const FGameChannelInfo* Ch = ChannelRegistry->FindChannel(Port);
+		return Ch && Ch->Status == EChannelStatus::Empty && HellunaChannelRegistry::DoesMapIdentifierMatch(Ch->MapName, MapKey);
+	}
+
 	const FString FilePath = FPaths::Combine(RegistryDir, FString::Printf(TEXT("channel_%d.json"), Port));
 
 	FString JsonString;
@@ -385,7 +517,7 @@ bool UHellunaGameServerManager::IsServerReadyForMap(int32 Port, const FString& M
 
 	// 맵 일치 확인
 	const FString MapName = JsonObj->GetStringField(TEXT("mapName"));
-	if (!DoesServerRegistryMapMatch(MapName, MapKey))
+	if (!HellunaChannelRegistry::DoesMapIdentifierMatch(MapName, MapKey))
 	{
 		return false;
 	}
@@ -431,6 +563,16 @@ int32 UHellunaGameServerManager::AllocatePort()
 			continue;
 		}
 
+		// [ChannelRegistryV1] 하트비트가 살아 있는 채널은 파일을 읽지 않고 점유로 간주
+		if (ChannelRegistry)
+		{
+			const FGameChannelInfo* Ch = ChannelRegistry->FindChannel(Port);
+			if (Ch && Ch->Status != EChannelStatus::Offline)
+			{
+				continue;
+			}
+		}
+
 		// [H5/#22-FIX] 레지스트리 파일이 존재하면 "확실히 비어있다고 증명될 때만" 포트를 할당한다.
 		// 기존 코드는 lastUpdate 파싱 실패나 JSON deserialize 실패(부분 기록 레이스) 시 그대로
 		// return Port 로 떨어져 점유 중인 포트를 빈 포트로 오인 → 이중배정/충돌이 발생했다.
@@ -522,6 +664,7 @@ void UHellunaGameServerManager::ShutdownAll()
 	if (WorldRef.IsValid())
 	{
 		WorldRef->GetTimerManager().ClearTimer(CleanupTimer);
+		WorldRef->GetTimerManager().ClearTimer(WarmPoolTimer);
 	}
 
 	for (FActiveServerInfo& Info : ActiveServers)
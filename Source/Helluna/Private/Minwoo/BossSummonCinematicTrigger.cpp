@@ -44,6 +44,7 @@
 #include "UObject/UnrealType.h"
 #include "DrawDebugHelpers.h"
 #include "Camera/PlayerCameraManager.h"
+#include "Utils/HellunaActorRegistrySubsystem.h"
 
 ABossSummonCinematicTrigger::ABossSummonCinematicTrigger()
 {
@@ -264,6 +265,9 @@ void ABossSummonCinematicTrigger::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// [ActorRegistryV1] 시네마틱 트리거 목록
+	UHellunaActorRegistrySubsystem::RegisterActor(this, EHellunaActorBucket::CinematicTrigger);
+
 	// [BPDefaultSyncV1] placement instance override 무시, BP CDO 값으로 강제 동기화.
 	SyncFromBPDefault();
 
@@ -423,6 +427,8 @@ void ABossSummonCinematicTrigger::UnregisterActorSpawnHandler()
 
 void ABossSummonCinematicTrigger::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	UHellunaActorRegistrySubsystem::UnregisterActor(this, EHellunaActorBucket::CinematicTrigger);
+
 	if (UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().ClearTimer(AutoActivateTimer);
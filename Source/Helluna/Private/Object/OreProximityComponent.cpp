@@ -1,14 +1,12 @@
 #include "Object/OreProximityComponent.h"
 
+#include "Object/OreProximitySubsystem.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/ShapeComponent.h"
 #include "Components/WidgetComponent.h"
 #include "Components/AudioComponent.h"
 #include "NiagaraComponent.h"
 #include "Engine/World.h"
-#include "GameFramework/PlayerController.h"
-#include "GameFramework/Pawn.h"
-#include "TimerManager.h"
 #include "Net/UnrealNetwork.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogOreProximity, Log, All);
@@ -48,18 +46,13 @@ void UOreProximityComponent::BeginPlay()
     CurrentLOD = EOreProximityLOD::Far;
     ActivateFarMode();
 
-    // 거리 체크 타이머 시작 (랜덤 오프셋으로 동시 실행 분산)
-    if (UWorld* World = GetWorld())
+    // [OreProximitySubsystemV1] 거리 체크는 서브시스템 패스에 위임 (광석별 타이머 없음)
+    if (Owner)
     {
-        const float RandomOffset = FMath::FRandRange(0.f, FarCheckInterval);
-        World->GetTimerManager().SetTimer(
-            ProximityTimerHandle,
-            this,
-            &UOreProximityComponent::CheckProximityToPlayers,
-            FarCheckInterval,
-            true,
-            RandomOffset
-        );
+        if (UOreProximitySubsystem* Proximity = UOreProximitySubsystem::Get(this))
+        {
+            ProximityHandle = Proximity->RegisterComponent(this, Owner->GetActorLocation(), NearRadius, MidRadius);
+        }
     }
 
     UE_LOG(LogOreProximity, Log,
@@ -76,9 +69,13 @@ void UOreProximityComponent::BeginPlay()
 
 void UOreProximityComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    if (UWorld* World = GetWorld())
+    if (ProximityHandle != INDEX_NONE)
     {
-        World->GetTimerManager().ClearTimer(ProximityTimerHandle);
+        if (UOreProximitySubsystem* Proximity = UOreProximitySubsystem::Get(this))
+        {
+            Proximity->Unregister(ProximityHandle);
+        }
+        ProximityHandle = INDEX_NONE;
     }
 
     // 오너 틱 상태 복원
@@ -144,61 +141,6 @@ void UOreProximityComponent::CacheOwnerComponents()
     }
 }
 
-float UOreProximityComponent::GetClosestPlayerDistanceSq() const
-{
-    UWorld* World = GetWorld();
-    if (!World) return MAX_FLT;
-
-    AActor* Owner = GetOwner();
-    if (!Owner) return MAX_FLT;
-
-    const FVector MyLocation = Owner->GetActorLocation();
-    float ClosestDistSq = MAX_FLT;
-
-    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
-    {
-        const APlayerController* PC = It->Get();
-        if (!PC) continue;
-
-        const APawn* Pawn = PC->GetPawn();
-        if (!Pawn) continue;
-
-        const float DistSq = FVector::DistSquared(MyLocation, Pawn->GetActorLocation());
-        if (DistSq < ClosestDistSq)
-        {
-            ClosestDistSq = DistSq;
-        }
-    }
-
-    return ClosestDistSq;
-}
-
-void UOreProximityComponent::CheckProximityToPlayers()
-{
-    const float DistSq = GetClosestPlayerDistanceSq();
-    const float NearSq = NearRadius * NearRadius;
-    const float MidSq = MidRadius * MidRadius;
-
-    EOreProximityLOD DesiredLOD;
-    if (DistSq <= NearSq)
-    {
-        DesiredLOD = EOreProximityLOD::Near;
-    }
-    else if (DistSq <= MidSq)
-    {
-        DesiredLOD = EOreProximityLOD::Mid;
-    }
-    else
-    {
-        DesiredLOD = EOreProximityLOD::Far;
-    }
-
-    if (DesiredLOD != CurrentLOD)
-    {
-        TransitionToLOD(DesiredLOD);
-    }
-}
-
 void UOreProximityComponent::TransitionToLOD(EOreProximityLOD NewLOD)
 {
     const EOreProximityLOD OldLOD = CurrentLOD;
@@ -217,7 +159,14 @@ void UOreProximityComponent::TransitionToLOD(EOreProximityLOD NewLOD)
         break;
     }
 
-    AdjustTimerInterval();
+    // 서브시스템 활성 목록 갱신 — Near/Mid는 매 패스 이탈 검사
+    if (ProximityHandle != INDEX_NONE)
+    {
+        if (UOreProximitySubsystem* Proximity = UOreProximitySubsystem::Get(this))
+        {
+            Proximity->NotifyActiveChanged(ProximityHandle, NewLOD != EOreProximityLOD::Far);
+        }
+    }
 
     UE_LOG(LogOreProximity, Verbose, TEXT("[%s] LOD 전환: %d → %d"),
         GetOwner() ? *GetOwner()->GetName() : TEXT("?"),
@@ -229,6 +178,14 @@ void UOreProximityComponent::ForceActivateNear()
     TransitionToLOD(EOreProximityLOD::Near);
 }
 
+void UOreProximityComponent::ApplyProximityLOD(EOreProximityLOD NewLOD)
+{
+    if (NewLOD != CurrentLOD)
+    {
+        TransitionToLOD(NewLOD);
+    }
+}
+
 // ============================================================================
 // Near 모드: 풀 활성화 — 플레이어가 상호작용 가능 거리
 // ============================================================================
@@ -416,40 +373,6 @@ void UOreProximityComponent::ActivateFarMode()
     }
 }
 
-// ============================================================================
-// 적응형 타이머 — LOD에 따라 체크 주기 조절
-// ============================================================================
-void UOreProximityComponent::AdjustTimerInterval()
-{
-    UWorld* World = GetWorld();
-    if (!World) return;
-
-    float NewInterval;
-    switch (CurrentLOD)
-    {
-    case EOreProximityLOD::Near:
-        NewInterval = NearCheckInterval;
-        break;
-    case EOreProximityLOD::Mid:
-        NewInterval = FMath::Lerp(NearCheckInterval, FarCheckInterval, 0.5f);
-        break;
-    case EOreProximityLOD::Far:
-    default:
-        NewInterval = FarCheckInterval;
-        break;
-    }
-
-    // 기존 타이머 교체
-    World->GetTimerManager().ClearTimer(ProximityTimerHandle);
-    World->GetTimerManager().SetTimer(
-        ProximityTimerHandle,
-        this,
-        &UOreProximityComponent::CheckProximityToPlayers,
-        NewInterval,
-        true
-    );
-}
-
 // ============================================================================
 // WidgetComponent Lazy 관리
 // UnregisterComponent()는 렌더링/틱 시스템에서 완전 제거 → 비용 0
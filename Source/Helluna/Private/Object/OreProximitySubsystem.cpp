@@ -0,0 +1,389 @@
+#include "Object/OreProximitySubsystem.h"
+
+#include "Object/OreProximityComponent.h"
+#include "PCG/OreHISMPoolComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogOreProximitySubsystem, Log, All);
+
+namespace OreProximity
+{
+    /** 격자 칸 크기 (cm) — 기본 Near 반경과 맞춤 */
+    constexpr float CellSize = 2500.f;
+    constexpr float InvCellSize = 1.f / CellSize;
+}
+
+static TAutoConsoleVariable<float> CVarOreProximityInterval(
+    TEXT("Helluna.Ore.ProximityInterval"),
+    0.3f,
+    TEXT("광석 Proximity 체크 패스 주기(초). 월드당 1회 패스로 LOD 전환 + HISM 승격/강등을 처리."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarOreMaxLODChangesPerPass(
+    TEXT("Helluna.Ore.MaxLODChangesPerPass"),
+    64,
+    TEXT("패스당 최대 광석 LOD 전환 수 (초과분은 다음 패스로)."),
+    ECVF_Default);
+
+UOreProximitySubsystem* UOreProximitySubsystem::Get(const UObject* WorldContext)
+{
+    if (!WorldContext || !GEngine) return nullptr;
+
+    UWorld* World = GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::ReturnNull);
+    return World ? World->GetSubsystem<UOreProximitySubsystem>() : nullptr;
+}
+
+bool UOreProximitySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UOreProximitySubsystem::Deinitialize()
+{
+    Entries.Empty();
+    Cells.Empty();
+    ActiveEntries.Empty();
+    KnownPools.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UOreProximitySubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UOreProximitySubsystem, STATGROUP_Tickables);
+}
+
+int32 UOreProximitySubsystem::ToCell(double Value)
+{
+    return FMath::FloorToInt32(Value * OreProximity::InvCellSize);
+}
+
+// ============================================================================
+// 등록 / 해제
+// ============================================================================
+int32 UOreProximitySubsystem::RegisterComponent(UOreProximityComponent* Component, const FVector& Location,
+    float NearRadius, float MidRadius)
+{
+    if (!Component) return INDEX_NONE;
+
+    FEntry Entry;
+    Entry.Kind = EEntryKind::Component;
+    Entry.Location = Location;
+    Entry.InnerRadiusSq = FMath::Square(NearRadius);
+    Entry.OuterRadiusSq = FMath::Square(FMath::Max(NearRadius, MidRadius));
+    Entry.Component = Component;
+    return AddEntry(MoveTemp(Entry));
+}
+
+int32 UOreProximitySubsystem::RegisterPoolInstance(UOreHISMPoolComponent* Pool, int32 InstanceID, const FVector& Location,
+    float PromoteRadius, float DemoteRadius)
+{
+    if (!Pool || InstanceID == INDEX_NONE) return INDEX_NONE;
+
+    KnownPools.AddUnique(Pool);
+
+    FEntry Entry;
+    Entry.Kind = EEntryKind::PoolInstance;
+    Entry.Location = Location;
+    Entry.InnerRadiusSq = FMath::Square(PromoteRadius);
+    Entry.OuterRadiusSq = FMath::Square(FMath::Max(PromoteRadius, DemoteRadius));
+    Entry.Pool = Pool;
+    Entry.PoolInstanceID = InstanceID;
+    return AddEntry(MoveTemp(Entry));
+}
+
+int32 UOreProximitySubsystem::AddEntry(FEntry&& Entry)
+{
+    Entry.CellKey = MakeCellKey(ToCell(Entry.Location.X), ToCell(Entry.Location.Y));
+    Entry.Serial = ++NextSerial;
+    MaxOuterRadius = FMath::Max(MaxOuterRadius, FMath::Sqrt(Entry.OuterRadiusSq));
+
+    const int64 CellKey = Entry.CellKey;
+    const int32 Handle = Entries.Add(MoveTemp(Entry));
+    Cells.FindOrAdd(CellKey).Add(Handle);
+    return Handle;
+}
+
+void UOreProximitySubsystem::Unregister(int32 Handle)
+{
+    if (!Entries.IsValidIndex(Handle)) return;
+
+    NotifyActiveChanged(Handle, false);
+
+    const int64 CellKey = Entries[Handle].CellKey;
+    if (TArray<int32>* Cell = Cells.Find(CellKey))
+    {
+        Cell->RemoveSingleSwap(Handle, EAllowShrinking::No);
+        if (Cell->Num() == 0)
+        {
+            Cells.Remove(CellKey);
+        }
+    }
+
+    Entries.RemoveAt(Handle);
+}
+
+void UOreProximitySubsystem::NotifyActiveChanged(int32 Handle, bool bActive)
+{
+    if (!Entries.IsValidIndex(Handle)) return;
+
+    FEntry& Entry = Entries[Handle];
+    const bool bWasActive = Entry.ActiveSlot != INDEX_NONE;
+    if (bWasActive == bActive) return;
+
+    if (bActive)
+    {
+        Entry.ActiveSlot = ActiveEntries.Add(Handle);
+        return;
+    }
+
+    // swap-remove + 옮겨진 엔트리의 슬롯 갱신
+    const int32 Slot = Entry.ActiveSlot;
+    Entry.ActiveSlot = INDEX_NONE;
+    ActiveEntries.RemoveAtSwap(Slot, EAllowShrinking::No);
+    if (ActiveEntries.IsValidIndex(Slot))
+    {
+        Entries[ActiveEntries[Slot]].ActiveSlot = Slot;
+    }
+}
+
+// ============================================================================
+// Tick — 주기마다 체크 패스 1회
+// ============================================================================
+void UOreProximitySubsystem::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if (Entries.Num() == 0) return;
+
+    TimeUntilPass -= DeltaTime;
+    if (TimeUntilPass > 0.f) return;
+
+    TimeUntilPass = FMath::Max(CVarOreProximityInterval.GetValueOnGameThread(), 0.05f);
+    RunPass();
+}
+
+void UOreProximitySubsystem::RunPass()
+{
+    GatherPlayerLocations();
+    GatherCandidates();
+
+    // ── 평가: 원하는 상태와 현재 상태가 다른 엔트리만 이벤트로 ──
+    LeaveEvents.Reset();
+    EnterEvents.Reset();
+
+    for (const int32 Handle : Candidates)
+    {
+        const FEntry& Entry = Entries[Handle];
+        const float DistSq = GetClosestPlayerDistSq(Entry.Location);
+
+        FPendingEvent Event;
+        Event.Handle = Handle;
+        Event.Serial = Entry.Serial;
+        Event.DistSq = DistSq;
+
+        if (Entry.Kind == EEntryKind::Component)
+        {
+            const UOreProximityComponent* Comp = Entry.Component.Get();
+            if (!Comp) continue;
+
+            EOreProximityLOD Desired = EOreProximityLOD::Far;
+            if (DistSq <= Entry.InnerRadiusSq)
+            {
+                Desired = EOreProximityLOD::Near;
+            }
+            else if (DistSq <= Entry.OuterRadiusSq)
+            {
+                Desired = EOreProximityLOD::Mid;
+            }
+
+            const EOreProximityLOD Current = Comp->GetCurrentLOD();
+            if (Desired == Current) continue;
+
+            // enum 순서 Near < Mid < Far — 값이 작아지면 진입
+            Event.bEnter = static_cast<uint8>(Desired) < static_cast<uint8>(Current);
+            Event.DesiredLOD = static_cast<uint8>(Desired);
+        }
+        else
+        {
+            const UOreHISMPoolComponent* Pool = Entry.Pool.Get();
+            if (!Pool) continue;
+
+            const bool bPromoted = Entry.ActiveSlot != INDEX_NONE;
+            if (bPromoted)
+            {
+                // 반경 밖이거나 승격 액터가 외부에서 파괴됨(채굴 등) → 이탈
+                if (DistSq <= Entry.OuterRadiusSq && Pool->IsPromotedActorAlive(Entry.PoolInstanceID)) continue;
+                Event.bEnter = false;
+            }
+            else
+            {
+                if (DistSq > Entry.InnerRadiusSq) continue;
+                Event.bEnter = true;
+            }
+        }
+
+        (Event.bEnter ? EnterEvents : LeaveEvents).Add(Event);
+    }
+
+    // ── 적용: 이탈 먼저 (승격 액터 파괴로 자리 확보), 진입은 가까운 순 ──
+    for (const TWeakObjectPtr<UOreHISMPoolComponent>& Pool : KnownPools)
+    {
+        if (UOreHISMPoolComponent* P = Pool.Get())
+        {
+            P->BeginProximityPass();
+        }
+    }
+
+    EnterEvents.Sort([](const FPendingEvent& A, const FPendingEvent& B) { return A.DistSq < B.DistSq; });
+
+    int32 LODChanges = 0;
+    for (const FPendingEvent& Event : LeaveEvents)
+    {
+        ApplyEvent(Event, LODChanges);
+    }
+    for (const FPendingEvent& Event : EnterEvents)
+    {
+        ApplyEvent(Event, LODChanges);
+    }
+
+    for (int32 i = KnownPools.Num() - 1; i >= 0; --i)
+    {
+        if (UOreHISMPoolComponent* P = KnownPools[i].Get())
+        {
+            P->EndProximityPass(PlayerLocations.Num(), TimeUntilPass);
+        }
+        else
+        {
+            KnownPools.RemoveAtSwap(i, EAllowShrinking::No);
+        }
+    }
+
+    UE_LOG(LogOreProximitySubsystem, Verbose,
+        TEXT("[OreProximitySubsystemV1] 패스: 등록=%d 활성=%d 후보=%d 이탈=%d 진입=%d LOD전환=%d 플레이어=%d"),
+        Entries.Num(), ActiveEntries.Num(), Candidates.Num(), LeaveEvents.Num(), EnterEvents.Num(),
+        LODChanges, PlayerLocations.Num());
+}
+
+// ============================================================================
+// 후보 수집 — 활성 엔트리 + 플레이어 주변 칸 (중복은 VisitStamp로 제거)
+// ============================================================================
+void UOreProximitySubsystem::GatherCandidates()
+{
+    ++PassStamp;
+    Candidates.Reset();
+
+    for (const int32 Handle : ActiveEntries)
+    {
+        Entries[Handle].VisitStamp = PassStamp;
+        Candidates.Add(Handle);
+    }
+
+    if (MaxOuterRadius <= 0.f) return;
+
+    for (const FVector& PlayerLoc : PlayerLocations)
+    {
+        const int32 MinX = ToCell(PlayerLoc.X - MaxOuterRadius);
+        const int32 MaxX = ToCell(PlayerLoc.X + MaxOuterRadius);
+        const int32 MinY = ToCell(PlayerLoc.Y - MaxOuterRadius);
+        const int32 MaxY = ToCell(PlayerLoc.Y + MaxOuterRadius);
+
+        for (int32 CX = MinX; CX <= MaxX; ++CX)
+        {
+            for (int32 CY = MinY; CY <= MaxY; ++CY)
+            {
+                const TArray<int32>* Cell = Cells.Find(MakeCellKey(CX, CY));
+                if (!Cell) continue;
+
+                for (const int32 Handle : *Cell)
+                {
+                    FEntry& Entry = Entries[Handle];
+                    if (Entry.VisitStamp == PassStamp) continue;
+
+                    Entry.VisitStamp = PassStamp;
+                    Candidates.Add(Handle);
+                }
+            }
+        }
+    }
+}
+
+// ============================================================================
+// 이벤트 적용 — 이전 이벤트가 액터 스폰/파괴로 엔트리를 바꿨을 수 있으므로 Serial 재확인
+// ============================================================================
+void UOreProximitySubsystem::ApplyEvent(const FPendingEvent& Event, int32& LODChanges)
+{
+    if (!Entries.IsValidIndex(Event.Handle)) return;
+
+    // 콜백이 Register로 Entries를 재할당할 수 있으므로 필요한 값은 먼저 복사
+    const FEntry& Entry = Entries[Event.Handle];
+    if (Entry.Serial != Event.Serial) return;
+
+    if (Entry.Kind == EEntryKind::Component)
+    {
+        if (LODChanges >= CVarOreMaxLODChangesPerPass.GetValueOnGameThread()) return;
+
+        if (UOreProximityComponent* Comp = Entry.Component.Get())
+        {
+            ++LODChanges;
+            Comp->ApplyProximityLOD(static_cast<EOreProximityLOD>(Event.DesiredLOD));
+        }
+        return;
+    }
+
+    UOreHISMPoolComponent* Pool = Entry.Pool.Get();
+    const int32 InstanceID = Entry.PoolInstanceID;
+    if (!Pool) return;
+
+    if (Event.bEnter)
+    {
+        Pool->OnProximityEnter(InstanceID);
+    }
+    else
+    {
+        Pool->OnProximityLeave(InstanceID);
+    }
+}
+
+// ============================================================================
+// 플레이어 위치 — 패스당 1회 수집
+// ============================================================================
+void UOreProximitySubsystem::GatherPlayerLocations()
+{
+    PlayerLocations.Reset();
+
+    UWorld* World = GetWorld();
+    if (!World) return;
+
+    // 서버: 모든 플레이어 / 클라이언트: 로컬 플레이어 (기존 컴포넌트 타이머와 동일한 기준)
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PC = It->Get();
+        if (!PC) continue;
+
+        const APawn* Pawn = PC->GetPawn();
+        if (!Pawn) continue;
+
+        PlayerLocations.Add(Pawn->GetActorLocation());
+    }
+}
+
+float UOreProximitySubsystem::GetClosestPlayerDistSq(const FVector& Location) const
+{
+    float ClosestDistSq = MAX_FLT;
+
+    for (const FVector& PlayerLoc : PlayerLocations)
+    {
+        const float DistSq = FVector::DistSquared(Location, PlayerLoc);
+        if (DistSq < ClosestDistSq)
+        {
+            ClosestDistSq = DistSq;
+        }
+    }
+
+    return ClosestDistSq;
+}
@@ -18,6 +18,7 @@
 #include "NiagaraComponent.h"
 #include "Net/UnrealNetwork.h"
 #include "TimerManager.h"
+#include "Utils/HellunaActorRegistrySubsystem.h"
 
 // =========================================================
 // 디졸브 스칼라 보간 (가디언과 동일 — M_Dissolve 계열 + 적 디졸브 파라미터 동시 지원)
@@ -112,6 +113,9 @@ void AHellunaTurretBase::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// [ActorRegistryV1] 적 어그로 탐색용 포탑 목록
+	UHellunaActorRegistrySubsystem::RegisterActor(this, EHellunaActorBucket::Turret);
+
 	if (TurretHealthComponent)
 	{
 		// 서버에서 디자이너 지정 MaxHealth 를 컴포넌트에 실제로 적용(컴포넌트 기본 100 무시)하고 풀 충전.
@@ -125,6 +129,8 @@ void AHellunaTurretBase::BeginPlay()
 
 void AHellunaTurretBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	UHellunaActorRegistrySubsystem::UnregisterActor(this, EHellunaActorBucket::Turret);
+
 	if (UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().ClearTimer(DeathDissolveTimerHandle);
@@ -17,6 +17,21 @@
 #include "DrawDebugHelpers.h"
 #include "Sound/SoundAttenuation.h"
 #include "UObject/ConstructorHelpers.h"
+#include "ECS/Spatial/EnemyEntitySpatialSubsystem.h" // [EntityTargetingV1]
+#include "HAL/IConsoleManager.h"
+
+// [EntityTargetingV1] 포탑의 Entity 상태 적 공격 전역 토글 (성능 비교/문제 격리용)
+static TAutoConsoleVariable<int32> CVarTurretEntityTargeting(
+	TEXT("Helluna.Turret.EntityTargeting"),
+	1,
+	TEXT("포탑이 Actor로 승격되지 않은 Entity 상태 적을 공격할지.\n 0 = Actor만 (기존 동작), 1 = Actor 우선 + Entity"),
+	ECVF_Default);
+
+namespace TurretEntityTargeting
+{
+	/** 타겟이 없을 때 Entity 스냅샷 재질의 간격 (초) */
+	constexpr float RetargetInterval = 0.25f;
+}
 
 
 // =========================================================
@@ -127,6 +142,7 @@ void AResourceUsingObject_AttackTurret::EndPlay(const EEndPlayReason::Type EndPl
 	}
 	CurrentTarget = nullptr;
 	EnemiesInRange.Empty();
+	ClearEntityTarget();
 
 	Super::EndPlay(EndPlayReason);
 }
@@ -146,6 +162,7 @@ void AResourceUsingObject_AttackTurret::OnTurretDestroyed_StopServerLogic()
 	}
 	CurrentTarget = nullptr;
 	EnemiesInRange.Empty();
+	ClearEntityTarget();
 }
 
 // =========================================================
@@ -176,6 +193,7 @@ void AResourceUsingObject_AttackTurret::Tick(float DeltaTime)
 			}
 			CurrentTarget = nullptr; // 복제 → 모든 클라이언트에서 헤드 회전도 정지
 		}
+		ClearEntityTarget();
 		return;
 	}
 
@@ -191,6 +209,13 @@ void AResourceUsingObject_AttackTurret::Tick(float DeltaTime)
 		return;
 	}
 
+	// [EntityTargetingV1] Entity 타겟 위치는 쿨다운 중에도 갱신 (회전이 따라가도록)
+	if (bHasEntityTarget && !RefreshEntityTarget())
+	{
+		ClearEntityTarget();
+	}
+	EntityRetargetCooldown -= DeltaTime;
+
 	// 쿨다운 미완료
 	if (TimeSinceLastAttack < AttackInterval)
 	{
@@ -203,11 +228,11 @@ void AResourceUsingObject_AttackTurret::Tick(float DeltaTime)
 		return;
 	}
 
-	// 타겟 유효성
+	// 타겟 유효성 — Actor 우선, 없으면 [EntityTargetingV1] Entity
 	if (!IsTargetValid())
 	{
 		SelectClosestTarget();
-		if (!IsTargetValid())
+		if (!IsTargetValid() && !bHasEntityTarget && !SelectEntityTarget())
 		{
 			return;
 		}
@@ -216,7 +241,14 @@ void AResourceUsingObject_AttackTurret::Tick(float DeltaTime)
 	// 타겟을 바라보고 있을 때만 발사
 	if (IsFacingTarget())
 	{
-		PerformAttack();
+		if (IsTargetValid())
+		{
+			PerformAttack();
+		}
+		else
+		{
+			PerformEntityAttack();
+		}
 	}
 
 	// 디버그: 공격 범위 시각화
@@ -240,6 +272,8 @@ void AResourceUsingObject_AttackTurret::GetLifetimeReplicatedProps(TArray<FLifet
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
 	DOREPLIFETIME(AResourceUsingObject_AttackTurret, CurrentTarget);
+	DOREPLIFETIME(AResourceUsingObject_AttackTurret, bHasEntityTarget);
+	DOREPLIFETIME(AResourceUsingObject_AttackTurret, EntityTargetLocation);
 }
 
 void AResourceUsingObject_AttackTurret::OnRep_CurrentTarget()
@@ -539,15 +573,34 @@ bool AResourceUsingObject_AttackTurret::IsTargetValid() const
 	return true;
 }
 
-bool AResourceUsingObject_AttackTurret::IsFacingTarget() const
+bool AResourceUsingObject_AttackTurret::GetAimLocation(FVector& OutLocation) const
 {
 	AActor* Target = CurrentTarget.Get();
-	if (!IsValid(Target) || !TurretHead)
+	if (IsValid(Target) && !Target->IsActorBeingDestroyed())
+	{
+		OutLocation = Target->GetActorLocation();
+		return true;
+	}
+
+	// [EntityTargetingV1] Actor 타겟이 없으면 Entity 조준점 (클라도 복제값으로 동일하게 계산)
+	if (bHasEntityTarget)
+	{
+		OutLocation = FVector(EntityTargetLocation) + FVector(0.f, 0.f, EntityAimHeight);
+		return true;
+	}
+
+	return false;
+}
+
+bool AResourceUsingObject_AttackTurret::IsFacingTarget() const
+{
+	FVector AimLocation;
+	if (!TurretHead || !GetAimLocation(AimLocation))
 	{
 		return false;
 	}
 
-	const FVector Direction = (Target->GetActorLocation() - TurretHead->GetComponentLocation()).GetSafeNormal();
+	const FVector Direction = (AimLocation - TurretHead->GetComponentLocation()).GetSafeNormal();
 	if (Direction.IsNearlyZero())
 	{
 		return true;
@@ -628,6 +681,9 @@ void AResourceUsingObject_AttackTurret::SelectClosestTarget()
 	if (ClosestEnemy)
 	{
 		BindTargetDeathDelegate(ClosestEnemy);
+
+		// [EntityTargetingV1] Actor 타겟이 생기면 Entity 타겟은 버린다 (Actor 우선)
+		ClearEntityTarget();
 	}
 }
 
@@ -698,15 +754,14 @@ void AResourceUsingObject_AttackTurret::UpdateTurretRotation(float DeltaTime)
 		return;
 	}
 
-	AActor* Target = CurrentTarget.Get();
-	if (!IsValid(Target) || Target->IsActorBeingDestroyed())
+	FVector TargetLocation;
+	if (!GetAimLocation(TargetLocation))
 	{
 		return;
 	}
 
 	// 헤드 피벗의 월드 위치 기준으로 방향 계산
 	const FVector HeadLocation = TurretHead->GetComponentLocation();
-	const FVector TargetLocation = Target->GetActorLocation();
 	const FVector Direction = (TargetLocation - HeadLocation).GetSafeNormal();
 
 	if (Direction.IsNearlyZero())
@@ -726,3 +781,136 @@ void AResourceUsingObject_AttackTurret::OnPostAttackPauseEnd()
 {
 	bRotationPaused = false;
 }
+
+// =========================================================
+// [EntityTargetingV1] Entity 타겟팅 (서버)
+//   Actor 승격 없이 Entity 상태 적을 원거리에서 솎아낸다.
+//   후보는 이동 Processor가 publish 한 스냅샷(셀 해시)에서 질의 — 월드 질의/오버랩 없음.
+// =========================================================
+
+bool AResourceUsingObject_AttackTurret::SelectEntityTarget()
+{
+	if (!bTargetEntityEnemies || CVarTurretEntityTargeting.GetValueOnGameThread() == 0 || !DetectionSphere)
+	{
+		return false;
+	}
+
+	if (EntityRetargetCooldown > 0.f)
+	{
+		return false;
+	}
+	EntityRetargetCooldown = TurretEntityTargeting::RetargetInterval;
+
+	UWorld* World = GetWorld();
+	const UEnemyEntitySpatialSubsystem* SpatialSubsystem = World ? World->GetSubsystem<UEnemyEntitySpatialSubsystem>() : nullptr;
+	const FEnemyEntitySpatialSnapshotPtr Snapshot = SpatialSubsystem ? SpatialSubsystem->GetSnapshot() : nullptr;
+	if (!Snapshot.IsValid() || Snapshot->Num() == 0)
+	{
+		return false;
+	}
+
+	TArray<int32> CandidateIndices;
+	Snapshot->FindNearest(DetectionSphere->GetComponentLocation(), DetectionSphere->GetScaledSphereRadius(),
+		FMath::Max(EntityLineOfSightSamples, 1), CandidateIndices);
+
+	// 시야 검사 — 가까운 순으로 최대 EntityLineOfSightSamples 개. 0 이면 가장 가까운 후보를 그대로 사용
+	const FVector TraceStart = MuzzlePoint ? MuzzlePoint->GetComponentLocation() : GetActorLocation();
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(TurretEntityLoS), false, this);
+
+	for (const int32 Index : CandidateIndices)
+	{
+		const FVector EntityLocation = Snapshot->Locations[Index];
+		if (EntityLineOfSightSamples > 0)
+		{
+			const FVector AimLocation = EntityLocation + FVector(0.f, 0.f, EntityAimHeight);
+			if (World->LineTraceTestByChannel(TraceStart, AimLocation, TraceChannel, QueryParams))
+			{
+				continue;
+			}
+		}
+
+		CurrentEntityTarget = Snapshot->Entities[Index];
+		EntityTargetLocation = EntityLocation;
+		bHasEntityTarget = true;
+		return true;
+	}
+
+	return false;
+}
+
+bool AResourceUsingObject_AttackTurret::RefreshEntityTarget()
+{
+	if (!bTargetEntityEnemies || CVarTurretEntityTargeting.GetValueOnGameThread() == 0 || !DetectionSphere)
+	{
+		return false;
+	}
+
+	const UWorld* World = GetWorld();
+	const UEnemyEntitySpatialSubsystem* SpatialSubsystem = World ? World->GetSubsystem<UEnemyEntitySpatialSubsystem>() : nullptr;
+	const FEnemyEntitySpatialSnapshotPtr Snapshot = SpatialSubsystem ? SpatialSubsystem->GetSnapshot() : nullptr;
+	if (!Snapshot.IsValid())
+	{
+		return false;
+	}
+
+	// 스냅샷에 없으면 사망/Actor 승격 — Actor가 됐다면 오버랩/재스캔 경로가 이어받는다
+	FVector NewLocation;
+	if (!Snapshot->FindEntityNear(CurrentEntityTarget, EntityTargetLocation, NewLocation))
+	{
+		return false;
+	}
+
+	const float Radius = DetectionSphere->GetScaledSphereRadius();
+	if (FVector::DistSquared(NewLocation, DetectionSphere->GetComponentLocation()) > FMath::Square(Radius))
+	{
+		return false;
+	}
+
+	EntityTargetLocation = NewLocation;
+	return true;
+}
+
+void AResourceUsingObject_AttackTurret::ClearEntityTarget()
+{
+	CurrentEntityTarget.Reset();
+	bHasEntityTarget = false;
+}
+
+void AResourceUsingObject_AttackTurret::PerformEntityAttack()
+{
+	UWorld* World = GetWorld();
+	if (!World || !bHasEntityTarget)
+	{
+		return;
+	}
+
+	// 쿨다운 리셋
+	TimeSinceLastAttack = 0.f;
+
+	const FVector TraceStart = MuzzlePoint ? MuzzlePoint->GetComponentLocation() : GetActorLocation();
+	const FVector AimLocation = FVector(EntityTargetLocation) + FVector(0.f, 0.f, EntityAimHeight);
+
+	FHitResult HitResult;
+	FCollisionQueryParams QueryParams;
+	QueryParams.AddIgnoredActor(this);
+
+	// Entity는 콜리전이 없으므로 "아무것도 안 맞음" = 명중. 맞은 게 있으면 차폐물(또는 앞을 막은 Actor 적)
+	const bool bBlocked = World->LineTraceSingleByChannel(HitResult, TraceStart, AimLocation, TraceChannel, QueryParams);
+	if (bBlocked)
+	{
+		Multicast_PlayFireFX(TraceStart, true, HitResult.ImpactPoint);
+
+		if (AHellunaEnemyCharacter* HitEnemy = Cast<AHellunaEnemyCharacter>(HitResult.GetActor()))
+		{
+			UGameplayStatics::ApplyDamage(HitEnemy, AttackDamage, nullptr, this, UDamageType::StaticClass());
+		}
+		return;
+	}
+
+	Multicast_PlayFireFX(TraceStart, true, AimLocation);
+
+	if (UEnemyEntitySpatialSubsystem* SpatialSubsystem = World->GetSubsystem<UEnemyEntitySpatialSubsystem>())
+	{
+		SpatialSubsystem->QueueEntityDamage(CurrentEntityTarget, AttackDamage, this);
+	}
+}
@@ -23,6 +23,7 @@
 // [Phase18] 3D 상호작용 위젯
 #include "Components/WidgetComponent.h"
 #include "Widgets/HUD/Inv_InteractPromptWidget.h"
+#include "Utils/HellunaActorRegistrySubsystem.h"
 
 
 // 박스 범위내에 들어올시 수리 가능 범위 능력 활성화(UI)
@@ -206,6 +207,9 @@ void AResourceUsingObject_SpaceShip::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// [ActorRegistryV1] 우주선 — 기존 GetAllActorsWithTag("SpaceShip") 대체
+	UHellunaActorRegistrySubsystem::RegisterActor(this, EHellunaActorBucket::SpaceShip);
+
 	// [ShipHP] 체력 초기화 + 파괴(OnDeath) 콜백 바인딩.
 	//   - OnDeath 는 서버에서만 broadcast 되므로 클라 바인딩은 무해(미발화). AddUnique 로 중복 방지.
 	//   - SetMaxHealth(서버 전용)로 디자이너 ShipMaxHealth 반영 + 풀 회복. 컴포넌트 BeginPlay 와
@@ -290,6 +294,13 @@ void AResourceUsingObject_SpaceShip::BeginPlay()
 	}
 }
 
+void AResourceUsingObject_SpaceShip::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UHellunaActorRegistrySubsystem::UnregisterActor(this, EHellunaActorBucket::SpaceShip);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 // 새로 추가: 수리 완료 처리
 void AResourceUsingObject_SpaceShip::OnRepairCompleted_Implementation()
 {
@@ -6,16 +6,16 @@
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
 #include "Engine/Engine.h"
-#include "TimerManager.h"
 #include "HAL/IConsoleManager.h"
 #include "Object/OreProximityComponent.h"
+#include "Object/OreProximitySubsystem.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogOreHISMPool, Log, All);
 
 // [OreHISMDiagV1] 진단용 CVar — 패키징/PIE 모두에서 콘솔로 토글 가능.
 //   Helluna.OreHISM.ForceFallback 1  → GameMode 가 HISM 우회하고 모든 광석을 직접 AActor 로 스폰.
 //                                      "HISM 시스템 문제 vs 생성 자체 문제" 구분에 사용.
-//   Helluna.OreHISM.ShowStats     1  → OreHISMPool 의 통계를 매 AutoManageTick 마다 화면 출력.
+//   Helluna.OreHISM.ShowStats     1  → OreHISMPool 의 통계를 매 Proximity 체크 패스마다 화면 출력.
 static TAutoConsoleVariable<int32> CVarOreHISMForceFallback(
     TEXT("Helluna.OreHISM.ForceFallback"),
     0,
@@ -26,7 +26,7 @@ static TAutoConsoleVariable<int32> CVarOreHISMForceFallback(
 static TAutoConsoleVariable<int32> CVarOreHISMShowStats(
     TEXT("Helluna.OreHISM.ShowStats"),
     0,
-    TEXT("1 = OreHISMPool 통계 (등록/활성/풀/승격 수) 를 매 AutoManageTick 화면에 출력."),
+    TEXT("1 = OreHISMPool 통계 (등록/활성/풀/승격 수) 를 매 Proximity 체크 패스마다 화면에 출력."),
     ECVF_Default);
 
 UOreHISMPoolComponent::UOreHISMPoolComponent()
@@ -38,23 +38,28 @@ void UOreHISMPoolComponent::BeginPlay()
 {
     Super::BeginPlay();
 
-    // 자동 관리 타이머 시작
-    if (UWorld* World = GetWorld())
+    // [OreProximitySubsystemV1] 자동 승격/강등은 UOreProximitySubsystem 패스가 이벤트로 호출
+    UE_LOG(LogOreHISMPool, Log, TEXT("[OreHISMPool] 초기화 완료 — 승격: %.0fcm, 강등: %.0fcm, 패스당 승격/강등: %d/%d"),
+        AutoPromoteRadius, AutoDemoteRadius, MaxPromotesPerCheck, MaxDemotesPerCheck);
+    UE_LOG(LogOreHISMPool, Log, TEXT("[OreHISMPool] 승격 최적화 — NetCullDistSq=%.0f, NetUpdateFreq=%.1fHz, TickOff=%s"),
+        PromotedNetCullDistSq, PromotedNetUpdateFrequency, bDisablePromotedActorTick ? TEXT("Y") : TEXT("N"));
+}
+
+void UOreHISMPoolComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UOreProximitySubsystem* Proximity = UOreProximitySubsystem::Get(this))
     {
-        World->GetTimerManager().SetTimer(
-            AutoManageTimerHandle,
-            this,
-            &UOreHISMPoolComponent::AutoManageTick,
-            AutoCheckInterval,
-            true,
-            FMath::FRandRange(0.f, AutoCheckInterval)
-        );
+        for (FOreInstanceData& Data : AllInstances)
+        {
+            if (Data.ProximityHandle != INDEX_NONE)
+            {
+                Proximity->Unregister(Data.ProximityHandle);
+                Data.ProximityHandle = INDEX_NONE;
+            }
+        }
     }
 
-    UE_LOG(LogOreHISMPool, Log, TEXT("[OreHISMPool] 초기화 완료 — 자동 관리 주기: %.1fs, 승격: %.0fcm, 강등: %.0fcm, 배치: %d"),
-        AutoCheckInterval, AutoPromoteRadius, AutoDemoteRadius, BatchSizePerCheck);
-    UE_LOG(LogOreHISMPool, Log, TEXT("[OreHISMPool] 승격 최적화 — NetCullDistSq=%.0f, NetUpdateFreq=%.1fHz, TickOff=%s"),
-        PromotedNetCullDistSq, PromotedNetUpdateFrequency, bDisablePromotedActorTick ? TEXT("Y") : TEXT("N"));
+    Super::EndPlay(EndPlayReason);
 }
 
 // ============================================================================
@@ -91,6 +96,13 @@ int32 UOreHISMPoolComponent::RegisterOreInstance(UStaticMesh* Mesh, TSubclassOf<
 
     Pool.InstanceIDs.Add(GlobalID);
 
+    // [OreProximitySubsystemV1] 서브시스템 격자에 등록 — 플레이어 근처일 때만 평가됨
+    if (UOreProximitySubsystem* Proximity = UOreProximitySubsystem::Get(this))
+    {
+        Data.ProximityHandle = Proximity->RegisterPoolInstance(this, GlobalID, Transform.GetLocation(),
+            AutoPromoteRadius, AutoDemoteRadius);
+    }
+
     return GlobalID;
 }
 
@@ -126,6 +138,7 @@ AActor* UOreHISMPoolComponent::PromoteToActor(int32 InstanceID)
     {
         Data.bPromotedToActor = true;
         Data.PromotedActor = SpawnedActor;
+        NotifyProximityActive(Data, true);
 
         // Tags 복원 (HISM 모드에서는 AActor가 없어 태그가 유실되므로 승격 시 복사)
         if (Data.Tags.Num() > 0)
@@ -192,6 +205,7 @@ void UOreHISMPoolComponent::DemoteToInstance(int32 InstanceID)
 
     Data.bPromotedToActor = false;
     Data.PromotedActor = nullptr;
+    NotifyProximityActive(Data, false);
 
     // 2) HISM 인스턴스 복원 (스케일 원복)
     FOreHISMPool& Pool = Pools[Data.PoolIndex];
@@ -235,6 +249,16 @@ void UOreHISMPoolComponent::DestroyOre(int32 InstanceID)
 
     Data.bDestroyed = true;
 
+    // 채굴된 광석은 더 이상 평가할 필요 없음
+    if (Data.ProximityHandle != INDEX_NONE)
+    {
+        if (UOreProximitySubsystem* Proximity = UOreProximitySubsystem::Get(this))
+        {
+            Proximity->Unregister(Data.ProximityHandle);
+        }
+        Data.ProximityHandle = INDEX_NONE;
+    }
+
     UE_LOG(LogOreHISMPool, Log, TEXT("[OreHISMPool] 파괴: ID=%d (풀=%d, 인스턴스=%d)"),
         InstanceID, Data.PoolIndex, Data.InstanceIndex);
 }
@@ -256,80 +280,51 @@ int32 UOreHISMPoolComponent::GetActiveInstanceCount() const
 }
 
 // ============================================================================
-// AutoPromoteNearPlayers — 자동 승격 (라운드-로빈 배치)
+// AutoPromoteNearPlayers — 수동 승격 (전체 순회, 자동 관리는 UOreProximitySubsystem)
 // ============================================================================
 void UOreHISMPoolComponent::AutoPromoteNearPlayers(float PromoteRadius)
 {
-    const int32 TotalCount = AllInstances.Num();
-    if (TotalCount == 0) return;
+    RefreshPlayerLocationCache();
 
     const float RadiusSq = PromoteRadius * PromoteRadius;
-    int32 PromotedThisFrame = 0;
-    int32 CheckedThisBatch = 0;
+    int32 PromotedThisCall = 0;
 
-    // 라운드-로빈 인덱스 보정
-    if (PromoteRoundRobinIndex >= TotalCount)
+    for (int32 i = 0; i < AllInstances.Num() && PromotedThisCall < MaxPromotesPerCheck; ++i)
     {
-        PromoteRoundRobinIndex = 0;
-    }
-
-    const int32 StartIdx = PromoteRoundRobinIndex;
-
-    for (int32 c = 0; c < TotalCount && CheckedThisBatch < BatchSizePerCheck && PromotedThisFrame < MaxPromotesPerCheck; ++c)
-    {
-        const int32 i = (StartIdx + c) % TotalCount;
         const FOreInstanceData& Data = AllInstances[i];
-        if (Data.bPromotedToActor || Data.bDestroyed)
-        {
-            ++CheckedThisBatch;
-            continue;
-        }
+        if (Data.bPromotedToActor || Data.bDestroyed) continue;
 
         const float DistSq = GetClosestPlayerDistSqCached(Data.Transform.GetLocation());
-        if (DistSq <= RadiusSq)
+        if (DistSq <= RadiusSq && PromoteToActor(i))
         {
-            PromoteToActor(i);
-            ++PromotedThisFrame;
+            ++PromotedThisCall;
         }
-        ++CheckedThisBatch;
     }
 
-    PromoteRoundRobinIndex = (StartIdx + CheckedThisBatch) % FMath::Max(TotalCount, 1);
-
-    UE_LOG(LogOreHISMPool, Log, TEXT("[OreHISMPool][배치] 승격 스캔: 배치=%d/%d, 승격=%d, 다음시작=%d"),
-        CheckedThisBatch, TotalCount, PromotedThisFrame, PromoteRoundRobinIndex);
+    UE_LOG(LogOreHISMPool, Log, TEXT("[OreHISMPool] 수동 승격: 승격=%d / 등록=%d"),
+        PromotedThisCall, AllInstances.Num());
 }
 
 // ============================================================================
-// AutoDemoteFarFromPlayers — 자동 강등 (승격된 것만 순회 — 전체 순회 불필요)
+// AutoDemoteFarFromPlayers — 수동 강등 (승격된 것만 대상)
 // ============================================================================
 void UOreHISMPoolComponent::AutoDemoteFarFromPlayers(float DemoteRadius)
 {
+    RefreshPlayerLocationCache();
+
     const float RadiusSq = DemoteRadius * DemoteRadius;
-    int32 DemotedThisFrame = 0;
+    int32 DemotedThisCall = 0;
     int32 CleanedInvalid = 0;
 
-    // 강등은 승격된 AActor만 대상이므로 전체를 돌되, 승격 수는 보통 50~200개라 부담 없음
-    for (int32 i = 0; i < AllInstances.Num() && DemotedThisFrame < MaxDemotesPerCheck; ++i)
+    for (int32 i = 0; i < AllInstances.Num() && DemotedThisCall < MaxDemotesPerCheck; ++i)
     {
-        FOreInstanceData& Data = AllInstances[i];
+        const FOreInstanceData& Data = AllInstances[i];
         if (!Data.bPromotedToActor || Data.bDestroyed) continue;
 
-        // 승격된 AActor가 유효한지 확인
+        // 승격된 AActor가 이미 파괴됨 (채굴 등) — 바로 파괴 마킹
         if (!Data.PromotedActor.IsValid())
         {
-            // AActor가 이미 파괴됨 (채굴 등) — 바로 파괴 마킹
-            Data.bDestroyed = true;
-            Data.bPromotedToActor = false;
-
-            // HISM도 숨김
-            FOreHISMPool& Pool = Pools[Data.PoolIndex];
-            if (Pool.HISMComp && Data.InstanceIndex != INDEX_NONE)
-            {
-                FTransform HiddenTransform = Data.Transform;
-                HiddenTransform.SetScale3D(FVector::ZeroVector);
-                Pool.HISMComp->UpdateInstanceTransform(Data.InstanceIndex, HiddenTransform, true, true);
-            }
+            HandlePromotedActorLost(i);
             ++CleanedInvalid;
             continue;
         }
@@ -338,29 +333,69 @@ void UOreHISMPoolComponent::AutoDemoteFarFromPlayers(float DemoteRadius)
         if (DistSq > RadiusSq)
         {
             DemoteToInstance(i);
-            ++DemotedThisFrame;
+            ++DemotedThisCall;
         }
     }
 
-    if (DemotedThisFrame > 0 || CleanedInvalid > 0)
+    if (DemotedThisCall > 0 || CleanedInvalid > 0)
     {
-        UE_LOG(LogOreHISMPool, Log, TEXT("[OreHISMPool][배치] 강등 스캔: 강등=%d, 무효정리=%d"),
-            DemotedThisFrame, CleanedInvalid);
+        UE_LOG(LogOreHISMPool, Log, TEXT("[OreHISMPool] 수동 강등: 강등=%d, 무효정리=%d"),
+            DemotedThisCall, CleanedInvalid);
     }
 }
 
 // ============================================================================
-// 자동 관리 타이머 콜백
+// [OreProximitySubsystemV1] 서브시스템 이벤트 — 패스당 예산 안에서 승격/강등
 // ============================================================================
-void UOreHISMPoolComponent::AutoManageTick()
+void UOreHISMPoolComponent::BeginProximityPass()
 {
-    // [최적화4] 플레이어 위치 캐싱 — 이번 틱 동안 1회만 조회
-    RefreshPlayerLocationCache();
-    UE_LOG(LogOreHISMPool, Verbose, TEXT("[OreHISMPool][캐시] 플레이어 %d명 위치 캐싱 완료"),
-        CachedPlayerLocations.Num());
+    PassPromoteCount = 0;
+    PassDemoteCount = 0;
+}
 
-    AutoDemoteFarFromPlayers(AutoDemoteRadius);
-    AutoPromoteNearPlayers(AutoPromoteRadius);
+bool UOreHISMPoolComponent::OnProximityEnter(int32 InstanceID)
+{
+    if (PassPromoteCount >= MaxPromotesPerCheck) return false;
+
+    if (!PromoteToActor(InstanceID)) return false;
+
+    ++PassPromoteCount;
+    return true;
+}
+
+bool UOreHISMPoolComponent::OnProximityLeave(int32 InstanceID)
+{
+    if (!AllInstances.IsValidIndex(InstanceID)) return false;
+
+    const FOreInstanceData& Data = AllInstances[InstanceID];
+    if (!Data.bPromotedToActor || Data.bDestroyed) return false;
+
+    // 액터 소실 정리는 비용이 거의 없으므로 예산 밖에서 처리
+    if (!Data.PromotedActor.IsValid())
+    {
+        HandlePromotedActorLost(InstanceID);
+        return true;
+    }
+
+    if (PassDemoteCount >= MaxDemotesPerCheck) return false;
+
+    DemoteToInstance(InstanceID);
+    ++PassDemoteCount;
+    return true;
+}
+
+bool UOreHISMPoolComponent::IsPromotedActorAlive(int32 InstanceID) const
+{
+    return AllInstances.IsValidIndex(InstanceID) && AllInstances[InstanceID].PromotedActor.IsValid();
+}
+
+void UOreHISMPoolComponent::EndProximityPass(int32 NumPlayers, float DisplayTime)
+{
+    if (PassPromoteCount > 0 || PassDemoteCount > 0)
+    {
+        UE_LOG(LogOreHISMPool, Verbose, TEXT("[OreHISMPool] 패스: 승격=%d, 강등=%d"),
+            PassPromoteCount, PassDemoteCount);
+    }
 
     // [OreHISMDiagV1] 진단용 화면 출력 — Helluna.OreHISM.ShowStats 1.
     if (CVarOreHISMShowStats.GetValueOnGameThread() != 0 && GEngine)
@@ -377,18 +412,54 @@ void UOreHISMPoolComponent::AutoManageTick()
         const FString Msg = FString::Printf(
             TEXT("[OreHISM] 등록=%d 활성HISM=%d 승격액터=%d 파괴=%d 풀=%d 플레이어=%d"),
             AllInstances.Num(), ActiveHISM, PromotedCount, DestroyedCount,
-            Pools.Num(), CachedPlayerLocations.Num());
+            Pools.Num(), NumPlayers);
 
         // 키 = 컴포넌트 포인터 → 같은 메시지 덮어쓰기
         const uint64 Key = reinterpret_cast<uint64>(this);
         GEngine->AddOnScreenDebugMessage(
-            static_cast<int32>(Key & 0x7FFFFFFF), AutoCheckInterval + 0.5f,
+            static_cast<int32>(Key & 0x7FFFFFFF), DisplayTime + 0.5f,
             FColor::Yellow, Msg);
 
         UE_LOG(LogOreHISMPool, Warning, TEXT("%s"), *Msg);
     }
 }
 
+void UOreHISMPoolComponent::HandlePromotedActorLost(int32 InstanceID)
+{
+    FOreInstanceData& Data = AllInstances[InstanceID];
+    Data.bDestroyed = true;
+    Data.bPromotedToActor = false;
+    Data.PromotedActor = nullptr;
+
+    // HISM도 숨김
+    FOreHISMPool& Pool = Pools[Data.PoolIndex];
+    if (Pool.HISMComp && Data.InstanceIndex != INDEX_NONE)
+    {
+        FTransform HiddenTransform = Data.Transform;
+        HiddenTransform.SetScale3D(FVector::ZeroVector);
+        Pool.HISMComp->UpdateInstanceTransform(Data.InstanceIndex, HiddenTransform, true, true);
+    }
+
+    if (Data.ProximityHandle != INDEX_NONE)
+    {
+        if (UOreProximitySubsystem* Proximity = UOreProximitySubsystem::Get(this))
+        {
+            Proximity->Unregister(Data.ProximityHandle);
+        }
+        Data.ProximityHandle = INDEX_NONE;
+    }
+}
+
+void UOreHISMPoolComponent::NotifyProximityActive(const FOreInstanceData& Data, bool bActive) const
+{
+    if (Data.ProximityHandle == INDEX_NONE) return;
+
+    if (UOreProximitySubsystem* Proximity = UOreProximitySubsystem::Get(this))
+    {
+        Proximity->NotifyActiveChanged(Data.ProximityHandle, bActive);
+    }
+}
+
 // ============================================================================
 // 내부: 메시별 풀 찾기/생성
 // ============================================================================
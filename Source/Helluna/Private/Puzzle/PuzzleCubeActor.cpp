@@ -7,6 +7,7 @@
 #include "Components/WidgetComponent.h"
 #include "Net/UnrealNetwork.h"
 #include "Controller/HellunaHeroController.h"
+#include "Utils/HellunaActorRegistrySubsystem.h"
 
 // ============================================================================
 // 생성자
@@ -48,6 +49,9 @@ void APuzzleCubeActor::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// [ActorRegistryV1] 퍼즐 큐브 목록
+	UHellunaActorRegistrySubsystem::RegisterActor(this, EHellunaActorBucket::PuzzleCube);
+
 	CurrentHealth = MaxHealth;
 
 	if (HasAuthority())
@@ -62,6 +66,13 @@ void APuzzleCubeActor::BeginPlay()
 	}
 }
 
+void APuzzleCubeActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UHellunaActorRegistrySubsystem::UnregisterActor(this, EHellunaActorBucket::PuzzleCube);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void APuzzleCubeActor::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -0,0 +1,165 @@
+/**
+ * HellunaActorRegistrySubsystem.cpp
+ *
+ * [ActorRegistryV1] 월드 Actor 레지스트리 구현.
+ *
+ * @author 김민우
+ */
+
+// File: Source/Helluna/Private/Utils/HellunaActorRegistrySubsystem.cpp
+
+#include "Utils/HellunaActorRegistrySubsystem.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+// ============================================================================
+// 접근
+// ============================================================================
+UHellunaActorRegistrySubsystem* UHellunaActorRegistrySubsystem::Get(const UObject* WorldContext)
+{
+	if (!WorldContext || !GEngine)
+		return nullptr;
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContext, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UHellunaActorRegistrySubsystem>() : nullptr;
+}
+
+void UHellunaActorRegistrySubsystem::RegisterActor(AActor* Actor, EHellunaActorBucket Bucket)
+{
+	if (UHellunaActorRegistrySubsystem* Registry = Get(Actor))
+	{
+		Registry->Register(Actor, Bucket);
+	}
+}
+
+void UHellunaActorRegistrySubsystem::UnregisterActor(AActor* Actor, EHellunaActorBucket Bucket)
+{
+	if (UHellunaActorRegistrySubsystem* Registry = Get(Actor))
+	{
+		Registry->Unregister(Actor, Bucket);
+	}
+}
+
+bool UHellunaActorRegistrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UHellunaActorRegistrySubsystem::Deinitialize()
+{
+	for (FBucket& B : Buckets)
+	{
+		B.Actors.Empty();
+		B.SlotByActor.Empty();
+		B.IterationDepth = 0;
+		B.bPendingCompact = false;
+	}
+
+	Super::Deinitialize();
+}
+
+// ============================================================================
+// 등록 / 해제 — O(1)
+// ============================================================================
+void UHellunaActorRegistrySubsystem::Register(AActor* Actor, EHellunaActorBucket Bucket)
+{
+	if (!Actor || Bucket == EHellunaActorBucket::MAX)
+		return;
+
+	FBucket& B = Buckets[static_cast<int32>(Bucket)];
+	if (B.SlotByActor.Contains(Actor))
+		return;
+
+	B.SlotByActor.Add(Actor, B.Actors.Add(Actor));
+}
+
+void UHellunaActorRegistrySubsystem::Unregister(AActor* Actor, EHellunaActorBucket Bucket)
+{
+	if (!Actor || Bucket == EHellunaActorBucket::MAX)
+		return;
+
+	FBucket& B = Buckets[static_cast<int32>(Bucket)];
+	int32 Slot = INDEX_NONE;
+	if (!B.SlotByActor.RemoveAndCopyValue(Actor, Slot))
+		return;
+
+	// 순회 중이면 인덱스를 흔들지 않고 비워만 둠 → 순회 종료 시 Compact
+	if (B.IterationDepth > 0)
+	{
+		B.Actors[Slot].Reset();
+		B.bPendingCompact = true;
+		return;
+	}
+
+	B.Actors.RemoveAtSwap(Slot, EAllowShrinking::No);
+	if (B.Actors.IsValidIndex(Slot))
+	{
+		if (const AActor* Moved = B.Actors[Slot].Get())
+		{
+			B.SlotByActor.Add(Moved, Slot);
+		}
+		else
+		{
+			// EndPlay 없이 GC된 Actor가 옮겨옴 → 인덱스 재구성
+			Compact(B);
+		}
+	}
+}
+
+void UHellunaActorRegistrySubsystem::Compact(FBucket& B)
+{
+	B.bPendingCompact = false;
+
+	// 순회 중 null이 된 슬롯 제거 + 인덱스 재구성 (드문 경로)
+	B.Actors.RemoveAll([](const TWeakObjectPtr<AActor>& Entry) { return !Entry.IsValid(); });
+	B.SlotByActor.Reset();
+	for (int32 i = 0; i < B.Actors.Num(); ++i)
+	{
+		B.SlotByActor.Add(B.Actors[i].Get(), i);
+	}
+}
+
+// ============================================================================
+// 조회
+// ============================================================================
+int32 UHellunaActorRegistrySubsystem::Num(EHellunaActorBucket Bucket) const
+{
+	return Bucket == EHellunaActorBucket::MAX ? 0 : Buckets[static_cast<int32>(Bucket)].Actors.Num();
+}
+
+AActor* UHellunaActorRegistrySubsystem::GetFirst(EHellunaActorBucket Bucket) const
+{
+	if (Bucket == EHellunaActorBucket::MAX)
+		return nullptr;
+
+	for (const TWeakObjectPtr<AActor>& Entry : Buckets[static_cast<int32>(Bucket)].Actors)
+	{
+		AActor* Actor = Entry.Get();
+		if (IsValid(Actor))
+		{
+			return Actor;
+		}
+	}
+	return nullptr;
+}
+
+// ============================================================================
+// FIterationScope
+// ============================================================================
+UHellunaActorRegistrySubsystem::FIterationScope::FIterationScope(UHellunaActorRegistrySubsystem& InOwner, EHellunaActorBucket InBucket)
+	: Owner(InOwner)
+	, Bucket(InBucket)
+{
+	++Owner.Buckets[static_cast<int32>(Bucket)].IterationDepth;
+}
+
+UHellunaActorRegistrySubsystem::FIterationScope::~FIterationScope()
+{
+	FBucket& B = Owner.Buckets[static_cast<int32>(Bucket)];
+	if (--B.IterationDepth == 0 && B.bPendingCompact)
+	{
+		Owner.Compact(B);
+	}
+}
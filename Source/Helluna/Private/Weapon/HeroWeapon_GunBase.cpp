@@ -12,6 +12,8 @@
 #include "Net/UnrealNetwork.h"
 #include "Character/HellunaHeroCharacter.h"
 #include "Camera/PlayerCameraManager.h"
+#include "Combat/HellunaLagCompensationSubsystem.h"
+#include "TimerManager.h"
 
 #include "DebugHelper.h"
 
@@ -113,11 +115,14 @@ void AHeroWeapon_GunBase::Fire(AController* InstigatorController)
 
 	const FVector ViewLoc = Pawn->GetPawnViewLocation();
 	FVector TraceEnd;
+	double RewindServerTime = -1.0;
 
 	// 캐싱된 AimPoint가 있으면 사용 (AnimNotify 경유 시)
 	if (bHasCachedClientAim)
 	{
 		bHasCachedClientAim = false;
+		// [LagCompV1] 조준한 순간 클라 화면 기준으로 되감아 판정
+		RewindServerTime = CachedClientViewTime;
 		FVector AimDir = (CachedClientAimPoint - ViewLoc).GetSafeNormal();
 		// [HIGH-FIX] 캐시 조준도 FireWithAimPoint와 동일하게 서버 검증한다 — ControlRotation과 90도 이상
 		// 벗어난(뒤를 겨냥하는) 캐시 값은 신뢰하지 않고 시야 방향으로 폴백(에임봇/임의 관통 방지).
@@ -139,7 +144,7 @@ void AHeroWeapon_GunBase::Fire(AController* InstigatorController)
 	CurrentMag = FMath::Max(0, CurrentMag - 1);
 	BroadcastAmmoChanged();
 
-	DoLineTraceAndDamage(InstigatorController, TraceStart, TraceEnd);
+	DoLineTraceAndDamage(InstigatorController, TraceStart, TraceEnd, RewindServerTime);
 }
 
 // ════════════════════════════════════════════════════════════════
@@ -214,15 +219,20 @@ void AHeroWeapon_GunBase::CacheClientAimPoint(const FVector& AimPoint)
 {
 	CachedClientAimPoint = AimPoint;
 	bHasCachedClientAim = true;
+	// 서버 로컬(리슨 호스트) 조준 — 화면이 곧 서버 상태라 되감기 불필요
+	CachedClientViewTime = -1.0;
 }
 
-void AHeroWeapon_GunBase::ServerCacheClientAimPoint_Implementation(const FVector& AimPoint)
+void AHeroWeapon_GunBase::ServerCacheClientAimPoint_Implementation(const FVector& AimPoint, double ClientViewTime)
 {
 	CachedClientAimPoint = AimPoint;
 	bHasCachedClientAim = true;
+	// [LagCompV1] 보고값은 신뢰하지 않음 — 되감기 창 제한은 ResolveHitscan 에서 서버 시각 기준으로 적용
+	CachedClientViewTime = FMath::IsFinite(ClientViewTime) ? ClientViewTime : -1.0;
 }
 
-void AHeroWeapon_GunBase::DoLineTraceAndDamage(AController* InstigatorController, const FVector& TraceStart, const FVector& TraceEnd)
+void AHeroWeapon_GunBase::DoLineTraceAndDamage(AController* InstigatorController, const FVector& TraceStart, const FVector& TraceEnd,
+	double RewindServerTime)
 {
 	// “실제 히트판정 + 데미지 적용” 핵심 함수
 
@@ -240,7 +250,7 @@ void AHeroWeapon_GunBase::DoLineTraceAndDamage(AController* InstigatorController
 	}
 
 	FHitResult Hit;
-	const bool bHit = World->LineTraceSingleByChannel(
+	bool bHit = World->LineTraceSingleByChannel(
 		Hit,
 		TraceStart,
 		TraceEnd,
@@ -248,6 +258,16 @@ void AHeroWeapon_GunBase::DoLineTraceAndDamage(AController* InstigatorController
 		Params
 	);
 
+	// [LagCompV1] 고핑 클라: 조준 시점의 영웅/적 캡슐로 되감아 재판정
+	if (RewindServerTime >= 0.0)
+	{
+		if (const UHellunaLagCompensationSubsystem* LagComp = UHellunaLagCompensationSubsystem::Get(this))
+		{
+			bHit = LagComp->ResolveHitscan(TraceStart, TraceEnd, TraceChannel, Params, Pawn,
+				RewindServerTime, Hit, bHit);
+		}
+	}
+
 	const FVector HitLocation = bHit ? Hit.ImpactPoint : TraceEnd;
 	const FVector ShotDirection = (TraceEnd - TraceStart).GetSafeNormal();
 
@@ -325,7 +345,7 @@ void AHeroWeapon_GunBase::DoLineTraceAndDamage(AController* InstigatorController
 			}
 		}
 
-		MulticastFireFX(TraceStart, TraceEnd, bHit, HitLocation);
+		QueueFireFX(HitLocation);
 	}
 }
 
@@ -339,19 +359,53 @@ void AHeroWeapon_GunBase::Multicast_DelayedImpactFX_Implementation(FVector_NetQu
 	SpawnImpactFX((FVector)HitLocation);
 }
 
-void AHeroWeapon_GunBase::MulticastFireFX_Implementation(FVector_NetQuantize TraceStart, FVector_NetQuantize TraceEnd, bool bHit, FVector_NetQuantize HitLocation)
+// ════════════════════════════════════════════════════════════════
+// [LagCompV1] 발사 FX 배치
+// ════════════════════════════════════════════════════════════════
+// 고핑 연사/RPC 몰림으로 한 프레임에 여러 발이 처리돼도
+// 무기당 Multicast 1회만 나가도록 임팩트 위치를 모았다가 다음 틱에 전송.
+// (샷건의 MulticastFireShotgunFX 와 같은 방식)
+// ════════════════════════════════════════════════════════════════
+void AHeroWeapon_GunBase::QueueFireFX(const FVector& ImpactLocation)
+{
+	PendingFireFX.Add(ImpactLocation);
+
+	if (bFireFXFlushScheduled)
+		return;
+
+	if (UWorld* World = GetWorld())
+	{
+		bFireFXFlushScheduled = true;
+		World->GetTimerManager().SetTimerForNextTick(this, &AHeroWeapon_GunBase::FlushPendingFireFX);
+	}
+}
+
+void AHeroWeapon_GunBase::FlushPendingFireFX()
+{
+	bFireFXFlushScheduled = false;
+	if (PendingFireFX.Num() == 0)
+		return;
+
+	MulticastFireFXBatch(PendingFireFX);
+	PendingFireFX.Reset();
+}
+
+void AHeroWeapon_GunBase::MulticastFireFXBatch_Implementation(const TArray<FVector_NetQuantize>& ImpactLocations)
 {
 	// ════════════════════════════════════════════
 	// [Phase 7.5] 발사 사운드 (소음기 자동 분기)
 	// ════════════════════════════════════════════
 	// 모든 GunBase 자식이 자동으로 상속받음.
 	// Shotgun은 자체 Multicast에서 사운드 1회 + FX 루프로 분리 호출.
+	// [LagCompV1] 같은 프레임에 묶인 발사는 사운드가 겹치므로 1회만 재생
 	// ════════════════════════════════════════════
 	PlayEquipActorFireSound();
 
-	// 임팩트 FX
-	const FVector SpawnLoc = bHit ? (FVector)HitLocation : (FVector)TraceEnd;
-	SpawnImpactFX(SpawnLoc);
+	// 임팩트 FX — 발사 수만큼
+	for (const FVector_NetQuantize& ImpactLocation : ImpactLocations)
+	{
+		SpawnImpactFX((FVector)ImpactLocation);
+	}
 }
 
 // ════════════════════════════════════════════════════════════════
@@ -186,8 +186,8 @@ void AHeroWeapon_Shotgun::DoLineTraceAndDamage_Shotgun(
 // ------------------------------------------------------------
 // ✅ 샷건 FX 멀티캐스트 구현
 // - 여기서 펠릿마다 "기존 GunBase의 FX 로직"을 그대로 재생해야 동일한 이펙트가 나옴
-// - 핵심: Super::MulticastFireFX_Implementation(...) 을 호출하면 네 기존 FX 코드가 그대로 실행됨
-//   (이건 네트워크 전송이 아니라 '로컬 실행'이야)
+// - 핵심: GunBase의 임팩트 FX(SpawnImpactFX)를 펠릿마다 로컬에서 직접 호출
+//   (GunBase 멀티캐스트를 다시 타지 않음 → 추가 네트워크 전송 없음)
 // ------------------------------------------------------------
 void AHeroWeapon_Shotgun::MulticastFireShotgunFX_Implementation(
 	FVector_NetQuantize TraceStart,
@@ -199,7 +199,7 @@ void AHeroWeapon_Shotgun::MulticastFireShotgunFX_Implementation(
 	// ════════════════════════════════════════════
 	// [Phase 7.5] 발사 사운드는 1회만 재생
 	// ════════════════════════════════════════════
-	// Super::MulticastFireFX_Implementation을 루프 안에서 호출하면
+	// GunBase FX 경로(사운드 + 임팩트)를 펠릿마다 그대로 돌리면
 	// 펠릿 수만큼 사운드가 중복 재생되는 문제 방지.
 	// 사운드 1회 + Niagara FX N회로 분리.
 	// ════════════════════════════════════════════
@@ -4,12 +4,31 @@
 
 #include "CoreMinimal.h"
 #include "BossEvent/BossPatternZoneBase.h"
+#include "ECS/Spatial/EnemySpatialHash.h"
+#include "Engine/NetSerialization.h"
 #include "BoidPredatorSwarmZone.generated.h"
 
 class UNiagaraSystem;
 class UNiagaraComponent;
 class AHellunaHeroCharacter;
 
+/** [BoidSoAV1] 클라 시뮬레이션 시작 정보 — 이것만 있으면 클라가 서버와 같은 초기 배치를 만든다 */
+USTRUCT()
+struct FBoidSwarmNetState
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Seed = 0;
+
+	UPROPERTY()
+	FVector_NetQuantize Center = FVector::ZeroVector;
+
+	/** false면 군집 종료 */
+	UPROPERTY()
+	bool bActive = false;
+};
+
 /**
  * ABoidPredatorSwarmZone
  *
@@ -49,6 +68,14 @@ class AHellunaHeroCharacter;
  *   - 이웃 탐색 O(N) (평균 밀도 기준)
  *   - 수십 마리 규모에서 Tick 부하 최소화
  *
+ * [BoidSoAV1] 성능 구조:
+ *   - 위치/속도/가속도를 SoA 배열로 보관, 가속도 계산·적분은 ParallelFor
+ *   - 히어로 위치는 스텝당 1회만 수집 (드론마다 TActorIterator 하던 경로 제거)
+ *   - 렌더링: Niagara 시스템 1개 + Array DI (드론마다 컴포넌트 1개 → 1개)
+ *   - 복제: 시드 + 중심만 복제 → 클라가 같은 초기 배치로 로컬 시뮬레이션,
+ *           서버는 CorrectionInterval 마다 양자화 위치/속도로 보정 (드론별 RPC 없음)
+ *   - 접촉 데미지는 서버만 판정
+ *
  * 시각적 특징:
  *   - 유기적 군집 흐름 — 완벽한 대칭이나 고정 패턴이 아닌 살아있는 움직임
  *   - 급강하 시 "포식자" 느낌
@@ -167,55 +194,122 @@ public:
 	// VFX
 	// =========================================================
 
+	/**
+	 * [BoidSoAV1] 군집 전체를 그리는 Niagara 시스템 1개.
+	 * User 파라미터로 Niagara Array DI 2개를 받는다 (월드 좌표):
+	 *   - SwarmPositionsParam (Position Array) : 드론 위치
+	 *   - SwarmVelocitiesParam (Vector Array)  : 드론 속도 (방향/스트레치용)
+	 * 그리고 float User 파라미터 BoidScale (= BoidVFXScale).
+	 * 파티클 수 = 배열 길이. 에미터는 Local Space 해제 상태여야 한다.
+	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "군집|VFX",
-		meta = (DisplayName = "드론 VFX (각 드론마다 1개)"))
+		meta = (DisplayName = "군집 VFX (Array DI, 시스템 1개)"))
+	TObjectPtr<UNiagaraSystem> SwarmVFX = nullptr;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "군집|VFX",
+		meta = (DisplayName = "위치 배열 User 파라미터 이름"))
+	FName SwarmPositionsParam = FName("BoidPositions");
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "군집|VFX",
+		meta = (DisplayName = "속도 배열 User 파라미터 이름"))
+	FName SwarmVelocitiesParam = FName("BoidVelocities");
+
+	/** [레거시] 드론마다 Niagara 컴포넌트 1개. SwarmVFX가 비어 있을 때만 사용 (에셋 이관 전 호환용) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "군집|VFX",
+		meta = (DisplayName = "[레거시] 드론 VFX (각 드론마다 1개)"))
 	TObjectPtr<UNiagaraSystem> BoidVFX = nullptr;
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "군집|VFX",
 		meta = (DisplayName = "VFX 스케일", ClampMin = "0.01", ClampMax = "5.0"))
 	float BoidVFXScale = 0.6f;
 
+	// =========================================================
+	// 네트워크
+	// =========================================================
+
+	/** [BoidSoAV1] 서버 → 클라 위치 보정 주기. 클라는 같은 시드로 로컬 시뮬레이션하고 이 주기로만 보정 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "군집|네트워크",
+		meta = (DisplayName = "보정 주기 (초)", ClampMin = "0.1", ClampMax = "5.0"))
+	float CorrectionInterval = 1.0f;
+
+	/** 보정 오차를 흡수하는 시간. 이 거리보다 크게 벌어진 드론은 즉시 스냅 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "군집|네트워크",
+		meta = (DisplayName = "보정 블렌드 시간 (초)", ClampMin = "0.0", ClampMax = "2.0"))
+	float CorrectionBlendTime = 0.3f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "군집|네트워크",
+		meta = (DisplayName = "보정 스냅 거리 (cm)", ClampMin = "50.0"))
+	float CorrectionSnapDistance = 600.f;
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
 protected:
 	virtual void Tick(float DeltaTime) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
-	struct FBoid
-	{
-		FVector Position = FVector::ZeroVector;
-		FVector Velocity = FVector::ZeroVector;
-		FVector Acceleration = FVector::ZeroVector;
-		TWeakObjectPtr<UNiagaraComponent> VFXComp;
-	};
-
-	TArray<FBoid> Boids;
-
-	// Uniform grid spatial hash
-	TMap<int64, TArray<int32>> SpatialHash;
+	// =========================================================
+	// [BoidSoAV1] Structure-of-Arrays 시뮬레이션 상태
+	//   인덱스 i = 드론 i. 세 배열은 항상 같은 길이.
+	//   Positions/Velocities는 Niagara Array DI에 그대로 복사된다.
+	// =========================================================
+
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	TArray<FVector> Accelerations;
+
+	/** [클라] 남은 보정 오프셋 — CorrectionBlendTime 동안 Positions에 나눠 반영 */
+	TArray<FVector> PendingCorrections;
+
+	/** 스텝당 1회 수집한 히어로 스냅샷 (ComputeChase / 접촉 데미지 공용) */
+	TArray<TWeakObjectPtr<AHellunaHeroCharacter>> HeroSnapshot;
+	TArray<FVector> HeroPositions;
+
+	/** 공간 해시 (ECS 이동 Processor와 같은 flat 해시 재사용 — Build 후 읽기 전용) */
+	FEnemySpatialHash SpatialHash;
 	float HashCellSize = 500.f;
 
+	/** 클라 시뮬레이션 시작용 복제 상태 (시드 + 중심) — 늦게 들어온 클라도 OnRep으로 시작 */
+	UPROPERTY(ReplicatedUsing = OnRep_SwarmState)
+	FBoidSwarmNetState SwarmState;
+
+	UFUNCTION()
+	void OnRep_SwarmState();
+
+	/** 서버 → 클라 주기 보정 (양자화 위치/속도 + Dive 상태). 유실돼도 다음 주기에 복구 */
+	UFUNCTION(NetMulticast, Unreliable)
+	void Multicast_SwarmCorrection(const TArray<FVector_NetQuantize>& InPositions,
+		const TArray<FVector_NetQuantize>& InVelocities, bool bInDive, float InDiveTimer, float InDiveElapsed);
+
+	UPROPERTY(Transient)
+	TObjectPtr<UNiagaraComponent> SwarmVFXComp = nullptr;
+
+	/** [레거시] 드론별 컴포넌트 (SwarmVFX 미지정 시) */
+	TArray<TWeakObjectPtr<UNiagaraComponent>> LegacyBoidVFXComps;
+
 	bool bZoneActive = false;
 	bool bInDiveMode = false;
 	float DiveTimer = 0.f;
 	float DiveElapsed = 0.f;
+	float CorrectionTimer = 0.f;
 
 	TMap<TWeakObjectPtr<AActor>, double> LastContactTime;
 
 	FTimerHandle PatternEndTimerHandle;
 
-	void SpawnBoids();
-	void BuildSpatialHash();
-	int64 HashKey(const FVector& Pos) const;
-	void GatherNeighbors(int32 BoidIdx, TArray<int32>& OutNeighbors) const;
+	/** 시드로 초기 배치 생성 (서버/클라 동일 결과) + VFX 생성 */
+	void StartSwarm(int32 Seed, const FVector& Center);
+	void StopSwarm();
 
-	FVector ComputeSeparation(int32 Idx, const TArray<int32>& Neighbors) const;
-	FVector ComputeAlignment(int32 Idx, const TArray<int32>& Neighbors) const;
-	FVector ComputeCohesion(int32 Idx, const TArray<int32>& Neighbors) const;
-	FVector ComputeChase(int32 Idx) const;
+	void GatherHeroes();
+	FVector ComputeChase(const FVector& Self, const FVector& Velocity, float ChaseZ) const;
 
 	void UpdateBoids(float DeltaTime);
 	void UpdateDiveMode(float DeltaTime);
+	void ApplyPendingCorrections(float DeltaTime);
+	void SendCorrection(float DeltaTime);
 	void ProcessContactDamage();
-	void UpdateVFXPositions();
+	void UpdateVFX();
 
-	FVector LimitVector(const FVector& V, float MaxLen) const;
+	static FVector LimitVector(const FVector& V, float MaxLen);
 };
@@ -250,6 +250,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 
 	/** [BPDefaultSyncV1] BP CDO 값을 instance 에 복사. */
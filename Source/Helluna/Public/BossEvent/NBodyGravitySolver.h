@@ -0,0 +1,126 @@
+// Capstone Project Helluna
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * FNBodyGravitySolver
+ *
+ * [NBodyBarnesHutV1] ANBodySingularityZone의 중력 계산부를 분리한 순수 C++ 솔버.
+ *
+ * ═══════════════════════════════════════════════════════════
+ * 개요:
+ *   - 정확 해(쌍별 O(N²))와 Barnes–Hut 근사(O(N log N))를 같은 인터페이스로 제공
+ *   - Barnes–Hut: 옥트리 노드의 질량중심을 하나의 바디로 취급
+ *       노드 크기 s, 질량중심까지 거리 d 에 대해 s / d < θ 이면 근사, 아니면 자식 노드로 내려감
+ *       θ = 0 이면 항상 내려가므로 정확 해와 같은 결과 (합산 순서만 다름)
+ *   - 바디별 가속도 평가는 ParallelFor (트리는 구축 후 읽기 전용)
+ *
+ * 결정성:
+ *   - 트리 구축은 단일 스레드, 바디별 합산은 스레드와 무관하게 항상 같은 순서
+ *     → 같은 입력 + 같은 Dt 이면 실행마다 같은 결과 (고정 스텝 모드 / 자동화 테스트 기준)
+ *
+ * 사용처:
+ *   - ANBodySingularityZone (게임플레이)
+ *   - Helluna.BossEvent.NBody.Solver 자동화 테스트 (정확 해 대비 오차 검증)
+ * ═══════════════════════════════════════════════════════════
+ */
+
+/** 솔버 파라미터 — Zone의 UPROPERTY에서 매 스텝 채운다 */
+struct FNBodySolverParams
+{
+	/** 중력 상수 (튜닝용) */
+	float GravityConstant = 50000.f;
+
+	/** 소프트닝 (cm) — r² + eps² */
+	float Softening = 100.f;
+
+	/** 최대 가속도 클램프 (cm/s²) */
+	float MaxAcceleration = 5000.f;
+
+	/** Barnes–Hut 개방 기준 θ. 0 이하면 정확 해 */
+	float Theta = 0.5f;
+
+	/** 살아있는 바디가 이 수 미만이면 트리 구축 비용이 더 커서 정확 해 사용 */
+	int32 MinBodiesForTree = 16;
+
+	/** false면 ParallelFor를 단일 스레드로 강제 */
+	bool bParallel = true;
+};
+
+/** SoA 바디 상태. bAlive = 0 인 바디는 힘을 주지도 받지도 않는다 */
+struct FNBodyState
+{
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	TArray<FVector> Accelerations;
+	TArray<float> Masses;
+	TArray<uint8> Alive;
+
+	int32 Num() const { return Positions.Num(); }
+
+	void Reset()
+	{
+		Positions.Reset();
+		Velocities.Reset();
+		Accelerations.Reset();
+		Masses.Reset();
+		Alive.Reset();
+	}
+
+	int32 Add(const FVector& Position, const FVector& Velocity, float Mass)
+	{
+		Positions.Add(Position);
+		Velocities.Add(Velocity);
+		Accelerations.Add(FVector::ZeroVector);
+		Masses.Add(Mass);
+		return Alive.Add(1);
+	}
+};
+
+class HELLUNA_API FNBodyGravitySolver
+{
+public:
+	/** Params.Theta / 바디 수에 따라 정확 해 또는 Barnes–Hut으로 State.Accelerations 채움 */
+	void ComputeAccelerations(FNBodyState& State, const FNBodySolverParams& Params);
+
+	/** 쌍별 정확 해 (테스트 기준값) */
+	static void ComputeExact(FNBodyState& State, const FNBodySolverParams& Params);
+
+	/** Barnes–Hut 근사 (Theta <= 0 이어도 트리를 사용 — 테스트용) */
+	void ComputeBarnesHut(FNBodyState& State, const FNBodySolverParams& Params);
+
+	/** 가속도 계산 + semi-implicit Euler 1스텝 (v += a*dt, p += v*dt) */
+	void Step(FNBodyState& State, const FNBodySolverParams& Params, float Dt);
+
+	/** 마지막 Barnes–Hut 트리 노드 수 (디버그용) */
+	int32 GetLastNodeCount() const { return Nodes.Num(); }
+
+private:
+	/** 옥트리 노드. 자식 8개는 FirstChild부터 연속 배치 */
+	struct FNode
+	{
+		FVector Center = FVector::ZeroVector;
+		double HalfSize = 0.0;
+
+		/** Σ m·p — 질량중심 = WeightedPosSum / Mass */
+		FVector WeightedPosSum = FVector::ZeroVector;
+		double Mass = 0.0;
+
+		int32 FirstChild = INDEX_NONE;
+
+		/** 리프의 첫 바디. 최대 깊이에서만 NextBody 체인으로 여러 개 */
+		int32 FirstBody = INDEX_NONE;
+	};
+
+	void BuildTree(const FNBodyState& State);
+	void InsertBody(const FNBodyState& State, int32 Body);
+	FVector EvaluateBody(const FNBodyState& State, int32 Body, double ThetaSq, double SoftSq, double G) const;
+
+	static int32 GetOctant(const FVector& Center, const FVector& Position);
+
+	/** 재사용 버퍼 (용량 유지) */
+	TArray<FNode> Nodes;
+	TArray<int32> NextBody;
+};
@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 #include "BossEvent/BossPatternZoneBase.h"
+#include "BossEvent/NBodyGravitySolver.h"
+#include "ECS/Spatial/EnemySpatialHash.h"
 #include "NBodySingularityZone.generated.h"
 
 class UNiagaraSystem;
@@ -50,6 +52,13 @@ class AHellunaHeroCharacter;
  *   - 예측 불가능한 카오스 궤도 (진정한 n-body)
  *   - 머저 시 거대 폭발 → 극적인 순간
  *
+ * [NBodyBarnesHutV1] 성능 구조:
+ *   - 중력 계산은 FNBodyGravitySolver로 분리 (SoA 상태, ParallelFor)
+ *   - BarnesHutTheta > 0 이고 바디가 BarnesHutMinBodies 이상이면 Barnes–Hut 옥트리 근사 (O(N log N))
+ *   - 머저 검사는 공간 해시 인접 셀만 (쌍별 O(N²) 제거)
+ *   - 히어로 위치는 프레임당 1회만 수집 (서브스텝/머저마다 TActorIterator 하던 경로 제거)
+ *   - bDeterministicFixedStep: 프레임 DeltaTime과 무관한 고정 스텝 → 정확 해와 비교 가능한 결정적 결과
+ *
  * 기술 플렉스:
  *   - 실제 뉴턴 중력 방정식 (F = Gm₁m₂/r²)
  *   - Semi-implicit Euler 수치 적분
@@ -74,7 +83,7 @@ public:
 
 	/** 초기 특이점 수 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "N-Body|초기",
-		meta = (DisplayName = "특이점 수", ClampMin = "2", ClampMax = "6"))
+		meta = (DisplayName = "특이점 수", ClampMin = "2", ClampMax = "64"))
 	int32 SingularityCount = 4;
 
 	/** 특이점 질량 */
@@ -116,6 +125,39 @@ public:
 		meta = (DisplayName = "궤도 경계 (cm)", ClampMin = "1000.0", ClampMax = "6000.0"))
 	float MaxOrbitRadius = 3000.f;
 
+	// =========================================================
+	// 솔버 설정 [NBodyBarnesHutV1]
+	// =========================================================
+
+	/** Barnes–Hut 개방 기준 θ (노드 크기 / 거리). 0 이면 항상 정확 해. 클수록 빠르고 부정확 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "N-Body|솔버",
+		meta = (DisplayName = "Barnes-Hut θ", ClampMin = "0.0", ClampMax = "1.5"))
+	float BarnesHutTheta = 0.5f;
+
+	/** 살아있는 특이점이 이 수 미만이면 트리 대신 정확 해 (소수일 땐 트리 구축이 더 비쌈) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "N-Body|솔버",
+		meta = (DisplayName = "Barnes-Hut 최소 바디 수", ClampMin = "2", ClampMax = "256"))
+	int32 BarnesHutMinBodies = 16;
+
+	/** 가변 스텝 모드의 프레임당 서브스텝 수 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "N-Body|솔버",
+		meta = (DisplayName = "서브스텝 수", ClampMin = "1", ClampMax = "8"))
+	int32 Substeps = 2;
+
+	/** 고정 스텝 모드 — 프레임 시간과 무관하게 FixedStepSeconds 단위로만 적분 (결정적) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "N-Body|솔버",
+		meta = (DisplayName = "결정적 고정 스텝"))
+	bool bDeterministicFixedStep = false;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "N-Body|솔버",
+		meta = (DisplayName = "고정 스텝 (초)", ClampMin = "0.002", ClampMax = "0.1", EditCondition = "bDeterministicFixedStep"))
+	float FixedStepSeconds = 1.f / 60.f;
+
+	/** 프레임당 최대 고정 스텝 수 (히치 시 스파이럴 방지 — 초과분은 버림) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "N-Body|솔버",
+		meta = (DisplayName = "프레임당 최대 고정 스텝", ClampMin = "1", ClampMax = "16", EditCondition = "bDeterministicFixedStep"))
+	int32 MaxFixedStepsPerFrame = 4;
+
 	// =========================================================
 	// 머저 설정
 	// =========================================================
@@ -183,28 +225,35 @@ protected:
 	virtual void Tick(float DeltaTime) override;
 
 private:
-	struct FSingularity
-	{
-		FVector Position = FVector::ZeroVector;
-		FVector Velocity = FVector::ZeroVector;
-		FVector Acceleration = FVector::ZeroVector;
-		float Mass = 100.f;
-		bool bAlive = true;
-		TWeakObjectPtr<UNiagaraComponent> VFXComp;
-	};
-
-	TArray<FSingularity> Singularities;
+	/** 특이점 SoA 상태 (Positions/Velocities/Accelerations/Masses/Alive) */
+	FNBodyState Bodies;
+
+	/** 바디별 VFX (Bodies 인덱스와 1:1) */
+	TArray<TWeakObjectPtr<UNiagaraComponent>> BodyVFXComps;
+
+	FNBodyGravitySolver Solver;
+
+	/** 머저 후보 탐색용 (셀 = MergerDistance) */
+	FEnemySpatialHash MergerHash;
+
+	/** 프레임당 1회 수집한 히어로 스냅샷 */
+	TArray<TWeakObjectPtr<AHellunaHeroCharacter>> HeroSnapshot;
 
 	bool bZoneActive = false;
 
+	/** 고정 스텝 누적 시간 */
+	float FixedStepAccumulator = 0.f;
+
 	// 접촉 쿨다운 per player
 	TMap<TWeakObjectPtr<AActor>, double> LastContactTime;
 
 	FTimerHandle PatternEndTimerHandle;
 
+	FNBodySolverParams MakeSolverParams() const;
+	void GatherHeroes();
+	void SimulateStep(float StepDt);
+
 	void InitializeSingularities();
-	void ComputeForces();
-	void IntegrateMotion(float DeltaTime);
 	void HandleMergers();
 	void EnforceBoundaryReflection();
 	void ApplyGravityToPlayers(float DeltaTime);
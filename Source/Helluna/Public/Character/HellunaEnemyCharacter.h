@@ -43,6 +43,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	virtual void PossessedBy(AController* NewController) override;
 
@@ -895,6 +896,40 @@ public:
 	public:
 	void UpdateAnimationLOD(float DistanceToCamera);
 
+	// =========================================================
+	// [AnimBudgetV1] 서버 애니메이션 예산
+	//  - 밴드별 URO 비렌더 갱신 주기: 근거리 4 / 중거리 8 / 원거리 16 프레임 (엔진 기본 4가 하한)
+	//  - 데디 서버: 몽타주/공격 포즈가 없으면 스켈레톤 갱신 자체를 생략
+	//  - Processor 가 매 프레임 예산을 넘으면 먼 Actor 부터 주기를 늘려 SetServerAnimUpdateRate 로 적용
+	// =========================================================
+
+	/** FAnimUpdateRateParameters::BaseNonRenderedUpdateRate 엔진 기본값 — 밴드/예산 주기의 하한 */
+	static constexpr int32 EngineNonRenderedAnimUpdateRate = 4;
+
+	/** 현재 거리 밴드의 기본 URO 갱신 주기 (프레임) */
+	int32 GetBandAnimUpdateRate() const { return BandAnimUpdateRate; }
+
+	/** 이번 프레임 스켈레톤 평가 비용이 드는지 (데디 서버 스킵 중이면 false) */
+	bool IsEvaluatingSkeleton() const;
+
+	/** URO 비렌더 갱신 주기 적용 (엔진 기본값 미만은 올림) — 값이 바뀔 때만 파라미터 갱신 */
+	void SetServerAnimUpdateRate(int32 UpdateRate);
+
+	/** 데디 서버 스켈레톤 스킵 재평가 (몽타주 시작/종료, 공격 포즈, 밴드 변경 시 호출) */
+	void RefreshServerSkeletonUpdate();
+
+private:
+	UFUNCTION()
+	void OnServerAnimMontageStarted(UAnimMontage* Montage);
+
+	UFUNCTION()
+	void OnServerAnimMontageEnded(UAnimMontage* Montage, bool bInterrupted);
+
+	int32 BandAnimUpdateRate = EngineNonRenderedAnimUpdateRate;
+
+	/** 마지막으로 적용한 갱신 주기 (0 = 미적용) */
+	int32 AppliedAnimUpdateRate = 0;
+
 protected:
 	// MassAgent가 이미 붙어있다면 캐싱(없으면 FindComponentByClass로 찾아씀)
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Mass")
@@ -0,0 +1,158 @@
+/**
+ * HellunaLagCompensationSubsystem.h
+ *
+ * [LagCompV1] 히트스캔 래그 보상 — 서버 전용 캡슐 히스토리 + 되감기 판정 (UTickableWorldSubsystem).
+ *
+ * ■ 이 파일이 뭔가요? (팀원용)
+ *   서버는 "지금" 위치로 라인트레이스를 하는데, 핑이 높은 클라는 RTT/2 만큼 과거의 적을 보고 쏩니다.
+ *   그래서 화면상 분명히 맞춘 총알이 서버에선 빗나가고, 플레이어는 연사로 보정 → RPC/트레이스만 늘어납니다.
+ *   이 서브시스템은 영웅/적의 충돌 캡슐을 고정 크기 링 버퍼에 기록해 두었다가,
+ *   클라가 보고한 "화면 기준 서버 시각"으로 되감아 히트를 확인합니다.
+ *
+ * ■ 기록 (서버, Helluna.LagComp.RecordHz 주기)
+ *   - 대상: ActorRegistry 의 Hero / Enemy 버킷 (Pool 비활성·숨김 Actor 제외)
+ *   - 모든 대상이 같은 프레임 슬롯에 기록됨 → 되감기 시 프레임 탐색 1회 후 대상별 인덱스 접근
+ *   - 캡슐 충돌이 꺼진 대상(사망 등)은 해당 프레임에 "맞을 수 없음"으로 기록
+ *
+ * ■ 판정 (ResolveHitscan)
+ *   1. 현재 트레이스 결과에서 추적 대상(영웅/적)을 걷어내고 고정 장애물까지의 거리를 구함
+ *   2. 되감은 시각의 캡슐들과 레이를 해석적으로 교차 (물리 씬은 건드리지 않음)
+ *      - 트레이스 채널을 Block 하지 않는 캡슐은 제외 (예: Visibility 를 무시하는 아군 Pawn)
+ *   3. 장애물보다 가까운 캡슐이 있으면 그 Actor 를 맞춘 것으로 확정
+ *      - ImpactPoint 는 되감은 지점을 Actor 의 현재 위치로 옮긴 값 (데미지/FX 가 현재 몸에 표시)
+ *      - 그 사이 죽었거나 Pool 로 돌아간 후보는 건너뛰고 다음으로 가까운 후보를 검사
+ *   4. 되감기 창은 Helluna.LagComp.MaxRewindMs 와 보관 중인 히스토리 중 짧은 쪽으로 제한
+ *
+ * ■ 시스템 내 위치
+ *   - 기록: 이 서브시스템 Tick (리슨/데디 서버만)
+ *   - 시각 보고: UHeroGameplayAbility_Shoot → AHeroWeapon_GunBase::ServerCacheClientAimPoint
+ *   - 판정: AHeroWeapon_GunBase::DoLineTraceAndDamage
+ *
+ * @author 김민우
+ */
+
+// File: Source/Helluna/Public/Combat/HellunaLagCompensationSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "HellunaLagCompensationSubsystem.generated.h"
+
+class APawn;
+class UCapsuleComponent;
+
+UCLASS()
+class HELLUNA_API UHellunaLagCompensationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** 히스토리 링 버퍼 프레임 수 (RecordHz 30 기준 약 0.5초) */
+	static constexpr int32 HistorySize = 16;
+
+	/** WorldContext의 서브시스템 (월드가 없으면 nullptr) */
+	static UHellunaLagCompensationSubsystem* Get(const UObject* WorldContext);
+
+	/**
+	 * 로컬 플레이어 화면 기준 서버 시각 — 발사 클라에서 호출해 서버로 보고.
+	 * 동기화된 서버 시각에서 단방향 지연(핑/2)을 뺀 값 = 화면에 보이는 적이 서버에 있던 시각.
+	 */
+	static double GetLocalViewServerTime(const APawn* ShooterPawn);
+
+	// === UWorldSubsystem 인터페이스 ===
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	// === FTickableGameObject 인터페이스 ===
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * 현재 트레이스 결과를 되감은 시각 기준으로 재판정.
+	 * @param ViewServerTime  클라가 보고한 화면 기준 서버 시각 (음수 = 되감기 안 함)
+	 * @param InOutHit        현재 트레이스 결과 → 되감기 판정 결과로 교체
+	 * @param bCurrentHit     현재 트레이스 적중 여부
+	 * @return                최종 적중 여부
+	 */
+	bool ResolveHitscan(const FVector& Start, const FVector& End, ECollisionChannel Channel,
+		const FCollisionQueryParams& Params, const AActor* Shooter, double ViewServerTime,
+		FHitResult& InOutHit, bool bCurrentHit) const;
+
+	/** 히스토리에 기록 중인 대상인지 */
+	bool IsTracked(const AActor* Actor) const { return Actor && TargetIndexByActor.Contains(Actor); }
+
+	int32 GetNumTracked() const { return Targets.Num(); }
+
+private:
+	struct FCapsuleSample
+	{
+		FVector Center = FVector::ZeroVector;
+		FVector Up = FVector::UpVector;
+		float Radius = 0.f;
+		float HalfHeight = 0.f;
+
+		/** false = 이 프레임엔 맞을 수 없음 (미기록/숨김/충돌 꺼짐) */
+		bool bValid = false;
+	};
+
+	struct FTarget
+	{
+		TWeakObjectPtr<AActor> Actor;
+
+		/** TargetIndexByActor 키 — Actor 가 GC 된 뒤에도 맵에서 지울 수 있도록 보관 */
+		TObjectKey<AActor> ActorKey;
+
+		/** 기록한 충돌 캡슐 — 판정 시 트레이스 채널 응답 확인용 (Cast 반복 방지) */
+		TWeakObjectPtr<const UCapsuleComponent> Capsule;
+
+		FCapsuleSample Samples[HistorySize];
+
+		/** 마지막으로 유효 샘플을 기록한 프레임 번호 — HistorySize 프레임 동안 안 보이면 제거 */
+		uint64 LastSeenSerial = 0;
+	};
+
+	/** 되감기 레이 판정 결과 */
+	struct FRewindHit
+	{
+		int32 TargetIndex = INDEX_NONE;
+		float Distance = 0.f;
+		FVector Point = FVector::ZeroVector;
+		FVector Normal = FVector::ZeroVector;
+		FVector RewoundCenter = FVector::ZeroVector;
+	};
+
+	double GetServerTime() const;
+	bool IsRecordingWorld() const;
+
+	void RecordFrame();
+	void RecordActor(AActor* Actor, int32 Slot);
+
+	/** 되감을 시각 → 앞/뒤 프레임 슬롯 + 보간 계수. 히스토리가 없으면 false */
+	bool FindFrames(double Time, int32& OutSlotA, int32& OutSlotB, float& OutAlpha) const;
+
+	/**
+	 * 되감은 캡슐 중 레이에 가장 가까운 대상. Channel 을 Block 하지 않는 대상과 SkipTargets 는 제외.
+	 * @param SkipTargets  이미 검사해 거절한 TargetIndex (다음 후보 탐색용)
+	 */
+	bool RewindRay(const FVector& Start, const FVector& Dir, float MaxDistance, double Time,
+		ECollisionChannel Channel, const AActor* Shooter, TConstArrayView<int32> SkipTargets, FRewindHit& OutHit) const;
+
+	/** 레이-캡슐 교차 (Dir 정규화). 진입 거리, 시작점이 캡슐 안이면 -1 */
+	static float IntersectCapsule(const FVector& Start, const FVector& Dir, const FCapsuleSample& Capsule);
+
+	TSparseArray<FTarget> Targets;
+	TMap<TObjectKey<AActor>, int32> TargetIndexByActor;
+
+	/** 프레임 슬롯별 기록 시각 */
+	double FrameTimes[HistorySize] = {};
+
+	/** 누적 기록 프레임 수 (슬롯 = Serial % HistorySize) */
+	uint64 FrameSerial = 0;
+
+	float TimeUntilRecord = 0.f;
+
+	/** 정리 스크래치 버퍼 (재할당 방지) */
+	TArray<int32> StaleTargets;
+};
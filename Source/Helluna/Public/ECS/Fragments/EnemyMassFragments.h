@@ -3,11 +3,14 @@
  *
  * 하이브리드 ECS 시스템에서 사용하는 Mass Entity Fragment 정의.
  *
- * 1) FEnemySpawnStateFragment - 각 Entity의 Actor 전환 상태 추적
- * 2) FEnemyDataFragment - 스폰/디스폰/틱 최적화 설정 + HP 보존 데이터
+ * 1) FEnemySpawnStateFragment   - 각 Entity의 Actor 전환 상태 추적
+ * 2) FEnemyConfigSharedFragment - 스폰/디스폰/틱 최적화/시각화 설정 (아키타입별 Const Shared)
+ * 3) FEnemyDataFragment         - HP 보존 + 목표/이동 방향 등 per-entity 런타임 상태
+ * 4) FEnemyVisualInstanceFragment - Entity 시각화 ISMC 인스턴스 인덱스 (클라/Listen 전용 의미)
  *
  * 모든 설정값은 UEnemyMassTrait에서 에디터로 설정하고,
- * BuildTemplate에서 AddFragment_GetRef<T>()로 Fragment에 복사된다.
+ * BuildTemplate에서 GetOrCreateConstSharedFragment()로 공유 Fragment를 만든다.
+ * 설정을 Entity마다 복사하지 않으므로 Chunk stride가 작아져 Chunk당 Entity 수가 늘어난다.
  */
 
 // File: Source/Helluna/Public/ECS/Fragments/EnemyMassFragments.h
@@ -16,6 +19,7 @@
 
 #include "CoreMinimal.h"
 #include "MassEntityTypes.h"
+#include "HellunaTypes.h"
 #include "EnemyMassFragments.generated.h"
 
 class AHellunaEnemyCharacter;
@@ -52,27 +56,32 @@ struct HELLUNA_API FEnemySpawnStateFragment : public FMassFragment
 };
 
 // ============================================================================
-// FEnemyDataFragment
-// 스폰/디스폰 설정 + 거리별 틱 최적화 + HP 보존 데이터.
-// Trait에서 설정하는 값과 런타임 상태가 공존한다.
+// FEnemyConfigSharedFragment
+// 아키타입(=Trait 설정)별로 1개만 존재하는 불변 설정 Const Shared Fragment.
+// UEnemyMassTrait::BuildTemplate에서 채워지고, 같은 설정의 Entity들은
+// 동일한 인스턴스를 공유한다 (Chunk 단위로 분할되므로 Chunk 내 설정은 항상 동일).
 // ============================================================================
 USTRUCT()
-struct HELLUNA_API FEnemyDataFragment : public FMassFragment
+struct HELLUNA_API FEnemyConfigSharedFragment : public FMassConstSharedFragment
 {
 	GENERATED_BODY()
 
-	// === 스폰 설정 (Trait에서 복사) ===
+	// === 스폰 설정 ===
 
 	/** 스폰할 적 블루프린트 클래스 */
 	UPROPERTY()
 	TSubclassOf<AHellunaEnemyCharacter> EnemyClass;
 
-	// === Entity 시각화 설정 (NEW!) ===
-	
+	/** EnemyClass CDO의 EnemyGrade — Entity 상태 사망도 Actor 사망과 같은 등급 분기를 타도록 */
+	UPROPERTY()
+	EEnemyGrade EnemyGrade = EEnemyGrade::Normal;
+
+	// === Entity 시각화 설정 ===
+
 	/** Entity 상태일 때 표시할 Static Mesh */
 	UPROPERTY()
 	TObjectPtr<UStaticMesh> EntityVisualizationMesh;
-	
+
 	/** Entity Mesh의 스케일 */
 	UPROPERTY()
 	FVector EntityMeshScale = FVector(1.0f, 1.0f, 1.0f);
@@ -80,7 +89,7 @@ struct HELLUNA_API FEnemyDataFragment : public FMassFragment
 	/** Entity Mesh의 Z축 오프셋 (cm). 메시가 공중에 떠 있을 때 사용 */
 	UPROPERTY()
 	float EntityMeshZOffset = 0.0f;
-	
+
 	/** Entity 상태에서도 보일지 여부 */
 	UPROPERTY()
 	bool bShowEntityVisualization = true;
@@ -93,7 +102,7 @@ struct HELLUNA_API FEnemyDataFragment : public FMassFragment
 	UPROPERTY()
 	float DespawnThreshold = 6000.f;
 
-	// === Actor 제한 (Trait에서 복사) ===
+	// === Actor 제한 ===
 
 	/** 동시 최대 Actor 수 (Soft Cap). 초과 시 먼 Actor부터 Entity로 복귀 */
 	UPROPERTY()
@@ -103,7 +112,7 @@ struct HELLUNA_API FEnemyDataFragment : public FMassFragment
 	UPROPERTY()
 	int32 PoolSize = 60;
 
-	// === 거리별 Tick 빈도 (Trait에서 복사) ===
+	// === 거리별 Tick 빈도 ===
 
 	/** 근거리 기준 (cm). 이 이내 = NearTickInterval 적용 */
 	UPROPERTY()
@@ -125,34 +134,12 @@ struct HELLUNA_API FEnemyDataFragment : public FMassFragment
 	UPROPERTY()
 	float FarTickInterval = 0.25f;
 
-	// === HP 보존 (런타임 상태 - Trait에서 설정하지 않음) ===
-
-	/** 현재 HP. -1 = 아직 스폰 안 됨. Actor->Entity 복귀 시 저장, 재스폰 시 복원 */
-	UPROPERTY()
-	float CurrentHP = -1.f;
-
-	/** 최대 HP. Actor에서 읽어서 저장 */
-	UPROPERTY()
-	float MaxHP = 100.f;
-	
-	// === Entity 이동(우주선 고정 목표) ===
+	// === Entity 이동 ===
 
 	/** 우주선(목표) 액터 태그. 시작 시 1회 찾아서 위치 캐싱 */
 	UPROPERTY()
 	FName GoalActorTag = TEXT("SpaceShip");
 
-	/** 캐싱된 우주선 위치 (월드 좌표) */
-	UPROPERTY()
-	FVector GoalLocation = FVector::ZeroVector;
-
-	/** GoalLocation이 유효하게 채워졌는지 */
-	UPROPERTY()
-	bool bGoalLocationCached = false;
-
-	/** Entity 상태에서 마지막으로 이동한 방향 (Actor 전환 시 초기 방향으로 사용) */
-	UPROPERTY()
-	FVector LastMoveDirection = FVector::ForwardVector;
-
 	/** Entity 상태에서 목표로 이동 속도 (cm/s) */
 	UPROPERTY()
 	float EntityMoveSpeed = 300.f;
@@ -181,10 +168,38 @@ struct HELLUNA_API FEnemyDataFragment : public FMassFragment
 	 */
 	UPROPERTY()
 	FVector MeshSpawnScale = FVector(1.f, 1.f, 1.f);
+};
 
-	// === Actor Tick Rate 밴드 캐싱 (#8 최적화) ===
-	/** 이전 거리 밴드 (0=근거리, 1=중거리, 2=원거리, -1=미설정). 밴드 변경 시에만 UpdateActorTickRate 호출 */
-	int32 CachedDistanceBand = -1;
+// ============================================================================
+// FEnemyDataFragment
+// Entity마다 달라지는 런타임 상태만 보관하는 slim per-entity Fragment.
+// (HP 보존, 목표 위치, 마지막 이동 방향, 거리 밴드, 팀 컬러)
+// 불변 설정값은 FEnemyConfigSharedFragment 참조.
+// ============================================================================
+USTRUCT()
+struct HELLUNA_API FEnemyDataFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	// === HP 보존 ===
+
+	/** 현재 HP. -1 = 아직 스폰 안 됨. Actor->Entity 복귀 시 저장, 재스폰 시 복원 */
+	UPROPERTY()
+	float CurrentHP = -1.f;
+
+	/** 최대 HP. Actor에서 읽어서 저장 */
+	UPROPERTY()
+	float MaxHP = 100.f;
+
+	// === Entity 이동(우주선 고정 목표) ===
+
+	/** 캐싱된 우주선 위치 (월드 좌표) */
+	UPROPERTY()
+	FVector GoalLocation = FVector::ZeroVector;
+
+	/** Entity 상태에서 마지막으로 이동한 방향 (Actor 전환 시 초기 방향으로 사용) */
+	UPROPERTY()
+	FVector LastMoveDirection = FVector::ForwardVector;
 
 	// === 팀 컬러 RGB ===
 	/**
@@ -195,14 +210,42 @@ struct HELLUNA_API FEnemyDataFragment : public FMassFragment
 	UPROPERTY()
 	FLinearColor TeamColor = FLinearColor::Transparent;
 
+	/** [EntityRepProxyV1] TeamColor의 CDO->TeamColorOptions 인덱스 (-1=미지정). 클라 프록시 복제용 */
+	int8 TeamColorIndex = INDEX_NONE;
+
+	// === Actor Tick Rate 밴드 캐싱 (#8 최적화) ===
+	/** 이전 거리 밴드 (0=근거리, 1=중거리, 2=원거리, -1=미설정). 밴드 변경 시에만 UpdateActorTickRate 호출 */
+	int8 CachedDistanceBand = -1;
+
+	/** GoalLocation이 유효하게 채워졌는지 */
+	UPROPERTY()
+	bool bGoalLocationCached = false;
+
 	/** TeamColor 가 첫 결정됐는지. false = 다음 ActivateActor 가 새로 픽. */
 	UPROPERTY()
 	bool bTeamColorAssigned = false;
 };
 
+// ============================================================================
+// FEnemyVisualInstanceFragment
+// [ISMCBatchV1] Entity 상태 시각화용 ISMC 인스턴스 인덱스.
+// 이전에는 Processor의 TMap<Entity, Ref>로 매 프레임 Entity마다 조회했으나
+// 인덱스를 Fragment에 직접 두어 Chunk 순회 중 맵 조회 없이 접근한다.
+// Mesh는 Chunk의 FEnemyConfigSharedFragment::EntityVisualizationMesh로 결정된다.
+// ============================================================================
+USTRUCT()
+struct HELLUNA_API FEnemyVisualInstanceFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	/** Mesh별 ISMC 내 인스턴스 인덱스. INDEX_NONE = 인스턴스 없음 (Actor 상태/사망/숨김) */
+	int32 InstanceIndex = INDEX_NONE;
+};
+
 // ============================================================================
 // TMassFragmentTraits 특수화
-// TSubclassOf, TWeakObjectPtr는 non-trivially copyable이므로 명시적 opt-out 필요.
+// TWeakObjectPtr는 non-trivially copyable이므로 명시적 opt-out 필요.
+// (FEnemyDataFragment는 POD 필드만 남아 opt-out 불필요)
 // ============================================================================
 
 template<>
@@ -211,8 +254,3 @@ struct TMassFragmentTraits<FEnemySpawnStateFragment>
 	enum { AuthorAcceptsItsNotTriviallyCopyable = true };
 };
 
-template<>
-struct TMassFragmentTraits<FEnemyDataFragment>
-{
-	enum { AuthorAcceptsItsNotTriviallyCopyable = true };
-};
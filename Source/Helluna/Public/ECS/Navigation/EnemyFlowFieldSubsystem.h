@@ -0,0 +1,168 @@
+/**
+ * EnemyFlowFieldSubsystem.h
+ *
+ * Entity 상태 적들이 우주선까지 지형을 따라 이동하도록 만드는 Flow Field 서브시스템.
+ *
+ * ■ 이 파일이 뭔가요? (팀원용)
+ *   우주선 주변 NavMesh를 격자로 샘플링해 "각 칸에서 우주선 쪽으로 가려면 어느 방향?"을
+ *   미리 구워 두는 지도입니다. Entity는 자기 칸의 방향만 읽으면 되므로 수천 마리여도 O(1)입니다.
+ *
+ * ■ 구조
+ *   1. Bake (게임 스레드, 프레임 분산): 칸마다 ProjectPointToNavigation → 걸을 수 있는 칸 + NavMesh 높이
+ *   2. Integration (Dijkstra): 우주선 주변 Goal 칸에서 역방향으로 비용 전파
+ *      - 인접 칸 높이 차가 MaxStepHeight 초과면 연결 안 함 (절벽 건너뛰기 방지)
+ *      - 대각선은 양옆 직교 칸이 모두 걸을 수 있을 때만 (벽 모서리 관통 방지)
+ *   3. Direction: 칸마다 비용이 가장 낮은 이웃 방향(8방향 uint8) 저장
+ *   완성된 필드는 TSharedPtr로 교체(publish) → 이동 Processor(워커 스레드)는 스냅샷만 읽는다.
+ *
+ * ■ 재생성 시점
+ *   - 밤 시작 (AHellunaDefenseGameMode::EnterNightCore → RequestRebuild)
+ *   - 건물(AInv_BuildingActor) 설치/파괴 (NavMesh 갱신을 기다리도록 RebuildDelay 후)
+ *
+ * ■ 실행 환경
+ *   - Server + Standalone (클라이언트에서는 Bake하지 않음)
+ *
+ * @author 김민우
+ */
+
+// File: Source/Helluna/Public/ECS/Navigation/EnemyFlowFieldSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MassExternalSubsystemTraits.h"
+#include "EnemyFlowFieldSubsystem.generated.h"
+
+// ============================================================================
+// FEnemyFlowField — 구워진 불변 필드 (publish 후 수정 금지)
+// ============================================================================
+struct HELLUNA_API FEnemyFlowField
+{
+	/** 방향 없음 (걸을 수 없음 / Goal 칸 / 도달 불가) */
+	static constexpr uint8 NoDirection = 0xFF;
+
+	/** 격자 좌하단 월드 XY */
+	FVector2D Origin = FVector2D::ZeroVector;
+	float CellSize = 200.f;
+	float InvCellSize = 1.f / 200.f;
+	int32 SizeX = 0;
+	int32 SizeY = 0;
+
+	/** 칸별 NavMesh 높이 (걸을 수 없는 칸은 의미 없음) */
+	TArray<float> NavZ;
+
+	/** 칸별 걸을 수 있는지 (ProjectPointToNavigation 성공) */
+	TBitArray<> Walkable;
+
+	/** 칸별 Goal 칸인지 */
+	TBitArray<> Goal;
+
+	/** 칸별 다음 이동 방향 인덱스 (0~7, NoDirection) */
+	TArray<uint8> Directions;
+
+	/** 8방향 오프셋/단위 벡터 테이블 */
+	static const FIntPoint NeighborOffsets[8];
+	static const FVector NeighborDirections[8];
+
+	bool IsValid() const { return SizeX > 0 && SizeY > 0 && Directions.Num() == SizeX * SizeY; }
+	int32 ToIndex(int32 X, int32 Y) const { return Y * SizeX + X; }
+
+	/** 월드 위치 → 칸 인덱스. 격자 밖이면 INDEX_NONE */
+	int32 WorldToIndex(const FVector& Location) const;
+
+	/** 칸 중심 월드 위치 (Z = NavZ) */
+	FVector GetCellCenter(int32 Index) const;
+
+	/** 위치의 칸에 구워진 이동 방향. 방향이 없으면 false (호출자는 직선 이동으로 폴백) */
+	bool SampleDirection(const FVector& Location, FVector& OutDirection) const;
+
+	/** 위치의 칸이 걸을 수 있으면 NavMesh 높이 반환 */
+	bool SampleNavZ(const FVector& Location, float& OutZ) const;
+};
+
+using FEnemyFlowFieldPtr = TSharedPtr<const FEnemyFlowField, ESPMode::ThreadSafe>;
+
+// ============================================================================
+// UEnemyFlowFieldSubsystem
+// ============================================================================
+UCLASS()
+class HELLUNA_API UEnemyFlowFieldSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// === UWorldSubsystem 인터페이스 ===
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// === FTickableGameObject 인터페이스 ===
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * 필드 재생성 요청. 진행 중인 Bake가 있으면 처음부터 다시 시작한다.
+	 * 기존 필드는 새 필드가 완성될 때까지 계속 사용된다.
+	 *
+	 * @param Reason  로그용 사유 ("NightStart", "BuildingPlaced" 등)
+	 * @param Delay   Bake 시작까지 지연(초). 건물 설치 직후 NavMesh 갱신을 기다릴 때 사용
+	 */
+	void RequestRebuild(const TCHAR* Reason, float Delay = 0.f);
+
+	/** 현재 publish된 필드 스냅샷 (없으면 nullptr). 워커 스레드에서 호출 가능 */
+	FEnemyFlowFieldPtr GetFlowField() const;
+
+private:
+	/** Bake 시작: 우주선 찾기 + 격자 크기 결정 + 작업 필드 할당 */
+	bool BeginBake();
+
+	/** 예산(ms) 안에서 칸 샘플링 진행. 모두 끝나면 true */
+	bool StepBake(double BudgetSeconds);
+
+	/** 샘플링 완료 후 Goal 칸 지정 + Dijkstra + 방향 결정 → publish */
+	void FinishBake();
+
+	void OnActorSpawned(AActor* Actor);
+	void OnActorDestroyed(AActor* Actor);
+
+	/** 건물 Actor 여부 (설치/파괴 시 재생성 트리거) */
+	static bool IsNavAffectingBuilding(const AActor* Actor);
+
+	/** publish된 필드 (워커 스레드와 공유 → Lock으로 교체/복사) */
+	FEnemyFlowFieldPtr PublishedField;
+	mutable FCriticalSection FieldLock;
+
+	/** Bake 중인 작업 필드 */
+	TSharedPtr<FEnemyFlowField, ESPMode::ThreadSafe> PendingField;
+
+	/** Bake 진행 칸 커서 */
+	int32 BakeCursor = 0;
+
+	/** 우주선 위치/반경 (Goal 칸 결정용) */
+	FVector GoalCenter = FVector::ZeroVector;
+	float GoalRadius = 0.f;
+
+	/** 재생성 대기 (Delay 카운트다운 중) */
+	bool bRebuildRequested = false;
+	float RebuildCountdown = 0.f;
+	bool bBaking = false;
+	double BakeStartTime = 0.0;
+
+	/** 서버/Standalone에서만 Bake */
+	bool bBakeEnabled = false;
+
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle ActorDestroyedHandle;
+};
+
+// 이동 Processor가 워커 스레드에서 ProcessorRequirements로 읽기 위해 필요
+template<>
+struct TMassExternalSubsystemTraits<UEnemyFlowFieldSubsystem> final
+{
+	enum
+	{
+		GameThreadOnly = false,
+		ThreadSafeWrite = false,
+	};
+};
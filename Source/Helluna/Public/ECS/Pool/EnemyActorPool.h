@@ -33,7 +33,16 @@
  *      - EnemyClass에 해당하는 Pool에서 꺼내기 → 위치/HP → 보이기
  *   3. Actor→Entity 복귀: DeactivateActor(Actor)
  *      - Actor의 클래스를 키로 해당 Pool에 반납
- *   4. 전투 사망: CleanupAndReplenish() → 클래스별 Pool을 모두 순회하여 보충
+ *   4. 전투 사망: CleanupAndReplenish() → 파괴된 Actor를 목록에서 정리 (보충은 Tick에서 예산 내)
+ *
+ * ■ [PoolWarmUpV1] 낮 시간 사전 생성 + 클래스별 성장 정책
+ *   - GameMode가 낮 시작 시 다음 밤의 FNightSpawnConfig를 보고 RequestWarmUp(Class, High, Low) 호출
+ *   - Tick에서 프레임당 ms 예산(Helluna.ECS.PoolWarmUpBudgetMs) 안에서만 Actor 생성 (1개 ≈ 2ms)
+ *   - High Watermark: 목표 총 Actor 수. 낮에는 여기까지 채우고 초과분(비활성)은 정리
+ *   - Low Watermark : 밤(전투)에는 비활성 Actor가 이 수 미만일 때만 보충
+ *     → 전투 중 SpawnActor 비용이 거의 발생하지 않음
+ *   - ActivateActor의 Hit/Miss 카운터로 Pool 크기가 적절한지 확인 가능
+ *   - SpawnActor는 게임 스레드 전용이라 다른 스레드 생성은 불가 — 대신 프레임 분산
  *
  * ■ 디버깅 팁
  *   - LogECSPool 카테고리로 모든 Pool 이벤트 확인
@@ -72,11 +81,40 @@ struct FActorPoolData
 	UPROPERTY()
 	TArray<TObjectPtr<AHellunaEnemyCharacter>> ActiveActors;
 
-	/** 목표 Pool 크기 (Active + Inactive 합계 유지 목표) */
+	/** 목표 Pool 크기 (Active + Inactive 합계 유지 목표) = High Watermark */
 	int32 DesiredPoolSize = 0;
 
+	/** [PoolWarmUpV1] 전투 중 보충 기준 — 비활성 Actor가 이 수 미만일 때만 새로 생성 */
+	int32 LowWatermark = 0;
+
+	/** [PoolWarmUpV1] true면 Low Watermark와 무관하게 High까지 채운다 (낮 Warm-up / 최초 초기화) — EndWarmUp에서 해제 */
+	bool bFillToHigh = false;
+
 	/** 이 Pool의 초기화 완료 여부 */
 	bool bInitialized = false;
+
+	/** [PoolWarmUpV1] ActivateActor 성공/실패(소진) 누적 카운터 */
+	int32 HitCount = 0;
+	int32 MissCount = 0;
+
+	/** [PoolWarmUpV1] Tick에서 생성/정리한 Actor 누적 수 */
+	int32 CreatedCount = 0;
+	int32 TrimmedCount = 0;
+};
+
+// ============================================================================
+// FEnemyPoolStats — 클래스별 Pool 상태 스냅샷 (디버그/로그용)
+// ============================================================================
+struct FEnemyPoolStats
+{
+	int32 Active = 0;
+	int32 Inactive = 0;
+	int32 HighWatermark = 0;
+	int32 LowWatermark = 0;
+	int32 Hits = 0;
+	int32 Misses = 0;
+	int32 Created = 0;
+	int32 Trimmed = 0;
 };
 
 // ============================================================================
@@ -86,9 +124,10 @@ struct FActorPoolData
 // ■ 핵심 변경: 단일 Pool → TMap<EnemyClass, FActorPoolData> 멀티 Pool
 //   → 근거리/원거리 등 서로 다른 클래스를 사용하는 여러 스포너를 동시에 지원.
 // ■ 왜 UWorldSubsystem: 월드당 하나 자동 생성, GetSubsystem<T>()로 어디서든 접근.
+// ■ [PoolWarmUpV1] UTickableWorldSubsystem — Actor 생성/정리를 Tick에서 프레임 분산 처리.
 // ============================================================================
 UCLASS()
-class HELLUNA_API UEnemyActorPool : public UWorldSubsystem
+class HELLUNA_API UEnemyActorPool : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
@@ -101,13 +140,20 @@ public:
 	/** 월드 소멸 시 모든 EnemyClass의 Pool Actor 전부 파괴 */
 	virtual void Deinitialize() override;
 
+	// === FTickableGameObject 인터페이스 ===
+
+	/** [PoolWarmUpV1] 예산 내에서 Pool 성장/정리 (서버 전용) */
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
 	// =========================================================================
 	// Pool 초기화
 	// =========================================================================
 
 	/**
-	 * 특정 EnemyClass에 대한 Pool을 초기화하고 Actor를 사전 생성한다.
+	 * 특정 EnemyClass에 대한 Pool을 초기화하고 Actor 사전 생성을 예약한다.
 	 * Processor의 첫 틱에서 Fragment의 EnemyClass를 읽어 호출.
+	 * [PoolWarmUpV1] 실제 생성은 Tick에서 프레임 분산 — 낮 Warm-up을 거친 클래스는 이미 초기화 상태.
 	 *
 	 * [기존 단일 Pool 방식의 문제]
 	 *   InitializePool(근거리Class) 이후 InitializePool(원거리Class)가 호출되면
@@ -132,6 +178,30 @@ public:
 	 */
 	bool IsPoolInitialized(TSubclassOf<AHellunaEnemyCharacter> EnemyClass) const;
 
+	// =========================================================================
+	// [PoolWarmUpV1] Warm-up / 성장 정책
+	// =========================================================================
+
+	/**
+	 * 다음 밤을 위해 EnemyClass의 Pool을 High Watermark까지 미리 채우도록 예약한다.
+	 * 낮 시작 시 GameMode가 FNightSpawnConfig 기반으로 호출. Pool이 없으면 새로 만들고 초기화 상태로 둔다.
+	 * Warm-up 중에는 High 초과분 비활성 Actor도 정리된다.
+	 *
+	 * @param EnemyClass     대상 적 클래스
+	 * @param HighWatermark  목표 총 Actor 수 (Active + Inactive)
+	 * @param LowWatermark   전투 중 비활성 Actor 최소 보유 수
+	 */
+	void RequestWarmUp(TSubclassOf<AHellunaEnemyCharacter> EnemyClass, int32 HighWatermark, int32 LowWatermark);
+
+	/**
+	 * Warm-up 단계 종료 (밤 시작). 모든 클래스의 bFillToHigh 해제 → 이후에는 전투 예산 + Low Watermark 기준으로만 보충.
+	 * @param bKeepFillingToHigh  낮 없이 시작한 첫 밤 — 방금 예약한 Warm-up을 전투 예산으로 마저 채움
+	 */
+	void EndWarmUp(bool bKeepFillingToHigh = false);
+
+	/** 현재 낮 Warm-up 단계인지 */
+	bool IsWarmingUp() const { return bWarmUpPhase; }
+
 	// =========================================================================
 	// Actor 활성화 / 비활성화
 	// =========================================================================
@@ -170,9 +240,10 @@ public:
 	// =========================================================================
 
 	/**
-	 * 전투 사망 등으로 파괴된 Pool Actor를 정리하고 새로 보충한다.
-	 * 모든 EnemyClass의 Pool을 순회하여 IsValid가 false인 Actor를 제거하고 보충.
+	 * 전투 사망 등으로 파괴된 Pool Actor를 목록에서 정리한다.
+	 * 모든 EnemyClass의 Pool을 순회하여 IsValid가 false인 Actor를 제거.
 	 * Processor의 Execute()에서 60프레임마다 호출.
+	 * [PoolWarmUpV1] 보충은 즉시 하지 않고 Tick에서 성장 정책 + 예산에 따라 처리.
 	 */
 	void CleanupAndReplenish();
 
@@ -198,6 +269,15 @@ public:
 	/** 전체 EnemyClass를 합산한 비활성 Actor 총 수 (디버그/로그용) */
 	int32 GetTotalInactiveCount() const;
 
+	/** [PoolWarmUpV1] 특정 EnemyClass의 Pool 통계. Pool이 없으면 false */
+	bool GetPoolStats(TSubclassOf<AHellunaEnemyCharacter> EnemyClass, FEnemyPoolStats& OutStats) const;
+
+	/** [PoolWarmUpV1] 전체 EnemyClass 합산 ActivateActor Hit 수 */
+	int32 GetTotalHitCount() const;
+
+	/** [PoolWarmUpV1] 전체 EnemyClass 합산 ActivateActor Miss(소진) 수 */
+	int32 GetTotalMissCount() const;
+
 private:
 	// =========================================================================
 	// 내부 데이터
@@ -231,6 +311,12 @@ private:
 	 */
 	AHellunaEnemyCharacter* CreatePooledActor(TSubclassOf<AHellunaEnemyCharacter> EnemyClass);
 
+	/** [PoolWarmUpV1] 비활성 Actor 1개 파괴 (High 초과분 정리용) */
+	void DestroyPooledActor(AHellunaEnemyCharacter* Actor);
+
+	/** [PoolWarmUpV1] 낮 Warm-up 단계 여부 — true면 큰 예산 + High 초과분 정리 */
+	bool bWarmUpPhase = false;
+
 	/** Pool Actor 보관용 숨김 위치 (맵 아래 Z=-50000, 렌더링/물리/Perception 범위 밖) */
 	static const FVector PoolHiddenLocation;
 };
@@ -269,8 +355,8 @@ private:
 //   A: MaxConcurrentActors + 10~20. 버퍼는 Soft Cap 발동 전 순간적 초과분 흡수용.
 //
 //   Q: 전투 중 Actor가 사망하면 Pool은 어떻게 되나요?
-//   A: 외부에서 Destroy된 Actor는 CleanupAndReplenish()가 60프레임마다 감지.
-//      파괴된 Actor를 목록에서 제거하고 새 Actor를 Pool에 보충합니다.
+//   A: 외부에서 Destroy된 Actor는 CleanupAndReplenish()가 60프레임마다 감지해 목록에서 제거합니다.
+//      보충은 Tick에서: 밤에는 비활성 수가 Low Watermark 미만일 때만, 낮에는 High까지 채웁니다.
 //
 //   Q: ActivateActor 시 0.2초 타이머가 필요한가요?
 //   A: 아닙니다. 첫 활성화 시 SpawnDefaultController()가 동기적으로 Controller를 생성하고
@@ -282,8 +368,11 @@ private:
 //      PoolSize를 늘리거나, MaxConcurrentActors를 줄이세요.
 //
 //   Q: 초기 로딩이 느려졌는데요?
-//   A: 60개 Actor를 한 번에 생성하므로 첫 틱에서 ~120ms 소요될 수 있습니다.
-//      PoolSize를 줄이거나, 향후 분할 생성(10개/프레임 × 6프레임) 적용 예정.
+//   A: [PoolWarmUpV1] 이제 Actor는 Tick에서 프레임당 ms 예산만큼만 생성됩니다.
+//      Helluna.ECS.PoolWarmUpBudgetMs(낮) / Helluna.ECS.PoolCombatBudgetMs(밤)로 조절하세요.
+//
+//   Q: Pool 크기가 적절한지 어떻게 아나요?
+//   A: [SpawnDiagV1] 로그의 Pool(H=.. M=..) — Miss가 계속 늘면 High/Low Watermark가 부족한 것.
 // ============================================================================
 
 // ============================================================================
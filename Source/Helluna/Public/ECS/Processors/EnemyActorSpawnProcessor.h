@@ -9,25 +9,36 @@
  *   멀어지면 HP/위치를 저장한 뒤 Pool에 반납합니다.
  *
  * ■ 시스템 내 위치
- *   - 의존: FEnemySpawnStateFragment, FEnemyDataFragment, FTransformFragment (Fragment),
+ *   - 의존: FEnemySpawnStateFragment, FEnemyDataFragment, FEnemyConfigSharedFragment(Const Shared),
+ *           FTransformFragment (Fragment),
  *           UEnemyActorPool (Pool), AHellunaEnemyCharacter, UHellunaHealthComponent
  *   - 피의존: MassSimulation 서브시스템이 매 틱 자동 호출
  *   - 실행: Server | Standalone | Client (ExecutionFlags::All)
- *     → 스폰/디스폰은 서버 전용, 시각화는 서버/클라 공통
+ *     → 스폰/디스폰은 서버 전용, 시각화는 Entity가 있는 곳(Standalone/리슨 서버)
+ *     → 클라에는 Entity가 없어 쿼리가 비므로 실행되지 않음 (클라 표시는 AEnemyEntityReplicationProxy)
  *
  * ■ 매 틱 실행 흐름
- *   0. Pool 초기화 (첫 틱만): Fragment에서 EnemyClass/PoolSize 읽어 Pool 사전 생성
+ *   0. [EntityTargetingV1] 큐잉된 Entity 데미지 적용 (CurrentHP 차감, 0 이하면 bDead + GameMode 통보)
+ *   0.5. Pool 초기화 (첫 틱만): Config Shared Fragment에서 EnemyClass/PoolSize 읽어 Pool 사전 생성
  *   1. 플레이어 위치 수집
  *   1.5. Pool 유지보수 (60프레임마다): 전투 사망 Actor 정리 + 보충
  *   2. 엔티티 순회 (ForEachEntityChunk):
  *      A) 이미 Actor: 파괴됨(bDead) / 멀어짐(역변환) / 범위 내(Tick 조절)
- *      B) 아직 Entity: 가까우면 Pool에서 Actor 꺼내기
- *   3. Soft Cap (30프레임마다): 초과분 중 가장 먼 Actor부터 Pool 반납
- *   4. 시각화: 서버/클라 공통으로 Entity ISMC 갱신
+ *      B) 아직 Entity: 가까우면 승격 큐에 등록 (즉시 스폰하지 않음)
+ *   3. 승격 스케줄러 (매 프레임, ms 예산): Soft Cap 초과분 강등 → 가까운 후보부터 승격,
+ *      Cap이 찼으면 가장 먼 Actor와 맞교환. 남은 후보는 다음 프레임으로 이월
+ *   4. 시각화: Entity ISMC 갱신 (데디 서버 제외)
+ *      - 인스턴스 인덱스는 FEnemyVisualInstanceFragment에 보관 (맵 조회 없음)
+ *      - Transform은 Mesh별 미러 배열에 모아 프레임당 BatchUpdateInstancesTransforms 1회
+ *      - TeamColor는 인스턴스 Custom Data(RGBA 4 float)로 전달
+ *   5. [EntityRepProxyV1] 서버: Entity 상태 적을 AEnemyEntityReplicationProxy에 저주기 Sync
+ *      (핸들 Index + SerialNumber 전송 — 클라 표시/보간은 프록시 Actor가 담당)
  *
  * ■ 디버깅 팁
  *   - LogECSEnemy 카테고리로 모든 스폰/디스폰/Soft Cap 이벤트 로깅
  *   - 300프레임마다 상태 로그: "[Status] 활성 Actor: N/M, Pool(Active: X, Inactive: Y)"
+ *   - [SpawnDiagV1] 로그의 Promo/Peak 항목: 승격 큐 깊이/이월/소요 시간
+ *   - 예산 튜닝: Helluna.ECS.PromotionBudgetMs / MaxPromotionsPerFrame / PromotionSwapRatio
  *   - 문제별 대응은 .cpp 파일 하단 참조
  */
 
@@ -35,23 +46,72 @@
 
 #include "CoreMinimal.h"
 #include "MassProcessor.h"
+#include "ECS/Spatial/EnemyEntitySpatialSubsystem.h"
 #include "EnemyActorSpawnProcessor.generated.h"
 
 // 전방선언
 struct FEnemySpawnStateFragment;
 struct FEnemyDataFragment;
+struct FEnemyConfigSharedFragment;
+struct FEnemyVisualInstanceFragment;
 struct FTransformFragment;
 class UEnemyActorPool;
 class USceneComponent;
 class UInstancedStaticMeshComponent;
+class AEnemyEntityReplicationProxy;
 
 // ============================================================================
-// Entity별 ISMC 인스턴스 참조 (스왑 삭제 대응)
+// [ISMCBatchV1] Mesh별 Entity ISMC 배치 상태
 // ============================================================================
-struct FEntityInstanceRef
+struct FEntityISMCBatch
 {
-	TObjectPtr<UStaticMesh> Mesh = nullptr;
-	int32 Index = INDEX_NONE;
+	/** 인스턴스 인덱스 → Entity (스왑 삭제 시 옮겨진 Entity의 Fragment 인덱스 보정용) */
+	TArray<FMassEntityHandle> InstanceEntities;
+
+	/** ISMC 인스턴스 Transform 미러 — 이번 프레임 갱신분을 모아 한 번에 BatchUpdate */
+	TArray<FTransform> InstanceTransforms;
+
+	/** 인스턴스별 마지막으로 순회에서 확인된 프레임 (파괴된 Entity의 고아 인스턴스 정리용) */
+	TArray<uint64> LastSeenFrame;
+
+	/** 이번 프레임 갱신된 인스턴스 범위 [DirtyMin, DirtyMax] */
+	int32 DirtyMin = MAX_int32;
+	int32 DirtyMax = INDEX_NONE;
+
+	void MarkDirty(int32 Index)
+	{
+		DirtyMin = FMath::Min(DirtyMin, Index);
+		DirtyMax = FMath::Max(DirtyMax, Index);
+	}
+};
+
+// ============================================================================
+// [PromotionSchedV1] 승격 스케줄러 통계
+// ============================================================================
+struct FEnemyPromotionStats
+{
+	/** 이번 프레임 승격 후보 수 */
+	int32 QueueDepth = 0;
+	/** 예산/상한으로 다음 프레임에 이월된 후보 수 */
+	int32 Deferred = 0;
+	int32 Promotions = 0;
+	int32 Demotions = 0;
+	/** 스케줄러 소요 시간 (ms) */
+	float TimeMs = 0.f;
+
+	// 로그 주기(60프레임) 누적값 — 로그 출력 후 ResetWindow()
+	int32 PeakQueueDepth = 0;
+	float PeakTimeMs = 0.f;
+	int32 WindowPromotions = 0;
+	int32 WindowDemotions = 0;
+
+	void ResetWindow()
+	{
+		PeakQueueDepth = 0;
+		PeakTimeMs = 0.f;
+		WindowPromotions = 0;
+		WindowDemotions = 0;
+	}
 };
 
 
@@ -70,6 +130,9 @@ protected:
 private:
 	FMassEntityQuery EntityQuery;
 
+	/** [PromotionSchedV1] 승격 스케줄러 통계 (SpawnDiag 로그 출력용) */
+	FEnemyPromotionStats PromotionStats;
+
 	// =========================================================
 	// 서버 전용 헬퍼
 	// =========================================================
@@ -86,17 +149,27 @@ private:
 		UEnemyActorPool* Pool);
 
 	/** 거리별 Actor/Controller Tick 빈도 조절 */
-	static void UpdateActorTickRate(AActor* Actor, float Distance, const FEnemyDataFragment& Data);
+	static void UpdateActorTickRate(AActor* Actor, float Distance, const FEnemyConfigSharedFragment& Config);
 
 	/** Pool에서 Actor 꺼내기. HP 복원 포함. 성공 시 true */
 	static bool TrySpawnActor(
 		FEnemySpawnStateFragment& SpawnState,
 		FEnemyDataFragment& Data,
+		const FEnemyConfigSharedFragment& Config,
 		const FTransformFragment& Transform,
 		UEnemyActorPool* Pool);
 
+	/**
+	 * [EntityTargetingV1] UEnemyEntitySpatialSubsystem에 쌓인 Entity 데미지 적용.
+	 * Entity 상태면 FEnemyDataFragment::CurrentHP 차감 (승격 없음), 그 사이 Actor가 됐으면 Actor에 ApplyDamage.
+	 */
+	void ApplyPendingEntityDamage(FMassEntityManager& EntityManager, UWorld* World);
+
+	/** ApplyPendingEntityDamage 재사용 버퍼 */
+	TArray<FEnemyEntityPendingDamage> PendingDamageScratch;
+
 	// =========================================================
-	// 시각화용 멤버 변수 (서버/클라 공통)
+	// 시각화용 멤버 변수 (Entity가 있는 Standalone/리슨 서버)
 	// =========================================================
 
 	/** ISMC를 붙이는 Root Actor */
@@ -111,11 +184,24 @@ private:
 	UPROPERTY(Transient)
 	TMap<TObjectPtr<UStaticMesh>, TObjectPtr<UInstancedStaticMeshComponent>> MeshToISMC;
 
-	/** ISMC 인스턴스 인덱스 → Entity 역추적 (스왑 삭제 대응) */
-	TMap<TObjectPtr<UStaticMesh>, TArray<FMassEntityHandle>> MeshToInstanceEntities;
+	/** [ISMCBatchV1] Mesh별 인스턴스 배치 상태 (인덱스→Entity, Transform 미러) */
+	TMap<TObjectPtr<UStaticMesh>, FEntityISMCBatch> MeshToBatch;
+
+	/** 부분 범위 BatchUpdate용 재사용 버퍼 */
+	TArray<FTransform> BatchScratchTransforms;
+
+	// =========================================================
+	// [EntityRepProxyV1] Entity 상태 적 복제 프록시
+	// =========================================================
+
+	/** 서버: Sync 대상 프록시 */
+	TWeakObjectPtr<AEnemyEntityReplicationProxy> ReplicationProxy;
+
+	/** [서버] 마지막 Sync 시각 (World 시간) */
+	double LastEntityRepSyncTime = 0.0;
 
-	/** Entity → 인스턴스 참조 */
-	TMap<FMassEntityHandle, FEntityInstanceRef> EntityToInstanceRef;
+	/** [서버] Entity 상태 적을 프록시에 양자화 Sync (Helluna.ECS.EntityRepHz 주기) */
+	void SyncReplicationProxy(FMassEntityManager& EntityManager, FMassExecutionContext& Context, UWorld* World);
 
 	// =========================================================
 	// 시각화 헬퍼
@@ -127,13 +213,41 @@ private:
 	/** Mesh에 대한 ISMC 반환 (없으면 생성 후 Root에 Attach) */
 	UInstancedStaticMeshComponent* GetOrCreateISMC(UStaticMesh* Mesh);
 
-	/** Entity 시각화 업데이트 (서버/클라 공통) */
+	/**
+	 * Entity 시각화 업데이트 (서버/클라 공통).
+	 * 기존 인스턴스는 미러 배열에만 기록하고 실제 ISMC 반영은 FlushEntityVisualization에서 일괄 처리.
+	 */
 	void UpdateEntityVisualization(
+		FMassEntityManager& EntityManager,
 		const FMassEntityHandle Entity,
 		const FTransformFragment& Transform,
-		const FEnemyDataFragment& Data,
-		const FEnemySpawnStateFragment& SpawnState);
-
-	/** ISMC 인스턴스 제거 (스왑 방식으로 인덱스 매핑 유지) */
-	void CleanupEntityVisualization(const FMassEntityHandle Entity);
+		const FEnemyConfigSharedFragment& Config,
+		const FEnemySpawnStateFragment& SpawnState,
+		FEnemyDataFragment& Data,
+		FEnemyVisualInstanceFragment& VisInstance,
+		uint64 FrameNumber);
+
+	/** 배치 끝에 인스턴스 추가 + TeamColor Custom Data 설정. 새 인스턴스 인덱스 반환 */
+	int32 AddBatchInstance(
+		UInstancedStaticMeshComponent* ISMC,
+		UStaticMesh* Mesh,
+		FEntityISMCBatch& Batch,
+		const FMassEntityHandle Owner,
+		const FTransform& InstanceTransform,
+		const FLinearColor& TeamColor,
+		bool bHasTeamColor,
+		uint64 FrameNumber);
+
+	/** ISMC 인스턴스 제거 (스왑 삭제 — 옮겨진 Entity의 Fragment 인덱스 보정) */
+	void RemoveEntityInstance(
+		FMassEntityManager& EntityManager,
+		UStaticMesh* Mesh,
+		FEntityISMCBatch& Batch,
+		int32 RemoveIndex);
+
+	/** 이번 프레임에 보이지 않은 고아 인스턴스 정리 + Mesh별 BatchUpdateInstancesTransforms 1회 */
+	void FlushEntityVisualization(FMassEntityManager& EntityManager, uint64 FrameNumber);
+
+	/** TeamColor 미결정이면 CDO->TeamColorOptions에서 랜덤 픽 (Actor/Entity 상태 공통) */
+	static void EnsureTeamColorAssigned(FEnemyDataFragment& Data, const FEnemyConfigSharedFragment& Config);
 };
@@ -4,9 +4,9 @@
  * Entity 상태의 적을 우주선(GoalLocation)을 향해 매 틱 이동시키는 Processor.
  *
  * ■ 역할
- *   - GoalLocation 캐싱 (우주선 위치 저장)
- *   - 매 틱 위치 업데이트 (직선 이동)
+ *   - 매 틱 위치 업데이트 (Flow Field 방향, 없으면 직선 이동)
  *   - Entity 간 충돌 회피 (Separation)
+ *   - GoalLocation 캐싱은 UEnemyGoalCacheProcessor(게임 스레드)가 담당
  *
  * ■ 실행 조건
  *   - bHasSpawnedActor = false (Entity 상태)
@@ -15,6 +15,17 @@
  *
  * ■ 실행 환경
  *   - Server + Standalone (클라이언트는 시각화만 담당)
+ *   - 워커 스레드 (Actor/UObject 접근 없음 — Fragment만 읽고 쓴다)
+ *
+ * ■ 병렬 모드 (Helluna.ECS.ParallelMovement, 기본 1)
+ *   - 공간 해시(FEnemySpatialHash)는 멤버로 유지 → 매 틱 Reset만 하고 재할당 없음
+ *   - Entity를 셀 순서로 정렬한 뒤 분리/적분 패스를 ParallelFor(블록 단위)로 실행
+ *   - 0 이면 같은 코드를 단일 스레드로 실행 (AccumMs/PeakMs 로그로 비교용)
+ *
+ * ■ [EntityTargetingV1] 공간 스냅샷 publish
+ *   - 이동 후 위치 + Entity 핸들로 FEnemyEntitySpatialSnapshot을 만들어 UEnemyEntitySpatialSubsystem에 publish
+ *   - 포탑 등 게임 스레드 코드가 Actor 승격 없이 Entity를 질의할 수 있게 한다
+ *   - 스냅샷 버퍼 2개를 번갈아 쓰고, 읽는 쪽이 아직 잡고 있을 때만 새로 할당
  * 
  * ■ AI 로직
  *   - Entity 상태: AI 없음, 단순 이동만
@@ -27,8 +38,13 @@
 
 #include "CoreMinimal.h"
 #include "MassProcessor.h"
+#include "ECS/Spatial/EnemySpatialHash.h"
+#include "ECS/Spatial/EnemyEntitySpatialSubsystem.h"
 #include "EnemyEntityMovementProcessor.generated.h"
 
+struct FTransformFragment;
+struct FEnemyDataFragment;
+
 UCLASS()
 class HELLUNA_API UEnemyEntityMovementProcessor : public UMassProcessor
 {
@@ -43,8 +59,31 @@ protected:
 
 private:
 	FMassEntityQuery EntityQuery;       // 이동 처리용
-	FMassEntityQuery GoalCacheQuery;    // GoalLocation 캐싱용 (별도 쿼리)
 
-	/** 우주선 캐시 — TActorIterator 반복 스캔 방지 (#2 최적화) */
-	TWeakObjectPtr<AActor> CachedSpaceShip;
+	// =========================================================
+	// 틱 간 재사용 버퍼 (Reset만 하고 용량 유지)
+	// =========================================================
+
+	/** 이동 대상 Entity SoA — 인덱스 = 수집 순서 */
+	TArray<FVector> CurrentLocations;
+	TArray<FVector> GoalLocations;
+	TArray<float> MoveSpeeds;
+	TArray<float> SeparationRadii;
+	TArray<bool> FollowGroundFlags;
+	TArray<FTransformFragment*> TransformPtrs;
+	TArray<FEnemyDataFragment*> DataPtrs;
+	TArray<FMassEntityHandle> EntityHandles;
+
+	/** 분리+적분 결과 위치 */
+	TArray<FVector> NewLocations;
+
+	/** 셀 정렬 공간 해시 (매 틱 Build, 재할당 없음) */
+	FEnemySpatialHash SpatialHash;
+
+	/** [EntityTargetingV1] publish용 스냅샷 더블 버퍼 */
+	TSharedPtr<FEnemyEntitySpatialSnapshot, ESPMode::ThreadSafe> SnapshotBuffers[2];
+	int32 NextSnapshotBuffer = 0;
+
+	/** 이동 결과로 스냅샷을 채워 서브시스템에 publish */
+	void PublishSpatialSnapshot(UEnemyEntitySpatialSubsystem& SpatialSubsystem, int32 TotalEntities);
 };
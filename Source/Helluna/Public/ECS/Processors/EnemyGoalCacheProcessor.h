@@ -0,0 +1,43 @@
+/**
+ * EnemyGoalCacheProcessor.h
+ *
+ * Entity 상태 적의 GoalLocation(우주선 주변 접근 지점)을 60프레임마다 갱신하는 Processor.
+ *
+ * ■ 분리 이유
+ *   우주선 Actor/컴포넌트/슬롯 매니저 접근은 게임 스레드에서만 안전하다.
+ *   이동 Processor(UEnemyEntityMovementProcessor)를 워커 스레드로 돌리기 위해
+ *   Actor에 닿는 부분만 이 Processor로 떼어냈다.
+ *
+ * ■ 실행 순서
+ *   UEnemyEntityMovementProcessor 보다 먼저 실행 (ExecuteBefore)
+ *
+ * ■ 실행 환경
+ *   - Server + Standalone, 게임 스레드
+ *
+ * @author 김민우
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "EnemyGoalCacheProcessor.generated.h"
+
+UCLASS()
+class HELLUNA_API UEnemyGoalCacheProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UEnemyGoalCacheProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery GoalCacheQuery;
+
+	/** 우주선 캐시 — TActorIterator 반복 스캔 방지 (#2 최적화) */
+	TWeakObjectPtr<AActor> CachedSpaceShip;
+};
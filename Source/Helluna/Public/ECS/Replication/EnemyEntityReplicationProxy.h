@@ -0,0 +1,292 @@
+/**
+ * EnemyEntityReplicationProxy.h
+ *
+ * [EntityRepProxyV1] Entity 상태 적을 클라이언트에 보여주기 위한 경량 복제 프록시.
+ *
+ * ■ 이 파일이 뭔가요? (팀원용)
+ *   Mass Entity는 서버에만 존재합니다 (Spawner가 NM_Client에서 바로 return).
+ *   그래서 SpawnThreshold 밖의 적은 Actor로 승격되기 전까지 클라이언트에서 안 보였습니다.
+ *   이 Actor 하나가 "Entity 상태 적 목록"을 FastArray로 들고 있고, 클라이언트에서는
+ *   이 Actor가 직접 ISMC로 그립니다.
+ *   (클라에는 Mass Entity가 없어 Processor 쿼리가 어떤 Archetype과도 맞지 않으므로
+ *    Processor의 Execute는 클라에서 실행되지 않는다 → 시각화를 Processor에 둘 수 없음)
+ *
+ * ■ 항목 포맷 (FEnemyEntityProxyItem, 약 17바이트)
+ *   - EntityId   : 서버 Entity 핸들 Index (uint32)
+ *   - EntitySerial : 서버 Entity 핸들 SerialNumber — Index 재사용 시 이전 적과 구분 (키 = Index + Serial)
+ *   - X/Y        : int16, PositionQuantStep(50cm) 단위 → ±16km
+ *   - Z          : int16, HeightQuantStep(10cm) 단위 → ±3.2km (ISMC가 지면에 붙도록 추가)
+ *   - Yaw        : uint8 (360/256°)
+ *   - VisualType : VisualTypes 테이블 인덱스 (EnemyClass + Mesh + Scale/ZOffset)
+ *   - TeamColor  : EnemyClass CDO->TeamColorOptions 인덱스 (255 = 미지정)
+ *
+ * ■ 복제 정책
+ *   - 서버 Processor가 Helluna.ECS.EntityRepHz 주기로 Sync → 양자화 값이 바뀐 항목만 MarkItemDirty
+ *   - Actor로 승격/사망/파괴된 Entity는 항목 제거 → 클라에서 ISMC 인스턴스도 정리
+ *   - bAlwaysRelevant, NetUpdateFrequency = EntityRepHz
+ *
+ * ■ 클라 시각화
+ *   - FastArray 콜백(PostReplicatedAdd/Change, PreReplicatedRemove)에서 Mesh별 ISMC 인스턴스 추가/갱신/제거
+ *   - 위치 변경은 수신 간격 동안 보간 — 보간 중인 항목이 있을 때만 Tick 활성
+ *   - VisualTypes가 항목보다 늦게 오면 OnRep_VisualTypes에서 대기 항목을 다시 생성
+ *
+ * ■ 시스템 내 위치
+ *   - 피의존: UEnemyActorSpawnProcessor (서버: BeginSync/UpdateEntity/EndSync 호출)
+ *   - 접근: AEnemyEntityReplicationProxy::FindOrSpawn(World) (서버)
+ *
+ * @author 김민우
+ */
+
+// File: Source/Helluna/Public/ECS/Replication/EnemyEntityReplicationProxy.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "EnemyEntityReplicationProxy.generated.h"
+
+class AHellunaEnemyCharacter;
+class UStaticMesh;
+class UInstancedStaticMeshComponent;
+class AEnemyEntityReplicationProxy;
+struct FEnemyEntityProxyArray;
+
+// ============================================================================
+// 양자화 상수 (서버/클라 공통)
+// ============================================================================
+namespace EnemyEntityRepQuant
+{
+	constexpr float PositionQuantStep = 50.f;
+	constexpr float HeightQuantStep = 10.f;
+	constexpr uint8 NoTeamColor = 0xFF;
+
+	inline int16 QuantizeAxis(double Value, float Step)
+	{
+		return static_cast<int16>(FMath::Clamp<int32>(FMath::RoundToInt32(Value / Step), MIN_int16, MAX_int16));
+	}
+
+	inline uint8 QuantizeYaw(float YawDegrees)
+	{
+		return static_cast<uint8>(FMath::RoundToInt32(FRotator::ClampAxis(YawDegrees) * (256.f / 360.f)) & 0xFF);
+	}
+
+	inline float DequantizeYaw(uint8 Yaw)
+	{
+		return Yaw * (360.f / 256.f);
+	}
+}
+
+// ============================================================================
+// FEnemyEntityProxyVisualType — 항목이 참조하는 시각화 타입 테이블 엔트리
+// ============================================================================
+USTRUCT()
+struct HELLUNA_API FEnemyEntityProxyVisualType
+{
+	GENERATED_BODY()
+
+	/** TeamColorOptions 조회용 */
+	UPROPERTY()
+	TSubclassOf<AHellunaEnemyCharacter> EnemyClass;
+
+	UPROPERTY()
+	TObjectPtr<UStaticMesh> Mesh = nullptr;
+
+	UPROPERTY()
+	FVector Scale = FVector::OneVector;
+
+	UPROPERTY()
+	float ZOffset = 0.f;
+};
+
+// ============================================================================
+// FEnemyEntityProxyItem — Entity 1개의 양자화된 상태
+// ============================================================================
+USTRUCT()
+struct HELLUNA_API FEnemyEntityProxyItem : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint32 EntityId = 0;
+
+	UPROPERTY()
+	int32 EntitySerial = 0;
+
+	UPROPERTY()
+	int16 X = 0;
+
+	UPROPERTY()
+	int16 Y = 0;
+
+	UPROPERTY()
+	int16 Z = 0;
+
+	UPROPERTY()
+	uint8 Yaw = 0;
+
+	UPROPERTY()
+	uint8 VisualType = 0;
+
+	UPROPERTY()
+	uint8 TeamColorIndex = EnemyEntityRepQuant::NoTeamColor;
+
+	/** [서버 전용] 마지막 Sync 세대 — 이번 Sync에서 안 보이면 제거 */
+	uint32 SyncGeneration = 0;
+
+	FVector GetLocation() const
+	{
+		using namespace EnemyEntityRepQuant;
+		return FVector(X * PositionQuantStep, Y * PositionQuantStep, Z * HeightQuantStep);
+	}
+
+	bool SetQuantized(const FVector& Location, float YawDegrees, uint8 InVisualType, uint8 InTeamColor);
+
+	/** Entity 핸들 Index + SerialNumber → 항목 키 (서버 IdToIndex / 클라 ClientVisuals 공통) */
+	static uint64 MakeKey(uint32 InEntityId, int32 InEntitySerial)
+	{
+		return (static_cast<uint64>(static_cast<uint32>(InEntitySerial)) << 32) | InEntityId;
+	}
+	uint64 GetKey() const { return MakeKey(EntityId, EntitySerial); }
+
+	// === FastArray 콜백 (클라) ===
+	void PostReplicatedAdd(const FEnemyEntityProxyArray& InArraySerializer);
+	void PostReplicatedChange(const FEnemyEntityProxyArray& InArraySerializer);
+	void PreReplicatedRemove(const FEnemyEntityProxyArray& InArraySerializer);
+};
+
+// ============================================================================
+// FEnemyEntityProxyArray — FastArraySerializer
+// ============================================================================
+USTRUCT()
+struct HELLUNA_API FEnemyEntityProxyArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FEnemyEntityProxyItem> Items;
+
+	/** 콜백 전달 대상 (생성자에서 설정, 복제 안 함) */
+	AEnemyEntityReplicationProxy* Owner = nullptr;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FEnemyEntityProxyItem, FEnemyEntityProxyArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FEnemyEntityProxyArray> : public TStructOpsTypeTraitsBase2<FEnemyEntityProxyArray>
+{
+	enum { WithNetDeltaSerializer = true };
+};
+
+// ============================================================================
+// AEnemyEntityReplicationProxy
+// ============================================================================
+UCLASS(NotPlaceable, Transient)
+class HELLUNA_API AEnemyEntityReplicationProxy : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AEnemyEntityReplicationProxy();
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void Tick(float DeltaSeconds) override;
+
+	/** [서버] 월드의 프록시 반환 (없으면 스폰) */
+	static AEnemyEntityReplicationProxy* FindOrSpawn(UWorld* World);
+
+	/** 월드의 프록시 검색 (없으면 nullptr) */
+	static AEnemyEntityReplicationProxy* Find(UWorld* World);
+
+	// =========================================================
+	// 서버 Sync API — Processor가 Sync 1회 동안 Begin → Update* → End 순으로 호출
+	// =========================================================
+
+	void BeginSync();
+
+	/** EnemyClass + Mesh 조합의 VisualType 인덱스 (없으면 테이블에 추가) */
+	uint8 GetOrAddVisualType(TSubclassOf<AHellunaEnemyCharacter> EnemyClass, UStaticMesh* Mesh,
+		const FVector& Scale, float ZOffset);
+
+	void UpdateEntity(uint32 EntityId, int32 EntitySerial, const FVector& Location, float YawDegrees, uint8 VisualType, uint8 TeamColorIndex);
+
+	/** 이번 Sync에서 갱신되지 않은 항목 제거 */
+	void EndSync();
+
+	// =========================================================
+	// 조회
+	// =========================================================
+
+	const TArray<FEnemyEntityProxyItem>& GetItems() const { return EntityArray.Items; }
+	const FEnemyEntityProxyVisualType* GetVisualType(uint8 Index) const
+	{
+		return VisualTypes.IsValidIndex(Index) ? &VisualTypes[Index] : nullptr;
+	}
+
+	// =========================================================
+	// 클라 시각화 — FEnemyEntityProxyItem 콜백에서 호출
+	// =========================================================
+
+	void OnItemAdded(const FEnemyEntityProxyItem& Item);
+	void OnItemChanged(const FEnemyEntityProxyItem& Item);
+	void OnItemRemoved(const FEnemyEntityProxyItem& Item);
+
+private:
+	/** [클라] 항목 1개의 ISMC 인스턴스 + 보간 상태 */
+	struct FClientVisual
+	{
+		UStaticMesh* Mesh = nullptr;
+		int32 InstanceIndex = INDEX_NONE;
+		uint8 VisualType = 0;
+		uint8 TeamColorIndex = EnemyEntityRepQuant::NoTeamColor;
+		FVector Scale = FVector::OneVector;
+		float ZOffset = 0.f;
+		float Yaw = 0.f;
+
+		/** 보간: FromLocation → ToLocation, BlendStart부터 BlendDuration 동안 (0 = 정지) */
+		FVector FromLocation = FVector::ZeroVector;
+		FVector ToLocation = FVector::ZeroVector;
+		double BlendStart = 0.0;
+		float BlendDuration = 0.f;
+
+		/** 마지막 수신 시각 — 다음 보간 길이 = 수신 간격 */
+		double LastReceiveTime = 0.0;
+	};
+
+	UFUNCTION()
+	void OnRep_VisualTypes();
+
+	/** 항목 인스턴스 생성 (VisualType 미도착이면 InstanceIndex=NONE으로 대기) */
+	void CreateClientInstance(const FEnemyEntityProxyItem& Item, FClientVisual& Visual);
+
+	/** 인스턴스 제거 (ISMC 스왑 삭제 — 옮겨진 항목의 InstanceIndex 보정) */
+	void RemoveClientInstance(FClientVisual& Visual);
+
+	UInstancedStaticMeshComponent* GetOrCreateISMC(UStaticMesh* Mesh);
+
+	float GetDefaultBlendDuration() const;
+
+	UPROPERTY(Replicated)
+	FEnemyEntityProxyArray EntityArray;
+
+	UPROPERTY(ReplicatedUsing = OnRep_VisualTypes)
+	TArray<FEnemyEntityProxyVisualType> VisualTypes;
+
+	/** [서버 전용] 항목 키(Index + Serial) → Items 인덱스 */
+	TMap<uint64, int32> KeyToIndex;
+
+	uint32 CurrentGeneration = 0;
+
+	/** [클라] 항목 키 → 시각화 상태 */
+	TMap<uint64, FClientVisual> ClientVisuals;
+
+	/** [클라] Mesh별 ISMC */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UStaticMesh>, TObjectPtr<UInstancedStaticMeshComponent>> MeshToISMC;
+
+	/** [클라] Mesh별 인스턴스 인덱스 → 항목 키 (스왑 삭제 보정용) */
+	TMap<TObjectPtr<UStaticMesh>, TArray<uint64>> MeshInstanceKeys;
+};
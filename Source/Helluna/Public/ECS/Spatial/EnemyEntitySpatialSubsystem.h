@@ -0,0 +1,135 @@
+/**
+ * EnemyEntitySpatialSubsystem.h
+ *
+ * [EntityTargetingV1] Entity 상태 적의 공간 인덱스 공유 + Entity 직접 데미지 큐.
+ *
+ * ■ 이 파일이 뭔가요? (팀원용)
+ *   포탑은 원래 오버랩 구체로 Actor만 찾았기 때문에, Actor로 승격된 적만 쏠 수 있었습니다.
+ *   이동 Processor가 매 틱 만드는 Entity 위치를 스냅샷(셀 해시 포함)으로 publish 하고,
+ *   포탑 같은 게임 스레드 코드는 그 스냅샷에서 "반경 내 가장 가까운 Entity"를 질의합니다.
+ *   Entity에 준 데미지는 큐에 쌓였다가 UEnemyActorSpawnProcessor(게임 스레드)가
+ *   FEnemyDataFragment::CurrentHP 에서 직접 차감합니다 — Actor 승격 없음.
+ *
+ * ■ 스냅샷
+ *   - 이동 Processor(워커 스레드)가 이동 후 위치로 Build → Publish (Lock으로 포인터만 교체)
+ *   - publish 후 불변. 읽는 쪽은 GetSnapshot()으로 TSharedPtr를 잡고 자유롭게 질의
+ *   - Actor로 승격됐거나 사망한 Entity는 포함되지 않음
+ *
+ * ■ 데미지 큐
+ *   - QueueEntityDamage (게임 스레드) → ConsumePendingDamage (스폰 Processor, 게임 스레드)
+ *   - 큐잉 사이 Actor로 승격된 Entity는 Processor가 Actor에 ApplyDamage로 넘긴다
+ *   - CurrentHP가 아직 -1(첫 스폰 전)이면 EnemyClass CDO의 HealthComponent 최대 체력으로 초기화
+ *
+ * ■ 시스템 내 위치
+ *   - 작성: UEnemyEntityMovementProcessor (Publish)
+ *   - 소비: UEnemyActorSpawnProcessor (ConsumePendingDamage), AResourceUsingObject_AttackTurret (질의/데미지)
+ *
+ * @author 김민우
+ */
+
+// File: Source/Helluna/Public/ECS/Spatial/EnemyEntitySpatialSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MassEntityTypes.h"
+#include "MassExternalSubsystemTraits.h"
+#include "ECS/Spatial/EnemySpatialHash.h"
+#include "EnemyEntitySpatialSubsystem.generated.h"
+
+class AHellunaEnemyCharacter;
+
+namespace EnemyEntitySpatial
+{
+	/** 스냅샷 해시 셀 크기 — 원거리 반경 질의용이라 이동 분리 해시(200)보다 크게 */
+	constexpr float CellSize = 500.f;
+}
+
+// ============================================================================
+// FEnemyEntitySpatialSnapshot — publish 된 불변 Entity 위치 스냅샷
+// ============================================================================
+struct HELLUNA_API FEnemyEntitySpatialSnapshot
+{
+	/** 인덱스 = Entities/Locations 인덱스 */
+	FEnemySpatialHash Hash;
+	TArray<FMassEntityHandle> Entities;
+	TArray<FVector> Locations;
+
+	int32 Num() const { return Entities.Num(); }
+
+	/**
+	 * Origin 기준 3D 반경 Radius 안의 Entity 인덱스를 가까운 순으로 최대 MaxCount개 반환.
+	 * 포탑은 결과를 순서대로 시야 검사해 첫 번째 통과 Entity를 고른다.
+	 */
+	void FindNearest(const FVector& Origin, float Radius, int32 MaxCount, TArray<int32>& OutIndices) const;
+
+	/** 마지막으로 알던 위치 주변 셀에서 Entity를 다시 찾는다. 사망/승격/이탈이면 false */
+	bool FindEntityNear(FMassEntityHandle Entity, const FVector& LastKnownLocation, FVector& OutLocation) const;
+};
+
+using FEnemyEntitySpatialSnapshotPtr = TSharedPtr<const FEnemyEntitySpatialSnapshot, ESPMode::ThreadSafe>;
+
+/** 큐잉된 Entity 데미지 1건 */
+struct FEnemyEntityPendingDamage
+{
+	FMassEntityHandle Entity;
+	float Damage = 0.f;
+	TWeakObjectPtr<AActor> DamageCauser;
+};
+
+// ============================================================================
+// UEnemyEntitySpatialSubsystem
+// ============================================================================
+UCLASS()
+class HELLUNA_API UEnemyEntitySpatialSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	// =========================================================
+	// 스냅샷 — Publish는 워커 스레드에서 호출 가능
+	// =========================================================
+
+	void Publish(FEnemyEntitySpatialSnapshotPtr InSnapshot);
+
+	/** 현재 publish 된 스냅샷 (없으면 nullptr) */
+	FEnemyEntitySpatialSnapshotPtr GetSnapshot() const;
+
+	// =========================================================
+	// 데미지 큐 — 게임 스레드 전용
+	// =========================================================
+
+	/** Entity에 데미지 예약. 다음 스폰 Processor 실행 시 CurrentHP에서 차감 */
+	void QueueEntityDamage(FMassEntityHandle Entity, float Damage, AActor* DamageCauser);
+
+	bool HasPendingDamage() const { return PendingDamage.Num() > 0; }
+
+	/** 큐를 OutDamage로 옮기고 비운다 (OutDamage 용량 재사용) */
+	void ConsumePendingDamage(TArray<FEnemyEntityPendingDamage>& OutDamage);
+
+	/** EnemyClass CDO의 최대 체력 (클래스별 캐시). 찾지 못하면 Fallback */
+	float GetDefaultMaxHP(TSubclassOf<AHellunaEnemyCharacter> EnemyClass, float Fallback);
+
+private:
+	FEnemyEntitySpatialSnapshotPtr PublishedSnapshot;
+	mutable FCriticalSection SnapshotLock;
+
+	TArray<FEnemyEntityPendingDamage> PendingDamage;
+
+	TMap<TWeakObjectPtr<UClass>, float> DefaultMaxHPCache;
+};
+
+// 이동 Processor가 워커 스레드에서 Publish 하기 위해 필요 (Publish는 Lock으로 보호)
+template<>
+struct TMassExternalSubsystemTraits<UEnemyEntitySpatialSubsystem> final
+{
+	enum
+	{
+		GameThreadOnly = false,
+		ThreadSafeWrite = true,
+	};
+};
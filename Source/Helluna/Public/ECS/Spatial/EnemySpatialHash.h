@@ -0,0 +1,136 @@
+/**
+ * EnemySpatialHash.h
+ *
+ * Entity 상태 적들의 XY 위치를 셀 단위로 정렬해 보관하는 재사용형 공간 해시.
+ *
+ * ■ 구조 (Counting Sort 기반 flat 해시)
+ *   - 셀 좌표 (CX, CY) → 버킷 = Hash(CX, CY) & BucketMask
+ *   - BucketStart[b] ~ BucketStart[b+1] 구간에 같은 버킷 Entity가 연속 배치
+ *   - SortedPositions/SortedIndices는 버킷 순서로 정렬된 사본 → 이웃 탐색이 연속 메모리 접근
+ *   - 버킷 충돌은 CellKey 비교로 걸러낸다 (같은 Entity가 두 번 방문되지 않음)
+ *
+ * ■ 재사용
+ *   Build()는 내부 배열을 Reset만 하고 재할당하지 않는다 (용량 유지).
+ *   매 틱 TMap을 새로 만드는 대신 같은 메모리를 계속 쓴다.
+ *
+ * ■ 스레드
+ *   Build는 단일 스레드, Build 이후 ForEachInCellNeighborhood는 읽기 전용이라 ParallelFor 안에서 호출해도 안전.
+ */
+
+// File: Source/Helluna/Public/ECS/Spatial/EnemySpatialHash.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct HELLUNA_API FEnemySpatialHash
+{
+	/** 위치 배열로 해시 재구축. Positions의 인덱스가 그대로 "원본 인덱스"로 쓰인다 */
+	void Build(TConstArrayView<FVector> Positions, float InCellSize);
+
+	/** 모든 데이터 비우기 (용량은 유지) */
+	void Reset();
+
+	/**
+	 * Location이 속한 셀과 인접 8셀에 있는 Entity를 순회한다.
+	 * Func(int32 OriginalIndex, const FVector& Position)
+	 */
+	template<typename FuncType>
+	void ForEachInCellNeighborhood(const FVector& Location, FuncType&& Func) const
+	{
+		if (SortedIndices.IsEmpty())
+			return;
+
+		const int32 CX = FMath::FloorToInt(Location.X * InvCellSize);
+		const int32 CY = FMath::FloorToInt(Location.Y * InvCellSize);
+
+		for (int32 dx = -1; dx <= 1; ++dx)
+		{
+			for (int32 dy = -1; dy <= 1; ++dy)
+			{
+				const int64 Key = MakeCellKey(CX + dx, CY + dy);
+				const uint32 Bucket = HashCellKey(Key) & BucketMask;
+				const int32 End = BucketStart[Bucket + 1];
+				for (int32 s = BucketStart[Bucket]; s < End; ++s)
+				{
+					if (SortedCellKeys[s] != Key)
+						continue;
+					Func(SortedIndices[s], SortedPositions[s]);
+				}
+			}
+		}
+	}
+
+	/**
+	 * Location 기준 XY 반경 Radius를 덮는 셀들을 순회한다 (셀 단위 후보 — 정확한 거리 판정은 호출자 몫).
+	 * 반경이 셀 크기보다 큰 원거리 질의(포탑 타겟팅 등)용.
+	 * Func(int32 OriginalIndex, const FVector& Position)
+	 */
+	template<typename FuncType>
+	void ForEachInRadius2D(const FVector& Location, float Radius, FuncType&& Func) const
+	{
+		if (SortedIndices.IsEmpty() || Radius <= 0.f)
+			return;
+
+		const int32 MinX = FMath::FloorToInt((Location.X - Radius) * InvCellSize);
+		const int32 MaxX = FMath::FloorToInt((Location.X + Radius) * InvCellSize);
+		const int32 MinY = FMath::FloorToInt((Location.Y - Radius) * InvCellSize);
+		const int32 MaxY = FMath::FloorToInt((Location.Y + Radius) * InvCellSize);
+
+		for (int32 CX = MinX; CX <= MaxX; ++CX)
+		{
+			for (int32 CY = MinY; CY <= MaxY; ++CY)
+			{
+				const int64 Key = MakeCellKey(CX, CY);
+				const uint32 Bucket = HashCellKey(Key) & BucketMask;
+				const int32 End = BucketStart[Bucket + 1];
+				for (int32 s = BucketStart[Bucket]; s < End; ++s)
+				{
+					if (SortedCellKeys[s] != Key)
+						continue;
+					Func(SortedIndices[s], SortedPositions[s]);
+				}
+			}
+		}
+	}
+
+	/** 원본 인덱스를 셀 순서로 정렬한 배열. 처리 순서로 쓰면 이웃끼리 캐시 지역성이 좋아진다 */
+	TConstArrayView<int32> GetSortedIndices() const { return SortedIndices; }
+
+	/** 마지막 Build에서 Entity가 들어간 셀 수 근사치 (로그/통계용) */
+	int32 GetNumOccupiedCells() const { return NumOccupiedCells; }
+
+	int32 Num() const { return SortedIndices.Num(); }
+	float GetCellSize() const { return CellSize; }
+
+	static int64 MakeCellKey(int32 CX, int32 CY)
+	{
+		return (static_cast<int64>(CX) << 32) | static_cast<int64>(static_cast<uint32>(CY));
+	}
+
+private:
+	static uint32 HashCellKey(int64 Key)
+	{
+		const uint32 CX = static_cast<uint32>(Key >> 32);
+		const uint32 CY = static_cast<uint32>(Key);
+		return (CX * 73856093u) ^ (CY * 19349663u);
+	}
+
+	float CellSize = 200.f;
+	float InvCellSize = 1.f / 200.f;
+	uint32 BucketMask = 0;
+	int32 NumOccupiedCells = 0;
+
+	/** 버킷별 시작 오프셋 (NumBuckets + 1) */
+	TArray<int32> BucketStart;
+
+	/** 버킷 순서로 정렬된 원본 인덱스 / 위치 / 셀 키 */
+	TArray<int32> SortedIndices;
+	TArray<FVector> SortedPositions;
+	TArray<int64> SortedCellKeys;
+
+	/** Build 중간 버퍼 (원본 인덱스별 셀 키/버킷) */
+	TArray<int64> ScratchCellKeys;
+	TArray<uint32> ScratchBuckets;
+	TArray<int32> ScratchCursor;
+};
@@ -14,6 +14,7 @@
 #include "HellunaEnemyMassSpawner.generated.h"
 
 class UNavigationInvokerComponent;
+class UEnemyMassTrait;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogHellunaSpawner, Log, All);
 
@@ -51,6 +52,12 @@ public:
 	/** 지정 수량을 이 스포너가 모두 배출하는 데 걸리는 예상 시간(초). SpawnDelay는 제외한다. */
 	float GetEstimatedSpawnSequenceSpacing(int32 InSpawnCount) const;
 
+	/**
+	 * [PoolWarmUpV1] EntityTypes의 Config 에셋에 들어있는 EnemyMassTrait 목록.
+	 * CDO에서도 호출 가능 — 스포너가 월드에 생성되기 전(첫 밤 이전)에 Pool Warm-up 계산에 사용.
+	 */
+	void GetEnemyMassTraits(TArray<const UEnemyMassTrait*>& OutTraits) const;
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -5,7 +5,7 @@
  * MassEntityConfig 에셋의 Traits 배열에 추가하여 에디터 Details 패널에서 설정한다.
  *
  * 모든 설정값이 UPROPERTY로 노출되어 코드 재컴파일 없이 런타임 튜닝 가능.
- * BuildTemplate에서 FEnemyDataFragment에 값을 복사하여 Processor가 읽는다.
+ * BuildTemplate에서 FEnemyConfigSharedFragment(Const Shared)를 만들어 Processor가 읽는다.
  */
 
 // File: Source/Helluna/Public/ECS/Traits/EnemyMassTrait.h
@@ -29,6 +29,11 @@ public:
 		FMassEntityTemplateBuildContext& BuildContext,
 		const UWorld& World) const override;
 
+	// [PoolWarmUpV1] 낮 Pool Warm-up 계산용 읽기 전용 접근자
+	TSubclassOf<AHellunaEnemyCharacter> GetEnemyClass() const { return EnemyClass; }
+	int32 GetMaxConcurrentActors() const { return MaxConcurrentActors; }
+	int32 GetPoolSize() const { return PoolSize; }
+
 protected:
 	// =================================================================
 	// 스폰 설정
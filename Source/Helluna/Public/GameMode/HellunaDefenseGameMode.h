@@ -21,6 +21,7 @@
 #include "HellunaTypes.h"
 #include "Persistence/Inv_SaveTypes.h"
 #include "Loading/HellunaLoadingTypes.h"
+#include "Lobby/ServerManager/HellunaChannelRegistry.h"
 #include "HellunaDefenseGameMode.generated.h"
 
 class ATargetPoint;
@@ -32,6 +33,7 @@ class ABossSummonCinematicTrigger;
 class UPCGComponent;
 class UPCGManagedActors;
 class UOreHISMPoolComponent;
+class FJsonObject;
 
 // ════════════════════════════════════════════════════════════════════════════════
 // Phase 7: 게임 종료 사유
@@ -454,10 +456,24 @@ protected:
 
 	void TriggerMassSpawning();
 
+	/**
+	 * [PoolWarmUpV1] 다음 밤의 FNightSpawnConfig 기준으로 적 Actor Pool을 낮 동안 미리 채우도록 예약.
+	 * 생성된 스포너(없으면 스포너 클래스 CDO)의 EnemyMassTrait에서 EnemyClass/PoolSize/MaxConcurrentActors를 읽어
+	 * 클래스별 High/Low Watermark를 계산한다. 실제 생성은 UEnemyActorPool::Tick에서 프레임 분산.
+	 */
+	void WarmUpEnemyPoolsForNight();
+
 public:
 	UFUNCTION(BlueprintCallable, Category = "Defense(게임)|Monster(몬스터)")
 	void NotifyMonsterDied(AActor* DeadMonster);
 
+	/**
+	 * [EntityTargetingV1] Actor로 승격되지 않은 Entity 상태 적 사망 통보.
+	 * 포탑 등이 Entity HP를 직접 깎아 죽였을 때 UEnemyActorSpawnProcessor가 호출한다.
+	 * @param Grade  Entity Config의 EnemyGrade — NotifyMonsterDied와 같은 등급 분기/카운터 처리
+	 */
+	void NotifyEntityMonsterDied(EEnemyGrade Grade);
+
 	/** 플레이어 사망 알림. 전원 사망 시 EndGame(AllDead) 호출 */
 	UFUNCTION(BlueprintCallable, Category = "Defense(게임)|GameEnd(게임종료)")
 	void NotifyPlayerDied(APlayerController* DeadPC);
@@ -581,6 +597,14 @@ public:
 	 */
 	void NotifyBossDied(AActor* DeadBoss);
 
+protected:
+	/** 사망 처리 공통 경로 — Normal은 카운터 차감/낮 전환, 그 외는 보스 사망 처리 (Actor/Entity 사망 공유) */
+	void HandleMonsterDeath(EEnemyGrade Grade, const FString& MonsterName, const TCHAR* Source);
+
+	/** 보스/세미보스 사망 후속 처리 (NotifyBossDied / Entity 보스 사망 공유) */
+	void HandleBossDeath(EEnemyGrade Grade, const FString& BossName);
+
+public:
 	/**
 	 * [BossCinematicFreezeV1] 현재 보스 시네마틱(소환/페이즈2/사망) 중 하나라도 재생 중인지 여부.
 	 *   각 시네마틱 트리거의 bCinematicActive 는 서버에서만 set 되므로 이 쿼리도 서버 전용이다.
@@ -767,11 +791,36 @@ protected:
 	FString GetRegistryDirectoryPath() const;
 	FString GetRegistryFilePath() const;
 	int32 GetServerPort() const;
+	FString BuildRegistryJson(const FString& Status, int32 PlayerCount) const;
 	void WriteRegistryFile(const FString& Status, int32 PlayerCount);
 
-	/** 하트비트 타이머 핸들 (30초마다 레지스트리 갱신) */
+	/** 주기 하트비트 — 소켓 송신, 소켓이 없으면 파일 재기록 */
+	void SendRegistryHeartbeat();
+
+	/** 하트비트 타이머 핸들 (소켓 5초 / 파일 폴백 30초) */
 	FTimerHandle RegistryHeartbeatTimer;
 
+	/** [ChannelRegistryV1] 로비 채널 레지스트리 송신/커맨드 수신 소켓 */
+	FHellunaChannelRegistryClient RegistryClient;
+
+	/**
+	 * [WarmPoolV1] 웜 스탠바이 서버 여부 (-WarmStandby 커맨드라인).
+	 * true인 동안 레지스트리에 "idle"로 보고 + 유휴 종료 안 함 → 로비의 "assign" 커맨드로 해제.
+	 */
+	bool bWarmStandby = false;
+
+	/** [WarmPoolV1] assign 커맨드로 배정된 파티 ID (솔로/직접 접속 = 0) — Barrier PartyId 기본값 */
+	int32 WarmAssignedPartyId = 0;
+
+	/** 현재 레지스트리 상태 문자열 (idle / playing / empty) */
+	FString GetRegistryStatus() const;
+
+	/**
+	 * [WarmPoolV1] 로비 배정 수신 — 파티/맵 적용 + 스탠바이 해제 + "empty" 보고(= 로비 WaitAndDeploy ack) + 유휴 종료 타이머 시작.
+	 * 맵 불일치는 배정 불가 → 프로세스 종료 (로비 대기는 서버 사망으로 실패 처리, 풀은 재보충)
+	 */
+	void HandleWarmAssign(const TSharedPtr<FJsonObject>& Command);
+
 	void DeleteRegistryFile();
 
 	// ════════════════════════════════════════════════════════════════
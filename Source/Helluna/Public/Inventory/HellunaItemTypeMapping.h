@@ -69,6 +69,14 @@ public:
  * DataTable 조회 유틸리티 클래스
  * 
  * ============================================
+ * 📌 [ItemTypeMapCacheV1] 해시 캐시
+ * ============================================
+ * - DataTable별로 처음 조회할 때 1회 빌드 → 이후 불변 (ItemType → ActorClass / ActorClass → ItemType)
+ * - 조회는 TMap 해시 1회 (기존: GetAllRows 배열 할당 + 행 수만큼 태그 비교)
+ * - 에디터: DataTable 수정(OnDataTableChanged) 시 해당 테이블 캐시 무효화 → 다음 조회에서 재빌드
+ * - 값은 TSoftClassPtr로 보관 (캐시가 클래스를 GC 루트로 붙잡지 않음)
+ * 
+ * ============================================
  * 📌 사용 예시:
  * ============================================
  * ```cpp
@@ -107,6 +115,25 @@ public:
 		const FGameplayTag& ItemType
 	);
 
+	/**
+	 * [ItemTypeMapCacheV1] Actor 클래스로 ItemType(GameplayTag) 역조회
+	 * 
+	 * @param DataTable - DT_ItemTypeMapping DataTable 에셋
+	 * @param ActorClass - 찾을 아이템 Actor 클래스
+	 * @return 매핑된 GameplayTag (없으면 EmptyTag)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Helluna|Inventory")
+	static FGameplayTag GetItemTypeFromActorClass(
+		const UDataTable* DataTable,
+		TSubclassOf<AActor> ActorClass
+	);
+
+	/**
+	 * [ItemTypeMapCacheV1] 해당 DataTable의 해시 캐시 폐기 (다음 조회 시 재빌드)
+	 * 에디터에서는 DataTable 변경 시 자동 호출됨. 런타임에 테이블을 교체했을 때만 직접 호출
+	 */
+	static void InvalidateCache(const UDataTable* DataTable);
+
 	/**
 	 * DataTable의 모든 매핑 정보를 로그에 출력 (디버깅용)
 	 * 
@@ -34,6 +34,13 @@
 //   로비서버 + 게임서버가 같은 PC에서 같은 DB 파일 공유
 //   PRAGMA journal_mode=WAL + busy_timeout=3000 으로 동시 접근 처리
 //
+// [비동기] [DBAsyncV1]
+//   Async* 함수 / EnqueueDatabaseJob — 쓰기는 전용 DB 워커 스레드 1개가 FIFO로 처리,
+//   읽기는 WAL 읽기 전용 연결로 스레드 풀에서 쓰기와 동시에 실행.
+//   결과는 게임 스레드 콜백(또는 TFuture)으로 돌아온다.
+//   동기 함수는 진입 시 "같은 플레이어"의 대기 중인 비동기 쓰기만 기다리므로 섞어 써도
+//   플레이어 단위 순서가 보장되고, 다른 플레이어의 저장 때문에 게임 스레드가 막히지 않는다.
+//
 // [주의사항]
 //   - FSQLiteDatabase는 UObject가 아니므로 UPROPERTY 불가 → 수동 delete 필수
 //   - 모든 쓰기 함수는 트랜잭션(BEGIN/COMMIT/ROLLBACK)으로 원자성 보장
@@ -50,12 +57,16 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Lobby/Database/IInventoryDatabase.h"
 #include "Lobby/Party/HellunaPartyTypes.h"
+#include "Async/Future.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/ThreadSafeCounter.h"
 #include "HellunaSQLiteSubsystem.generated.h"
 
 // 전방선언 — FSQLiteDatabase, FSQLitePreparedStatement는 UObject가 아닌 POD 클래스
 // #include "SQLiteDatabase.h"와 "SQLitePreparedStatement.h"는 cpp에서만 수행 (헤더 오염 방지)
 class FSQLiteDatabase;
 class FSQLitePreparedStatement;
+class FHellunaDBWorker;
 
 UCLASS()
 class HELLUNA_API UHellunaSQLiteSubsystem : public UGameInstanceSubsystem, public IInventoryDatabase
@@ -533,6 +544,92 @@ public:
 	 */
 	int32 CleanupStaleParties(int32 HoursOld = 24);
 
+	// ════════════════════════════════════════════════════════════════
+	// [DBAsyncV1] 비동기 API — 게임 스레드를 디스크 I/O로 막지 않음
+	// ════════════════════════════════════════════════════════════════
+	//
+	//   쓰기: 전용 DB 워커 스레드(단일 Writer)가 요청 순서(FIFO)대로 실행
+	//         → 같은 플레이어의 저장이 뒤바뀌지 않는다
+	//   읽기: WAL 읽기 전용 연결로 스레드 풀에서 실행 (쓰기와 동시 진행)
+	//         → 같은 플레이어의 대기 중인 쓰기가 있으면 쓰기 큐 뒤에 붙여 "내가 쓴 값"을 읽도록 보장
+	//   동기 호출: 같은 PlayerId의 대기 중인 비동기 쓰기만 기다림 (큐 전체를 비우지 않음)
+	//   콜백: 항상 게임 스레드. 서브시스템이 이미 파괴됐으면 호출하지 않음
+	//
+	//   예) 여러 명이 동시에 복귀할 때:
+	//     DB->AsyncMergeGameResultToStash(PlayerId, Items,
+	//         FOnOperationComplete::CreateUObject(this, &AMyGameMode::OnMergeDone));
+
+	/** LoadPlayerStash 비동기 버전 (읽기 전용 연결, 스레드 풀) */
+	virtual void AsyncLoadPlayerStash(const FString& PlayerId, FOnStashLoaded OnComplete) override;
+
+	/** SavePlayerStash 비동기 버전 (DB 워커, FIFO) — Items는 복사되어 큐에 들어간다 */
+	virtual void AsyncSavePlayerStash(const FString& PlayerId, const TArray<FInv_SavedItemData>& Items, FOnOperationComplete OnComplete) override;
+
+	/** LoadPlayerLoadout 비동기 버전 (읽기 전용 연결, 스레드 풀) */
+	void AsyncLoadPlayerLoadout(const FString& PlayerId, FOnStashLoaded OnComplete);
+
+	/** SaveStashAndLoadoutAtomic 비동기 버전 (DB 워커, FIFO) */
+	void AsyncSaveStashAndLoadoutAtomic(
+		const FString& PlayerId,
+		const TArray<FInv_SavedItemData>& StashItems,
+		const TArray<FInv_SavedItemData>& LoadoutItems,
+		FOnOperationComplete OnComplete);
+
+	/** MergeGameResultToStash 비동기 버전 (DB 워커, FIFO) */
+	void AsyncMergeGameResultToStash(const FString& PlayerId, const TArray<FInv_SavedItemData>& ResultItems, FOnOperationComplete OnComplete);
+
+	/**
+	 * 임의의 동기 DB 함수를 DB 워커에서 실행 (파티 함수 등 전용 Async 버전이 없는 경우)
+	 *
+	 * 예) DB->EnqueueDatabaseJob<int32>(
+	 *         [Code](UHellunaSQLiteSubsystem& Db) { return Db.FindPartyByCode(Code); },
+	 *         [WeakThis](const int32& PartyId) { ... });   // 게임 스레드
+	 *
+	 * @param Work          DB 워커 스레드에서 실행 (UObject/월드 접근 금지 — DB 함수만 호출)
+	 * @param OnGameThread  결과를 받을 게임 스레드 콜백 (생략 가능)
+	 * @param PlayerId      작업 대상 플레이어 — 지정하면 이 플레이어의 동기 호출/비동기 읽기가 작업 완료를 기다림
+	 * @return 결과 Future — 게임 스레드에서 Get()으로 블록하지 말 것 (콜백 사용 권장)
+	 */
+	template<typename ResultType>
+	TFuture<ResultType> EnqueueDatabaseJob(
+		TUniqueFunction<ResultType(UHellunaSQLiteSubsystem&)> Work,
+		TUniqueFunction<void(const ResultType&)> OnGameThread = nullptr,
+		const FString& PlayerId = FString())
+	{
+		TSharedRef<TPromise<ResultType>> Promise = MakeShared<TPromise<ResultType>>();
+		TFuture<ResultType> Future = Promise->GetFuture();
+
+		// 워커는 Deinitialize()에서 큐를 비운 뒤 종료되므로 작업 내 this는 항상 유효
+		EnqueueDatabaseWrite([this, Promise, Work = MoveTemp(Work), OnGameThread = MoveTemp(OnGameThread)]() mutable
+		{
+			ResultType Result = Work(*this);
+			Promise->SetValue(Result);
+			if (OnGameThread)
+			{
+				DispatchToGameThread([OnGameThread = MoveTemp(OnGameThread), Result = MoveTemp(Result)]() mutable
+				{
+					OnGameThread(Result);
+				});
+			}
+		}, PlayerId);
+		return Future;
+	}
+
+	/** 큐에 남은 비동기 쓰기 수 (디버그/종료 대기용) */
+	int32 GetPendingDatabaseJobCount() const;
+
+	/** 특정 플레이어의 큐에 남은 비동기 쓰기 수 */
+	int32 GetPendingDatabaseJobCount(const FString& PlayerId) const;
+
+	/**
+	 * 대기 중인 비동기 쓰기를 모두 처리할 때까지 대기 (워커 스레드에서 호출 시 무시) — DB 열기/닫기 전용
+	 * FDatabaseAccessScope 안에서 호출 금지 — 워커 작업이 DatabaseMutex를 기다리므로 교착
+	 */
+	void FlushDatabaseJobs();
+
+	/** 해당 플레이어의 대기 중인 비동기 쓰기만 처리될 때까지 대기 (워커 스레드에서 호출 시 무시) */
+	void WaitForPlayerDatabaseJobs(const FString& PlayerId);
+
 private:
 	// ════════════════════════════════════════════════════════════════
 	// DB 관리 (private)
@@ -552,10 +649,17 @@ private:
 
 	/**
 	 * DB 닫기 — Deinitialize()에서 호출
-	 * → Database->Close() + delete Database + nullptr 초기화
+	 * → 비동기 큐 전체 대기 후 CloseDatabaseLocked()
 	 */
 	void CloseDatabase();
 
+	/**
+	 * DatabaseMutex를 이미 잡은 상태에서 닫기 (큐 대기 없음)
+	 * → Database->Close() + delete Database + nullptr 초기화
+	 * OpenDatabase() 실패 경로 전용 — 스코프 안에서 FlushDatabaseJobs()를 부르면 교착
+	 */
+	void CloseDatabaseLocked();
+
 	/**
 	 * 테이블 스키마 생성 + PRAGMA 설정 — OpenDatabase() 성공 직후 호출
 	 *
@@ -586,12 +690,32 @@ private:
 	 *   is_equipped         → bool (player_loadout에는 없음 → 기본값 false)
 	 *   weapon_slot         → int32 (-1 = 미장착)
 	 *   serialized_manifest → TArray<uint8> (BLOB)
-	 *   attachments_json    → TArray<FInv_SavedAttachmentData> (JSON 파싱)
+	 *   attachments_blob    → TArray<FInv_SavedAttachmentData> (바이너리, [AttachBlobV1])
+	 *   attachments_json    → 위 BLOB이 비어있을 때만 JSON 파싱 (레거시 행)
 	 */
 	static FInv_SavedItemData ParseRowToSavedItem(const FSQLitePreparedStatement& Statement);
 
 	/**
-	 * FInv_SavedAttachmentData 배열 → JSON 문자열
+	 * [AttachBlobV1] FInv_SavedAttachmentData 배열 → 버전 바이너리 (attachments_blob 컬럼)
+	 *
+	 * 형식 (FMemoryWriter):
+	 *   uint8 Version(=1) | int32 Count | Count × { FString 아이템태그, int32 슬롯, FString 부착타입, TArray<uint8> 매니페스트 }
+	 * 부착물이 없으면 빈 배열 → DB에는 NULL
+	 */
+	static TArray<uint8> SerializeAttachmentsToBlob(const TArray<FInv_SavedAttachmentData>& Attachments);
+
+	/** 바이너리 → FInv_SavedAttachmentData 배열 (알 수 없는 버전/손상 시 빈 배열 + 경고) */
+	static TArray<FInv_SavedAttachmentData> DeserializeAttachmentsFromBlob(const TArray<uint8>& Blob);
+
+	/**
+	 * [AttachBlobV1] 기존 attachments_json 행을 attachments_blob으로 1회 변환
+	 * schema_version 1 → 2. InitializeSchema에서 호출, 실패해도 레거시 읽기 경로로 동작 (다음 실행 시 재시도)
+	 */
+	bool MigrateAttachmentsToBlob();
+
+	/**
+	 * [레거시] FInv_SavedAttachmentData 배열 → JSON 문자열
+	 * DB에는 더 이상 쓰지 않음 — 전송 파일(Export*ToFile) 포맷 전용
 	 *
 	 * JSON 형식: [{"t":"태그","s":슬롯인덱스,"at":"부착타입","m":"Base64 매니페스트"}, ...]
 	 *   t  = AttachmentItemType (FGameplayTag 문자열)
@@ -601,7 +725,7 @@ private:
 	 */
 	static FString SerializeAttachmentsToJson(const TArray<FInv_SavedAttachmentData>& Attachments);
 
-	/** JSON 문자열 → FInv_SavedAttachmentData 배열 (위의 역변환) */
+	/** JSON 문자열 → FInv_SavedAttachmentData 배열 (위의 역변환 — 전송 파일 + 마이그레이션 전 DB 행) */
 	static TArray<FInv_SavedAttachmentData> DeserializeAttachmentsFromJson(const FString& JsonString);
 
 	/** Loadout 전송 파일의 전체 경로를 반환 */
@@ -610,6 +734,84 @@ private:
 	/** Game Result 전송 파일의 전체 경로를 반환 */
 	FString GetGameResultTransferFilePath(const FString& PlayerId) const;
 
+	/**
+	 * 아이템 SELECT 공통 실행 — 동기 로드와 비동기 읽기(읽기 전용 연결)가 공유
+	 * SelectSQL은 ParseRowToSavedItem 컬럼 순서를 따라야 하며 ?1 = player_id
+	 */
+	static TArray<FInv_SavedItemData> QueryItemRows(FSQLiteDatabase& Db, const TCHAR* SelectSQL, const FString& PlayerId, const TCHAR* Context);
+
+	/** 이미 준비된 SELECT 실행 (캐시된 Statement용) — QueryItemRows 내부에서도 사용 */
+	static TArray<FInv_SavedItemData> ExecuteItemQuery(FSQLitePreparedStatement& SelectStmt, const FString& PlayerId, const TCHAR* Context);
+
+	// ════════════════════════════════════════════════════════════════
+	// [StmtCacheV1] Prepared Statement 캐시 + Diff 기반 아이템 저장
+	// ════════════════════════════════════════════════════════════════
+
+	/**
+	 * SQL 텍스트로 캐시된 Statement 반환 (없으면 Persistent로 컴파일 후 캐시)
+	 * 반환 시 Reset + ClearBindings 완료 상태. Database(Writer) 전용 — DatabaseMutex 안에서만 호출
+	 * @return 컴파일 실패 시 nullptr (GetLastError로 원인 확인)
+	 */
+	FSQLitePreparedStatement* GetCachedStatement(const FString& SQL);
+
+	/** 캐시된 Statement 전부 해제 — Database->Close() 전에 반드시 호출 (CloseDatabase) */
+	void ResetStatementCache();
+
+	/** 아이템 1행의 컬럼 값 (cpp 정의) — 새 상태/기존 행 비교와 배치 바인딩에 공용 */
+	struct FItemRow;
+
+	/**
+	 * 아이템 테이블(player_stash/player_loadout)을 Items 상태로 맞춤 — 변경된 행만 기록
+	 *   기존 행과 컬럼 값이 같은 아이템은 유지, 사라진 행만 DELETE, 새 행만 다중 행 INSERT
+	 * 호출자가 트랜잭션을 열어둔 상태여야 함 (실패 시 호출자가 ROLLBACK)
+	 * @param Table  반드시 코드 상수 테이블명 (SQL에 직접 삽입됨)
+	 */
+	bool WriteItemRowsDiff(const TCHAR* Table, const FString& PlayerId, const TArray<FInv_SavedItemData>& Items, const TCHAR* Context);
+
+	/** 다중 행 INSERT (최대 MaxItemRowsPerStatement행씩 배치) — 트랜잭션은 호출자 책임 */
+	bool InsertItemRows(const TCHAR* Table, const FString& PlayerId, TConstArrayView<const FItemRow*> Rows, const TCHAR* Context);
+
+	// ════════════════════════════════════════════════════════════════
+	// [DBAsyncV1] 비동기 내부 구현
+	// ════════════════════════════════════════════════════════════════
+
+	/**
+	 * DB 접근 RAII — 모든 동기 DB 함수 진입 시 생성
+	 *   1. (바깥쪽 진입 + DB 워커가 아닌 스레드 + PlayerId 지정) 그 플레이어의 대기 중인 비동기 쓰기만 기다림
+	 *      → 플레이어 단위 FIFO 유지, 다른 플레이어의 큐는 기다리지 않음
+	 *   2. DatabaseMutex 획득 (재진입 가능 — 동기 함수끼리 중첩 호출 허용)
+	 */
+	struct FDatabaseAccessScope
+	{
+		explicit FDatabaseAccessScope(UHellunaSQLiteSubsystem& InOwner, const FString& PlayerId = FString());
+		~FDatabaseAccessScope();
+
+	private:
+		UHellunaSQLiteSubsystem& Owner;
+	};
+
+	/**
+	 * 쓰기 작업을 DB 워커 큐에 추가 (워커 없으면 지연 생성, 멀티스레드 미지원 플랫폼은 즉시 실행)
+	 * PlayerId를 지정하면 작업이 끝날 때까지 PendingJobsByPlayer에 집계됨
+	 */
+	void EnqueueDatabaseWrite(TUniqueFunction<void()> Job, const FString& PlayerId = FString());
+
+	/**
+	 * 읽기 작업 실행 — 읽기 전용 연결이 있고 해당 플레이어의 대기 중인 쓰기가 없으면 스레드 풀, 아니면 쓰기 큐
+	 * Job에는 사용할 연결이 전달된다 (DB 미준비 시 nullptr)
+	 */
+	void EnqueueDatabaseRead(const FString& PlayerId, TUniqueFunction<void(FSQLiteDatabase*)> Job);
+
+	/** 게임 스레드에서 실행 (서브시스템 파괴 후에는 생략) */
+	void DispatchToGameThread(TUniqueFunction<void()> Callback);
+
+	/** WAL 읽기 전용 연결 열기/닫기 — OpenDatabase/CloseDatabase에서 호출 */
+	void OpenReadConnection();
+	void CloseReadConnection();
+
+	/** DB 워커 종료 — 남은 작업을 모두 처리한 뒤 스레드 정리 (Deinitialize) */
+	void ShutdownDatabaseWorker();
+
 	// ════════════════════════════════════════════════════════════════
 	// 멤버 변수
 	// ════════════════════════════════════════════════════════════════
@@ -626,6 +828,37 @@ private:
 	 */
 	FSQLiteDatabase* Database = nullptr;
 
+	/**
+	 * [StmtCacheV1] SQL 텍스트 → 컴파일된 Statement (Database 전용)
+	 * 수명: GetCachedStatement에서 new, ResetStatementCache에서 delete
+	 *       (CloseDatabase / ReleaseDatabaseConnection 시 초기화 — 닫힌 연결의 Statement 재사용 금지)
+	 */
+	TMap<FString, FSQLitePreparedStatement*> StatementCache;
+
+	/**
+	 * [DBAsyncV1] 비동기 읽기 전용 연결 (WAL이므로 Writer와 동시 읽기 가능)
+	 * 열기 실패 시 nullptr → 비동기 읽기는 쓰기 큐(Database)로 폴백
+	 */
+	FSQLiteDatabase* ReadDatabase = nullptr;
+
+	/** [DBAsyncV1] 쓰기 전용 DB 워커 (FRunnable, cpp 내부 클래스) — 수동 delete */
+	FHellunaDBWorker* DBWorker = nullptr;
+
+	/** Database 접근 직렬화 (FCriticalSection은 재진입 가능) */
+	FCriticalSection DatabaseMutex;
+
+	/** ReadDatabase 접근 직렬화 + 닫기와의 경합 방지 */
+	FCriticalSection ReadDatabaseMutex;
+
+	/** 스레드 풀에서 실행 중인 비동기 읽기 수 (Deinitialize 대기용) */
+	FThreadSafeCounter InFlightReads;
+
+	/** 플레이어별 "큐에 있음 + 실행 중" 쓰기 수 (0이면 키 제거) — 동기 호출의 플레이어 단위 대기용 */
+	TMap<FString, int32> PendingJobsByPlayer;
+
+	/** PendingJobsByPlayer 보호 */
+	mutable FCriticalSection PendingJobsMutex;
+
 	/** DB 파일 절대 경로 캐시 (Initialize에서 한 번 설정) */
 	FString CachedDatabasePath;
 	/**
@@ -29,12 +29,17 @@
  *
  * // TODO: [SQL전환] 이 인터페이스를 새 클래스에서 구현하면 백엔드 교체 완료
  *
- * // TODO: [비동기] 추후 비동기 버전 필요 시:
- * // DECLARE_DELEGATE_OneParam(FOnStashLoaded, const TArray<FInv_SavedItemData>&);
- * // DECLARE_DELEGATE_OneParam(FOnOperationComplete, bool);
- * // virtual void AsyncLoadPlayerStash(const FString& PlayerId, FOnStashLoaded OnComplete) = 0;
- * // virtual void AsyncSavePlayerStash(const FString& PlayerId, const TArray<FInv_SavedItemData>& Items, FOnOperationComplete OnComplete) = 0;
+ * [비동기] [DBAsyncV1]
+ * AsyncLoadPlayerStash / AsyncSavePlayerStash — 구현체가 백그라운드에서 실행하고
+ * 결과 델리게이트는 반드시 게임 스레드에서 호출한다.
  */
+
+/** 비동기 로드 완료 (게임 스레드). 실패/데이터 없음이면 빈 배열 */
+DECLARE_DELEGATE_OneParam(FOnStashLoaded, const TArray<FInv_SavedItemData>&);
+
+/** 비동기 쓰기 완료 (게임 스레드). true = 커밋 성공 */
+DECLARE_DELEGATE_OneParam(FOnOperationComplete, bool);
+
 class HELLUNA_API IInventoryDatabase
 {
 public:
@@ -66,6 +71,19 @@ public:
 	 */
 	virtual bool SavePlayerStash(const FString& PlayerId, const TArray<FInv_SavedItemData>& Items) = 0;
 
+	/**
+	 * [DBAsyncV1] LoadPlayerStash의 비동기 버전.
+	 * 호출 스레드를 막지 않으며, OnComplete는 게임 스레드에서 호출된다.
+	 */
+	virtual void AsyncLoadPlayerStash(const FString& PlayerId, FOnStashLoaded OnComplete) = 0;
+
+	/**
+	 * [DBAsyncV1] SavePlayerStash의 비동기 버전.
+	 * Items는 호출 시점에 복사되므로 호출 직후 원본을 수정해도 된다.
+	 * 같은 구현체에 요청한 쓰기는 요청 순서대로 커밋된다.
+	 */
+	virtual void AsyncSavePlayerStash(const FString& PlayerId, const TArray<FInv_SavedItemData>& Items, FOnOperationComplete OnComplete) = 0;
+
 	/**
 	 * 해당 플레이어의 Stash 데이터가 존재하는지 확인한다.
 	 *
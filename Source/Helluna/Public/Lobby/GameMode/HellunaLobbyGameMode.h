@@ -34,6 +34,7 @@ class UHellunaSQLiteSubsystem;
 class UInv_InventoryComponent;
 class UHellunaAccountSaveGame;
 class UHellunaGameServerManager;
+class UHellunaChannelRegistry;
 
 UCLASS()
 class HELLUNA_API AHellunaLobbyGameMode : public AHellunaBaseGameMode
@@ -81,12 +82,16 @@ protected:
 
 	/**
 	 * SQLite에서 Stash 로드 → StashComp에 RestoreFromSaveData
+	 * [DBAsyncV1] 로드는 비동기 — 복원은 게임 스레드 콜백(ApplyLoadedStash)에서 수행
 	 *
 	 * @param LobbyPC  대상 로비 컨트롤러
 	 * @param PlayerId 플레이어 고유 ID
 	 */
 	void LoadStashToComponent(AHellunaLobbyController* LobbyPC, const FString& PlayerId);
 
+	/** LoadStashToComponent의 로드 결과를 StashComp에 복원 + LoadedStashItemCount 기록 */
+	void ApplyLoadedStash(AHellunaLobbyController* LobbyPC, const FString& PlayerId, TArray<FInv_SavedItemData> StashItems);
+
 	/**
 	 * [Fix23] SQLite에서 Loadout 로드 → LoadoutComp에 RestoreFromSaveData
 	 * 게임 생존 후 복귀 시 Loadout 아이템을 LoadoutComp에 복원
@@ -124,6 +129,10 @@ public:
 	UPROPERTY()
 	TObjectPtr<UHellunaGameServerManager> GameServerManager;
 
+	/** [ChannelRegistryV1] 메모리 채널 레지스트리 (게임서버 하트비트 수신, 맵/상태 인덱스) */
+	UPROPERTY()
+	TObjectPtr<UHellunaChannelRegistry> ChannelRegistry;
+
 protected:
 
 	/** [Phase 13] 계정 SaveGame (BeginPlay에서 LoadOrCreate) */
@@ -151,18 +160,22 @@ public:
 	void UnregisterLobbyCharacterUse(const FString& PlayerId);
 
 	// ════════════════════════════════════════════════════════════════
-	// [Phase 12b] 채널 레지스트리 스캔
+	// [Phase 12b] 채널 레지스트리 조회 (ChannelRegistry 인덱스 — 디스크 I/O 없음)
 	// ════════════════════════════════════════════════════════════════
 
-	/** ServerRegistry 폴더 스캔 → 채널 목록 반환 */
-	TArray<FGameChannelInfo> ScanAvailableChannels();
-
 	/** 빈 채널(status=empty, PendingDeploy 제외) 찾기 — null이면 빈 채널 없음 */
 	bool FindEmptyChannel(FGameChannelInfo& OutChannel);
 
-	/** [Phase 16] 특정 맵의 빈 채널 검색 */
+	/** [Phase 16] 특정 맵의 빈 채널 검색 (status=empty만 — 웜 서버는 ClaimWarmServerForMap) */
 	bool FindEmptyChannelForMap(const FString& MapKey, FGameChannelInfo& OutChannel);
 
+	/**
+	 * [WarmPoolV1] 특정 맵의 웜 서버 1개에 assign 전송 후 포트 반환 (없으면 -1).
+	 * 서버가 assign을 처리해 "empty"를 보고해야 입장 가능 → 반환 포트는 반드시 WaitAndDeploy로 배치.
+	 * @param PartyId  assign 커맨드에 실어 보낼 파티 ID (솔로 = 0)
+	 */
+	int32 ClaimWarmServerForMap(const FString& MapKey, int32 PartyId = 0);
+
 	/** [Phase 16] 맵키로 MapPath 조회 */
 	FString GetMapPathByKey(const FString& MapKey) const;
 
@@ -216,7 +229,7 @@ public:
 	// [Phase 14d] 재참가 시스템
 	// ════════════════════════════════════════════════════════════════
 
-	/** 게임서버 포트의 레지스트리가 유효한지 확인 (status=playing + 60초 이내) */
+	/** 게임서버 포트의 레지스트리가 유효한지 확인 (status=playing + 하트비트 신선) */
 	bool IsGameServerRunning(int32 Port);
 
 	/** 플레이어가 현재 게임 모드를 사용할 수 있는지 검증 */
@@ -244,6 +257,9 @@ public:
 	/** 큐 상태 확인 */
 	bool IsPlayerInQueue(const FString& PlayerId) const;
 
+	/** [MatchBucketV1] 버킷별 대기 깊이 / 대기 시간 통계 (비어 있는 버킷 제외) */
+	void GetMatchmakingBucketStats(TArray<FMatchmakingBucketStats>& OutStats) const;
+
 	/** 파티 상태를 전원에게 RPC */
 	void BroadcastPartyState(int32 PartyId);
 
@@ -276,6 +292,14 @@ public:
 		meta = (DisplayName = "Default Map Key (기본 맵 키)"))
 	FString DefaultMapKey = TEXT("GihyeonMap");
 
+	/**
+	 * [WarmPoolV1] 맵 키별 웜 스탠바이 서버 수 (미리 띄워 맵 로드까지 끝낸 대기 서버).
+	 * 배치 시 빈 채널이 없으면 여기서 즉시 배정 → 콜드 스타트 대기 제거. 비우면 풀 비활성.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Lobby|Server",
+		meta = (DisplayName = "Warm Servers Per Map (맵별 웜 서버 수)", ClampMin = "0"))
+	TMap<FString, int32> WarmServersPerMap;
+
 	/** Deploy 예약된 채널 포트 (이중 배정 방지) */
 	TSet<int32> PendingDeployChannels;
 
@@ -293,6 +317,12 @@ public:
 	/** FIFO 매칭 큐 */
 	TArray<FMatchmakingQueueEntry> MatchmakingQueue;
 
+	/** [MatchBucketV1] (맵 키 + 모드) 버킷 인덱스 — Enqueue/RemoveQueueEntry에서 MatchmakingQueue와 동기 유지 */
+	TMap<FMatchmakingBucketKey, FMatchmakingBucket> MatchmakingBuckets;
+
+	/** [MatchBucketV1] 마지막 버킷 통계 로그 시간 */
+	double LastBucketStatsLogTime = 0.0;
+
 	/** PlayerId → EntryId 빠른 조회 */
 	TMap<FString, int32> PlayerToQueueEntryMap;
 
@@ -329,9 +359,12 @@ public:
 	/** 여러 플레이어의 deploy 상태 롤백 */
 	void RollbackDeployStateForPlayers(const TArray<FString>& PlayerIds, int32 ExpectedPort = INDEX_NONE);
 
-	/** 매칭 알고리즘 — 조합 찾으면 true */
+	/** 매칭 알고리즘 — 버킷별 greedy 패킹, 한 패스에 가능한 매칭 전부 성사. 1개 이상이면 true */
 	bool TryFormMatch();
 
+	/** [MatchBucketV1] 버킷 통계 로그 (TickMatchmaking에서 주기 호출) */
+	void LogMatchmakingBucketStats() const;
+
 	/** 매칭 완료 → Deploy 실행 (서버 없으면 비동기 스폰 대기) */
 	void ExecuteMatchedDeploy(const TArray<FMatchmakingQueueEntry>& Matched, bool bRequeueOnFailure = false);
 
@@ -97,6 +97,64 @@ struct FMatchmakingQueueEntry
 	int32 GetPlayerCount() const { return PlayerIds.Num(); }
 };
 
+// ============================================================================
+// [MatchBucketV1] 매칭 버킷 (맵 키 + 게임 모드) — 서버 전용
+// ============================================================================
+
+/** 버킷 키 — 같은 맵 + 같은 모드끼리만 매칭 */
+struct FMatchmakingBucketKey
+{
+	FString MapKey;
+	ELobbyGameMode GameMode = ELobbyGameMode::Squad;
+
+	bool operator==(const FMatchmakingBucketKey& Other) const
+	{
+		return GameMode == Other.GameMode && MapKey == Other.MapKey;
+	}
+
+	friend uint32 GetTypeHash(const FMatchmakingBucketKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.MapKey), ::GetTypeHash(static_cast<uint8>(Key.GameMode)));
+	}
+};
+
+/** 버킷 내 엔트리 요약 (패킹에 필요한 불변 값만) */
+struct FMatchmakingBucketSlot
+{
+	int32 EntryId = 0;
+	int32 PlayerCount = 0;
+	double QueueEnterTime = 0.0;
+};
+
+/** 버킷 — 파티 크기별 FIFO 슬롯 + 누적 통계 */
+struct FMatchmakingBucket
+{
+	/** 파티 크기별 슬롯 (큐 진입 순). [0]=1인, [1]=2인, [2]=3인 이상 */
+	TArray<FMatchmakingBucketSlot> SlotsBySize[3];
+
+	/** 대기 엔트리 / 인원 */
+	int32 EntryCount = 0;
+	int32 PlayerCount = 0;
+
+	/** 누적: 성사된 매칭 수 + 매칭 시점 최장 대기 합 (평균 대기 통계용) */
+	int32 MatchesFormed = 0;
+	double TotalMatchedWaitSeconds = 0.0;
+
+	static int32 GetSizeIndex(int32 InPlayerCount) { return FMath::Clamp(InPlayerCount, 1, 3) - 1; }
+};
+
+/** 버킷별 대기 통계 (로그/디버그용) */
+struct FMatchmakingBucketStats
+{
+	FMatchmakingBucketKey Key;
+	int32 EntryCount = 0;
+	int32 PlayerCount = 0;
+	float OldestWaitSeconds = 0.f;
+	float AverageWaitSeconds = 0.f;
+	int32 MatchesFormed = 0;
+	float AverageMatchedWaitSeconds = 0.f;
+};
+
 /** 클라이언트용 상태 정보 (RPC 전달용) */
 USTRUCT(BlueprintType)
 struct FMatchmakingStatusInfo
@@ -38,7 +38,9 @@ enum class EChannelStatus : uint8
 {
 	Empty   = 0	UMETA(DisplayName = "Empty (비어있음)"),
 	Playing = 1	UMETA(DisplayName = "Playing (플레이 중)"),
-	Offline = 2	UMETA(DisplayName = "Offline (오프라인)")
+	Offline = 2	UMETA(DisplayName = "Offline (오프라인)"),
+	/** [WarmPoolV1] 웜 스탠바이 — 맵 로드 완료, 로비 배정(assign) 대기. FindEmptyChannel 대상 아님 */
+	Idle    = 3	UMETA(DisplayName = "Idle (웜 스탠바이)")
 };
 
 // ════════════════════════════════════════════════════════════════
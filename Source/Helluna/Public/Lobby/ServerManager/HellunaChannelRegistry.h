@@ -0,0 +1,178 @@
+// ============================================================================
+// HellunaChannelRegistry.h
+// ============================================================================
+//
+// [ChannelRegistryV1] 이벤트 기반 채널 레지스트리 (channel_*.json 디렉토리 스캔 대체)
+//
+// 사용처:
+//   - HellunaLobbyGameMode (소유, BeginPlay에서 Initialize) — FindEmptyChannel 계열 조회
+//   - HellunaGameServerManager — IsServerReady / AllocatePort 신선도 판단
+//   - HellunaDefenseGameMode — FHellunaChannelRegistryClient로 하트비트/상태 push
+//
+// 역할:
+//   - 로비가 127.0.0.1 UDP 포트를 열고 게임서버의 상태 패킷(기존 channel JSON과 동일 포맷)을 수신
+//   - 채널 상태를 메모리에 유지 + 맵 키 / 상태별 인덱스 제공 (조회 시 디스크 I/O 없음)
+//   - 소켓을 못 쓰는 게임서버를 위해 ServerRegistry 폴더를 mtime diff로 감시 (변경 파일만 파싱)
+//   - 로비 → 게임서버 커맨드(맵 전환)도 하트비트 송신 주소로 역전송
+//
+// 신선도:
+//   - 소켓 채널: Helluna.Lobby.ChannelStaleSeconds(기본 15초) 동안 하트비트 없으면 Offline
+//   - 파일 채널: 기존과 동일하게 lastUpdate 60초 초과 시 Offline (파일 하트비트 30초 주기)
+//
+// ============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Containers/Ticker.h"
+#include "Lobby/Party/HellunaPartyTypes.h"
+#include "HellunaChannelRegistry.generated.h"
+
+class FSocket;
+class FInternetAddr;
+
+namespace HellunaChannelRegistry
+{
+	/** 로비 레지스트리 수신 포트 기본값 (-ChannelRegistryPort= 로 오버라이드) */
+	constexpr int32 DefaultListenPort = 7800;
+
+	/** 커맨드라인 오버라이드를 반영한 레지스트리 포트 */
+	HELLUNA_API int32 GetListenPort();
+
+	/** channel JSON → FGameChannelInfo. OutLastUpdate는 lastUpdate 파싱 실패 시 MinValue */
+	HELLUNA_API bool ParseChannelJson(const FString& JsonString, FGameChannelInfo& OutInfo, FDateTime& OutLastUpdate);
+
+	/**
+	 * 맵 경로/이름 → 맵 식별자 (앞뒤 공백 제거 + 경로면 basename, 대소문자 유지).
+	 * 로비/서버 매니저/레지스트리/게임서버가 맵을 비교할 때 공통으로 사용.
+	 */
+	HELLUNA_API FString NormalizeMapIdentifier(const FString& MapIdentifier);
+
+	/** 두 맵 경로/이름이 같은 맵인지 (NormalizeMapIdentifier 후 대소문자 무시 비교, 빈 값은 불일치) */
+	HELLUNA_API bool DoesMapIdentifierMatch(const FString& A, const FString& B);
+
+	/** 맵 경로/이름 → 인덱스 키 (NormalizeMapIdentifier + 소문자) */
+	HELLUNA_API FString MakeMapIndexKey(const FString& MapIdentifier);
+}
+
+// ============================================================================
+// 로비 측 레지스트리
+// ============================================================================
+
+UCLASS()
+class HELLUNA_API UHellunaChannelRegistry : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** 소켓 바인드 + 레지스트리 폴더 초기 스캔 + 틱 등록 */
+	void Initialize(const FString& InRegistryDir, int32 InListenPort);
+
+	/** 소켓/틱 해제 (LobbyGameMode::EndPlay) */
+	void Shutdown();
+
+	/** 수신 소켓이 열려 있는지 (false면 폴더 감시만으로 동작) */
+	bool IsListening() const { return ListenSocket != nullptr; }
+
+	/** 포트의 채널 정보. 없으면 nullptr */
+	const FGameChannelInfo* FindChannel(int32 Port) const;
+
+	/** 해당 상태의 채널 포트 (오름차순) */
+	void GetPortsByStatus(EChannelStatus Status, TArray<int32>& OutPorts) const;
+
+	/** 맵 + 상태가 일치하는 채널 포트 (오름차순). MapIdentifier는 경로/이름 모두 허용 */
+	void GetPortsForMap(const FString& MapIdentifier, EChannelStatus Status, TArray<int32>& OutPorts) const;
+
+	/** 전체 채널 수 */
+	int32 GetChannelCount() const { return Entries.Num(); }
+
+	/** 채널 제거 (프로세스 종료 / 레지스트리 파일 삭제 시) */
+	void RemoveChannel(int32 Port);
+
+	/**
+	 * 게임서버에 커맨드 JSON 전송.
+	 * 해당 채널이 소켓으로 하트비트를 보내고 있을 때만 true — false면 호출자가 파일 폴백.
+	 */
+	bool SendCommand(int32 Port, const FString& JsonCommand);
+
+private:
+	/** 채널 엔트리 + 인덱스 키 */
+	struct FChannelEntry
+	{
+		FGameChannelInfo Info;
+		FString MapKey;
+		/** FPlatformTime::Seconds 기준 마지막 갱신 */
+		double LastSeenTime = 0.0;
+		/** 소켓 하트비트로 갱신된 엔트리인지 (신선도 기준이 다름) */
+		bool bFromSocket = false;
+		/** 하트비트 송신 주소 (커맨드 역전송용) */
+		TSharedPtr<FInternetAddr> Endpoint;
+	};
+
+	TMap<int32, FChannelEntry> Entries;
+
+	/** 상태별 포트 인덱스 */
+	TMap<EChannelStatus, TSet<int32>> PortsByStatus;
+
+	/** 맵 키별 포트 인덱스 */
+	TMap<FString, TSet<int32>> PortsByMap;
+
+	/** 파일 감시: 파일명 → 마지막으로 파싱한 mtime */
+	TMap<FString, FDateTime> KnownFileTimes;
+
+	FString RegistryDir;
+	FSocket* ListenSocket = nullptr;
+	FTSTicker::FDelegateHandle TickHandle;
+	double LastFileScanTime = 0.0;
+	double LastExpireCheckTime = 0.0;
+
+	bool Tick(float DeltaTime);
+
+	/** 수신 소켓 드레인 (non-blocking) */
+	void DrainSocket();
+
+	/** 폴더 mtime diff — 변경/추가/삭제 파일만 반영 */
+	void ScanRegistryDirectory();
+
+	/** 하트비트 없는 채널 → Offline */
+	void ExpireStaleChannels(double Now);
+
+	/** 엔트리 upsert + 인덱스 갱신 */
+	void ApplyUpdate(const FGameChannelInfo& Info, double SeenTime, bool bFromSocket, const TSharedPtr<FInternetAddr>& Endpoint);
+
+	void IndexEntry(int32 Port, const FChannelEntry& Entry);
+	void UnindexEntry(int32 Port, const FChannelEntry& Entry);
+};
+
+// ============================================================================
+// 게임서버 측 클라이언트
+// ============================================================================
+
+/**
+ * 게임서버 → 로비 레지스트리 송신 + 로비 커맨드 수신.
+ * Open 실패 시 IsOpen()=false → 호출자가 기존 파일 레지스트리로 폴백.
+ */
+class HELLUNA_API FHellunaChannelRegistryClient
+{
+public:
+	FHellunaChannelRegistryClient() = default;
+	~FHellunaChannelRegistryClient();
+
+	FHellunaChannelRegistryClient(const FHellunaChannelRegistryClient&) = delete;
+	FHellunaChannelRegistryClient& operator=(const FHellunaChannelRegistryClient&) = delete;
+
+	bool Open(int32 LobbyRegistryPort);
+	void Close();
+	bool IsOpen() const { return Socket != nullptr; }
+
+	/** 상태 JSON 송신 (channel_<port>.json과 동일 포맷) */
+	bool SendState(const FString& JsonState);
+
+	/** 로비가 보낸 커맨드 1개 수신 (non-blocking). 없으면 false */
+	bool ReceiveCommand(FString& OutJsonCommand);
+
+private:
+	FSocket* Socket = nullptr;
+	TSharedPtr<FInternetAddr> LobbyAddr;
+};
@@ -9,9 +9,10 @@
 //
 // 역할:
 //   - 매칭 완료 시 게임서버 프로세스를 FPlatformProcess::CreateProc으로 스폰
-//   - 서버 레지스트리 폴링으로 준비 상태 확인
+//   - 채널 레지스트리(UHellunaChannelRegistry)로 준비 상태 확인 (없으면 레지스트리 파일)
 //   - 포트 자동 할당 (7778~7798 범위)
 //   - 종료된 프로세스 주기적 정리
+//   - [WarmPoolV1] 맵별 웜 스탠바이 풀 — 미리 띄워 "idle"로 대기시킨 서버를 배치 시 즉시 배정
 //
 // ============================================================================
 
@@ -21,6 +22,9 @@
 #include "UObject/NoExportTypes.h"
 #include "HellunaGameServerManager.generated.h"
 
+class UHellunaChannelRegistry;
+struct FGameChannelInfo;
+
 UCLASS()
 class HELLUNA_API UHellunaGameServerManager : public UObject
 {
@@ -48,9 +52,25 @@ public:
 	/** True only when this lobby still tracks a live game server process for the port. */
 	bool IsTrackedServerRunning(int32 Port);
 
+	/** [ChannelRegistryV1] 메모리 채널 레지스트리 연결 (LobbyGameMode 소유) */
+	void SetChannelRegistry(UHellunaChannelRegistry* InRegistry);
+
 	/** Remove stale channel registry for the port. */
 	void RemoveRegistryFileForPort(int32 Port);
 
+	/**
+	 * [WarmPoolV1] 맵별 웜 스탠바이 목표 수 설정 (MapPath → 대기 서버 수).
+	 * 0개 맵만 있으면 풀 비활성. 설정 즉시 백그라운드 보충 타이머 시작.
+	 */
+	void SetWarmPoolTargets(const TMap<FString, int32>& InTargets);
+
+	/**
+	 * [WarmPoolV1] 해당 맵의 로드 완료(idle) 웜 서버 1개를 배정.
+	 * assign 커맨드 전송 후 OutChannel 반환 — 서버가 "empty"를 보고하면 기존 WaitAndDeploy가 그대로 배치.
+	 * @param PartyId  assign 커맨드에 실어 보낼 파티 ID (솔로 = 0)
+	 */
+	bool ClaimWarmServer(const FString& MapIdentifier, FGameChannelInfo& OutChannel, int32 PartyId = 0);
+
 	/** 프로세스 정리 (EndPlay 시 전체 종료) */
 	void ShutdownAll();
 
@@ -65,11 +85,17 @@ private:
 		int32 Port = 0;
 		FString MapPath;
 		double SpawnTime = 0.0;
+		/** [WarmPoolV1] 풀 소속 (배정 전) — 배정되면 false */
+		bool bWarmStandby = false;
 	};
 
 	/** 활성 서버 프로세스 목록 */
 	TArray<FActiveServerInfo> ActiveServers;
 
+	/** [ChannelRegistryV1] 채널 레지스트리 (LobbyGameMode 소유) */
+	UPROPERTY()
+	TObjectPtr<UHellunaChannelRegistry> ChannelRegistry;
+
 	/** World 약참조 (타이머용) */
 	TWeakObjectPtr<UWorld> WorldRef;
 
@@ -80,12 +106,24 @@ private:
 	/** 서버 실행 파일 경로 (에디터 vs 패키징 자동 감지) */
 	FString GetServerExecutablePath() const;
 
-	/** 지정 포트에 서버 프로세스 스폰 (내부 전용) */
-	int32 SpawnGameServerOnPort(int32 Port, const FString& MapPath);
+	/** 지정 포트에 서버 프로세스 스폰 (내부 전용). bWarmStandby면 -WarmStandby 전달 */
+	int32 SpawnGameServerOnPort(int32 Port, const FString& MapPath, bool bWarmStandby = false);
+
+	/** [WarmPoolV1] 목표 미달 맵에 웜 서버 1개 스폰 (타이머 1회당 1개 — 동시 콜드 스타트 폭주 방지) */
+	void RefillWarmPool();
 
 	/** 정리 타이머 */
 	FTimerHandle CleanupTimer;
 
+	/** [WarmPoolV1] 맵 경로 → 웜 스탠바이 목표 수 */
+	TMap<FString, int32> WarmPoolTargets;
+
+	/** [WarmPoolV1] 풀 보충 타이머 */
+	FTimerHandle WarmPoolTimer;
+
+	/** [WarmPoolV1] 보충 주기 (초) */
+	static constexpr float WarmPoolRefillInterval = 3.0f;
+
 	/** 포트 범위 상수 */
 	static constexpr int32 MinPort = 7778;
 	static constexpr int32 MaxPort = 7798;
@@ -6,6 +6,9 @@
 //  8. WidgetComponent lazy 생성/파괴 (스폰 시 가장 비싼 단일 비용 제거)
 //  9. WidgetComponent UnregisterComponent 경량화 (Near 외에는 렌더링 제외)
 // 10. HISM 풀 매니저 연동 준비 (OreHISMPoolComponent 연동 인터페이스)
+//
+// [OreProximitySubsystemV1] 거리 체크는 UOreProximitySubsystem이 월드당 1회 패스로 수행합니다.
+//   광석마다 돌던 체크 타이머(Near/Far 체크 주기)는 제거 — 주기는 Helluna.Ore.ProximityInterval.
 
 #pragma once
 
@@ -43,6 +46,9 @@ public:
     /** HISM 풀에서 액터로 전환 후 호출 — 즉시 Near 모드 */
     void ForceActivateNear();
 
+    /** [OreProximitySubsystemV1] 서브시스템 진입/이탈 이벤트 — LOD 전환 */
+    void ApplyProximityLOD(EOreProximityLOD NewLOD);
+
 protected:
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
@@ -61,16 +67,6 @@ protected:
         meta = (DisplayName = "Mid 반경(cm)", ClampMin = "1000.0", ClampMax = "20000.0"))
     float MidRadius = 5000.f;
 
-    /** 거리 체크 주기 — Near (초) */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Proximity 최적화|타이머",
-        meta = (DisplayName = "Near 체크 주기(초)", ClampMin = "0.1", ClampMax = "2.0"))
-    float NearCheckInterval = 0.3f;
-
-    /** 거리 체크 주기 — Far (초). 멀리 있을수록 드물게 체크 */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Proximity 최적화|타이머",
-        meta = (DisplayName = "Far 체크 주기(초)", ClampMin = "0.5", ClampMax = "5.0"))
-    float FarCheckInterval = 1.0f;
-
     /** 렌더링 컬 디스턴스 (cm, 0=사용안함) */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Proximity 최적화|렌더링",
         meta = (DisplayName = "렌더 컬 디스턴스(cm)", ClampMin = "0.0"))
@@ -98,8 +94,8 @@ protected:
     /** 현재 LOD 레벨 */
     EOreProximityLOD CurrentLOD = EOreProximityLOD::Far;
 
-    /** 거리 체크 타이머 핸들 */
-    FTimerHandle ProximityTimerHandle;
+    /** UOreProximitySubsystem 등록 핸들 */
+    int32 ProximityHandle = INDEX_NONE;
 
     /** 오너의 원래 틱 활성화 상태 (복원용) */
     bool bOriginalOwnerTickEnabled = true;
@@ -133,12 +129,6 @@ protected:
     /** 오너 액터에서 최적화 대상 컴포넌트들을 캐싱 */
     void CacheOwnerComponents();
 
-    /** 주기적으로 플레이어 거리를 체크하여 모드 전환 */
-    void CheckProximityToPlayers();
-
-    /** 가장 가까운 플레이어까지의 거리 제곱을 반환 */
-    float GetClosestPlayerDistanceSq() const;
-
     /** LOD 전환 */
     void TransitionToLOD(EOreProximityLOD NewLOD);
 
@@ -151,9 +141,6 @@ protected:
     /** Far 모드: 전부 경량화 */
     void ActivateFarMode();
 
-    /** 타이머 주기를 현재 LOD에 맞게 조절 */
-    void AdjustTimerInterval();
-
     // ── WidgetComponent Lazy 관리 ──
 
     /** WidgetComponent를 렌더링 시스템에 등록 (Near 진입 시) */
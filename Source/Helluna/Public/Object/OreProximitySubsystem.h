@@ -0,0 +1,149 @@
+// [최적화] 광석 Proximity 중앙 관리 서브시스템 (OreProximitySubsystemV1)
+//
+// 광석 액터마다 돌던 UOreProximityComponent 타이머 + UOreHISMPoolComponent 라운드-로빈 스캔을
+// 하나의 월드 서브시스템으로 합쳤습니다.
+//
+// 구조:
+//  1. 등록 — 광석 위치를 평면 XY 격자(CellSize)에 보관 (정적 광석 전제, 위치는 등록 시 고정)
+//     - UOreProximityComponent : BeginPlay 등록 / EndPlay 해제 → Near/Mid/Far LOD
+//     - UOreHISMPoolComponent  : RegisterOreInstance 등록 / DestroyOre·EndPlay 해제 → 승격/강등
+//  2. 체크 패스 (Helluna.Ore.ProximityInterval 주기, 월드당 1회)
+//     - 플레이어 위치를 한 번만 수집
+//     - 플레이어 주변 격자 칸의 광석 + 현재 활성(Near/Mid/승격) 광석만 평가
+//       → 비용이 "전체 광석 수"가 아니라 "플레이어 근처 광석 수"에 비례
+//     - 이탈 이벤트 먼저, 진입 이벤트는 가까운 순으로 처리
+//     - 예산: LOD 전환은 Helluna.Ore.MaxLODChangesPerPass, 승격/강등은 풀의 MaxPromotes/MaxDemotesPerCheck
+//       (예산을 넘은 이벤트는 다음 패스에서 다시 평가됨)
+//  3. 활성 목록 — 상태가 바뀌면 컴포넌트/풀이 NotifyActiveChanged로 알려준다
+//     (ForceActivateNear, BP에서 직접 호출한 PromoteToActor도 자동 반영)
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "OreProximitySubsystem.generated.h"
+
+class UOreProximityComponent;
+class UOreHISMPoolComponent;
+
+UCLASS()
+class HELLUNA_API UOreProximitySubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** WorldContext의 서브시스템 (월드가 없으면 nullptr) */
+    static UOreProximitySubsystem* Get(const UObject* WorldContext);
+
+    // === UWorldSubsystem 인터페이스 ===
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    virtual void Deinitialize() override;
+
+    // === FTickableGameObject 인터페이스 ===
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // ==================================================================================
+    // 등록 API — 반환된 핸들로 해제/활성 통지 (INDEX_NONE = 등록 실패)
+    // ==================================================================================
+
+    /** 광석 액터 컴포넌트 등록 (NearRadius 안 = Near, MidRadius 안 = Mid, 밖 = Far) */
+    int32 RegisterComponent(UOreProximityComponent* Component, const FVector& Location, float NearRadius, float MidRadius);
+
+    /** HISM 풀 인스턴스 등록 (PromoteRadius 안 = 승격, DemoteRadius 밖 = 강등) */
+    int32 RegisterPoolInstance(UOreHISMPoolComponent* Pool, int32 InstanceID, const FVector& Location,
+        float PromoteRadius, float DemoteRadius);
+
+    void Unregister(int32 Handle);
+
+    /** 상태 변경 통지 — 활성(Near/Mid/승격)이면 매 패스 이탈 검사 대상 */
+    void NotifyActiveChanged(int32 Handle, bool bActive);
+
+    int32 GetNumRegistered() const { return Entries.Num(); }
+    int32 GetNumActive() const { return ActiveEntries.Num(); }
+
+private:
+    enum class EEntryKind : uint8
+    {
+        Component,
+        PoolInstance
+    };
+
+    struct FEntry
+    {
+        FVector Location = FVector::ZeroVector;
+
+        /** Component: Near 반경² / Pool: 승격 반경² */
+        float InnerRadiusSq = 0.f;
+
+        /** Component: Mid 반경² / Pool: 강등 반경² */
+        float OuterRadiusSq = 0.f;
+
+        TWeakObjectPtr<UOreProximityComponent> Component;
+        TWeakObjectPtr<UOreHISMPoolComponent> Pool;
+        int32 PoolInstanceID = INDEX_NONE;
+
+        int64 CellKey = 0;
+
+        /** ActiveEntries 내 위치 (INDEX_NONE = 비활성) */
+        int32 ActiveSlot = INDEX_NONE;
+
+        /** 슬롯 재사용 구분용 — 패스 도중 해제 후 재등록된 엔트리에 이전 이벤트가 적용되지 않도록 */
+        uint32 Serial = 0;
+
+        /** 이번 패스에 이미 후보로 수집됐는지 */
+        uint32 VisitStamp = 0;
+
+        EEntryKind Kind = EEntryKind::Component;
+    };
+
+    /** 평가 결과 — 적용 직전 Serial로 유효성 재확인 */
+    struct FPendingEvent
+    {
+        int32 Handle = INDEX_NONE;
+        uint32 Serial = 0;
+        float DistSq = 0.f;
+        bool bEnter = false;
+        uint8 DesiredLOD = 0;
+    };
+
+    int32 AddEntry(FEntry&& Entry);
+
+    /** 체크 패스 1회: 플레이어 수집 → 후보 수집 → 평가 → 이벤트 적용 */
+    void RunPass();
+
+    void GatherPlayerLocations();
+    void GatherCandidates();
+    float GetClosestPlayerDistSq(const FVector& Location) const;
+    void ApplyEvent(const FPendingEvent& Event, int32& LODChanges);
+
+    static int64 MakeCellKey(int32 CX, int32 CY)
+    {
+        return (static_cast<int64>(CX) << 32) | static_cast<uint32>(CY);
+    }
+    static int32 ToCell(double Value);
+
+    TSparseArray<FEntry> Entries;
+
+    /** 격자 칸 → 엔트리 핸들 */
+    TMap<int64, TArray<int32>> Cells;
+
+    /** 현재 활성(Near/Mid/승격) 엔트리 핸들 */
+    TArray<int32> ActiveEntries;
+
+    /** 승격 예산/통계 통지 대상 풀 */
+    TArray<TWeakObjectPtr<UOreHISMPoolComponent>> KnownPools;
+
+    /** 등록된 엔트리 중 가장 큰 바깥 반경 (후보 칸 범위 결정용, 줄어들지 않음) */
+    float MaxOuterRadius = 0.f;
+
+    float TimeUntilPass = 0.f;
+    uint32 PassStamp = 0;
+    uint32 NextSerial = 0;
+
+    /** 패스 스크래치 버퍼 (재할당 방지) */
+    TArray<FVector> PlayerLocations;
+    TArray<int32> Candidates;
+    TArray<FPendingEvent> LeaveEvents;
+    TArray<FPendingEvent> EnterEvents;
+};
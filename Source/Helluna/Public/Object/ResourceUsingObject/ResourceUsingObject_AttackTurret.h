@@ -3,6 +3,7 @@
 
 #include "CoreMinimal.h"
 #include "Object/ResourceUsingObject/HellunaTurretBase.h"
+#include "MassEntityTypes.h"
 #include "ResourceUsingObject_AttackTurret.generated.h"
 
 class AHellunaEnemyCharacter;
@@ -16,6 +17,10 @@ class USoundAttenuation;
  * 적을 자동으로 공격하는 포탑.
  * 탐지 구체 오버랩 이벤트로 범위 내 적을 추적하고,
  * 공격 주기마다 가장 가까운 적에게 데미지를 적용한다.
+ *
+ * [EntityTargetingV1] 범위 안에 Actor 적이 없으면 Actor로 승격되지 않은 Entity 상태 적을
+ * UEnemyEntitySpatialSubsystem 스냅샷에서 찾아 공격한다. 데미지는 Entity HP에서 직접 차감 (승격 없음).
+ * Actor 적이 범위에 들어오면 Actor가 우선.
  */
 UCLASS()
 class HELLUNA_API AResourceUsingObject_AttackTurret : public AHellunaTurretBase
@@ -113,6 +118,24 @@ protected:
 		meta = (DisplayName = "발사 허용 각도(도)", ClampMin = "1.0", ClampMax = "45.0"))
 	float FireAngleThreshold = 5.f;
 
+	/**
+	 * [EntityTargetingV1] 범위 안에 Actor 적이 없을 때 Entity 상태 적도 공격.
+	 * 원거리에서 무리를 솎아내 Actor 승격 압력을 줄인다. Helluna.Turret.EntityTargeting 0 으로 전역 비활성화 가능.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Turret|Attack",
+		meta = (DisplayName = "Entity 적 공격"))
+	bool bTargetEntityEnemies = true;
+
+	/** [EntityTargetingV1] 가까운 Entity 후보 중 시야(라인트레이스) 검사할 최대 수. 0 = 시야 검사 없이 가장 가까운 Entity */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Turret|Attack",
+		meta = (DisplayName = "Entity 시야 검사 후보 수", ClampMin = "0", ClampMax = "16", EditCondition = "bTargetEntityEnemies"))
+	int32 EntityLineOfSightSamples = 4;
+
+	/** [EntityTargetingV1] Entity 위치(발밑) 기준 조준점 높이 (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Turret|Attack",
+		meta = (DisplayName = "Entity 조준 높이(cm)", ClampMin = "0.0", EditCondition = "bTargetEntityEnemies"))
+	float EntityAimHeight = 60.f;
+
 	/** 탐지 범위를 게임 화면에 표시 */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Turret|Debug",
 		meta = (DisplayName = "공격 범위 표시"))
@@ -177,6 +200,20 @@ private:
 	UFUNCTION()
 	void OnRep_CurrentTarget();
 
+	/** [EntityTargetingV1] Entity 타겟 보유 여부 (서버 → 클라 복제, 회전용) */
+	UPROPERTY(Replicated)
+	bool bHasEntityTarget = false;
+
+	/** [EntityTargetingV1] Entity 타겟 위치 (서버 → 클라 복제, 회전 보간용) */
+	UPROPERTY(Replicated)
+	FVector_NetQuantize EntityTargetLocation = FVector::ZeroVector;
+
+	/** [EntityTargetingV1] 현재 Entity 타겟 (서버 전용) */
+	FMassEntityHandle CurrentEntityTarget;
+
+	/** [EntityTargetingV1] Entity 재탐색 쿨다운 — 타겟이 없을 때 매 틱 질의하지 않도록 */
+	float EntityRetargetCooldown = 0.f;
+
 	/** 탐지 범위 내 적 목록 (서버 전용) */
 	TArray<TWeakObjectPtr<AHellunaEnemyCharacter>> EnemiesInRange;
 
@@ -195,6 +232,9 @@ private:
 	/** 현재 타겟 방향을 바라보고 있는지 (FireAngleThreshold 이내) */
 	bool IsFacingTarget() const;
 
+	/** Actor 타겟 위치, 없으면 Entity 타겟 조준점. 둘 다 없으면 false */
+	bool GetAimLocation(FVector& OutLocation) const;
+
 	// =========================================================
 	// 오버랩 콜백
 	// =========================================================
@@ -230,6 +270,21 @@ private:
 	 *  EnemiesInRange 에 등록. begin-overlap 이벤트만으로는 놓치는 "이미 서 있던 보스" 등을 잡기 위함. */
 	void SeedEnemiesAlreadyInRange();
 
+	// =========================================================
+	// [EntityTargetingV1] Entity 타겟팅 (서버)
+	// =========================================================
+
+	/** 스냅샷에서 반경 내 가장 가까운(시야 통과) Entity 선택. 성공 시 true */
+	bool SelectEntityTarget();
+
+	/** 현재 Entity 타겟 위치를 최신 스냅샷으로 갱신. 사망/승격/범위 이탈이면 false */
+	bool RefreshEntityTarget();
+
+	void ClearEntityTarget();
+
+	/** Entity 타겟 사격 — 라인트레이스 통과 시 Entity 데미지 큐잉 */
+	void PerformEntityAttack();
+
 	/** 포탑을 타겟 방향으로 보간 회전 */
 	void UpdateTurretRotation(float DeltaTime);
 
@@ -11,6 +11,11 @@
 //   3. 플레이어 접근 시 자동으로 PromoteToActor() 호출 → AActor 스폰
 //   4. 플레이어 이탈 시 DemoteToInstance() 호출 → AActor 파괴, HISM 복원
 //
+// [OreProximitySubsystemV1] 자동 승격/강등은 UOreProximitySubsystem이 담당:
+//   - 등록된 인스턴스는 서브시스템 격자에 들어가고, 플레이어 근처 인스턴스만 패스에서 평가
+//   - 진입/이탈 이벤트 → OnProximityEnter / OnProximityLeave (패스당 MaxPromotes/MaxDemotesPerCheck 예산)
+//   - 이 컴포넌트의 자동 관리 타이머와 라운드-로빈 전체 스캔은 제거
+//
 // 기존 OreProximityComponent V3와 연동:
 //   - PromoteToActor 후 OreProximityComponent::ForceActivateNear() 호출
 //   - DemoteToInstance는 OreProximityComponent가 Far 전환 시 자동 트리거 가능
@@ -55,6 +60,9 @@ struct FOreInstanceData
 
     /** 채굴되어 제거되었는지 */
     bool bDestroyed = false;
+
+    /** UOreProximitySubsystem 등록 핸들 */
+    int32 ProximityHandle = INDEX_NONE;
 };
 
 /** 메시별 HISM 풀 */
@@ -129,20 +137,40 @@ public:
     int32 GetTotalRegistered() const { return AllInstances.Num(); }
 
     /**
-     * 주기적으로 호출 — 플레이어에 가까운 HISM 인스턴스를 AActor로 자동 승격.
-     * GameMode의 Tick이나 타이머에서 호출.
+     * 수동 호출용 — 플레이어에 가까운 HISM 인스턴스를 AActor로 승격 (전체 순회).
+     * 평상시 자동 승격은 UOreProximitySubsystem이 처리하므로 디버그/일괄 처리에만 사용.
      */
     UFUNCTION(BlueprintCallable, Category = "HISM 풀")
     void AutoPromoteNearPlayers(float PromoteRadius);
 
     /**
-     * 주기적으로 호출 — 플레이어에서 먼 AActor를 HISM으로 자동 강등.
+     * 수동 호출용 — 플레이어에서 먼 AActor를 HISM으로 강등.
      */
     UFUNCTION(BlueprintCallable, Category = "HISM 풀")
     void AutoDemoteFarFromPlayers(float DemoteRadius);
 
+    // ==================================================================================
+    // [OreProximitySubsystemV1] UOreProximitySubsystem 이벤트
+    // ==================================================================================
+
+    /** 패스 시작 — 승격/강등 예산 초기화 */
+    void BeginProximityPass();
+
+    /** 승격 반경 진입. 예산 초과/실패면 false (다음 패스에 다시 평가됨) */
+    bool OnProximityEnter(int32 InstanceID);
+
+    /** 강등 반경 이탈 또는 승격 액터 소실. 예산 초과면 false */
+    bool OnProximityLeave(int32 InstanceID);
+
+    /** 승격된 AActor가 아직 살아 있는지 (채굴 등으로 외부 파괴되면 false) */
+    bool IsPromotedActorAlive(int32 InstanceID) const;
+
+    /** 패스 종료 — 진단 통계 출력 (Helluna.OreHISM.ShowStats) */
+    void EndProximityPass(int32 NumPlayers, float DisplayTime);
+
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     // ==================================================================================
     // 설정
@@ -158,11 +186,6 @@ protected:
         meta = (DisplayName = "HISM 그림자 캐스팅"))
     bool bHISMCastShadow = false;
 
-    /** 자동 승격/강등 체크 주기 (초) */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HISM 풀|자동 관리",
-        meta = (DisplayName = "자동 체크 주기(초)", ClampMin = "0.1", ClampMax = "5.0"))
-    float AutoCheckInterval = 0.5f;
-
     /** 자동 승격 반경 (cm) — 이 안에 들어오면 AActor로 전환 */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HISM 풀|자동 관리",
         meta = (DisplayName = "자동 승격 반경(cm)", ClampMin = "500.0"))
@@ -173,21 +196,16 @@ protected:
         meta = (DisplayName = "자동 강등 반경(cm)", ClampMin = "1000.0"))
     float AutoDemoteRadius = 5000.f;
 
-    /** 한 프레임에 최대 승격 수 (스파이크 방지) */
+    /** 체크 패스당 최대 승격 수 (스파이크 방지) */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HISM 풀|자동 관리",
         meta = (DisplayName = "프레임당 최대 승격 수", ClampMin = "1", ClampMax = "20"))
     int32 MaxPromotesPerCheck = 5;
 
-    /** 한 프레임에 최대 강등 수 */
+    /** 체크 패스당 최대 강등 수 */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HISM 풀|자동 관리",
         meta = (DisplayName = "프레임당 최대 강등 수", ClampMin = "1", ClampMax = "20"))
     int32 MaxDemotesPerCheck = 10;
 
-    /** 라운드-로빈 배치 크기 — 한 체크 주기에 검사할 인스턴스 수 (전체 순회 방지) */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HISM 풀|자동 관리",
-        meta = (DisplayName = "배치당 검사 수", ClampMin = "100", ClampMax = "5000"))
-    int32 BatchSizePerCheck = 2000;
-
     /** 승격된 AActor의 NetCullDistanceSquared (네트워크 리플리케이션 컬 거리²) */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HISM 풀|승격 최적화",
         meta = (DisplayName = "NetCullDistSq (cm²)", ClampMin = "0.0"))
@@ -216,16 +234,11 @@ private:
     UPROPERTY()
     TArray<FOreInstanceData> AllInstances;
 
-    /** 자동 관리 타이머 */
-    FTimerHandle AutoManageTimerHandle;
-
-    /** 라운드-로빈: 다음 체크 시작 인덱스 (승격) */
-    int32 PromoteRoundRobinIndex = 0;
+    /** 이번 패스에서 처리한 승격/강등 수 (BeginProximityPass에서 초기화) */
+    int32 PassPromoteCount = 0;
+    int32 PassDemoteCount = 0;
 
-    /** 라운드-로빈: 다음 체크 시작 인덱스 (강등) */
-    int32 DemoteRoundRobinIndex = 0;
-
-    /** 캐싱된 플레이어 위치 (AutoManageTick 1회 호출 동안 유효) */
+    /** 캐싱된 플레이어 위치 (AutoPromote/AutoDemote 1회 호출 동안 유효) */
     TArray<FVector> CachedPlayerLocations;
 
     // ==================================================================================
@@ -235,10 +248,13 @@ private:
     /** 메시에 대응하는 풀 인덱스 반환 (없으면 생성) */
     int32 FindOrCreatePool(UStaticMesh* Mesh);
 
-    /** 자동 관리 타이머 콜백 */
-    void AutoManageTick();
+    /** 승격 AActor가 외부에서 파괴됨 — 파괴 마킹 + HISM 숨김 + 서브시스템 해제 */
+    void HandlePromotedActorLost(int32 InstanceID);
+
+    /** 서브시스템 활성 목록 갱신 (승격 = 활성) */
+    void NotifyProximityActive(const FOreInstanceData& Data, bool bActive) const;
 
-    /** 플레이어 위치 캐시 갱신 (AutoManageTick 시작 시 1회 호출) */
+    /** 플레이어 위치 캐시 갱신 (AutoPromote/AutoDemote 시작 시 1회 호출) */
     void RefreshPlayerLocationCache();
 
     /** 캐시된 플레이어 위치 기반 가장 가까운 거리 제곱 */
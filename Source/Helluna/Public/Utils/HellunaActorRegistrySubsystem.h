@@ -0,0 +1,142 @@
+/**
+ * HellunaActorRegistrySubsystem.h
+ *
+ * [ActorRegistryV1] 자주 찾는 월드 Actor를 종류별 버킷으로 보관하는 레지스트리 (UWorldSubsystem).
+ *
+ * ■ 이 파일이 뭔가요? (팀원용)
+ *   매 틱/매 프레임 GetAllActorsOfClass, GetAllActorsWithTag("SpaceShip"), TActorIterator로
+ *   월드 전체를 훑던 코드를 대체합니다. 월드 Actor 수에 비례하던 비용이
+ *   (밤에는 풀링된 적 + 승격된 광석 때문에 수천 개) 버킷 크기에 비례하는 비용으로 줄어듭니다.
+ *
+ * ■ 등록 규칙
+ *   - 대상 Actor가 BeginPlay에서 Register, EndPlay에서 Unregister (양쪽 모두 서버/클라 공통)
+ *   - 한 Actor가 여러 버킷에 들어갈 수 있음 (예: 보스 = Enemy + Boss)
+ *   - Register/Unregister: O(1) (Actor → 슬롯 인덱스 맵 + swap-remove)
+ *
+ * ■ 순회 규칙
+ *   - ForEach 중에 Register/Unregister가 일어나도 안전 (제거는 순회가 끝난 뒤 압축)
+ *   - 순회 중 추가된 Actor는 그 순회에서는 방문하지 않음
+ *   - 이미 파괴 중인 Actor(IsValid 실패)는 건너뜀
+ *
+ * ■ 시스템 내 위치
+ *   - 등록: AResourceUsingObject_SpaceShip, AHellunaTurretBase, AHellunaHeroCharacter,
+ *           AHellunaEnemyCharacter(+ _Boss), APuzzleCubeActor, ABossEncounterCube,
+ *           ABoss{Summon,Phase2,Death}CinematicTrigger
+ *   - 접근: UHellunaActorRegistrySubsystem::Get(WorldContext)
+ *
+ * @author 김민우
+ */
+
+// File: Source/Helluna/Public/Utils/HellunaActorRegistrySubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HellunaActorRegistrySubsystem.generated.h"
+
+/** 레지스트리 버킷 종류 */
+UENUM()
+enum class EHellunaActorBucket : uint8
+{
+	SpaceShip,
+	Turret,
+	Hero,
+	Enemy,
+	Boss,
+	PuzzleCube,
+	BossEncounterCube,
+	/** Summon / Phase2 / Death 시네마틱 트리거 공통 — 호출자가 Cast로 구분 */
+	CinematicTrigger,
+
+	MAX UMETA(Hidden)
+};
+
+UCLASS()
+class HELLUNA_API UHellunaActorRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** WorldContext의 레지스트리 (월드가 없으면 nullptr) */
+	static UHellunaActorRegistrySubsystem* Get(const UObject* WorldContext);
+
+	/** BeginPlay/EndPlay용 편의 함수 — 레지스트리가 없으면 무시 */
+	static void RegisterActor(AActor* Actor, EHellunaActorBucket Bucket);
+	static void UnregisterActor(AActor* Actor, EHellunaActorBucket Bucket);
+
+	void Register(AActor* Actor, EHellunaActorBucket Bucket);
+	void Unregister(AActor* Actor, EHellunaActorBucket Bucket);
+
+	/** 버킷의 등록 수 (순회 중 제거 대기 슬롯 포함 — 상한값으로만 사용) */
+	int32 Num(EHellunaActorBucket Bucket) const;
+
+	/** 버킷의 첫 유효 Actor (SpaceShip처럼 보통 1개인 버킷용) */
+	AActor* GetFirst(EHellunaActorBucket Bucket) const;
+
+	/** 우주선 — 기존 GetAllActorsWithTag("SpaceShip")[0] 대체 */
+	AActor* GetSpaceShip() const { return GetFirst(EHellunaActorBucket::SpaceShip); }
+
+	/**
+	 * 버킷의 유효 Actor를 T로 Cast해서 순회. Func가 false를 반환하면 중단.
+	 * 예) Registry->ForEach<AHellunaTurretBase>(EHellunaActorBucket::Turret, [&](AHellunaTurretBase* T) { ...; return true; });
+	 */
+	template<typename T, typename FuncType>
+	void ForEach(EHellunaActorBucket Bucket, FuncType&& Func) const
+	{
+		const FBucket& B = Buckets[static_cast<int32>(Bucket)];
+		FIterationScope Scope(*const_cast<UHellunaActorRegistrySubsystem*>(this), Bucket);
+
+		const int32 Count = B.Actors.Num();
+		for (int32 i = 0; i < Count; ++i)
+		{
+			T* Typed = Cast<T>(B.Actors[i].Get());
+			if (IsValid(Typed) && !Func(Typed))
+			{
+				break;
+			}
+		}
+	}
+
+	/** 버킷 내용을 배열로 복사 (GetAllActorsOfClass 결과를 그대로 쓰던 코드용) */
+	template<typename T>
+	void GetActors(EHellunaActorBucket Bucket, TArray<T*>& OutActors) const
+	{
+		OutActors.Reset(Num(Bucket));
+		ForEach<T>(Bucket, [&OutActors](T* Actor) { OutActors.Add(Actor); return true; });
+	}
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+private:
+	struct FBucket
+	{
+		/** 등록 배열 — 순회 중 제거된 슬롯은 null로 남았다가 압축 */
+		TArray<TWeakObjectPtr<AActor>> Actors;
+
+		/** Actor → Actors 인덱스 */
+		TMap<const AActor*, int32> SlotByActor;
+
+		/** 진행 중인 ForEach 수 (중첩 허용) */
+		int32 IterationDepth = 0;
+
+		/** 순회 중 제거되어 압축이 필요한지 */
+		bool bPendingCompact = false;
+	};
+
+	/** ForEach 동안 IterationDepth 유지 — 끝나면 대기 중인 제거를 반영 */
+	struct FIterationScope
+	{
+		FIterationScope(UHellunaActorRegistrySubsystem& InOwner, EHellunaActorBucket InBucket);
+		~FIterationScope();
+
+		UHellunaActorRegistrySubsystem& Owner;
+		EHellunaActorBucket Bucket;
+	};
+
+	void Compact(FBucket& B);
+
+	/** 약참조 보관 — 레지스트리가 Actor 수명을 붙잡지 않음 (해제는 EndPlay 책임) */
+	FBucket Buckets[static_cast<int32>(EHellunaActorBucket::MAX)];
+};
@@ -82,8 +82,9 @@ public:
 	bool HasCachedClientAim() const { return bHasCachedClientAim; }
 	void ClearCachedClientAim() { bHasCachedClientAim = false; }
 
+	// [LagCompV1] ClientViewTime = 클라 화면 기준 서버 시각 (UHellunaLagCompensationSubsystem::GetLocalViewServerTime, 음수 = 되감기 안 함)
 	UFUNCTION(Server, Reliable)
-	void ServerCacheClientAimPoint(const FVector& AimPoint);
+	void ServerCacheClientAimPoint(const FVector& AimPoint, double ClientViewTime);
 
 	// ===== [ADD] 탄창 최대치
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Weapon|Stats", meta = (DisplayName = "탄창"))
@@ -631,9 +632,14 @@ public:
 protected:
 	// 서버에서 실제 히트판정/데미지 수행
 
-	// (선택) 이펙트/사운드 동기화용
+	// [LagCompV1] 이펙트/사운드 동기화 — 같은 프레임의 발사를 모아 무기당 1회 전송
+	//   ImpactLocations: 발사별 임팩트 위치 (적중 = HitLocation, 빗나감 = TraceEnd)
 	UFUNCTION(NetMulticast, Unreliable)
-	void MulticastFireFX(FVector_NetQuantize TraceStart, FVector_NetQuantize TraceEnd, bool bHit, FVector_NetQuantize HitLocation);
+	void MulticastFireFXBatch(const TArray<FVector_NetQuantize>& ImpactLocations);
+
+	// [LagCompV1] 이번 프레임 발사 FX 큐 — 다음 틱에 MulticastFireFXBatch 1회로 전송
+	void QueueFireFX(const FVector& ImpactLocation);
+	void FlushPendingFireFX();
 
 	// [SlowMo] 머즐 사운드만 즉시 재생 (슬로우 중 분리 호출)
 	UFUNCTION(NetMulticast, Unreliable)
@@ -669,7 +675,9 @@ protected:
 	void SpawnImpactFX(const FVector& SpawnLocation);
 
 	// 실제 라인트레이스 + 데미지 적용
-	void DoLineTraceAndDamage(AController* InstigatorController, const FVector& TraceStart, const FVector& TraceEnd);
+	// [LagCompV1] RewindServerTime >= 0 이면 그 시각으로 영웅/적 캡슐을 되감아 판정
+	void DoLineTraceAndDamage(AController* InstigatorController, const FVector& TraceStart, const FVector& TraceEnd,
+		double RewindServerTime = -1.0);
 
 
 
@@ -733,4 +741,12 @@ protected:
 	// [SlowMo] 캐싱된 클라이언트 AimPoint (AnimNotify에서 사용)
 	FVector CachedClientAimPoint = FVector::ZeroVector;
 	bool bHasCachedClientAim = false;
+
+	// [LagCompV1] 캐싱된 AimPoint 를 조준한 시점의 클라 화면 기준 서버 시각 (음수 = 되감기 안 함)
+	double CachedClientViewTime = -1.0;
+
+private:
+	// [LagCompV1] 발사 FX 배치 큐
+	TArray<FVector_NetQuantize> PendingFireFX;
+	bool bFireFXFlushScheduled = false;
 };